@@ -57,12 +57,20 @@ public:
 	QueryResultType ResultMode() const {
 		return result_type;
 	}
+	//! The number of concurrent client threads (1 = regular single-client benchmark)
+	idx_t Concurrency() const {
+		return concurrency;
+	}
 	idx_t ArrowBatchSize() const {
 		return arrow_batch_size;
 	}
 
 private:
 	string VerifyInternal(BenchmarkState *state_p, MaterializedQueryResult &result);
+	//! Run the benchmark with multiple concurrent clients
+	void RunConcurrent(BenchmarkState *state_p);
+	//! Get the query that the given (0-based) client runs - either its own stream (runN) or the shared run query
+	string GetClientQuery(idx_t client_idx);
 
 	void ReadResultFromFile(BenchmarkFileReader &reader, const string &file);
 	void ReadResultFromReader(BenchmarkFileReader &reader, const string &file);
@@ -90,6 +98,10 @@ private:
 	string subgroup;
 
 	bool in_memory = true;
+	//! The number of concurrent client threads that execute the run query (set by the "concurrency" command)
+	idx_t concurrency = 1;
+	//! The number of times each client runs its query per benchmark run
+	idx_t queries_per_client = 1;
 	QueryResultType result_type = QueryResultType::MATERIALIZED_RESULT;
 	idx_t arrow_batch_size = STANDARD_VECTOR_SIZE;
 	bool require_reinit = false;
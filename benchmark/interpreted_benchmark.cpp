@@ -12,8 +12,10 @@
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
 #include "duckdb/common/arrow/physical_arrow_collector.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 namespace duckdb {
 
@@ -42,6 +44,12 @@ struct InterpretedBenchmarkState : public BenchmarkState {
 	DuckDB db;
 	Connection con;
 	duckdb::unique_ptr<MaterializedQueryResult> result;
+	//! The connections of the client threads (only set when running with concurrency)
+	vector<duckdb::unique_ptr<Connection>> client_connections;
+	//! The first error raised by any client thread (only set when running with concurrency)
+	string concurrent_error;
+	//! The throughput/latency statistics of the last concurrent run
+	string concurrent_stats;
 
 	explicit InterpretedBenchmarkState(string path)
 	    : benchmark_config(GetBenchmarkConfig()), db(path.empty() ? nullptr : path.c_str(), benchmark_config.get()),
@@ -149,7 +157,15 @@ void InterpretedBenchmark::LoadBenchmark() {
 		}
 		// look for a command in this line
 		auto splits = StringUtil::Split(StringUtil::Lower(line), ' ');
-		if (splits[0] == "load" || splits[0] == "run" || splits[0] == "init" || splits[0] == "cleanup") {
+		// besides the shared "run" section, clients of a concurrent benchmark can have their own streams (run1, run2, ...)
+		bool is_client_run = splits[0].size() > 3 && StringUtil::StartsWith(splits[0], "run");
+		for (idx_t i = 3; is_client_run && i < splits[0].size(); i++) {
+			if (!StringUtil::CharacterIsDigit(splits[0][i])) {
+				is_client_run = false;
+			}
+		}
+		if (splits[0] == "load" || splits[0] == "run" || splits[0] == "init" || splits[0] == "cleanup" ||
+		    is_client_run) {
 			if (queries.find(splits[0]) != queries.end()) {
 				throw std::runtime_error("Multiple calls to " + splits[0] + " in the same benchmark file");
 			}
@@ -243,6 +259,18 @@ void InterpretedBenchmark::LoadBenchmark() {
 			} else {
 				throw std::runtime_error(reader.FormatException("Invalid argument for storage"));
 			}
+		} else if (splits[0] == "concurrency") {
+			if (splits.size() != 2 && splits.size() != 3) {
+				throw std::runtime_error(reader.FormatException(
+				    "concurrency requires the number of clients, and optionally the number of queries per client"));
+			}
+			concurrency = NumericCast<idx_t>(std::stoi(splits[1]));
+			if (concurrency == 0) {
+				throw std::runtime_error(reader.FormatException("concurrency requires at least one client"));
+			}
+			if (splits.size() == 3) {
+				queries_per_client = NumericCast<idx_t>(std::stoi(splits[2]));
+			}
 		} else if (splits[0] == "require_reinit") {
 			if (splits.size() != 1) {
 				throw std::runtime_error(reader.FormatException("require_reinit does not take any parameters"));
@@ -352,9 +380,12 @@ void InterpretedBenchmark::LoadBenchmark() {
 	}
 	// set up the queries
 	if (queries.find("run") == queries.end()) {
-		throw InvalidInputException("Invalid benchmark file: no \"run\" query specified");
+		if (concurrency == 1 || queries.find("run1") == queries.end()) {
+			throw InvalidInputException("Invalid benchmark file: no \"run\" query specified");
+		}
+	} else {
+		run_query = queries["run"];
 	}
-	run_query = queries["run"];
 	is_loaded = true;
 }
 
@@ -451,6 +482,12 @@ unique_ptr<BenchmarkState> InterpretedBenchmark::Initialize(BenchmarkConfigurati
 		state->con.Query("PRAGMA enable_profiling");
 		state->con.Query("PRAGMA profiling_mode='detailed'");
 	}
+	if (concurrency > 1) {
+		// every client thread gets its own connection to the shared database
+		for (idx_t client_idx = 0; client_idx < concurrency; client_idx++) {
+			state->client_connections.push_back(make_uniq<Connection>(state->db));
+		}
+	}
 	return std::move(state);
 }
 
@@ -474,7 +511,79 @@ ScopedConfigSetting PrepareResultCollector(ClientConfig &config, InterpretedBenc
 	return ScopedConfigSetting(config);
 }
 
+string InterpretedBenchmark::GetClientQuery(idx_t client_idx) {
+	auto entry = queries.find("run" + std::to_string(client_idx + 1));
+	if (entry != queries.end()) {
+		return entry->second;
+	}
+	if (run_query.empty()) {
+		throw InvalidInputException("Invalid benchmark file: no \"run\" or \"run%llu\" query specified",
+		                            client_idx + 1);
+	}
+	return run_query;
+}
+
+void InterpretedBenchmark::RunConcurrent(BenchmarkState *state_p) {
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	state.concurrent_error = string();
+	state.concurrent_stats = string();
+	state.result = nullptr;
+
+	mutex run_lock;
+	vector<double> latencies;
+	std::vector<std::thread> clients;
+	Profiler total_timer;
+	total_timer.Start();
+	for (idx_t client_idx = 0; client_idx < concurrency; client_idx++) {
+		clients.emplace_back([&, client_idx]() {
+			auto &con = *state.client_connections[client_idx];
+			auto client_query = GetClientQuery(client_idx);
+			vector<double> client_latencies;
+			string client_error;
+			Profiler query_timer;
+			for (idx_t i = 0; i < queries_per_client; i++) {
+				query_timer.Start();
+				auto result = con.Query(client_query);
+				query_timer.End();
+				for (QueryResult *res = result.get(); res; res = res->next.get()) {
+					if (res->HasError()) {
+						client_error = res->GetError();
+						break;
+					}
+				}
+				if (!client_error.empty()) {
+					break;
+				}
+				client_latencies.push_back(query_timer.Elapsed());
+			}
+			lock_guard<mutex> guard(run_lock);
+			latencies.insert(latencies.end(), client_latencies.begin(), client_latencies.end());
+			if (!client_error.empty() && state.concurrent_error.empty()) {
+				state.concurrent_error = client_error;
+			}
+		});
+	}
+	for (auto &client : clients) {
+		client.join();
+	}
+	total_timer.End();
+
+	if (!latencies.empty()) {
+		std::sort(latencies.begin(), latencies.end());
+		auto p50 = latencies[latencies.size() / 2];
+		auto p99 = latencies[MinValue<idx_t>(latencies.size() - 1, latencies.size() * 99 / 100)];
+		auto throughput = static_cast<double>(latencies.size()) / total_timer.Elapsed();
+		state.concurrent_stats =
+		    StringUtil::Format("clients=%llu\tqueries=%llu\tthroughput=%.2f qps\tp50=%.6fs\tp99=%.6fs", concurrency,
+		                       latencies.size(), throughput, p50, p99);
+	}
+}
+
 void InterpretedBenchmark::Run(BenchmarkState *state_p) {
+	if (concurrency > 1) {
+		RunConcurrent(state_p);
+		return;
+	}
 	auto &state = (InterpretedBenchmarkState &)*state_p;
 	auto &context = state.con.context;
 
@@ -569,6 +678,10 @@ string InterpretedBenchmark::VerifyInternal(BenchmarkState *state_p, Materialize
 
 string InterpretedBenchmark::Verify(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
+	if (concurrency > 1) {
+		// concurrent clients do not produce a single verifiable result - only check for errors
+		return state.concurrent_error;
+	}
 	if (!state.result) {
 		D_ASSERT(result_type != QueryResultType::MATERIALIZED_RESULT);
 		return string();
@@ -623,6 +736,9 @@ string InterpretedBenchmark::Verify(BenchmarkState *state_p) {
 void InterpretedBenchmark::Interrupt(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
 	state.con.Interrupt();
+	for (auto &client_connection : state.client_connections) {
+		client_connection->Interrupt();
+	}
 }
 
 string InterpretedBenchmark::BenchmarkInfo() {
@@ -631,6 +747,9 @@ string InterpretedBenchmark::BenchmarkInfo() {
 
 string InterpretedBenchmark::GetLogOutput(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
+	if (concurrency > 1) {
+		return state.concurrent_stats;
+	}
 	auto &profiler = QueryProfiler::Get(*state.con.context);
 	return profiler.ToJSON();
 }
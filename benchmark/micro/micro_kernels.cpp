@@ -0,0 +1,234 @@
+//===----------------------------------------------------------------------===//
+//
+// benchmark/micro/micro_kernels.cpp
+//
+// Standalone microbenchmark for the primitive vector kernels: hashing,
+// comparison selects, row scatter, and casts. Inputs are generated with
+// controlled selectivity, NULL density, and string lengths so that kernel
+// regressions can be measured in isolation instead of through noisy
+// end-to-end query timings. Reports per-value time, processed bytes per
+// second, and - where hardware counters are available - retired
+// instructions per value.
+//
+// Usage: micro_kernels [iterations_per_kernel]
+//
+//===----------------------------------------------------------------------===//
+
+#include "duckdb.hpp"
+#include "duckdb/common/hardware_counters.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/row_data_collection.hpp"
+#include "duckdb/common/types/row/row_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <cstdio>
+#include <functional>
+#include <random>
+
+using namespace duckdb;
+
+struct KernelResult {
+	double ns_per_value;
+	double megabytes_per_second;
+	//! Retired instructions per value (0 if hardware counters are unavailable)
+	double instructions_per_value;
+};
+
+//! Time a kernel over the given number of iterations - each iteration processes one vector of values
+static KernelResult TimeKernel(idx_t iterations, idx_t values_per_iteration, idx_t bytes_per_iteration,
+                               const std::function<void()> &kernel) {
+	// warm up the caches and the branch predictors before measuring
+	kernel();
+
+	HardwareCounterProfiler counters;
+	Profiler timer;
+	timer.Start();
+	counters.Start();
+	for (idx_t i = 0; i < iterations; i++) {
+		kernel();
+	}
+	counters.End();
+	timer.End();
+
+	auto total_values = static_cast<double>(iterations * values_per_iteration);
+	KernelResult result;
+	result.ns_per_value = timer.Elapsed() * 1e9 / total_values;
+	result.megabytes_per_second = static_cast<double>(iterations * bytes_per_iteration) / timer.Elapsed() / 1e6;
+	result.instructions_per_value =
+	    counters.IsSupported() ? static_cast<double>(counters.Elapsed().instructions) / total_values : 0;
+	return result;
+}
+
+static void Report(const char *kernel, const string &input, const KernelResult &result) {
+	printf("%-24s %-40s %8.2f ns/value %10.2f MB/s", kernel, input.c_str(), result.ns_per_value,
+	       result.megabytes_per_second);
+	if (result.instructions_per_value > 0) {
+		printf(" %8.2f instr/value", result.instructions_per_value);
+	}
+	printf("\n");
+}
+
+//! Fill a flat INTEGER vector with uniformly distributed values in [0, value_range), returns the bytes written
+static idx_t FillIntegers(Vector &vec, idx_t count, int32_t value_range, double null_density, std::mt19937 &gen) {
+	std::uniform_int_distribution<int32_t> value_dist(0, value_range - 1);
+	std::uniform_real_distribution<double> null_dist(0, 1);
+	auto data = FlatVector::GetData<int32_t>(vec);
+	for (idx_t i = 0; i < count; i++) {
+		data[i] = value_dist(gen);
+		if (null_density > 0 && null_dist(gen) < null_density) {
+			FlatVector::SetNull(vec, i, true);
+		}
+	}
+	return count * sizeof(int32_t);
+}
+
+//! Fill a flat VARCHAR vector with random strings of the given length, returns the bytes written
+static idx_t FillStrings(Vector &vec, idx_t count, idx_t string_length, double null_density, std::mt19937 &gen) {
+	std::uniform_int_distribution<int32_t> char_dist('a', 'z');
+	std::uniform_real_distribution<double> null_dist(0, 1);
+	idx_t bytes = 0;
+	string value;
+	for (idx_t i = 0; i < count; i++) {
+		if (null_density > 0 && null_dist(gen) < null_density) {
+			FlatVector::SetNull(vec, i, true);
+			continue;
+		}
+		value.clear();
+		for (idx_t c = 0; c < string_length; c++) {
+			value += static_cast<char>(char_dist(gen));
+		}
+		StringVector::AddString(vec, value);
+		bytes += string_length;
+	}
+	return bytes;
+}
+
+static void RunHashBenchmarks(idx_t iterations, std::mt19937 &gen) {
+	const idx_t count = STANDARD_VECTOR_SIZE;
+	for (auto null_density : {0.0, 0.5}) {
+		Vector input(LogicalType::INTEGER);
+		auto bytes = FillIntegers(input, count, NumericLimits<int32_t>::Maximum(), null_density, gen);
+		Vector hashes(LogicalType::HASH);
+		auto result =
+		    TimeKernel(iterations, count, bytes, [&]() { VectorOperations::Hash(input, hashes, count); });
+		Report("hash", StringUtil::Format("INTEGER, null_density=%.2f", null_density), result);
+	}
+	for (auto string_length : {idx_t(8), idx_t(64)}) {
+		Vector input(LogicalType::VARCHAR);
+		auto bytes = FillStrings(input, count, string_length, 0, gen);
+		Vector hashes(LogicalType::HASH);
+		auto result =
+		    TimeKernel(iterations, count, bytes, [&]() { VectorOperations::Hash(input, hashes, count); });
+		Report("hash", StringUtil::Format("VARCHAR, string_length=%llu", string_length), result);
+	}
+}
+
+static void RunSelectBenchmarks(idx_t iterations, std::mt19937 &gen) {
+	const idx_t count = STANDARD_VECTOR_SIZE;
+	const int32_t value_range = 1000;
+	for (auto selectivity : {0.01, 0.5, 0.99}) {
+		Vector left(LogicalType::INTEGER);
+		auto bytes = FillIntegers(left, count, value_range, 0, gen);
+		// values are uniform in [0, value_range), so this threshold passes ~selectivity of them
+		Vector right(Value::INTEGER(static_cast<int32_t>((1.0 - selectivity) * value_range)));
+		SelectionVector true_sel(count);
+		auto result = TimeKernel(iterations, count, bytes, [&]() {
+			VectorOperations::GreaterThan(left, right, nullptr, count, &true_sel, nullptr);
+		});
+		Report("select_greater_than", StringUtil::Format("INTEGER, selectivity=%.2f", selectivity), result);
+	}
+}
+
+static void RunScatterBenchmarks(idx_t iterations, BufferManager &buffer_manager, std::mt19937 &gen) {
+	const idx_t count = STANDARD_VECTOR_SIZE;
+	const idx_t string_length = 16;
+	vector<LogicalType> types {LogicalType::INTEGER, LogicalType::INTEGER, LogicalType::VARCHAR};
+
+	DataChunk chunk;
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
+	idx_t bytes = 0;
+	bytes += FillIntegers(chunk.data[0], count, NumericLimits<int32_t>::Maximum(), 0, gen);
+	bytes += FillIntegers(chunk.data[1], count, NumericLimits<int32_t>::Maximum(), 0.1, gen);
+	bytes += FillStrings(chunk.data[2], count, string_length, 0, gen);
+	chunk.SetCardinality(count);
+
+	RowLayout layout;
+	layout.Initialize(types);
+
+	const auto block_size = buffer_manager.GetBlockSize();
+	auto entries_per_block = RowDataCollection::EntriesPerBlock(layout.GetRowWidth(), block_size);
+	RowDataCollection rows(buffer_manager, entries_per_block, layout.GetRowWidth());
+	RowDataCollection heap(buffer_manager, block_size, 1U, true);
+
+	Vector addresses(LogicalType::POINTER);
+	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
+	auto handles = rows.Build(count, data_pointers, nullptr);
+
+	auto col_data = chunk.ToUnifiedFormat();
+	auto &sel = *FlatVector::IncrementalSelectionVector();
+	auto result = TimeKernel(iterations, count, bytes, [&]() {
+		RowOperations::Scatter(chunk, col_data.get(), layout, addresses, heap, sel, count);
+	});
+	Report("row_scatter", StringUtil::Format("INTEGER, INTEGER, VARCHAR(%llu)", string_length), result);
+}
+
+static void RunCastBenchmarks(idx_t iterations, std::mt19937 &gen) {
+	const idx_t count = STANDARD_VECTOR_SIZE;
+	{
+		Vector input(LogicalType::INTEGER);
+		auto bytes = FillIntegers(input, count, NumericLimits<int32_t>::Maximum(), 0, gen);
+		auto result = TimeKernel(iterations, count, bytes, [&]() {
+			Vector target(LogicalType::BIGINT);
+			VectorOperations::DefaultCast(input, target, count);
+		});
+		Report("cast", "INTEGER -> BIGINT", result);
+	}
+	{
+		Vector input(LogicalType::INTEGER);
+		auto bytes = FillIntegers(input, count, NumericLimits<int32_t>::Maximum(), 0, gen);
+		auto result = TimeKernel(iterations, count, bytes, [&]() {
+			Vector target(LogicalType::VARCHAR);
+			VectorOperations::DefaultCast(input, target, count);
+		});
+		Report("cast", "INTEGER -> VARCHAR", result);
+	}
+	{
+		// digit strings so that the cast back to INTEGER succeeds
+		Vector numbers(LogicalType::INTEGER);
+		FillIntegers(numbers, count, NumericLimits<int32_t>::Maximum(), 0, gen);
+		Vector input(LogicalType::VARCHAR);
+		VectorOperations::DefaultCast(numbers, input, count);
+		idx_t bytes = 0;
+		for (idx_t i = 0; i < count; i++) {
+			bytes += FlatVector::GetData<string_t>(input)[i].GetSize();
+		}
+		auto result = TimeKernel(iterations, count, bytes, [&]() {
+			Vector target(LogicalType::INTEGER);
+			VectorOperations::DefaultCast(input, target, count);
+		});
+		Report("cast", "VARCHAR -> INTEGER", result);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	idx_t iterations = 1000;
+	if (argc > 1) {
+		iterations = NumericCast<idx_t>(std::stoll(argv[1]));
+	}
+
+	DuckDB db(nullptr);
+	auto &buffer_manager = BufferManager::GetBufferManager(*db.instance);
+
+	std::mt19937 gen;
+	gen.seed(42);
+
+	printf("running each kernel for %llu iterations of %d values\n", static_cast<unsigned long long>(iterations),
+	       STANDARD_VECTOR_SIZE);
+	RunHashBenchmarks(iterations, gen);
+	RunSelectBenchmarks(iterations, gen);
+	RunScatterBenchmarks(iterations, buffer_manager, gen);
+	RunCastBenchmarks(iterations, gen);
+	return 0;
+}
@@ -60,11 +60,16 @@ static void LoadInternal(DuckDB &db) {
 	create_fts_index_func.named_parameters["lower"] = LogicalType::BOOLEAN;
 	create_fts_index_func.named_parameters["overwrite"] = LogicalType::BOOLEAN;
 
+	auto refresh_fts_index_func =
+	    PragmaFunction::PragmaCall("refresh_fts_index", FTSIndexing::RefreshFTSIndexQuery,
+	                               {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::VARCHAR);
+
 	auto drop_fts_index_func =
 	    PragmaFunction::PragmaCall("drop_fts_index", FTSIndexing::DropFTSIndexQuery, {LogicalType::VARCHAR});
 
 	ExtensionUtil::RegisterFunction(db_instance, stem_func);
 	ExtensionUtil::RegisterFunction(db_instance, create_fts_index_func);
+	ExtensionUtil::RegisterFunction(db_instance, refresh_fts_index_func);
 	ExtensionUtil::RegisterFunction(db_instance, drop_fts_index_func);
 }
 
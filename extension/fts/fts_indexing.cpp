@@ -145,7 +145,8 @@ static string IndexingScript(ClientContext &context, QualifiedName &qname, const
 
         CREATE TABLE %fts_schema%.stats AS (
             SELECT COUNT(docs.docid) AS num_docs,
-                   SUM(docs.len) / COUNT(docs.len) AS avgdl
+                   SUM(docs.len) / COUNT(docs.len) AS avgdl,
+                   '%stemmer%' AS stemmer
             FROM %fts_schema%.docs AS docs
         );
 
@@ -248,6 +249,36 @@ static void CheckIfTableExists(ClientContext &context, QualifiedName &qname) {
 	Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
 }
 
+static vector<string> GetDocValues(ClientContext &context, QualifiedName &qname,
+                                   const FunctionParameters &parameters) {
+	// check all specified columns
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	vector<string> doc_values;
+	for (idx_t i = 2; i < parameters.values.size(); i++) {
+		string col_name = StringValue::Get(parameters.values[i]);
+		if (col_name == "*") {
+			// star found - get all columns
+			doc_values.clear();
+			for (auto &cd : table.GetColumns().Logical()) {
+				if (cd.Type() == LogicalType::VARCHAR) {
+					doc_values.push_back(cd.Name());
+				}
+			}
+			break;
+		}
+		if (!table.ColumnExists(col_name)) {
+			// we check this here because else we we end up with an error halfway the indexing script
+			throw CatalogException("Table '%s.%s' does not have a column named '%s'!", qname.schema, qname.name,
+			                       col_name);
+		}
+		doc_values.push_back(col_name);
+	}
+	if (doc_values.empty()) {
+		throw InvalidInputException("at least one column must be supplied for indexing!");
+	}
+	return doc_values;
+}
+
 string FTSIndexing::CreateFTSIndexQuery(ClientContext &context, const FunctionParameters &parameters) {
 	auto qname = GetQualifiedName(context, StringValue::Get(parameters.values[0]));
 	CheckIfTableExists(context, qname);
@@ -303,33 +334,146 @@ string FTSIndexing::CreateFTSIndexQuery(ClientContext &context, const FunctionPa
 
 	// positional parameters
 	auto doc_id = StringValue::Get(parameters.values[1]);
-	// check all specified columns
-	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
-	vector<string> doc_values;
-	for (idx_t i = 2; i < parameters.values.size(); i++) {
-		string col_name = StringValue::Get(parameters.values[i]);
-		if (col_name == "*") {
-			// star found - get all columns
-			doc_values.clear();
-			for (auto &cd : table.GetColumns().Logical()) {
-				if (cd.Type() == LogicalType::VARCHAR) {
-					doc_values.push_back(cd.Name());
-				}
-			}
-			break;
-		}
-		if (!table.ColumnExists(col_name)) {
-			// we check this here because else we we end up with an error halfway the indexing script
-			throw CatalogException("Table '%s.%s' does not have a column named '%s'!", qname.schema, qname.name,
-			                       col_name);
-		}
-		doc_values.push_back(col_name);
+	auto doc_values = GetDocValues(context, qname, parameters);
+
+	return IndexingScript(context, qname, doc_id, doc_values, stemmer, stopwords, ignore, strip_accents, lower);
+}
+
+string FTSIndexing::RefreshFTSIndexQuery(ClientContext &context, const FunctionParameters &parameters) {
+	auto qname = GetQualifiedName(context, StringValue::Get(parameters.values[0]));
+	CheckIfTableExists(context, qname);
+
+	const string fts_schema = GetFTSSchema(qname);
+	if (!Catalog::GetSchema(context, qname.catalog, fts_schema, OnEntryNotFound::RETURN_NULL)) {
+		throw CatalogException(
+		    "a FTS index does not exist on table '%s.%s'. Create one with 'PRAGMA create_fts_index()'.", qname.schema,
+		    qname.name);
 	}
-	if (doc_values.empty()) {
-		throw InvalidInputException("at least one column must be supplied for indexing!");
+
+	// the refresh re-uses the stemmer stored in the stats table - indexes built before the stemmer was persisted
+	// cannot be refreshed, because stemming new documents differently would corrupt the index
+	auto &stats_table = Catalog::GetEntry<TableCatalogEntry>(
+	    context, qname.catalog, StringUtil::Format("fts_%s_%s", qname.schema, qname.name), "stats");
+	if (!stats_table.ColumnExists("stemmer")) {
+		throw CatalogException("the FTS index on table '%s.%s' was created by an older version that did not store "
+		                       "the stemmer, so it cannot be refreshed. Rebuild it with 'PRAGMA create_fts_index()' "
+		                       "with 'overwrite=1'.",
+		                       qname.schema, qname.name);
 	}
 
-	return IndexingScript(context, qname, doc_id, doc_values, stemmer, stopwords, ignore, strip_accents, lower);
+	// positional parameters (same as create_fts_index - the schema does not store the column identifiers)
+	auto doc_id = StringValue::Get(parameters.values[1]);
+	auto doc_values = GetDocValues(context, qname, parameters);
+
+	// incrementally maintain the index tables: documents that were added to (or removed from) the input table since
+	// the index was built are tokenized (or deleted) and the statistics of the affected terms are recomputed
+	// NOTE: updates to already-indexed documents are not detected - delete and re-insert such rows, or rebuild
+	// clang-format off
+	string result = R"(
+        CREATE OR REPLACE TEMPORARY TABLE fts_delta_removed_docs AS
+        SELECT docid
+        FROM %fts_schema%.docs
+        WHERE docid NOT IN (SELECT rowid FROM %input_table%);
+
+        CREATE OR REPLACE TEMPORARY TABLE fts_delta_new_docs AS
+        SELECT rowid AS docid
+        FROM %input_table%
+        WHERE rowid NOT IN (SELECT docid FROM %fts_schema%.docs);
+
+        CREATE OR REPLACE TEMPORARY TABLE fts_delta_touched_terms AS
+        SELECT DISTINCT termid
+        FROM %fts_schema%.terms
+        WHERE docid IN (SELECT docid FROM fts_delta_removed_docs);
+
+        DELETE FROM %fts_schema%.terms
+        WHERE docid IN (SELECT docid FROM fts_delta_removed_docs);
+        DELETE FROM %fts_schema%.docs
+        WHERE docid IN (SELECT docid FROM fts_delta_removed_docs);
+
+        CREATE OR REPLACE TEMPORARY TABLE fts_delta_terms AS
+        WITH tokenized AS (
+            %union_fields_query%
+        )
+        SELECT stem(t.w, (SELECT stemmer FROM %fts_schema%.stats)) AS term,
+               t.docid AS docid,
+               t.fieldid AS fieldid
+        FROM tokenized AS t
+        WHERE t.w NOT NULL
+          AND len(t.w) > 0
+          AND t.w NOT IN (SELECT sw FROM %fts_schema%.stopwords);
+
+        INSERT INTO %fts_schema%.dict (termid, term, df)
+        SELECT (SELECT coalesce(max(termid), -1) FROM %fts_schema%.dict) + row_number() OVER (),
+               term,
+               0
+        FROM (
+            SELECT DISTINCT term
+            FROM fts_delta_terms
+            WHERE term NOT IN (SELECT term FROM %fts_schema%.dict)
+        ) AS new_terms;
+
+        INSERT INTO fts_delta_touched_terms
+        SELECT DISTINCT dict.termid
+        FROM fts_delta_terms AS t,
+             %fts_schema%.dict AS dict
+        WHERE t.term = dict.term;
+
+        INSERT INTO %fts_schema%.terms (docid, fieldid, termid)
+        SELECT t.docid,
+               t.fieldid,
+               dict.termid
+        FROM fts_delta_terms AS t,
+             %fts_schema%.dict AS dict
+        WHERE t.term = dict.term;
+
+        INSERT INTO %fts_schema%.docs (docid, name, len)
+        SELECT fts_ii.rowid,
+               fts_ii."%input_id%",
+               (SELECT count(*) FROM fts_delta_terms AS t WHERE t.docid = fts_ii.rowid)
+        FROM %input_table% AS fts_ii
+        WHERE fts_ii.rowid IN (SELECT docid FROM fts_delta_new_docs);
+
+        UPDATE %fts_schema%.dict d
+        SET df = (
+            SELECT count(distinct docid)
+            FROM %fts_schema%.terms t
+            WHERE d.termid = t.termid
+        )
+        WHERE d.termid IN (SELECT termid FROM fts_delta_touched_terms);
+
+        UPDATE %fts_schema%.stats
+        SET num_docs = (SELECT count(docid) FROM %fts_schema%.docs),
+            avgdl = (SELECT sum(len) / count(len) FROM %fts_schema%.docs);
+
+        DROP TABLE fts_delta_removed_docs;
+        DROP TABLE fts_delta_new_docs;
+        DROP TABLE fts_delta_touched_terms;
+        DROP TABLE fts_delta_terms;
+    )";
+
+    // tokenize only the new documents, reusing the stored tokenize macro, stopword list and stemmer
+	string tokenize_field_query = R"(
+        SELECT unnest(%fts_schema%.tokenize(fts_ii."%input_value%")) AS w,
+	           rowid AS docid,
+	           (SELECT fieldid FROM %fts_schema%.fields WHERE field = '%input_value%') AS fieldid
+        FROM %input_table% AS fts_ii
+        WHERE fts_ii.rowid IN (SELECT docid FROM fts_delta_new_docs)
+    )";
+	// clang-format on
+	vector<string> tokenize_fields;
+	for (idx_t i = 0; i < doc_values.size(); i++) {
+		tokenize_fields.push_back(StringUtil::Replace(tokenize_field_query, "%input_value%", doc_values[i]));
+	}
+	result = StringUtil::Replace(result, "%union_fields_query%", StringUtil::Join(tokenize_fields, " UNION ALL "));
+
+	string input_table = qname.catalog == INVALID_CATALOG ? "" : StringUtil::Format("%s.", qname.catalog);
+	input_table += StringUtil::Format("%s.%s", qname.schema, qname.name);
+
+	result = StringUtil::Replace(result, "%fts_schema%", fts_schema);
+	result = StringUtil::Replace(result, "%input_table%", input_table);
+	result = StringUtil::Replace(result, "%input_id%", doc_id);
+
+	return result;
 }
 
 } // namespace duckdb
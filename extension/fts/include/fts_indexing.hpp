@@ -15,6 +15,7 @@ namespace duckdb {
 struct FTSIndexing {
 	static string DropFTSIndexQuery(ClientContext &context, const FunctionParameters &parameters);
 	static string CreateFTSIndexQuery(ClientContext &context, const FunctionParameters &parameters);
+	static string RefreshFTSIndexQuery(ClientContext &context, const FunctionParameters &parameters);
 };
 
 } // namespace duckdb
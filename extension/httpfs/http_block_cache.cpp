@@ -0,0 +1,259 @@
+#include "http_block_cache.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "httpfs.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//! Version of the cache file layout; bump when the header or block layout changes
+static constexpr uint64_t CACHE_FILE_VERSION = 1;
+
+HTTPFileBlockCache::HTTPFileBlockCache(string path_p, idx_t length_p, time_t last_modified_p, string etag_p)
+    : path(std::move(path_p)), length(length_p), last_modified(last_modified_p), etag(std::move(etag_p)) {
+}
+
+bool HTTPFileBlockCache::Validate(idx_t length_p, time_t last_modified_p, const string &etag_p) const {
+	if (length != length_p || last_modified != last_modified_p) {
+		return false;
+	}
+	// not every server sends an etag: only compare them when both sides have one
+	if (!etag.empty() && !etag_p.empty() && etag != etag_p) {
+		return false;
+	}
+	return true;
+}
+
+static bool ReadCacheValue(FileSystem &fs, FileHandle &handle, idx_t file_size, idx_t &offset, void *result,
+                           idx_t result_size) {
+	if (offset + result_size > file_size) {
+		return false;
+	}
+	fs.Read(handle, result, result_size, offset);
+	offset += result_size;
+	return true;
+}
+
+static bool ReadCacheString(FileSystem &fs, FileHandle &handle, idx_t file_size, idx_t &offset, string &result) {
+	uint64_t string_size;
+	if (!ReadCacheValue(fs, handle, file_size, offset, &string_size, sizeof(string_size))) {
+		return false;
+	}
+	if (string_size > file_size - offset) {
+		return false;
+	}
+	result.resize(string_size);
+	if (string_size > 0) {
+		fs.Read(handle, &result[0], string_size, offset);
+		offset += string_size;
+	}
+	return true;
+}
+
+template <class T>
+static void AppendCacheValue(vector<data_t> &header, T value) {
+	auto value_ptr = reinterpret_cast<data_t *>(&value);
+	header.insert(header.end(), value_ptr, value_ptr + sizeof(T));
+}
+
+static void AppendCacheString(vector<data_t> &header, const string &value) {
+	AppendCacheValue<uint64_t>(header, value.size());
+	header.insert(header.end(), value.begin(), value.end());
+}
+
+void HTTPFileBlockCache::AttachDiskCache(const string &cache_file_path) {
+	disk_fs = FileSystem::CreateLocal();
+	auto flags = FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE;
+	cache_file = disk_fs->OpenFile(cache_file_path, flags);
+	auto num_blocks = (length + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	block_on_disk.clear();
+	block_on_disk.resize(num_blocks, 0);
+	if (!TryLoadDiskCache()) {
+		InitializeDiskCache();
+	}
+}
+
+bool HTTPFileBlockCache::TryLoadDiskCache() {
+	auto file_size = idx_t(disk_fs->GetFileSize(*cache_file));
+	idx_t offset = 0;
+
+	uint64_t version;
+	if (!ReadCacheValue(*disk_fs, *cache_file, file_size, offset, &version, sizeof(version)) ||
+	    version != CACHE_FILE_VERSION) {
+		return false;
+	}
+	string stored_path;
+	if (!ReadCacheString(*disk_fs, *cache_file, file_size, offset, stored_path) || stored_path != path) {
+		return false;
+	}
+	uint64_t stored_length;
+	int64_t stored_last_modified;
+	string stored_etag;
+	if (!ReadCacheValue(*disk_fs, *cache_file, file_size, offset, &stored_length, sizeof(stored_length)) ||
+	    !ReadCacheValue(*disk_fs, *cache_file, file_size, offset, &stored_last_modified,
+	                    sizeof(stored_last_modified)) ||
+	    !ReadCacheString(*disk_fs, *cache_file, file_size, offset, stored_etag)) {
+		return false;
+	}
+	if (!Validate(stored_length, time_t(stored_last_modified), stored_etag)) {
+		return false;
+	}
+	auto num_blocks = block_on_disk.size();
+	if (offset + num_blocks > file_size) {
+		return false;
+	}
+	bitmap_offset = offset;
+	data_offset = bitmap_offset + num_blocks;
+	disk_fs->Read(*cache_file, block_on_disk.data(), num_blocks, bitmap_offset);
+	return true;
+}
+
+void HTTPFileBlockCache::InitializeDiskCache() {
+	std::fill(block_on_disk.begin(), block_on_disk.end(), 0);
+
+	vector<data_t> header;
+	AppendCacheValue<uint64_t>(header, CACHE_FILE_VERSION);
+	AppendCacheString(header, path);
+	AppendCacheValue<uint64_t>(header, length);
+	AppendCacheValue<int64_t>(header, last_modified);
+	AppendCacheString(header, etag);
+
+	bitmap_offset = header.size();
+	data_offset = bitmap_offset + block_on_disk.size();
+
+	disk_fs->Truncate(*cache_file, NumericCast<int64_t>(data_offset));
+	disk_fs->Write(*cache_file, header.data(), header.size(), 0);
+	disk_fs->Write(*cache_file, block_on_disk.data(), block_on_disk.size(), bitmap_offset);
+}
+
+void HTTPFileBlockCache::InsertIntoMemory(shared_ptr<HTTPCacheBlock> block) {
+	auto location = block->location;
+	if (blocks.find(location) != blocks.end()) {
+		// another thread fetched the same block concurrently - keep the existing one
+		return;
+	}
+	lru_list.push_front(std::move(block));
+	blocks[location] = lru_list.begin();
+	if (lru_list.size() > MAX_CACHED_BLOCKS) {
+		blocks.erase(lru_list.back()->location);
+		lru_list.pop_back();
+	}
+}
+
+shared_ptr<HTTPCacheBlock> HTTPFileBlockCache::Find(idx_t location) {
+	lock_guard<mutex> parallel_lock(lock);
+	auto lookup = blocks.find(location);
+	if (lookup != blocks.end()) {
+		// move the block to the front of the LRU list
+		lru_list.splice(lru_list.begin(), lru_list, lookup->second);
+		return *lookup->second;
+	}
+	if (!cache_file) {
+		return nullptr;
+	}
+	auto block_idx = location / BLOCK_SIZE;
+	if (block_idx >= block_on_disk.size() || !block_on_disk[block_idx]) {
+		return nullptr;
+	}
+	// the block was spilled to the cache file by an earlier query - read it back
+	auto block = make_shared_ptr<HTTPCacheBlock>();
+	block->location = location;
+	block->length = MinValue<idx_t>(BLOCK_SIZE, length - location);
+	block->data = duckdb::unique_ptr<data_t[]>(new data_t[block->length]);
+	try {
+		disk_fs->Read(*cache_file, block->data.get(), block->length, data_offset + block_idx * BLOCK_SIZE);
+	} catch (...) {
+		block_on_disk[block_idx] = 0;
+		return nullptr;
+	}
+	InsertIntoMemory(block);
+	return block;
+}
+
+void HTTPFileBlockCache::Insert(shared_ptr<HTTPCacheBlock> block) {
+	lock_guard<mutex> parallel_lock(lock);
+	if (cache_file) {
+		auto block_idx = block->location / BLOCK_SIZE;
+		if (block_idx < block_on_disk.size() && !block_on_disk[block_idx]) {
+			try {
+				disk_fs->Write(*cache_file, block->data.get(), block->length, data_offset + block_idx * BLOCK_SIZE);
+				uint8_t block_present = 1;
+				disk_fs->Write(*cache_file, &block_present, sizeof(block_present), bitmap_offset + block_idx);
+				block_on_disk[block_idx] = 1;
+			} catch (...) {
+				// spilling to the cache file is best-effort
+			}
+		}
+	}
+	InsertIntoMemory(std::move(block));
+}
+
+//! Evict the least recently modified cache files until the directory fits the configured size
+static void EnforceCacheDirectorySize(FileSystem &fs, const string &directory, idx_t max_size) {
+	struct CacheFileInfo {
+		string path;
+		idx_t size;
+		time_t last_modified;
+	};
+	vector<CacheFileInfo> cache_files;
+	idx_t total_size = 0;
+	fs.ListFiles(directory, [&](const string &name, bool is_dir) {
+		if (is_dir || !StringUtil::EndsWith(name, ".cache")) {
+			return;
+		}
+		auto file_path = fs.JoinPath(directory, name);
+		try {
+			auto handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_READ);
+			auto file_size = idx_t(fs.GetFileSize(*handle));
+			cache_files.push_back({file_path, file_size, fs.GetLastModifiedTime(*handle)});
+			total_size += file_size;
+		} catch (...) {
+			// files that cannot be opened do not count towards the cache size
+		}
+	});
+	if (total_size <= max_size) {
+		return;
+	}
+	std::sort(cache_files.begin(), cache_files.end(),
+	          [](const CacheFileInfo &a, const CacheFileInfo &b) { return a.last_modified < b.last_modified; });
+	for (auto &cache_file : cache_files) {
+		if (total_size <= max_size) {
+			break;
+		}
+		try {
+			fs.RemoveFile(cache_file.path);
+			total_size -= cache_file.size;
+		} catch (...) {
+			// the file might be in use - skip it
+		}
+	}
+}
+
+shared_ptr<HTTPFileBlockCache> HTTPBlockCache::GetCache(const string &path, idx_t length, time_t last_modified,
+                                                        const string &etag, const HTTPParams &params) {
+	lock_guard<mutex> parallel_lock(lock);
+	auto lookup = caches.find(path);
+	if (lookup != caches.end() && lookup->second->Validate(length, last_modified, etag)) {
+		return lookup->second;
+	}
+	auto cache = make_shared_ptr<HTTPFileBlockCache>(path, length, last_modified, etag);
+	if (!params.cache_directory.empty()) {
+		try {
+			auto fs = FileSystem::CreateLocal();
+			if (!fs->DirectoryExists(params.cache_directory)) {
+				fs->CreateDirectory(params.cache_directory);
+			}
+			EnforceCacheDirectorySize(*fs, params.cache_directory, params.cache_size);
+			auto cache_name = StringUtil::Format("httpfs-%llx.cache", Hash(path.c_str(), path.size()));
+			cache->AttachDiskCache(fs->JoinPath(params.cache_directory, cache_name));
+		} catch (...) {
+			// the persistent cache is best-effort: fall back to the in-memory cache
+		}
+	}
+	caches[path] = cache;
+	return cache;
+}
+
+} // namespace duckdb
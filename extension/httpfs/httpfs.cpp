@@ -42,6 +42,7 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	std::string ca_cert_file;
 	uint64_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	uint64_t prefetch_blocks = DEFAULT_PREFETCH_BLOCKS;
 
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
@@ -71,6 +72,17 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", value)) {
 		hf_max_per_page = value.GetValue<uint64_t>();
 	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_prefetch_blocks", value)) {
+		prefetch_blocks = value.GetValue<uint64_t>();
+	}
+	std::string cache_directory;
+	uint64_t cache_size = DEFAULT_CACHE_SIZE;
+	if (FileOpener::TryGetCurrentSetting(opener, "http_cache_directory", value)) {
+		cache_directory = value.ToString();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_cache_size", value)) {
+		cache_size = DBConfig::ParseMemoryLimit(value.ToString());
+	}
 
 	return {timeout,
 	        retries,
@@ -81,7 +93,10 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener) {
 	        enable_server_cert_verification,
 	        ca_cert_file,
 	        "",
-	        hf_max_per_page};
+	        hf_max_per_page,
+	        prefetch_blocks,
+	        cache_directory,
+	        cache_size};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -171,9 +186,12 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PostRequest(FileHandle &handle, stri
 	auto headers = initialize_http_headers(header_map);
 	idx_t out_offset = 0;
 
-	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
-		auto client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs);
+	auto client = hfs.TakeClient();
+	if (!client) {
+		client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs);
+	}
 
+	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
 		if (hfs.state) {
 			hfs.state->post_count++;
 			hfs.state->total_bytes_sent += buffer_in_len;
@@ -206,7 +224,12 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PostRequest(FileHandle &handle, stri
 		return client->send(req);
 	});
 
-	return RunRequestWithRetry(request, url, "POST", hfs.http_params);
+	std::function<void(void)> on_retry(
+	    [&]() { client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
+
+	auto response = RunRequestWithRetry(request, url, "POST", hfs.http_params, on_retry);
+	hfs.StoreClient(std::move(client));
+	return response;
 }
 
 unique_ptr<duckdb_httplib_openssl::Client> HTTPFileSystem::GetClient(const HTTPParams &http_params,
@@ -240,8 +263,12 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PutRequest(FileHandle &handle, strin
 	ParseUrl(url, path, proto_host_port);
 	auto headers = initialize_http_headers(header_map);
 
+	auto client = hfs.TakeClient();
+	if (!client) {
+		client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs);
+	}
+
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
-		auto client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs);
 		if (hfs.state) {
 			hfs.state->put_count++;
 			hfs.state->total_bytes_sent += buffer_in_len;
@@ -249,7 +276,12 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::PutRequest(FileHandle &handle, strin
 		return client->Put(path.c_str(), *headers, buffer_in, buffer_in_len, "application/octet-stream");
 	});
 
-	return RunRequestWithRetry(request, url, "PUT", hfs.http_params);
+	std::function<void(void)> on_retry(
+	    [&]() { client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
+
+	auto response = RunRequestWithRetry(request, url, "PUT", hfs.http_params, on_retry);
+	hfs.StoreClient(std::move(client));
+	return response;
 }
 
 unique_ptr<ResponseWrapper> HTTPFileSystem::HeadRequest(FileHandle &handle, string url, HeaderMap header_map) {
@@ -340,11 +372,17 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 
 	idx_t out_offset = 0;
 
+	// check out a client so that concurrent range requests on the same handle each use their own connection
+	auto client = hfs.TakeClient();
+	if (!client) {
+		client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs);
+	}
+
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
 		if (hfs.state) {
 			hfs.state->get_count++;
 		}
-		return hfs.http_client->Get(
+		return client->Get(
 		    path.c_str(), *headers,
 		    [&](const duckdb_httplib_openssl::Response &response) {
 			    if (response.status >= 400) {
@@ -388,10 +426,11 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 		    });
 	});
 
-	std::function<void(void)> on_retry(
-	    [&]() { hfs.http_client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
+	std::function<void(void)> on_retry([&]() { client = GetClient(hfs.http_params, proto_host_port.c_str(), &hfs); });
 
-	return RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	auto response = RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	hfs.StoreClient(std::move(client));
+	return response;
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
@@ -399,6 +438,21 @@ HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags
       file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
+unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::TakeClient() {
+	lock_guard<mutex> lock(client_pool_lock);
+	if (client_pool.empty()) {
+		return nullptr;
+	}
+	auto client = std::move(client_pool.back());
+	client_pool.pop_back();
+	return client;
+}
+
+void HTTPFileHandle::StoreClient(unique_ptr<duckdb_httplib_openssl::Client> client) {
+	lock_guard<mutex> lock(client_pool_lock);
+	client_pool.push_back(std::move(client));
+}
+
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
                                                         optional_ptr<FileOpener> opener) {
 	D_ASSERT(flags.Compression() == FileCompressionType::UNCOMPRESSED);
@@ -438,6 +492,138 @@ unique_ptr<FileHandle> HTTPFileSystem::OpenFile(const string &path, FileOpenFlag
 	return std::move(handle);
 }
 
+void HTTPFileSystem::FetchRanges(HTTPFileHandle &hfh, vector<HTTPRangeRequest> &ranges) {
+	auto max_concurrent = MaxValue<idx_t>(hfh.http_params.prefetch_blocks, 1);
+	for (idx_t batch_start = 0; batch_start < ranges.size(); batch_start += max_concurrent) {
+		auto batch_size = MinValue<idx_t>(max_concurrent, ranges.size() - batch_start);
+		vector<thread> fetch_threads;
+		vector<std::exception_ptr> exceptions(batch_size);
+		for (idx_t i = 1; i < batch_size; i++) {
+			auto range = &ranges[batch_start + i];
+			auto exception = &exceptions[i];
+			fetch_threads.emplace_back([this, &hfh, range, exception]() {
+				try {
+					GetRangeRequest(hfh, hfh.path, {}, range->location, range->buffer_out, range->length);
+				} catch (...) {
+					*exception = std::current_exception();
+				}
+			});
+		}
+		// fetch the first range of the batch on the calling thread
+		try {
+			auto &range = ranges[batch_start];
+			GetRangeRequest(hfh, hfh.path, {}, range.location, range.buffer_out, range.length);
+		} catch (...) {
+			exceptions[0] = std::current_exception();
+		}
+		for (auto &fetch_thread : fetch_threads) {
+			fetch_thread.join();
+		}
+		for (auto &exception : exceptions) {
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+	}
+}
+
+void HTTPFileSystem::ReadFromBlockCache(HTTPFileHandle &hfh, char *buffer, idx_t nr_bytes, idx_t location) {
+	constexpr auto block_size = HTTPFileBlockCache::BLOCK_SIZE;
+	auto &cache = *hfh.block_cache;
+	auto max_concurrent = MaxValue<idx_t>(hfh.http_params.prefetch_blocks, 1);
+
+	bool sequential = location == hfh.sequential_read_end;
+	hfh.sequential_read_end = location + nr_bytes;
+
+	// reads spanning more blocks than one prefetch batch bypass the cache: they are split into concurrent range
+	// requests straight into the output buffer so that they do not evict the entire cache
+	if (nr_bytes > max_concurrent * block_size) {
+		vector<HTTPRangeRequest> ranges;
+		auto part_size = (nr_bytes + max_concurrent - 1) / max_concurrent;
+		for (idx_t offset = 0; offset < nr_bytes; offset += part_size) {
+			auto part_length = MinValue<idx_t>(part_size, nr_bytes - offset);
+			ranges.push_back({location + offset, part_length, buffer + offset});
+		}
+		FetchRanges(hfh, ranges);
+		return;
+	}
+
+	// make sure a previous read-ahead has finished inserting its blocks before probing the cache
+	hfh.JoinReadAhead();
+
+	auto first_block = location / block_size;
+	auto last_block = (location + nr_bytes - 1) / block_size;
+	auto fetch_end = last_block;
+	if (sequential) {
+		// the consumer is reading sequentially: fetch blocks ahead of it in the background
+		fetch_end = MaxValue<idx_t>(last_block, first_block + max_concurrent - 1);
+	}
+	fetch_end = MinValue<idx_t>(fetch_end, (hfh.length - 1) / block_size);
+
+	vector<shared_ptr<HTTPCacheBlock>> needed;
+	vector<shared_ptr<HTTPCacheBlock>> missing;
+	vector<shared_ptr<HTTPCacheBlock>> read_ahead_missing;
+	for (idx_t block_idx = first_block; block_idx <= fetch_end; block_idx++) {
+		auto block_location = block_idx * block_size;
+		auto block = cache.Find(block_location);
+		if (!block) {
+			block = make_shared_ptr<HTTPCacheBlock>();
+			block->location = block_location;
+			block->length = MinValue<idx_t>(block_size, hfh.length - block_location);
+			block->data = duckdb::unique_ptr<data_t[]>(new data_t[block->length]);
+			if (block_idx <= last_block) {
+				missing.push_back(block);
+			} else {
+				read_ahead_missing.push_back(block);
+			}
+		}
+		if (block_idx <= last_block) {
+			needed.push_back(std::move(block));
+		}
+	}
+
+	if (!missing.empty()) {
+		vector<HTTPRangeRequest> ranges;
+		for (auto &block : missing) {
+			ranges.push_back({block->location, block->length, (char *)block->data.get()});
+		}
+		FetchRanges(hfh, ranges);
+		for (auto &block : missing) {
+			cache.Insert(std::move(block));
+		}
+	}
+
+	if (!read_ahead_missing.empty()) {
+		// fetch the blocks ahead of the consumer on a background thread, so the calling worker can go back to
+		// running pipeline tasks while the network round trip is in flight; the next sequential read joins the
+		// thread and picks the blocks up from the cache. Read-ahead is best-effort: on failure the blocks are
+		// simply not inserted and a later read fetches the ranges synchronously, surfacing the error there
+		hfh.read_ahead_thread = thread([this, &hfh, read_ahead_missing]() {
+			try {
+				vector<HTTPRangeRequest> ranges;
+				for (auto &block : read_ahead_missing) {
+					ranges.push_back({block->location, block->length, (char *)block->data.get()});
+				}
+				FetchRanges(hfh, ranges);
+				for (auto &block : read_ahead_missing) {
+					hfh.block_cache->Insert(block);
+				}
+			} catch (...) { // NOLINT
+			}
+		});
+	}
+
+	// copy the requested range out of the blocks
+	idx_t out_offset = 0;
+	for (auto &block : needed) {
+		auto copy_start = MaxValue<idx_t>(location, block->location);
+		auto copy_end = MinValue<idx_t>(location + nr_bytes, block->location + block->length);
+		memcpy(buffer + out_offset, block->data.get() + (copy_start - block->location), copy_end - copy_start);
+		out_offset += copy_end - copy_start;
+	}
+	D_ASSERT(out_offset == nr_bytes);
+}
+
 // Buffered read from http file.
 // Note that buffering is disabled when FileFlags::FILE_FLAGS_DIRECT_IO is set
 void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
@@ -453,6 +639,14 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		return;
 	}
 
+	if (hfh.block_cache && nr_bytes > 0) {
+		ReadFromBlockCache(hfh, (char *)buffer, nr_bytes, location);
+		hfh.buffer_available = 0;
+		hfh.buffer_idx = 0;
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
+
 	idx_t to_read = nr_bytes;
 	idx_t buffer_offset = 0;
 
@@ -603,6 +797,34 @@ static optional_ptr<HTTPMetadataCache> TryGetMetadataCache(optional_ptr<FileOpen
 	return nullptr;
 }
 
+// Get the shared block cache for this file, if the prefetching block cache is enabled
+static shared_ptr<HTTPFileBlockCache> TryGetBlockCache(optional_ptr<FileOpener> opener, HTTPFileHandle &handle) {
+	if (handle.http_params.prefetch_blocks == 0 && handle.http_params.cache_directory.empty()) {
+		return nullptr;
+	}
+	if (handle.http_params.force_download) {
+		return nullptr;
+	}
+	if (!handle.flags.OpenForReading() || handle.flags.OpenForWriting() || handle.length == 0 ||
+	    handle.cached_file_handle) {
+		return nullptr;
+	}
+	auto client_context = FileOpener::TryGetClientContext(opener);
+	if (!client_context) {
+		return nullptr;
+	}
+	HTTPBlockCache *block_cache;
+	auto lookup = client_context->registered_state.find("http_block_cache");
+	if (lookup == client_context->registered_state.end()) {
+		auto cache = make_shared_ptr<HTTPBlockCache>();
+		client_context->registered_state["http_block_cache"] = cache;
+		block_cache = cache.get();
+	} else {
+		block_cache = (HTTPBlockCache *)lookup->second.get();
+	}
+	return block_cache->GetCache(handle.path, handle.length, handle.last_modified, handle.etag, handle.http_params);
+}
+
 void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 	InitializeClient(FileOpener::TryGetClientContext(opener));
 	auto &hfs = file_system.Cast<HTTPFileSystem>();
@@ -622,10 +844,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			block_cache = TryGetBlockCache(opener, *this);
 			return;
 		}
 
@@ -718,6 +942,8 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		}
 	}
 
+	etag = res->headers["ETag"];
+
 	if (!res->headers["Last-Modified"].empty()) {
 		auto result = StrpTimeFormat::Parse("%a, %d %h %Y %T %Z", res->headers["Last-Modified"]);
 
@@ -733,8 +959,10 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 	}
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
 	}
+
+	block_cache = TryGetBlockCache(opener, *this);
 }
 
 void HTTPFileHandle::InitializeClient(optional_ptr<ClientContext> context) {
@@ -758,5 +986,13 @@ ResponseWrapper::ResponseWrapper(duckdb_httplib_openssl::Response &res, string &
 	body = res.body;
 }
 
-HTTPFileHandle::~HTTPFileHandle() = default;
+void HTTPFileHandle::JoinReadAhead() {
+	if (read_ahead_thread.joinable()) {
+		read_ahead_thread.join();
+	}
+}
+
+HTTPFileHandle::~HTTPFileHandle() {
+	JoinReadAhead();
+}
 } // namespace duckdb
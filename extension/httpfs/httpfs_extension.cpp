@@ -38,6 +38,18 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	// Prefetching issues extra requests, which also shows up in the request counts of EXPLAIN ANALYZE,
+	// so it is disabled by default
+	config.AddExtensionOption("http_prefetch_blocks",
+	                          "Number of 1MB blocks to read ahead with concurrent range requests when scanning remote "
+	                          "files (0 disables the shared block cache)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("http_cache_directory",
+	                          "Directory used to persist blocks fetched from remote files across queries (empty "
+	                          "disables the persistent cache)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_cache_size", "Maximum total size of the persistent remote file cache",
+	                          LogicalType::VARCHAR, Value("1GB"));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
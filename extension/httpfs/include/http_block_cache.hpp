@@ -0,0 +1,102 @@
+#pragma once
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_context_state.hpp"
+
+#include <string>
+
+namespace duckdb {
+
+struct HTTPParams;
+
+//! A single fixed-size aligned block of a remote file
+struct HTTPCacheBlock {
+	//! Start of the block within the file
+	idx_t location;
+	//! Number of valid bytes in the block (only the last block of a file can be short)
+	idx_t length;
+	//! The block data
+	duckdb::unique_ptr<data_t[]> data;
+};
+
+//! Cached blocks of a single remote file, shared between all handles that read the same file.
+//! Blocks are held in memory in LRU order and can additionally be spilled to a persistent cache file,
+//! so hot remote data survives across queries and is re-read at local disk speed.
+class HTTPFileBlockCache {
+public:
+	//! Blocks are aligned to this size
+	static constexpr idx_t BLOCK_SIZE = 1ULL << 20;
+	//! Maximum number of blocks kept in memory per file
+	static constexpr idx_t MAX_CACHED_BLOCKS = 64;
+
+	HTTPFileBlockCache(string path, idx_t length, time_t last_modified, string etag);
+
+	//! Attach a persistent cache file that fetched blocks are spilled to; existing contents are
+	//! kept when they match the current version of the remote file and discarded otherwise
+	void AttachDiskCache(const string &cache_file_path);
+
+	//! Whether this cache still describes the given version of the remote file
+	bool Validate(idx_t length, time_t last_modified, const string &etag) const;
+
+	shared_ptr<HTTPCacheBlock> Find(idx_t location);
+	void Insert(shared_ptr<HTTPCacheBlock> block);
+
+private:
+	//! Read the cache file header and bitmap; returns false if it does not match the remote file
+	bool TryLoadDiskCache();
+	//! Write a fresh header and an empty bitmap to the cache file
+	void InitializeDiskCache();
+
+	void InsertIntoMemory(shared_ptr<HTTPCacheBlock> block);
+
+private:
+	//! Remote path, length, timestamp and etag of the file version these blocks were fetched from
+	string path;
+	idx_t length;
+	time_t last_modified;
+	string etag;
+
+	mutex lock;
+	//! In-memory blocks, most recently used first
+	list<shared_ptr<HTTPCacheBlock>> lru_list;
+	unordered_map<idx_t, list<shared_ptr<HTTPCacheBlock>>::iterator> blocks;
+
+	//! The persistent cache file, if any
+	unique_ptr<FileSystem> disk_fs;
+	unique_ptr<FileHandle> cache_file;
+	//! Presence bitmap (one byte per block) and the file offsets of the bitmap and the block data
+	vector<uint8_t> block_on_disk;
+	idx_t bitmap_offset = 0;
+	idx_t data_offset = 0;
+};
+
+//! Registry of per-file block caches, registered in the client context like the http metadata cache.
+//! The in-memory blocks are dropped when the query ends; cache files persist across queries.
+class HTTPBlockCache : public ClientContextState {
+public:
+	//! Get the block cache for a file, dropping any stale cache for an older version of the file
+	shared_ptr<HTTPFileBlockCache> GetCache(const string &path, idx_t length, time_t last_modified, const string &etag,
+	                                        const HTTPParams &params);
+
+	void Clear() {
+		lock_guard<mutex> parallel_lock(lock);
+		caches.clear();
+	}
+
+	//! Called by the ClientContext when the current query ends
+	void QueryEnd(ClientContext &context) override {
+		Clear();
+	}
+
+private:
+	mutex lock;
+	unordered_map<string, shared_ptr<HTTPFileBlockCache>> caches;
+};
+
+} // namespace duckdb
@@ -1,11 +1,16 @@
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/http_state.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "http_block_cache.hpp"
 #include "http_metadata_cache.hpp"
 
 namespace duckdb_httplib_openssl {
@@ -41,6 +46,8 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr uint64_t DEFAULT_PREFETCH_BLOCKS = 0;
+	static constexpr uint64_t DEFAULT_CACHE_SIZE = 1ULL << 30; // 1GB
 
 	uint64_t timeout;
 	uint64_t retries;
@@ -55,6 +62,10 @@ struct HTTPParams {
 
 	idx_t hf_max_per_page;
 
+	uint64_t prefetch_blocks;
+	std::string cache_directory;
+	uint64_t cache_size;
+
 	static HTTPParams ReadFrom(optional_ptr<FileOpener> opener);
 };
 
@@ -75,6 +86,7 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
@@ -90,16 +102,42 @@ public:
 	duckdb::unique_ptr<data_t[]> read_buffer;
 	constexpr static idx_t READ_BUFFER_LEN = 1000000;
 
+	// Block cache shared with other handles reading the same file (only set when http_prefetch_blocks > 0)
+	shared_ptr<HTTPFileBlockCache> block_cache;
+	// End of the previous read served from the block cache; reads resuming here trigger read-ahead
+	atomic<idx_t> sequential_read_end {0};
+	// Background thread fetching read-ahead blocks into the block cache (at most one in flight)
+	thread read_ahead_thread;
+
+	//! Wait for an in-flight read-ahead to finish inserting its blocks into the block cache
+	void JoinReadAhead();
+
 	shared_ptr<HTTPState> state;
 
 	void AddHeaders(HeaderMap &map);
 
+	//! Check out a client for a (possibly concurrent) range request; returns nullptr if none is pooled
+	duckdb::unique_ptr<duckdb_httplib_openssl::Client> TakeClient();
+	//! Return a client to the pool so the connection can be reused
+	void StoreClient(duckdb::unique_ptr<duckdb_httplib_openssl::Client> client);
+
 public:
 	void Close() override {
 	}
 
 protected:
 	virtual void InitializeClient(optional_ptr<ClientContext> client_context);
+
+	//! Clients for concurrent range requests, reused across prefetch batches
+	mutex client_pool_lock;
+	vector<duckdb::unique_ptr<duckdb_httplib_openssl::Client>> client_pool;
+};
+
+//! A single ranged GET executed as part of a concurrent batch
+struct HTTPRangeRequest {
+	idx_t location;
+	idx_t length;
+	char *buffer_out;
 };
 
 class HTTPFileSystem : public FileSystem {
@@ -169,6 +207,11 @@ protected:
 	RunRequestWithRetry(const std::function<duckdb_httplib_openssl::Result(void)> &request, string &url, string method,
 	                    const HTTPParams &params, const std::function<void(void)> &retry_cb = {});
 
+	//! Serve a read through the shared block cache, reading ahead of sequential consumers
+	void ReadFromBlockCache(HTTPFileHandle &hfh, char *buffer, idx_t nr_bytes, idx_t location);
+	//! Execute a set of ranged GETs, issuing up to http_prefetch_blocks of them concurrently
+	void FetchRanges(HTTPFileHandle &hfh, vector<HTTPRangeRequest> &ranges);
+
 private:
 	// Global cache
 	mutex global_cache_lock;
@@ -149,7 +149,6 @@ protected:
 
 	//! Synchronization for upload threads
 	mutex uploads_in_progress_lock;
-	std::condition_variable uploads_in_progress_cv;
 	std::condition_variable final_flush_cv;
 	uint16_t uploads_in_progress;
 
@@ -241,6 +240,13 @@ protected:
 	void FlushBuffer(S3FileHandle &handle, shared_ptr<S3WriteBuffer> write_buffer);
 	string GetPayloadHash(char *buffer, idx_t buffer_len);
 
+	//! Global bound on the number of part uploads that are in flight. s3_uploader_thread_limit is a global limit, so
+	//! it is enforced here rather than per file handle: writers queueing up more parts block in FlushBuffer until an
+	//! upload thread finishes, which also caps the amount of part data that is buffered in memory.
+	mutex uploads_in_flight_lock;
+	std::condition_variable uploads_in_flight_cv;
+	idx_t uploads_in_flight = 0;
+
 	// helper for ReadQueryParams
 	void GetQueryParam(const string &key, string &param, CPPHTTPLIB_NAMESPACE::Params &query_params);
 };
@@ -402,13 +402,18 @@ string S3FileSystem::InitializeMultipartUpload(S3FileHandle &file_handle) {
 }
 
 void S3FileSystem::NotifyUploadsInProgress(S3FileHandle &file_handle) {
+	auto &s3fs = (S3FileSystem &)file_handle.file_system;
+	{
+		unique_lock<mutex> lck(s3fs.uploads_in_flight_lock);
+		s3fs.uploads_in_flight--;
+	}
 	{
 		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
 		file_handle.uploads_in_progress--;
 	}
 	// Note that there are 2 cv's because otherwise we might deadlock when the final flushing thread is notified while
 	// another thread is still waiting for an upload thread
-	file_handle.uploads_in_progress_cv.notify_one();
+	s3fs.uploads_in_flight_cv.notify_one();
 	file_handle.final_flush_cv.notify_one();
 }
 
@@ -483,14 +488,18 @@ void S3FileSystem::FlushBuffer(S3FileHandle &file_handle, shared_ptr<S3WriteBuff
 	}
 
 	{
-		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
-		// check if there are upload threads available
-		if (file_handle.uploads_in_progress >= file_handle.config_params.max_upload_threads) {
+		unique_lock<mutex> lck(uploads_in_flight_lock);
+		// check if there are upload threads available, note that the limit is global rather than per file so that
+		// writing many files concurrently (e.g. a partitioned write) cannot spawn an unbounded number of threads
+		if (uploads_in_flight >= file_handle.config_params.max_upload_threads) {
 			// there are not - wait for one to become available
-			file_handle.uploads_in_progress_cv.wait(lck, [&file_handle] {
-				return file_handle.uploads_in_progress < file_handle.config_params.max_upload_threads;
-			});
+			uploads_in_flight_cv.wait(
+			    lck, [&] { return uploads_in_flight < file_handle.config_params.max_upload_threads; });
 		}
+		uploads_in_flight++;
+	}
+	{
+		unique_lock<mutex> lck(file_handle.uploads_in_progress_lock);
 		file_handle.uploads_in_progress++;
 	}
 
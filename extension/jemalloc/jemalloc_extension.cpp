@@ -2,12 +2,141 @@
 #include "jemalloc_extension.hpp"
 
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension_util.hpp"
 #include "jemalloc/jemalloc.h"
 
 namespace duckdb {
 
+//! A snapshot of the statistics of a single jemalloc arena
+struct ArenaStatsEntry {
+	idx_t arena_id;
+	idx_t allocated;
+	idx_t active;
+	idx_t dirty;
+	idx_t muzzy;
+	idx_t mapped;
+	idx_t retained;
+};
+
+struct MemoryAllocatorStatsData : public GlobalTableFunctionState {
+	MemoryAllocatorStatsData() : offset(0) {
+	}
+
+	vector<ArenaStatsEntry> entries;
+	idx_t offset;
+};
+
+template <class T>
+static bool TryGetJemallocCTL(const char *name, T &result) {
+	size_t len = sizeof(T);
+	return duckdb_je_mallctl(name, &result, &len, nullptr, 0) == 0;
+}
+
+static unique_ptr<FunctionData> MemoryAllocatorStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("arena_id");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("allocated_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("active_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("dirty_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("muzzy_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("mapped_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("retained_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> MemoryAllocatorStatsInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	auto result = make_uniq<MemoryAllocatorStatsData>();
+
+	// refresh the epoch so that the statistics are current
+	uint64_t epoch = 1;
+	size_t epoch_len = sizeof(epoch);
+	duckdb_je_mallctl("epoch", &epoch, &epoch_len, &epoch, epoch_len);
+
+	unsigned narenas;
+	size_t page;
+	if (!TryGetJemallocCTL("arenas.narenas", narenas) || !TryGetJemallocCTL("arenas.page", page)) {
+		return std::move(result);
+	}
+
+	for (unsigned arena_idx = 0; arena_idx < narenas; arena_idx++) {
+		size_t small_allocated, large_allocated, pactive, pdirty, pmuzzy, mapped, retained;
+		auto prefix = StringUtil::Format("stats.arenas.%u.", arena_idx);
+		// arenas that no thread has touched yet are not initialized - skip them
+		if (!TryGetJemallocCTL((prefix + "small.allocated").c_str(), small_allocated) ||
+		    !TryGetJemallocCTL((prefix + "large.allocated").c_str(), large_allocated) ||
+		    !TryGetJemallocCTL((prefix + "pactive").c_str(), pactive) ||
+		    !TryGetJemallocCTL((prefix + "pdirty").c_str(), pdirty) ||
+		    !TryGetJemallocCTL((prefix + "pmuzzy").c_str(), pmuzzy) ||
+		    !TryGetJemallocCTL((prefix + "mapped").c_str(), mapped) ||
+		    !TryGetJemallocCTL((prefix + "retained").c_str(), retained)) {
+			continue;
+		}
+		ArenaStatsEntry entry;
+		entry.arena_id = arena_idx;
+		entry.allocated = small_allocated + large_allocated;
+		entry.active = pactive * page;
+		entry.dirty = pdirty * page;
+		entry.muzzy = pmuzzy * page;
+		entry.mapped = mapped;
+		entry.retained = retained;
+		result->entries.push_back(entry);
+	}
+	return std::move(result);
+}
+
+static void MemoryAllocatorStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<MemoryAllocatorStatsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// arena_id, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.arena_id));
+		// allocated_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.allocated)));
+		// active_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.active)));
+		// dirty_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.dirty)));
+		// muzzy_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.muzzy)));
+		// mapped_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.mapped)));
+		// retained_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.retained)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
 void JemallocExtension::Load(DuckDB &db) {
-	// NOP: This extension can only be loaded statically
+	// This extension can only be loaded statically, but we do register the allocator statistics here
+	TableFunction allocator_stats("duckdb_memory_allocator_stats", {}, MemoryAllocatorStatsFunction,
+	                              MemoryAllocatorStatsBind, MemoryAllocatorStatsInit);
+	ExtensionUtil::RegisterFunction(*db.instance, allocator_stats);
 }
 
 std::string JemallocExtension::Name() {
@@ -287,6 +287,45 @@ public:
 	//! Validate JSON Path ($.field[index]... syntax), returns true if there are wildcards in the path
 	static JSONPathType ValidatePath(const char *ptr, const idx_t &len, const bool binder);
 
+	//! Single segment of a JSON path that was compiled with CompilePath
+	struct JSONPathSegment {
+		//! Object field key (empty for array index segments)
+		string key;
+		//! Array index (may be counted from the back of the array)
+		idx_t array_index = 0;
+		bool from_back = false;
+		//! Whether this is an object field or an array index segment
+		bool is_field = false;
+	};
+
+	//! Compile a validated REGULAR '$' path into segments, so it does not have to be re-tokenized per value
+	static vector<JSONPathSegment> CompilePath(const char *ptr, const idx_t &len);
+
+	//! Get JSON value using a path that was compiled with CompilePath
+	static inline yyjson_val *GetCompiledPath(yyjson_val *val, const vector<JSONPathSegment> &segments) {
+		for (const auto &segment : segments) {
+			if (val == nullptr) {
+				break;
+			}
+			if (segment.is_field) {
+				if (!unsafe_yyjson_is_obj(val)) {
+					return nullptr;
+				}
+				val = yyjson_obj_getn(val, segment.key.c_str(), segment.key.size());
+			} else {
+				if (!unsafe_yyjson_is_arr(val)) {
+					return nullptr;
+				}
+				auto array_index = segment.array_index;
+				if (segment.from_back && array_index != 0) {
+					array_index = unsafe_yyjson_get_len(val) - array_index;
+				}
+				val = yyjson_arr_get(val, array_index);
+			}
+		}
+		return val;
+	}
+
 private:
 	//! Get JSON pointer (/field/index/... syntax)
 	static inline yyjson_val *GetPointer(yyjson_val *val, const char *ptr, const idx_t &len) {
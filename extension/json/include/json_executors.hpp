@@ -47,7 +47,8 @@ public:
 				    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
 					    auto doc =
 					        JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
-					    auto val = JSONCommon::GetUnsafe(doc->root, ptr, len);
+					    auto val = info.compiled ? JSONCommon::GetCompiledPath(doc->root, info.segments)
+					                             : JSONCommon::GetUnsafe(doc->root, ptr, len);
 					    if (!val || (NULL_IF_NULL && unsafe_yyjson_is_null(val))) {
 						    mask.SetInvalid(idx);
 						    return T {};
@@ -147,7 +148,8 @@ public:
 			auto doc = JSONCommon::ReadDocument(inputs[idx], JSONCommon::READ_FLAG, lstate.json_allocator.GetYYAlc());
 			for (idx_t path_i = 0; path_i < num_paths; path_i++) {
 				auto child_idx = offset + path_i;
-				val = JSONCommon::GetUnsafe(doc->root, info.ptrs[path_i], info.lens[path_i]);
+				val = info.compiled[path_i] ? JSONCommon::GetCompiledPath(doc->root, info.segments[path_i])
+				                            : JSONCommon::GetUnsafe(doc->root, info.ptrs[path_i], info.lens[path_i]);
 				if (!val || (NULL_IF_NULL && unsafe_yyjson_is_null(val))) {
 					child_validity.SetInvalid(child_idx);
 				} else {
@@ -36,6 +36,9 @@ public:
 	const JSONCommon::JSONPathType path_type;
 	const char *ptr;
 	const size_t len;
+	//! Whether the path was compiled at bind time ('$' paths only, '/' paths use yyjson's pointer lookup)
+	const bool compiled;
+	const vector<JSONCommon::JSONPathSegment> segments;
 };
 
 struct JSONReadManyFunctionData : public FunctionData {
@@ -50,6 +53,9 @@ public:
 	const vector<string> paths;
 	vector<const char *> ptrs;
 	const vector<size_t> lens;
+	//! Per-path compilation (see JSONReadFunctionData)
+	vector<bool> compiled;
+	vector<vector<JSONCommon::JSONPathSegment>> segments;
 };
 
 struct JSONFunctionLocalState : public FunctionLocalState {
@@ -221,6 +221,43 @@ JSONPathType JSONCommon::ValidatePath(const char *ptr, const idx_t &len, const b
 	return path_type;
 }
 
+vector<JSONCommon::JSONPathSegment> JSONCommon::CompilePath(const char *ptr, const idx_t &len) {
+	// Path has been validated at this point
+	vector<JSONPathSegment> segments;
+	const char *const end = ptr + len;
+	ptr++; // Skip past '$'
+	while (ptr != end) {
+		const auto &c = *ptr++;
+		D_ASSERT(ptr != end);
+		JSONPathSegment segment;
+		switch (c) {
+		case '.': { // Object field
+			auto key_result = ReadKey(ptr, end);
+			D_ASSERT(key_result.IsValid() && !key_result.IsWildCard());
+			ptr += key_result.chars_read;
+			segment.is_field = true;
+			segment.key = std::move(key_result.key);
+			break;
+		}
+		case '[': { // Array index
+#ifdef DEBUG
+			bool success =
+#endif
+			    ReadArrayIndex(ptr, end, segment.array_index, segment.from_back);
+#ifdef DEBUG
+			D_ASSERT(success);
+#endif
+			break;
+		}
+		default: // LCOV_EXCL_START
+			throw InternalException(
+			    "Invalid JSON Path encountered in JSONCommon::CompilePath, call JSONCommon::ValidatePath first!");
+		} // LCOV_EXCL_STOP
+		segments.push_back(std::move(segment));
+	}
+	return segments;
+}
+
 yyjson_val *JSONCommon::GetPath(yyjson_val *val, const char *ptr, const idx_t &len) {
 	// Path has been validated at this point
 	const char *const end = ptr + len;
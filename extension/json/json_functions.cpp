@@ -41,7 +41,9 @@ static JSONPathType CheckPath(const Value &path_val, string &path, size_t &len)
 }
 
 JSONReadFunctionData::JSONReadFunctionData(bool constant, string path_p, idx_t len, JSONPathType path_type_p)
-    : constant(constant), path(std::move(path_p)), path_type(path_type_p), ptr(path.c_str()), len(len) {
+    : constant(constant), path(std::move(path_p)), path_type(path_type_p), ptr(path.c_str()), len(len),
+      compiled(constant && path_type == JSONPathType::REGULAR && len != 0 && *ptr == '$'),
+      segments(compiled ? JSONCommon::CompilePath(ptr, len) : vector<JSONCommon::JSONPathSegment>()) {
 }
 
 unique_ptr<FunctionData> JSONReadFunctionData::Copy() const {
@@ -76,8 +78,11 @@ unique_ptr<FunctionData> JSONReadFunctionData::Bind(ClientContext &context, Scal
 
 JSONReadManyFunctionData::JSONReadManyFunctionData(vector<string> paths_p, vector<size_t> lens_p)
     : paths(std::move(paths_p)), lens(std::move(lens_p)) {
-	for (const auto &path : paths) {
-		ptrs.push_back(path.c_str());
+	for (idx_t i = 0; i < paths.size(); i++) {
+		ptrs.push_back(paths[i].c_str());
+		compiled.push_back(lens[i] != 0 && paths[i][0] == '$');
+		segments.push_back(compiled.back() ? JSONCommon::CompilePath(ptrs[i], lens[i])
+		                                   : vector<JSONCommon::JSONPathSegment>());
 	}
 }
 
@@ -1,6 +1,7 @@
 #include "json_scan.hpp"
 
 #include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/helper.hpp"
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
@@ -295,7 +296,18 @@ static inline const char *NextNewline(const char *ptr, const idx_t size) {
 
 static inline const char *PreviousNewline(const char *ptr, const idx_t size) {
 	const auto end = ptr - size;
-	for (ptr--; ptr != end; ptr--) {
+	// There is no portable memrchr, so we scan backwards a word at a time:
+	// after XOR'ing with the newline pattern, a newline in the word shows up as a zero byte
+	static constexpr uint64_t NEWLINES = 0x0a0a0a0a0a0a0a0aULL;
+	static constexpr uint64_t LOW_BITS = 0x0101010101010101ULL;
+	static constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+	for (ptr--; ptr - end >= 8; ptr -= 8) {
+		const auto word = Load<uint64_t>(const_data_ptr_cast(ptr - 7)) ^ NEWLINES;
+		if ((word - LOW_BITS) & ~word & HIGH_BITS) {
+			break; // This word contains a newline, find it byte-by-byte
+		}
+	}
+	for (; ptr != end; ptr--) {
 		if (*ptr == '\n') {
 			break;
 		}
@@ -303,6 +315,26 @@ static inline const char *PreviousNewline(const char *ptr, const idx_t size) {
 	return ptr;
 }
 
+static inline const char *NextJSONString(const char *ptr, const char *const end) {
+	// Skip over the string content that ptr points into, stopping just past the closing quote
+	while (ptr != end) {
+		auto quote = const_char_ptr_cast(memchr(ptr, '"', idx_t(end - ptr)));
+		if (quote == nullptr) {
+			return end; // No closing quote in this buffer
+		}
+		ptr = quote + 1;
+		// The quote only closes the string if it is preceded by an even number of backslashes
+		auto backslash = quote;
+		while (backslash[-1] == '\\') {
+			backslash--;
+		}
+		if ((quote - backslash) % 2 == 0) {
+			break;
+		}
+	}
+	return ptr;
+}
+
 static inline const char *NextJSONDefault(const char *ptr, const char *const end) {
 	idx_t parents = 0;
 	while (ptr != end) {
@@ -316,16 +348,7 @@ static inline const char *NextJSONDefault(const char *ptr, const char *const end
 			parents--;
 			break;
 		case '"':
-			while (ptr != end) {
-				auto string_char = *ptr++;
-				if (string_char == '"') {
-					break;
-				} else if (string_char == '\\') {
-					if (ptr != end) {
-						ptr++; // Skip the escaped char
-					}
-				}
-			}
+			ptr = NextJSONString(ptr, end);
 			break;
 		default:
 			continue;
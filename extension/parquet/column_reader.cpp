@@ -197,6 +197,15 @@ void ColumnReader::Dictionary(shared_ptr<ResizeableBuffer> dictionary_data, idx_
 	throw NotImplementedException("Dictionary");
 }
 
+bool ColumnReader::SupportsDictionaryReference() {
+	return false;
+}
+
+void ColumnReader::ReferenceDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, // NOLINT
+                                             Vector &result) {
+	throw NotImplementedException("ReferenceDictionaryVector");
+}
+
 void ColumnReader::Offsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, parquet_filter_t &filter,
                            idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Offsets");
@@ -241,12 +250,16 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
+	PageHeader page_hdr;
+	reader.Read(page_hdr, *protocol);
+	PreparePageInternal(page_hdr);
+}
+
+void ColumnReader::PreparePageInternal(PageHeader &page_hdr) {
 	dict_decoder.reset();
 	defined_decoder.reset();
 	bss_decoder.reset();
 	block.reset();
-	PageHeader page_hdr;
-	reader.Read(page_hdr, *protocol);
 
 	switch (page_hdr.type) {
 	case PageType::DATA_PAGE_V2:
@@ -528,9 +541,18 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			if (result_offset == 0 && read_now == num_values && SupportsDictionaryReference() && !HasRepeats() &&
+			    filter.count() == num_values) {
+				// the entire batch is dictionary-encoded and no rows are filtered out: instead of copying the values
+				// out we emit a dictionary vector that references the shared per-chunk dictionary.
+				// readers nested below a list re-use their result vector across reads, so they are excluded
+				ReferenceDictionaryVector(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now,
+				                          result);
+			} else {
+				DictReference(result);
+				Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
+				        result);
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
@@ -598,6 +620,39 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	D_ASSERT(!HasRepeats());
+	D_ASSERT(page_rows_available == 0);
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+
+	idx_t skipped = 0;
+	while (skipped < num_values) {
+		PageHeader page_hdr;
+		reader.Read(page_hdr, *protocol);
+
+		idx_t page_rows = 0;
+		if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+			page_rows = page_hdr.data_page_header.num_values;
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+			page_rows = page_hdr.data_page_header_v2.num_values;
+		}
+		if (page_rows > 0 && page_rows <= num_values - skipped) {
+			// all rows in this page are skipped - jump over the payload without decompressing or decoding it
+			trans.SetLocation(trans.GetLocation() + page_hdr.compressed_page_size);
+			skipped += page_rows;
+			continue;
+		}
+		// either a dictionary page, or a data page that still holds rows we need:
+		// prepare it as usual and fall back to row-level skipping
+		PreparePageInternal(page_hdr);
+		if (page_rows_available > 0) {
+			break;
+		}
+	}
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
@@ -607,10 +662,24 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	// TODO this can be optimized, for example we dont actually have to bitunpack offsets
 	Vector dummy_result(type, nullptr);
 
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+
 	idx_t remaining = num_values;
 	idx_t read = 0;
 
 	while (remaining) {
+		if (!HasRepeats() && page_rows_available == 0) {
+			// at a page boundary we can skip entire pages without decompressing them,
+			// since the page headers tell us how many rows each page holds
+			trans.SetLocation(chunk_read_offset);
+			auto skipped = SkipPages(remaining);
+			chunk_read_offset = trans.GetLocation();
+			read += skipped;
+			remaining -= skipped;
+			if (!remaining) {
+				break;
+			}
+		}
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
 		read += Read(to_read, none_filter, dummy_define.ptr, dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
@@ -655,9 +724,24 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 	return VerifyString(str_data, str_len, Type() == LogicalTypeId::VARCHAR);
 }
 
+class ParquetStringVectorBuffer : public VectorBuffer {
+public:
+	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
+	}
+
+private:
+	shared_ptr<ByteBuffer> buffer;
+};
+
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
 	dict_strings = unsafe_unique_ptr<string_t[]>(new string_t[num_entries]);
+	// the shared dictionary vector has one extra entry at the end: a NULL that null rows can reference
+	dict_size = num_entries;
+	dict_vector = make_uniq<Vector>(type, num_entries + 1);
+	auto dict_vector_data = FlatVector::GetData<string_t>(*dict_vector);
+	FlatVector::Validity(*dict_vector).SetInvalid(num_entries);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
 		if (fixed_width_string_length == 0) {
@@ -672,8 +756,35 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 		auto dict_str = reinterpret_cast<const char *>(dict->ptr);
 		auto actual_str_len = VerifyString(dict_str, str_len);
 		dict_strings[dict_idx] = string_t(dict_str, actual_str_len);
+		dict_vector_data[dict_idx] = dict_strings[dict_idx];
 		dict->inc(str_len);
 	}
+	// the dictionary vector references the strings in the dictionary page directly
+	StringVector::AddBuffer(*dict_vector, make_buffer<ParquetStringVectorBuffer>(dict));
+}
+
+bool StringColumnReader::SupportsDictionaryReference() {
+	return true;
+}
+
+void StringColumnReader::ReferenceDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values,
+                                                   Vector &result) {
+	D_ASSERT(dict_vector);
+	SelectionVector sel(num_values);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			// null rows reference the NULL entry at the end of the dictionary
+			sel.set_index(row_idx, dict_size);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= dict_size) {
+			throw IOException("Parquet file is likely corrupted, dictionary offset out of range");
+		}
+		sel.set_index(row_idx, offset);
+	}
+	result.Slice(*dict_vector, sel, num_values);
 }
 
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
@@ -771,16 +882,6 @@ void StringColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, parq
 	StringVector::AddHeapReference(result, *byte_array_data);
 }
 
-class ParquetStringVectorBuffer : public VectorBuffer {
-public:
-	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
-	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
-	}
-
-private:
-	shared_ptr<ByteBuffer> buffer;
-};
-
 void StringColumnReader::DictReference(Vector &result) {
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(dict));
 }
@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -337,8 +338,8 @@ struct PageWriteInformation {
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
-	size_t compressed_size;
-	data_ptr_t compressed_data;
+	size_t compressed_size = 0;
+	data_ptr_t compressed_data = nullptr;
 	unique_ptr<data_t[]> compressed_buf;
 };
 
@@ -391,6 +392,7 @@ public:
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizeCompress(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -420,6 +422,10 @@ protected:
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
 	}
+	//! Whether the values written by this writer can be added to a bloom filter
+	virtual bool SupportsBloomFilter() {
+		return false;
+	}
 	//! The number of elements in the dictionary
 	virtual idx_t DictionarySize(BasicColumnWriterState &state_p);
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
@@ -495,6 +501,14 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (SupportsBloomFilter() && writer.WriteBloomFilters()) {
+		// size the bloom filter for the number of values in this row group (an upper bound on the distinct count)
+		idx_t value_count = 0;
+		for (auto &page_info : state.page_info) {
+			value_count += page_info.row_count - page_info.empty_count;
+		}
+		state.stats_state->bloom_filter = make_uniq<ParquetBloomFilter>(value_count);
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -586,6 +600,10 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 
 	// compress the page info
 	auto &write_info = state.write_info[state.current_page - 1];
+	if (write_info.compressed_data) {
+		// the page has already been flushed and compressed
+		return;
+	}
 	auto &temp_writer = *write_info.temp_writer;
 	auto &hdr = write_info.page_header;
 
@@ -686,22 +704,35 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	}
 }
 
+void BasicColumnWriter::FinalizeCompress(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	// flush and compress the last page (if any remains)
+	FlushPage(state);
+	// compress the dictionary page (if any); its file offset is filled in during FinalizeWrite
+	if (HasDictionary(state)) {
+		FlushDictionary(state, state.stats_state.get());
+	}
+}
+
 void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
 	auto &column_chunk = state.row_group.columns[state.col_idx];
 
-	// flush the last page (if any remains)
+	// flush the last page (no-op if FinalizeCompress already took care of it)
 	FlushPage(state);
 
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
 	// flush the dictionary
 	if (HasDictionary(state)) {
+		if (state.write_info.empty() || state.write_info[0].page_header.type != PageType::DICTIONARY_PAGE) {
+			// FinalizeCompress was not called, compress the dictionary page now
+			FlushDictionary(state, state.stats_state.get());
+		}
 		column_chunk.meta_data.statistics.distinct_count = DictionarySize(state);
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.dictionary_page_offset = column_writer.GetTotalWritten();
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 	}
 
 	// record the start position of the pages for this column
@@ -727,6 +758,21 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	// write the bloom filter (if any) after the pages; the footer records where to find it
+	if (state.stats_state->bloom_filter) {
+		auto &bloom_filter = *state.stats_state->bloom_filter;
+		column_chunk.meta_data.bloom_filter_offset = NumericCast<int64_t>(column_writer.GetTotalWritten());
+		column_chunk.meta_data.__isset.bloom_filter_offset = true;
+
+		duckdb_parquet::format::BloomFilterHeader bloom_header;
+		bloom_header.numBytes = NumericCast<int32_t>(bloom_filter.GetSize());
+		bloom_header.algorithm.__isset.BLOCK = true;
+		bloom_header.hash.__isset.XXHASH = true;
+		bloom_header.compression.__isset.UNCOMPRESSED = true;
+		writer.Write(bloom_header);
+		writer.WriteData(bloom_filter.GetData(), bloom_filter.GetSize());
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -890,6 +936,10 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, cons
 		}
 		TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
 		OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+		if (stats->bloom_filter) {
+			stats->bloom_filter->FilterInsert(
+			    ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+		}
 		write_combiner[write_combiner_count++] = target_value;
 		if (write_combiner_count == WRITE_COMBINER_CAPACITY) {
 			ser.WriteData(const_data_ptr_cast(write_combiner), WRITE_COMBINER_CAPACITY * sizeof(TGT));
@@ -922,6 +972,11 @@ public:
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
+
+	bool SupportsBloomFilter() override {
+		// only for types whose plain encoding is the in-memory representation
+		return std::is_same<TGT, int32_t>::value || std::is_same<TGT, int64_t>::value;
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -1467,6 +1522,10 @@ public:
 					continue;
 				}
 				stats.Update(ptr[r]);
+				if (stats_p->bloom_filter) {
+					stats_p->bloom_filter->FilterInsert(
+					    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+				}
 				temp_writer.Write<uint32_t>(ptr[r].GetSize());
 				temp_writer.WriteData(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize());
 			}
@@ -1501,6 +1560,10 @@ public:
 		return state.IsDictionaryEncoded();
 	}
 
+	bool SupportsBloomFilter() override {
+		return true;
+	}
+
 	idx_t DictionarySize(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		D_ASSERT(state.IsDictionaryEncoded());
@@ -1526,6 +1589,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (stats_p->bloom_filter) {
+				stats_p->bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -1706,6 +1773,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizeCompress(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1795,6 +1863,13 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
+void StructColumnWriter::FinalizeCompress(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
+		child_writers[child_idx]->FinalizeCompress(*state.child_states[child_idx]);
+	}
+}
+
 void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
@@ -1827,6 +1902,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizeCompress(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1969,6 +2045,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::FinalizeCompress(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->FinalizeCompress(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
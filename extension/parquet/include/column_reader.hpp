@@ -123,6 +123,11 @@ protected:
 	virtual void Offsets(uint32_t *offsets, uint8_t *defines, idx_t num_values, parquet_filter_t &filter,
 	                     idx_t result_offset, Vector &result);
 
+	//! Whether this reader can reference a shared per-chunk dictionary instead of copying the values out
+	virtual bool SupportsDictionaryReference();
+	//! Emit the result as a dictionary vector over the shared dictionary built by Dictionary()
+	virtual void ReferenceDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result);
+
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
@@ -163,6 +168,10 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	void PreparePageInternal(PageHeader &page_hdr);
+	//! Skip over entire data pages without decompressing them, until we reach a page that holds rows we need;
+	//! returns the number of rows skipped
+	idx_t SkipPages(idx_t num_values);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
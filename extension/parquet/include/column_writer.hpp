@@ -13,6 +13,7 @@
 
 namespace duckdb {
 class MemoryStream;
+class ParquetBloomFilter;
 class ParquetWriter;
 class ColumnWriterPageState;
 class BasicColumnWriterState;
@@ -50,6 +51,9 @@ public:
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
 
+	//! Bloom filter for the column chunk, if any (only set for types that support bloom filters)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+
 public:
 	template <class TARGET>
 	TARGET &Cast() {
@@ -105,6 +109,11 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Flushes and compresses any remaining pages (including the dictionary page, if any). This is called on the
+	//! thread that produced the row group, so that FinalizeWrite only assembles pre-compressed pages while holding
+	//! the writer lock
+	virtual void FinalizeCompress(ColumnWriterState &state) {
+	}
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+
+namespace duckdb {
+
+//! A block of a split-block bloom filter: eight 32-bit words, one bit set per word per inserted value
+struct ParquetBloomBlock {
+	uint32_t word[8];
+};
+
+//! Split-block bloom filter as specified by the Parquet format. Values are hashed with XXH64 (seed 0) over their
+//! plain-encoded representation before being inserted or probed.
+class ParquetBloomFilter {
+public:
+	//! Bits per distinct value - roughly a 1% false positive rate
+	static constexpr const double BITS_PER_VALUE = 10.5;
+	//! Cap the filter size - above this the footer overhead outweighs the pruning benefit
+	static constexpr const idx_t MAX_FILTER_BYTES = 1048576;
+
+public:
+	//! Create an empty filter sized for the given number of distinct values
+	explicit ParquetBloomFilter(idx_t num_entries);
+	//! Load a filter from its on-disk representation
+	ParquetBloomFilter(const_data_ptr_t data, idx_t len);
+
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	const_data_ptr_t GetData() const {
+		return const_data_ptr_cast(blocks.get());
+	}
+	idx_t GetSize() const {
+		return block_count * sizeof(ParquetBloomBlock);
+	}
+
+	//! Hash the plain-encoded representation of a value (XXH64 with seed 0)
+	static uint64_t Hash(const_data_ptr_t data, idx_t len);
+
+private:
+	ParquetBloomBlock &GetBlock(uint64_t hash) const;
+
+private:
+	unique_ptr<ParquetBloomBlock[]> blocks;
+	idx_t block_count;
+};
+
+} // namespace duckdb
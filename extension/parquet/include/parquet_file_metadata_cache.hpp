@@ -10,6 +10,7 @@
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 #include "geo_parquet.hpp"
 #endif
 #include "parquet_types.h"
@@ -21,8 +22,10 @@ public:
 	ParquetFileMetadataCache() : metadata(nullptr) {
 	}
 	ParquetFileMetadataCache(unique_ptr<duckdb_parquet::format::FileMetaData> file_metadata, time_t r_time,
+	                         time_t last_modified_p, idx_t file_size_p,
 	                         unique_ptr<GeoParquetFileMetadata> geo_metadata)
-	    : metadata(std::move(file_metadata)), read_time(r_time), geo_metadata(std::move(geo_metadata)) {
+	    : metadata(std::move(file_metadata)), read_time(r_time), last_modified(last_modified_p),
+	      file_size(file_size_p), geo_metadata(std::move(geo_metadata)) {
 	}
 
 	~ParquetFileMetadataCache() override = default;
@@ -33,6 +36,10 @@ public:
 	//! read time
 	time_t read_time;
 
+	//! Last modified time and size of the file when the metadata was read, used for invalidation
+	time_t last_modified;
+	idx_t file_size;
+
 	//! GeoParquet metadata
 	unique_ptr<GeoParquetFileMetadata> geo_metadata;
 
@@ -44,5 +51,32 @@ public:
 	string GetObjectType() override {
 		return ObjectType();
 	}
+
+	//! Whether the cached metadata is still valid for the file as it is on disk now
+	bool IsValid(time_t current_last_modified, idx_t current_file_size) const {
+		return current_last_modified == last_modified && current_file_size == file_size;
+	}
+
+	//! Get the cached merged statistics of a column (or nullptr if not cached yet)
+	unique_ptr<BaseStatistics> GetColumnStatistics(const string &name) {
+		lock_guard<mutex> guard(stats_lock);
+		auto entry = column_stats.find(name);
+		if (entry == column_stats.end()) {
+			return nullptr;
+		}
+		return entry->second->ToUnique();
+	}
+
+	//! Cache the merged statistics of a column
+	void SetColumnStatistics(const string &name, const BaseStatistics &stats) {
+		lock_guard<mutex> guard(stats_lock);
+		column_stats[name] = stats.ToUnique();
+	}
+
+private:
+	//! Lock protecting the column statistics cache
+	mutex stats_lock;
+	//! Lazily cached merged column statistics (over all row groups), by column name
+	unordered_map<string, unique_ptr<BaseStatistics>> column_stats;
 };
 } // namespace duckdb
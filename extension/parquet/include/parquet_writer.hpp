@@ -102,6 +102,10 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Bloom filters are stored unencrypted, so we do not write them for encrypted files
+	bool WriteBloomFilters() const {
+		return !encryption_config;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
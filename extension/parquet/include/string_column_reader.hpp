@@ -32,12 +32,18 @@ public:
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
 	unsafe_unique_ptr<string_t[]> dict_strings;
+	//! The dictionary of the current column chunk as a shared vector, with a trailing NULL entry for null rows
+	unique_ptr<Vector> dict_vector;
+	idx_t dict_size = 0;
 	idx_t fixed_width_string_length;
 	idx_t delta_offset = 0;
 
 public:
 	void Dictionary(shared_ptr<ResizeableBuffer> dictionary_data, idx_t num_entries) override;
 
+	bool SupportsDictionaryReference() override;
+	void ReferenceDictionaryVector(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) override;
+
 	void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer) override;
 	void PrepareDeltaByteArray(ResizeableBuffer &buffer) override;
 	void DeltaByteArray(uint8_t *defines, idx_t num_values, parquet_filter_t &filter, idx_t result_offset,
@@ -1,5 +1,7 @@
 #pragma once
+#include <algorithm>
 #include <list>
+#include <map>
 #include "thrift/protocol/TCompactProtocol.h"
 #include "thrift/transport/TBufferTransports.h"
 
@@ -31,33 +33,23 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
-struct ReadHeadComparator {
+// Three-step read ahead buffer
+// 1: register all ranges that will be read
+// 2: finalize the registration, which coalesces ranges that are consecutive or nearly so
+// 3: prefetch all registered ranges
+struct ReadAheadBuffer {
+	// Ranges that are overlapping, adjacent, or within ALLOW_GAP bytes from each other are coalesced
 	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
-	bool operator()(const ReadHead *a, const ReadHead *b) const {
-		auto a_start = a->location;
-		auto a_end = a->location + a->size;
-		auto b_start = b->location;
-
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
-		}
-
-		return a_start < b_start && a_end < b_start;
-	}
-};
 
-// Two-step read ahead buffer
-// 1: register all ranges that will be read, merging ranges that are consecutive
-// 2: prefetch all registered ranges
-struct ReadAheadBuffer {
 	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
 	}
 
 	// The list of read heads
 	std::list<ReadHead> read_heads;
-	// Set for merging consecutive ranges
-	std::set<ReadHead *, ReadHeadComparator> merge_set;
+	// Registered ranges that have not been coalesced into read heads yet (location, size)
+	std::vector<std::pair<idx_t, uint64_t>> pending_ranges;
+	// Index over the read heads by starting location, for finding the read head that covers a position
+	std::map<idx_t, ReadHead *> read_head_index;
 
 	Allocator &allocator;
 	FileHandle &handle;
@@ -66,39 +58,55 @@ struct ReadAheadBuffer {
 
 	// Add a read head to the prefetching list
 	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true) {
-		// Attempt to merge with existing
+		if (pos + len > handle.GetFileSize()) {
+			throw std::runtime_error("Prefetch registered for bytes outside file");
+		}
 		if (merge_buffers) {
-			ReadHead new_read_head {pos, len};
-			auto lookup_set = merge_set.find(&new_read_head);
-			if (lookup_set != merge_set.end()) {
-				auto existing_head = *lookup_set;
-				auto new_start = MinValue<idx_t>(existing_head->location, new_read_head.location);
-				auto new_length = MaxValue<idx_t>(existing_head->GetEnd(), new_read_head.GetEnd()) - new_start;
-				existing_head->location = new_start;
-				existing_head->size = new_length;
-				return;
-			}
+			// coalesced with the other mergeable ranges in FinalizeRegistration
+			pending_ranges.emplace_back(pos, len);
+			return;
 		}
-
 		read_heads.emplace_front(ReadHead(pos, len));
 		total_size += len;
-		auto &read_head = read_heads.front();
+		read_head_index[pos] = &read_heads.front();
+	}
 
-		if (merge_buffers) {
-			merge_set.insert(&read_head);
+	// Coalesce the pending ranges into read heads - this plans the I/O for an entire row group up front,
+	// turning the many small column-chunk reads of a wide table into a handful of large ranged reads
+	void FinalizeRegistration() {
+		if (pending_ranges.empty()) {
+			return;
 		}
-
-		if (read_head.GetEnd() > handle.GetFileSize()) {
-			throw std::runtime_error("Prefetch registered for bytes outside file");
+		std::sort(pending_ranges.begin(), pending_ranges.end());
+		idx_t current_start = pending_ranges[0].first;
+		idx_t current_end = current_start + pending_ranges[0].second;
+		for (idx_t i = 1; i <= pending_ranges.size(); i++) {
+			if (i < pending_ranges.size() && pending_ranges[i].first <= current_end + ALLOW_GAP) {
+				current_end = MaxValue<idx_t>(current_end, pending_ranges[i].first + pending_ranges[i].second);
+				continue;
+			}
+			read_heads.emplace_front(ReadHead(current_start, current_end - current_start));
+			total_size += current_end - current_start;
+			read_head_index[current_start] = &read_heads.front();
+			if (i < pending_ranges.size()) {
+				current_start = pending_ranges[i].first;
+				current_end = pending_ranges[i].first + pending_ranges[i].second;
+			}
 		}
+		pending_ranges.clear();
 	}
 
 	// Returns the relevant read head
 	ReadHead *GetReadHead(idx_t pos) {
-		for (auto &read_head : read_heads) {
-			if (pos >= read_head.location && pos < read_head.GetEnd()) {
-				return &read_head;
-			}
+		// find the read head with the greatest starting location that is at most "pos"
+		auto entry = read_head_index.upper_bound(pos);
+		if (entry == read_head_index.begin()) {
+			return nullptr;
+		}
+		entry--;
+		auto read_head = entry->second;
+		if (pos >= read_head->location && pos < read_head->GetEnd()) {
+			return read_head;
 		}
 		return nullptr;
 	}
@@ -106,6 +114,10 @@ struct ReadAheadBuffer {
 	// Prefetch all read heads
 	void Prefetch() {
 		for (auto &read_head : read_heads) {
+			if (read_head.data_isset) {
+				// already fetched on demand - don't read it again
+				continue;
+			}
 			read_head.Allocate(allocator);
 
 			if (read_head.GetEnd() > handle.GetFileSize()) {
@@ -164,9 +176,9 @@ public:
 		ra_buffer.AddReadHead(pos, len, can_merge);
 	}
 
-	// Prevents any further merges, should be called before PrefetchRegistered
+	// Coalesces all registered ranges, must be called before PrefetchRegistered
 	void FinalizeRegistration() {
-		ra_buffer.merge_set.clear();
+		ra_buffer.FinalizeRegistration();
 	}
 
 	// Prefetch all previously registered ranges
@@ -176,7 +188,8 @@ public:
 
 	void ClearPrefetch() {
 		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.pending_ranges.clear();
+		ra_buffer.read_head_index.clear();
 	}
 
 	void SetLocation(idx_t location_p) {
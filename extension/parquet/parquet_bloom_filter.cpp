@@ -0,0 +1,56 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+namespace duckdb {
+
+//! Salts from the Parquet split-block bloom filter specification
+static constexpr const uint32_t PARQUET_BLOOM_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                         0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_entries) {
+	// aim for BITS_PER_VALUE bits per distinct value, rounded up to a power-of-two number of blocks
+	auto bytes = idx_t(double(num_entries) * BITS_PER_VALUE / 8.0);
+	auto required_blocks = MaxValue<idx_t>(bytes / sizeof(ParquetBloomBlock), 1);
+	block_count = MinValue<idx_t>(NextPowerOfTwo(required_blocks), MAX_FILTER_BYTES / sizeof(ParquetBloomBlock));
+	blocks = unique_ptr<ParquetBloomBlock[]>(new ParquetBloomBlock[block_count]);
+	memset(blocks.get(), 0, GetSize());
+}
+
+ParquetBloomFilter::ParquetBloomFilter(const_data_ptr_t data, idx_t len) {
+	D_ASSERT(len % sizeof(ParquetBloomBlock) == 0);
+	block_count = len / sizeof(ParquetBloomBlock);
+	blocks = unique_ptr<ParquetBloomBlock[]>(new ParquetBloomBlock[block_count]);
+	memcpy(blocks.get(), data, len);
+}
+
+ParquetBloomBlock &ParquetBloomFilter::GetBlock(uint64_t hash) const {
+	// the top 32 bits of the hash select the block, the bottom 32 bits select the bits within it
+	auto block_index = idx_t(((hash >> 32) * block_count) >> 32);
+	return blocks[block_index];
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto &block = GetBlock(hash);
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block.word[i] |= 1U << ((key * PARQUET_BLOOM_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto &block = GetBlock(hash);
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block.word[i] & (1U << ((key * PARQUET_BLOOM_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t len) {
+	return duckdb_zstd::XXH64(data, len, 0);
+}
+
+} // namespace duckdb
@@ -24,6 +24,7 @@ source_files = [
     for x in [
         'extension/parquet/column_reader.cpp',
         'extension/parquet/column_writer.cpp',
+        'extension/parquet/parquet_bloom_filter.cpp',
         'extension/parquet/parquet_crypto.cpp',
         'extension/parquet/parquet_extension.cpp',
         'extension/parquet/parquet_metadata.cpp',
@@ -471,8 +471,8 @@ public:
 				if (!fs.IsRemoteFile(file_name)) {
 					auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 					// we need to check if the metadata cache entries are current
-					if (fs.GetLastModifiedTime(*handle) >= metadata->read_time) {
-						// missing or invalid metadata entry in cache, no usable stats overall
+					if (!metadata->IsValid(fs.GetLastModifiedTime(*handle), handle->GetFileSize())) {
+						// invalid metadata entry in cache, no usable stats overall
 						return nullptr;
 					}
 				} else {
@@ -7,6 +7,7 @@
 #include "duckdb.hpp"
 #include "expression_column_reader.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -114,7 +115,9 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
 	// Try to read the GeoParquet metadata (if present)
 	auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
 
-	return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, std::move(geo_metadata));
+	auto last_modified = file_handle.file_system.GetLastModifiedTime(file_handle);
+	return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, last_modified, file_size,
+	                                                 std::move(geo_metadata));
 }
 
 LogicalType ParquetReader::DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string) {
@@ -516,9 +519,8 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 		if (!ObjectCache::ObjectCacheEnabled(context_p)) {
 			metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config);
 		} else {
-			auto last_modify_time = fs.GetLastModifiedTime(*file_handle);
 			metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file_name);
-			if (!metadata || (last_modify_time + 10 >= metadata->read_time)) {
+			if (!metadata || !metadata->IsValid(fs.GetLastModifiedTime(*file_handle), file_handle->GetFileSize())) {
 				metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config);
 				ObjectCache::GetObjectCache(context_p).Put(file_name, metadata);
 			}
@@ -559,6 +561,16 @@ unique_ptr<BaseStatistics> ParquetReader::ReadStatistics(const string &name) {
 		return nullptr;
 	}
 
+	// the merged column statistics are cached along with the metadata, so that repeated queries over the same file
+	// do not re-parse the statistics of every row group (options that change the schema bypass the cache)
+	const bool can_cache_stats = !parquet_options.binary_as_string && parquet_options.schema.empty();
+	if (can_cache_stats) {
+		auto cached_stats = metadata->GetColumnStatistics(name);
+		if (cached_stats) {
+			return cached_stats;
+		}
+	}
+
 	unique_ptr<BaseStatistics> column_stats;
 	auto file_meta_data = GetFileMetadata();
 	auto column_reader = root_reader->Cast<StructColumnReader>().GetChildReader(file_col_idx);
@@ -575,6 +587,9 @@ unique_ptr<BaseStatistics> ParquetReader::ReadStatistics(const string &name) {
 			column_stats->Merge(*chunk_stats);
 		}
 	}
+	if (column_stats && can_cache_stats) {
+		metadata->SetColumnStatistics(name, *column_stats);
+	}
 	return column_stats;
 }
 
@@ -671,6 +686,95 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+//! Bloom filters can only be probed for types whose plain encoding matches the in-memory representation
+static bool BloomFilterSupported(const LogicalTypeId type_id) {
+	switch (type_id) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Collects the set of constants the filter restricts the column to. Returns false if the filter admits values
+//! outside of the collected set, in which case the bloom filter cannot be used to prune
+static bool GetBloomFilterProbes(const TableFilter &filter, vector<Value> &probes) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL || constant_filter.constant.IsNull() ||
+		    !BloomFilterSupported(constant_filter.constant.type().id())) {
+			return false;
+		}
+		probes.push_back(constant_filter.constant);
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		// a single conjunct that restricts the column to a set of values suffices
+		bool usable = false;
+		for (auto &child : conjunction.child_filters) {
+			usable = GetBloomFilterProbes(*child, probes) || usable;
+		}
+		return usable;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		// every disjunct must restrict the column, otherwise rows can slip through the bloom filter check
+		for (auto &child : conjunction.child_filters) {
+			if (!GetBloomFilterProbes(*child, probes)) {
+				return false;
+			}
+		}
+		return !conjunction.child_filters.empty();
+	}
+	default:
+		return false;
+	}
+}
+
+static uint64_t BloomProbeHash(const Value &constant) {
+	switch (constant.type().id()) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE: {
+		auto val = constant.GetValueUnsafe<int32_t>();
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(&val), sizeof(val));
+	}
+	case LogicalTypeId::BIGINT: {
+		auto val = constant.GetValueUnsafe<int64_t>();
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(&val), sizeof(val));
+	}
+	case LogicalTypeId::VARCHAR: {
+		auto &str = StringValue::Get(constant);
+		return ParquetBloomFilter::Hash(const_data_ptr_cast(str.data()), str.size());
+	}
+	default:
+		throw InternalException("Unsupported type for parquet bloom filter probe");
+	}
+}
+
+static unique_ptr<ParquetBloomFilter> ReadBloomFilter(duckdb_apache::thrift::protocol::TProtocol &file_proto,
+                                                      Allocator &allocator, idx_t bloom_filter_offset) {
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto.getTransport());
+	transport.SetLocation(bloom_filter_offset);
+
+	duckdb_parquet::format::BloomFilterHeader header;
+	header.read(&file_proto);
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		// we only understand uncompressed split-block bloom filters hashed with xxhash
+		return nullptr;
+	}
+	if (header.numBytes <= 0 || idx_t(header.numBytes) % sizeof(ParquetBloomBlock) != 0) {
+		return nullptr;
+	}
+	auto data = allocator.Allocate(NumericCast<idx_t>(header.numBytes));
+	transport.read(data.get(), NumericCast<uint32_t>(header.numBytes));
+	return make_uniq<ParquetBloomFilter>(data.get(), data.GetSize());
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -689,6 +793,26 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
 			}
+			auto &column_chunk = group.columns[column_reader->FileIdx()];
+			if (!skip_chunk && column_chunk.meta_data.__isset.bloom_filter_offset && !parquet_options.encryption_config &&
+			    BloomFilterSupported(column_reader->Type().id())) {
+				// the zone map cannot prune this row group, but for equality and IN predicates the bloom filter can
+				vector<Value> probes;
+				if (GetBloomFilterProbes(filter, probes)) {
+					auto bloom_filter = ReadBloomFilter(
+					    *state.thrift_file_proto, allocator,
+					    NumericCast<idx_t>(column_chunk.meta_data.bloom_filter_offset));
+					if (bloom_filter) {
+						skip_chunk = true;
+						for (auto &probe : probes) {
+							if (bloom_filter->FilterCheck(BloomProbeHash(probe))) {
+								skip_chunk = false;
+								break;
+							}
+						}
+					}
+				}
+			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
@@ -743,6 +867,16 @@ void FilterIsNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 		}
 		return;
 	}
+	if (v.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto &sel = DictionaryVector::SelVector(v);
+		auto &mask = FlatVector::Validity(DictionaryVector::Child(v));
+		for (idx_t i = 0; i < count; i++) {
+			if (filter_mask.test(i)) {
+				filter_mask.set(i, !mask.RowIsValid(sel.get_index(i)));
+			}
+		}
+		return;
+	}
 	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
 
 	auto &mask = FlatVector::Validity(v);
@@ -765,6 +899,16 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 		}
 		return;
 	}
+	if (v.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto &sel = DictionaryVector::SelVector(v);
+		auto &mask = FlatVector::Validity(DictionaryVector::Child(v));
+		for (idx_t i = 0; i < count; i++) {
+			if (filter_mask.test(i)) {
+				filter_mask.set(i, mask.RowIsValid(sel.get_index(i)));
+			}
+		}
+		return;
+	}
 	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
 
 	auto &mask = FlatVector::Validity(v);
@@ -791,6 +935,20 @@ void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_ma
 		return;
 	}
 
+	if (v.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto &sel = DictionaryVector::SelVector(v);
+		auto &child = DictionaryVector::Child(v);
+		auto child_ptr = FlatVector::GetData<T>(child);
+		auto &mask = FlatVector::Validity(child);
+		for (idx_t i = 0; i < count; i++) {
+			if (filter_mask.test(i)) {
+				auto child_idx = sel.get_index(i);
+				filter_mask.set(i, mask.RowIsValid(child_idx) && OP::Operation(child_ptr[child_idx], constant));
+			}
+		}
+		return;
+	}
+
 	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
 	auto v_ptr = FlatVector::GetData<T>(v);
 	auto &mask = FlatVector::Validity(v);
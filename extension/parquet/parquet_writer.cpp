@@ -445,6 +445,12 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 			}
 		}
 
+		// compress the remaining pages (including the dictionary pages) here, on the thread that produced the row
+		// group, so that FlushRowGroup only has to do ordered assembly while holding the writer lock
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().FinalizeCompress(*write_states[i]);
+		}
+
 		for (auto &write_state : write_states) {
 			states.push_back(std::move(write_state));
 		}
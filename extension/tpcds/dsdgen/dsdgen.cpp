@@ -68,13 +68,22 @@ void DSDGenWrapper::CreateTPCDSSchema(ClientContext &context, string catalog, st
 	CreateTPCDSTable<WebSiteInfo>(context, catalog, schema, suffix, keys, overwrite);
 }
 
-void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string catalog_name, string schema, string suffix) {
+void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string catalog_name, string schema, string suffix,
+                           int children, int step) {
 	if (scale <= 0) {
 		// schema only
 		return;
 	}
+	if (step >= children) {
+		return;
+	}
 
 	InitializeDSDgen(scale);
+	bool chunked_generation = children > 1 && step != -1;
+	if (chunked_generation) {
+		// chunked generation uses the generator's own work split (the CHILD parameter is 1-based)
+		SetChunking(children, step + 1);
+	}
 
 	// populate append info
 	duckdb::vector<duckdb::unique_ptr<tpcds_append_information>> append_info;
@@ -102,6 +111,12 @@ void DSDGenWrapper::DSDGen(double scale, ClientContext &context, string catalog_
 		}
 
 		ds_key_t k_row_count = GetRowCount(table_id), k_first_row = 1;
+		if (chunked_generation) {
+			// restrict the generation to this chunk of the table and position the random
+			// streams as if the preceding rows had been generated
+			SplitWork(table_id, k_first_row, k_row_count);
+			SkipRows(table_id, k_first_row);
+		}
 
 		// TODO: verify this is correct and required here
 		/*
@@ -6,6 +6,7 @@
 #include "config.h"
 #include "dist.h"
 #include "genrand.h"
+#include "parallel.h"
 #include "params.h"
 #include "porting.h"
 #include "scaling.h"
@@ -45,4 +46,31 @@ tpcds_builder_func GetTDefFunctionByNumber(int table_id) {
 	return table_funcs->builder;
 }
 
+void SetChunking(int children, int chunk) {
+	auto children_str = std::to_string(children);
+	auto chunk_str = std::to_string(chunk);
+	set_int("PARALLEL", children_str.c_str());
+	set_int("CHILD", chunk_str.c_str());
+}
+
+void SplitWork(int table_id, ds_key_t &first_row, ds_key_t &row_count) {
+	::ds_key_t k_first_row = first_row;
+	::ds_key_t k_row_count = row_count;
+	split_work(table_id, &k_first_row, &k_row_count);
+	first_row = k_first_row;
+	row_count = k_row_count;
+}
+
+void SkipRows(int table_id, ds_key_t first_row) {
+	if (first_row <= 1) {
+		return;
+	}
+	row_skip(table_id, first_row - 1);
+	auto tdef = getSimpleTdefsByNumber(table_id);
+	if (tdef->flags & FL_PARENT) {
+		// also skip the child table that is generated alongside this one
+		row_skip(tdef->nParam, first_row - 1);
+	}
+}
+
 } // namespace tpcds
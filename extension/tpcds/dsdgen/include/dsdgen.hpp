@@ -26,7 +26,9 @@ struct DSDGenWrapper {
 	static void CreateTPCDSSchema(duckdb::ClientContext &context, std::string catalog, std::string schema, std::string suffix, bool keys,
 	                              bool overwrite);
 	//! Generate the TPC-DS data of the given scale factor
-	static void DSDGen(double scale, duckdb::ClientContext &context, std::string catalog, std::string schema, std::string suffix);
+	//! When children > 1 and step is set, only the given chunk of each table is generated
+	static void DSDGen(double scale, duckdb::ClientContext &context, std::string catalog, std::string schema,
+	                   std::string suffix, int children = 1, int step = -1);
 
 	static uint32_t QueriesCount();
 	//! Gets the specified TPC-DS Query number as a string
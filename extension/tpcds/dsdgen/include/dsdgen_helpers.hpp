@@ -15,5 +15,11 @@ ds_key_t GetRowCount(int table_id);
 void ResetCountCount();
 tpcds_table_def GetTDefByNumber(int table_id);
 tpcds_builder_func GetTDefFunctionByNumber(int table_id);
+//! Configure chunked generation - children is the total number of chunks, chunk is the 1-based chunk to generate
+void SetChunking(int children, int chunk);
+//! Compute the row range of the configured chunk for the given table
+void SplitWork(int table_id, ds_key_t &first_row, ds_key_t &row_count);
+//! Advance the random streams as if the rows before first_row had been generated
+void SkipRows(int table_id, ds_key_t first_row);
 
 }; // namespace tpcds
@@ -23,6 +23,8 @@ struct DSDGenFunctionData : public TableFunctionData {
 	string suffix;
 	bool overwrite = false;
 	bool keys = false;
+	uint32_t children = 1;
+	int step = -1;
 };
 
 static duckdb::unique_ptr<FunctionData> DsdgenBind(ClientContext &context, TableFunctionBindInput &input,
@@ -41,8 +43,15 @@ static duckdb::unique_ptr<FunctionData> DsdgenBind(ClientContext &context, Table
 			result->overwrite = kv.second.GetValue<bool>();
 		} else if (kv.first == "keys") {
 			result->keys = kv.second.GetValue<bool>();
+		} else if (kv.first == "children") {
+			result->children = UIntegerValue::Get(kv.second);
+		} else if (kv.first == "step") {
+			result->step = UIntegerValue::Get(kv.second);
 		}
 	}
+	if (result->children != 1 && result->step == -1) {
+		throw InvalidInputException("Step must be defined when children are defined");
+	}
 	if (input.binder) {
 		auto &catalog = Catalog::GetCatalog(context, result->catalog);
 		auto &properties = input.binder->GetStatementProperties();
@@ -58,8 +67,12 @@ static void DsdgenFunction(ClientContext &context, TableFunctionInput &data_p, D
 	if (data.finished) {
 		return;
 	}
-	tpcds::DSDGenWrapper::CreateTPCDSSchema(context, data.catalog, data.schema, data.suffix, data.keys, data.overwrite);
-	tpcds::DSDGenWrapper::DSDGen(data.sf, context, data.catalog, data.schema, data.suffix);
+	if (data.step <= 0) {
+		// later steps of a chunked generation append to the tables created by the first step
+		tpcds::DSDGenWrapper::CreateTPCDSSchema(context, data.catalog, data.schema, data.suffix, data.keys,
+		                                        data.overwrite);
+	}
+	tpcds::DSDGenWrapper::DSDGen(data.sf, context, data.catalog, data.schema, data.suffix, data.children, data.step);
 
 	data.finished = true;
 }
@@ -161,6 +174,8 @@ static void LoadInternal(DuckDB &db) {
 	dsdgen_func.named_parameters["catalog"] = LogicalType::VARCHAR;
 	dsdgen_func.named_parameters["schema"] = LogicalType::VARCHAR;
 	dsdgen_func.named_parameters["suffix"] = LogicalType::VARCHAR;
+	dsdgen_func.named_parameters["children"] = LogicalType::UINTEGER;
+	dsdgen_func.named_parameters["step"] = LogicalType::UINTEGER;
 	ExtensionUtil::RegisterFunction(db_instance, dsdgen_func);
 
 	// create the TPCDS pragma that allows us to run the query
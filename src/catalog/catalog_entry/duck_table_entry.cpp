@@ -97,6 +97,9 @@ DuckTableEntry::DuckTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, Bou
 		storage =
 		    make_shared_ptr<DataTable>(catalog.GetAttached(), StorageManager::Get(catalog).GetTableIOManager(&info),
 		                               schema.name, name, std::move(storage_columns), std::move(info.data));
+		if (unlogged) {
+			storage->GetDataTableInfo()->SetUnlogged();
+		}
 
 		// create the unique indexes for the UNIQUE and PRIMARY KEY and FOREIGN KEY constraints
 		idx_t indexes_idx = 0;
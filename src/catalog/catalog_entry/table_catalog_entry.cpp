@@ -4,6 +4,7 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
@@ -23,6 +24,7 @@ TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schem
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
       constraints(std::move(info.constraints)) {
 	this->temporary = info.temporary;
+	this->unlogged = info.unlogged;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
 	this->tags = info.tags;
@@ -71,6 +73,7 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
 	result->tags = tags;
+	result->unlogged = unlogged;
 	return std::move(result);
 }
 
@@ -305,6 +308,14 @@ void TableCatalogEntry::BindUpdateConstraints(Binder &binder, LogicalGet &get, L
 		}
 	}
 
+	// over the bulk update threshold we also turn the update into a delete + insert
+	// in-place updates build per-row version chains that subsequent scans have to merge back in,
+	// while re-appended rows are written as fresh column segments
+	if (!update.update_is_del_and_insert &&
+	    proj.EstimateCardinality(context) >= ClientConfig::GetConfig(context).bulk_update_threshold) {
+		update.update_is_del_and_insert = true;
+	}
+
 	if (update.update_is_del_and_insert) {
 		// the update updates a column required by an index or requires returning the updated rows,
 		// push projections for all columns
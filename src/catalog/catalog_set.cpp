@@ -91,7 +91,7 @@ bool IsDependencyEntry(CatalogEntry &entry) {
 	return entry.type == CatalogType::DEPENDENCY_ENTRY;
 }
 
-bool CatalogSet::StartChain(CatalogTransaction transaction, const string &name, unique_lock<mutex> &read_lock) {
+bool CatalogSet::StartChain(CatalogTransaction transaction, const string &name, unique_ptr<StorageLockKey> &read_lock) {
 	D_ASSERT(!map.GetEntry(name));
 
 	// check if there is a default entry
@@ -167,7 +167,7 @@ optional_ptr<CatalogEntry> CatalogSet::CreateCommittedEntry(unique_ptr<CatalogEn
 }
 
 bool CatalogSet::CreateEntryInternal(CatalogTransaction transaction, const string &name, unique_ptr<CatalogEntry> value,
-                                     unique_lock<mutex> &read_lock, bool should_be_empty) {
+                                     unique_ptr<StorageLockKey> &read_lock, bool should_be_empty) {
 	auto entry_value = map.GetEntry(name);
 	if (!entry_value) {
 		// Add a dummy node to start the chain
@@ -204,8 +204,8 @@ bool CatalogSet::CreateEntry(CatalogTransaction transaction, const string &name,
 
 	// lock the catalog for writing
 	lock_guard<mutex> write_lock(catalog.GetWriteLock());
-	// lock this catalog set to disallow reading
-	unique_lock<mutex> read_lock(catalog_lock);
+	// get an exclusive lock on this catalog set to disallow reading
+	auto read_lock = catalog_lock.GetExclusiveLock();
 
 	return CreateEntryInternal(transaction, name, std::move(value), read_lock);
 }
@@ -266,7 +266,7 @@ bool CatalogSet::AlterOwnership(CatalogTransaction transaction, ChangeOwnershipI
 }
 
 bool CatalogSet::RenameEntryInternal(CatalogTransaction transaction, CatalogEntry &old, const string &new_name,
-                                     AlterInfo &alter_info, unique_lock<mutex> &read_lock) {
+                                     AlterInfo &alter_info, unique_ptr<StorageLockKey> &read_lock) {
 	auto &original_name = old.name;
 
 	auto &context = *transaction.context;
@@ -333,8 +333,8 @@ bool CatalogSet::AlterEntry(CatalogTransaction transaction, const string &name,
 
 	// lock the catalog for writing
 	unique_lock<mutex> write_lock(catalog.GetWriteLock());
-	// lock this catalog set to disallow reading
-	unique_lock<mutex> read_lock(catalog_lock);
+	// get an exclusive lock on this catalog set to disallow reading
+	auto read_lock = catalog_lock.GetExclusiveLock();
 
 	// fetch the entry again before doing the modification
 	// this will catch any write-write conflicts between transactions
@@ -366,7 +366,7 @@ bool CatalogSet::AlterEntry(CatalogTransaction transaction, const string &name,
 		dtransaction.PushCatalogEntry(new_entry->Child(), stream.GetData(), stream.GetPosition());
 	}
 
-	read_lock.unlock();
+	read_lock.reset();
 	write_lock.unlock();
 
 	// Check the dependency manager to verify that there are no conflicting dependencies with this alter
@@ -425,7 +425,7 @@ bool CatalogSet::DropEntry(CatalogTransaction transaction, const string &name, b
 		return false;
 	}
 	lock_guard<mutex> write_lock(catalog.GetWriteLock());
-	lock_guard<mutex> read_lock(catalog_lock);
+	auto read_lock = catalog_lock.GetExclusiveLock();
 	return DropEntryInternal(transaction, name, allow_drop_internal);
 }
 
@@ -440,7 +440,7 @@ DuckCatalog &CatalogSet::GetCatalog() {
 void CatalogSet::CleanupEntry(CatalogEntry &catalog_entry) {
 	// destroy the backed up entry: it is no longer required
 	lock_guard<mutex> write_lock(catalog.GetWriteLock());
-	lock_guard<mutex> lock(catalog_lock);
+	auto lock = catalog_lock.GetExclusiveLock();
 	auto &parent = catalog_entry.Parent();
 	map.DropEntry(catalog_entry);
 	if (parent.deleted && !parent.HasChild() && !parent.HasParent()) {
@@ -502,8 +502,14 @@ CatalogEntry &CatalogSet::GetCommittedEntry(CatalogEntry &current) {
 }
 
 SimilarCatalogEntry CatalogSet::SimilarEntry(CatalogTransaction transaction, const string &name) {
-	unique_lock<mutex> lock(catalog_lock);
-	CreateDefaultEntries(transaction, lock);
+	unique_ptr<StorageLockKey> lock;
+	if (defaults && !defaults->created_all_entries) {
+		// default entries have not been created yet: take an exclusive lock so we can create them
+		lock = catalog_lock.GetExclusiveLock();
+		CreateDefaultEntries(transaction, lock);
+	} else {
+		lock = catalog_lock.GetSharedLock();
+	}
 
 	SimilarCatalogEntry result;
 	for (auto &kv : map.Entries()) {
@@ -517,18 +523,18 @@ SimilarCatalogEntry CatalogSet::SimilarEntry(CatalogTransaction transaction, con
 }
 
 optional_ptr<CatalogEntry> CatalogSet::CreateDefaultEntry(CatalogTransaction transaction, const string &name,
-                                                          unique_lock<mutex> &read_lock) {
+                                                          unique_ptr<StorageLockKey> &read_lock) {
 	// no entry found with this name, check for defaults
 	if (!defaults || defaults->created_all_entries) {
 		// no defaults either: return null
 		return nullptr;
 	}
-	read_lock.unlock();
+	read_lock.reset();
 	// this catalog set has a default map defined
 	// check if there is a default entry that we can create with this name
 	auto entry = defaults->CreateDefaultEntry(transaction, name);
 
-	read_lock.lock();
+	read_lock = catalog_lock.GetExclusiveLock();
 	if (!entry) {
 		// no default entry
 		return nullptr;
@@ -541,26 +547,45 @@ optional_ptr<CatalogEntry> CatalogSet::CreateDefaultEntry(CatalogTransaction tra
 	// we found a default entry, but failed
 	// this means somebody else created the entry first
 	// just retry?
-	read_lock.unlock();
+	read_lock.reset();
 	return GetEntry(transaction, name);
 }
 
 CatalogSet::EntryLookup CatalogSet::GetEntryDetailed(CatalogTransaction transaction, const string &name) {
-	unique_lock<mutex> read_lock(catalog_lock);
+	{
+		// lookups only read the catalog set - take a shared lock so concurrent lookups do not contend
+		auto read_lock = catalog_lock.GetSharedLock();
+		auto entry_value = map.GetEntry(name);
+		if (entry_value) {
+			// we found an entry for this name
+			// check the version numbers
+
+			auto &catalog_entry = *entry_value;
+			auto &current = GetEntryForTransaction(transaction, catalog_entry);
+			if (current.deleted) {
+				return EntryLookup {nullptr, EntryLookup::FailureReason::DELETED};
+			}
+			D_ASSERT(StringUtil::CIEquals(name, current.name));
+			return EntryLookup {&current, EntryLookup::FailureReason::SUCCESS};
+		}
+		if (!defaults || defaults->created_all_entries) {
+			// no entry found and no default entries to create: the entry does not exist
+			return EntryLookup {nullptr, EntryLookup::FailureReason::NOT_PRESENT};
+		}
+	}
+	// the entry might be a default entry that has not been created yet
+	// take an exclusive lock and retry the lookup before attempting to create it
+	auto write_lock = catalog_lock.GetExclusiveLock();
 	auto entry_value = map.GetEntry(name);
 	if (entry_value) {
-		// we found an entry for this name
-		// check the version numbers
-
-		auto &catalog_entry = *entry_value;
-		auto &current = GetEntryForTransaction(transaction, catalog_entry);
+		auto &current = GetEntryForTransaction(transaction, *entry_value);
 		if (current.deleted) {
 			return EntryLookup {nullptr, EntryLookup::FailureReason::DELETED};
 		}
 		D_ASSERT(StringUtil::CIEquals(name, current.name));
 		return EntryLookup {&current, EntryLookup::FailureReason::SUCCESS};
 	}
-	auto default_entry = CreateDefaultEntry(transaction, name, read_lock);
+	auto default_entry = CreateDefaultEntry(transaction, name, write_lock);
 	if (!default_entry) {
 		return EntryLookup {default_entry, EntryLookup::FailureReason::NOT_PRESENT};
 	}
@@ -582,7 +607,7 @@ void CatalogSet::UpdateTimestamp(CatalogEntry &entry, transaction_t timestamp) {
 
 void CatalogSet::Undo(CatalogEntry &entry) {
 	lock_guard<mutex> write_lock(catalog.GetWriteLock());
-	lock_guard<mutex> lock(catalog_lock);
+	auto lock = catalog_lock.GetExclusiveLock();
 
 	// entry has to be restored
 	// and entry->parent has to be removed ("rolled back")
@@ -604,7 +629,7 @@ void CatalogSet::Undo(CatalogEntry &entry) {
 	catalog.ModifyCatalog();
 }
 
-void CatalogSet::CreateDefaultEntries(CatalogTransaction transaction, unique_lock<mutex> &read_lock) {
+void CatalogSet::CreateDefaultEntries(CatalogTransaction transaction, unique_ptr<StorageLockKey> &read_lock) {
 	if (!defaults || defaults->created_all_entries) {
 		return;
 	}
@@ -615,13 +640,13 @@ void CatalogSet::CreateDefaultEntries(CatalogTransaction transaction, unique_loc
 		if (!entry_value) {
 			// we unlock during the CreateEntry, since it might reference other catalog sets...
 			// specifically for views this can happen since the view will be bound
-			read_lock.unlock();
+			read_lock.reset();
 			auto entry = defaults->CreateDefaultEntry(transaction, default_entry);
 			if (!entry) {
 				throw InternalException("Failed to create default entry for %s", default_entry);
 			}
 
-			read_lock.lock();
+			read_lock = catalog_lock.GetExclusiveLock();
 			CreateCommittedEntry(std::move(entry));
 		}
 	}
@@ -630,8 +655,14 @@ void CatalogSet::CreateDefaultEntries(CatalogTransaction transaction, unique_loc
 
 void CatalogSet::Scan(CatalogTransaction transaction, const std::function<void(CatalogEntry &)> &callback) {
 	// lock the catalog set
-	unique_lock<mutex> lock(catalog_lock);
-	CreateDefaultEntries(transaction, lock);
+	unique_ptr<StorageLockKey> lock;
+	if (defaults && !defaults->created_all_entries) {
+		// default entries have not been created yet: take an exclusive lock so we can create them
+		lock = catalog_lock.GetExclusiveLock();
+		CreateDefaultEntries(transaction, lock);
+	} else {
+		lock = catalog_lock.GetSharedLock();
+	}
 
 	for (auto &kv : map.Entries()) {
 		auto &entry = *kv.second;
@@ -649,8 +680,14 @@ void CatalogSet::Scan(ClientContext &context, const std::function<void(CatalogEn
 void CatalogSet::ScanWithPrefix(CatalogTransaction transaction, const std::function<void(CatalogEntry &)> &callback,
                                 const string &prefix) {
 	// lock the catalog set
-	unique_lock<mutex> lock(catalog_lock);
-	CreateDefaultEntries(transaction, lock);
+	unique_ptr<StorageLockKey> lock;
+	if (defaults && !defaults->created_all_entries) {
+		// default entries have not been created yet: take an exclusive lock so we can create them
+		lock = catalog_lock.GetExclusiveLock();
+		CreateDefaultEntries(transaction, lock);
+	} else {
+		lock = catalog_lock.GetSharedLock();
+	}
 
 	auto &entries = map.Entries();
 	auto it = entries.lower_bound(prefix);
@@ -666,7 +703,7 @@ void CatalogSet::ScanWithPrefix(CatalogTransaction transaction, const std::funct
 
 void CatalogSet::Scan(const std::function<void(CatalogEntry &)> &callback) {
 	// lock the catalog set
-	lock_guard<mutex> lock(catalog_lock);
+	auto lock = catalog_lock.GetSharedLock();
 	for (auto &kv : map.Entries()) {
 		auto &entry = *kv.second;
 		auto &commited_entry = GetCommittedEntry(entry);
@@ -595,6 +595,12 @@ AdbcStatusCode Ingest(duckdb_connection connection, const char *table_name, stru
 			arrow_scan->CreateView("temp_adbc_view", true, true);
 			auto query = duckdb::StringUtil::Format("insert into \"%s\" select * from temp_adbc_view", table_name);
 			auto result = cconn->Query(query);
+			if (result->HasError()) {
+				if (error) {
+					error->message = strdup(result->GetError().c_str());
+				}
+				return ADBC_STATUS_INTERNAL;
+			}
 		}
 		// After creating a table, the arrow array stream is released. Hence we must set it as released to avoid
 		// double-releasing it
@@ -8,6 +8,12 @@
 
 #include <cstdint>
 
+#ifdef __linux__
+#include <sys/mman.h>
+// mman.h defines MAP_TYPE as a macro, which clashes with template parameters of the same name in unity builds
+#undef MAP_TYPE
+#endif
+
 #ifdef DUCKDB_DEBUG_ALLOCATION
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
@@ -119,6 +125,21 @@ Allocator::Allocator(allocate_function_ptr_t allocate_function_p, free_function_
 Allocator::~Allocator() {
 }
 
+//! Whether to back large allocations with (transparent) huge pages, set through PRAGMA allocator_huge_pages
+static atomic<bool> allocator_huge_pages {false};
+
+static void AdviseHugePages(data_ptr_t pointer, idx_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	// madvise operates on whole pages, so we advise the huge-page-aligned interior of the allocation
+	auto start = AlignValue<uintptr_t, Allocator::HUGE_PAGE_SIZE>(uintptr_t(pointer));
+	auto end = (uintptr_t(pointer) + size) / Allocator::HUGE_PAGE_SIZE * Allocator::HUGE_PAGE_SIZE;
+	if (end > start) {
+		// best effort: the kernel is free to ignore the advice, e.g., if transparent huge pages are disabled
+		madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE);
+	}
+#endif
+}
+
 data_ptr_t Allocator::AllocateData(idx_t size) {
 	D_ASSERT(size > 0);
 	if (size >= MAXIMUM_ALLOC_SIZE) {
@@ -136,6 +157,9 @@ data_ptr_t Allocator::AllocateData(idx_t size) {
 	if (!result) {
 		throw OutOfMemoryException("Failed to allocate block of %llu bytes (bad allocation)", size);
 	}
+	if (allocator_huge_pages && size >= HUGE_PAGE_SIZE) {
+		AdviseHugePages(result, size);
+	}
 	return result;
 }
 
@@ -173,6 +197,9 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 	if (!new_pointer) {
 		throw OutOfMemoryException("Failed to re-allocate block of %llu bytes (bad allocation)", size);
 	}
+	if (allocator_huge_pages && size >= HUGE_PAGE_SIZE) {
+		AdviseHugePages(new_pointer, size);
+	}
 	return new_pointer;
 }
 
@@ -254,6 +281,14 @@ void Allocator::SetBackgroundThreads(bool enable) {
 #endif
 }
 
+bool Allocator::HugePagesEnabled() {
+	return allocator_huge_pages;
+}
+
+void Allocator::SetHugePages(bool enable) {
+	allocator_huge_pages = enable;
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Info (extended)
 //===--------------------------------------------------------------------===//
@@ -179,6 +179,9 @@ ResultArrowArrayStreamWrapper::ResultArrowArrayStreamWrapper(unique_ptr<QueryRes
 bool ArrowUtil::TryFetchChunk(ChunkScanState &scan_state, ClientProperties options, idx_t batch_size, ArrowArray *out,
                               idx_t &count, ErrorData &error) {
 	count = 0;
+	// chunks fetched from a query result are not modified or recycled afterwards - the appender can safely
+	// reference their buffers directly instead of copying them
+	options.arrow_allow_zero_copy = true;
 	ArrowAppender appender(scan_state.Types(), batch_size, std::move(options));
 	auto remaining_tuples_in_chunk = scan_state.RemainingInChunk();
 	if (remaining_tuples_in_chunk) {
@@ -8,16 +8,30 @@ hash_t Checksum(uint64_t x) {
 }
 
 uint64_t Checksum(uint8_t *buffer, size_t size) {
-	uint64_t result = 5381;
 	uint64_t *ptr = reinterpret_cast<uint64_t *>(buffer);
-	size_t i;
+	size_t word_count = size / 8;
 	// for efficiency, we first checksum uint64_t values
-	for (i = 0; i < size / 8; i++) {
-		result ^= Checksum(ptr[i]);
+	// the per-word mixes are independent and xor is associative, so we can keep four independent
+	// accumulators; this breaks the latency chain of a single running xor and lets the multiplies
+	// pipeline (or vectorize, where the target has 64-bit SIMD multiplies), without changing the result
+	uint64_t result0 = 5381;
+	uint64_t result1 = 0;
+	uint64_t result2 = 0;
+	uint64_t result3 = 0;
+	size_t i;
+	for (i = 0; i + 4 <= word_count; i += 4) {
+		result0 ^= Checksum(ptr[i]);
+		result1 ^= Checksum(ptr[i + 1]);
+		result2 ^= Checksum(ptr[i + 2]);
+		result3 ^= Checksum(ptr[i + 3]);
+	}
+	for (; i < word_count; i++) {
+		result0 ^= Checksum(ptr[i]);
 	}
-	if (size - i * 8 > 0) {
+	uint64_t result = result0 ^ result1 ^ result2 ^ result3;
+	if (size - word_count * 8 > 0) {
 		// the remaining 0-7 bytes we hash using a string hash
-		result ^= Hash(buffer + i * 8, size - i * 8);
+		result ^= Hash(buffer + word_count * 8, size - word_count * 8);
 	}
 	return result;
 }
@@ -32,31 +32,9 @@ void CompressedFile::Initialize(bool write) {
 	stream_wrapper->Initialize(*this, write);
 }
 
-int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
-	idx_t total_read = 0;
-	while (true) {
-		// first check if there are input bytes available in the output buffers
-		if (stream_data.out_buff_start != stream_data.out_buff_end) {
-			// there is! copy it into the output buffer
-			auto available =
-			    MinValue<idx_t>(UnsafeNumericCast<idx_t>(remaining),
-			                    UnsafeNumericCast<idx_t>(stream_data.out_buff_end - stream_data.out_buff_start));
-			memcpy(data_ptr_t(buffer) + total_read, stream_data.out_buff_start, available);
-
-			// increment the total read variables as required
-			stream_data.out_buff_start += available;
-			total_read += available;
-			remaining -= available;
-			if (remaining == 0) {
-				// done! read enough
-				return UnsafeNumericCast<int64_t>(total_read);
-			}
-		}
-		if (!stream_wrapper) {
-			return UnsafeNumericCast<int64_t>(total_read);
-		}
-
-		// ran out of buffer: read more data from the child stream
+bool CompressedFile::DecompressChunk(DecompressedChunk &chunk) {
+	while (stream_wrapper) {
+		// reset the output buffer and decompress the next batch of data into it
 		stream_data.out_buff_start = stream_data.out_buff.get();
 		stream_data.out_buff_end = stream_data.out_buff.get();
 		D_ASSERT(stream_data.in_buff_start <= stream_data.in_buff_end);
@@ -95,6 +73,93 @@ int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 		if (finished) {
 			stream_wrapper.reset();
 		}
+
+		auto produced = UnsafeNumericCast<idx_t>(stream_data.out_buff_end - stream_data.out_buff_start);
+		if (produced > 0) {
+			chunk.data = make_unsafe_uniq_array<data_t>(produced);
+			chunk.size = produced;
+			memcpy(chunk.data.get(), stream_data.out_buff_start, produced);
+			break;
+		}
+	}
+	return !stream_wrapper;
+}
+
+void CompressedFile::ReadAheadLoop() {
+	unique_lock<mutex> guard(read_ahead_lock);
+	while (!read_ahead_done) {
+		read_ahead_cv.wait(guard, [&]() { return shutdown || read_ahead_chunks.size() < READ_AHEAD_CHUNKS; });
+		if (shutdown) {
+			break;
+		}
+		guard.unlock();
+		ErrorData error;
+		DecompressedChunk chunk;
+		bool finished = false;
+		try {
+			finished = DecompressChunk(chunk);
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		guard.lock();
+		if (error.HasError()) {
+			if (!has_read_error) {
+				read_error = std::move(error);
+				has_read_error = true;
+			}
+			read_ahead_done = true;
+		} else {
+			if (chunk.size > 0) {
+				read_ahead_chunks.push_back(std::move(chunk));
+			}
+			if (finished) {
+				read_ahead_done = true;
+			}
+		}
+		read_ahead_cv.notify_all();
+	}
+}
+
+int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
+	idx_t total_read = 0;
+	unique_lock<mutex> guard(read_ahead_lock);
+	if (!read_ahead_thread) {
+		if (!stream_wrapper) {
+			return 0;
+		}
+		// decompression runs on a background thread that reads ahead of the consumer,
+		// so that (e.g.) CSV parsing is not capped by single-threaded decompression speed
+		read_ahead_thread = make_uniq<thread>(&CompressedFile::ReadAheadLoop, this);
+	}
+	while (remaining > 0) {
+		if (!read_ahead_chunks.empty()) {
+			// there is a decompressed chunk available: copy it into the output buffer
+			auto &chunk = read_ahead_chunks.front();
+			auto available = MinValue<idx_t>(UnsafeNumericCast<idx_t>(remaining), chunk.size - chunk.offset);
+			memcpy(data_ptr_t(buffer) + total_read, chunk.data.get() + chunk.offset, available);
+
+			// increment the total read variables as required
+			chunk.offset += available;
+			total_read += available;
+			remaining -= available;
+			if (chunk.offset == chunk.size) {
+				// chunk fully consumed: hand the ring slot back to the read-ahead thread
+				read_ahead_chunks.pop_front();
+				read_ahead_cv.notify_all();
+			}
+			continue;
+		}
+		if (has_read_error) {
+			auto error = std::move(read_error);
+			read_error = ErrorData();
+			has_read_error = false;
+			guard.unlock();
+			error.Throw();
+		}
+		if (read_ahead_done) {
+			break;
+		}
+		read_ahead_cv.wait(guard, [&]() { return !read_ahead_chunks.empty() || read_ahead_done; });
 	}
 	return UnsafeNumericCast<int64_t>(total_read);
 }
@@ -105,6 +170,20 @@ int64_t CompressedFile::WriteData(data_ptr_t buffer, int64_t nr_bytes) {
 }
 
 void CompressedFile::Close() {
+	{
+		lock_guard<mutex> guard(read_ahead_lock);
+		shutdown = true;
+	}
+	read_ahead_cv.notify_all();
+	if (read_ahead_thread) {
+		read_ahead_thread->join();
+		read_ahead_thread.reset();
+	}
+	shutdown = false;
+	read_ahead_done = false;
+	has_read_error = false;
+	read_error = ErrorData();
+	read_ahead_chunks.clear();
 	if (stream_wrapper) {
 		stream_wrapper->Close();
 		stream_wrapper.reset();
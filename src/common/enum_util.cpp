@@ -1249,6 +1249,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ROARING:
+		return "COMPRESSION_ROARING";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1294,6 +1296,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ROARING")) {
+		return CompressionType::COMPRESSION_ROARING;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -4213,6 +4218,16 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPERATOR_CARDINALITY";
 	case MetricsType::OPERATOR_TIMING:
 		return "OPERATOR_TIMING";
+	case MetricsType::OPERATOR_INSTRUCTIONS:
+		return "OPERATOR_INSTRUCTIONS";
+	case MetricsType::OPERATOR_LLC_MISSES:
+		return "OPERATOR_LLC_MISSES";
+	case MetricsType::OPERATOR_BRANCH_MISSES:
+		return "OPERATOR_BRANCH_MISSES";
+	case MetricsType::OPERATOR_IO_WAIT:
+		return "OPERATOR_IO_WAIT";
+	case MetricsType::OPERATOR_BUFFER_WAIT:
+		return "OPERATOR_BUFFER_WAIT";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -4232,6 +4247,21 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPERATOR_TIMING")) {
 		return MetricsType::OPERATOR_TIMING;
 	}
+	if (StringUtil::Equals(value, "OPERATOR_INSTRUCTIONS")) {
+		return MetricsType::OPERATOR_INSTRUCTIONS;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_LLC_MISSES")) {
+		return MetricsType::OPERATOR_LLC_MISSES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_BRANCH_MISSES")) {
+		return MetricsType::OPERATOR_BRANCH_MISSES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_IO_WAIT")) {
+		return MetricsType::OPERATOR_IO_WAIT;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_BUFFER_WAIT")) {
+		return MetricsType::OPERATOR_BUFFER_WAIT;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -4497,6 +4527,10 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "COMPRESSED_MATERIALIZATION";
 	case OptimizerType::DUPLICATE_GROUPS:
 		return "DUPLICATE_GROUPS";
+	case OptimizerType::EAGER_AGGREGATION:
+		return "EAGER_AGGREGATION";
+	case OptimizerType::COUNT_STAR:
+		return "COUNT_STAR";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
 	case OptimizerType::EXTENSION:
@@ -4565,6 +4599,12 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "DUPLICATE_GROUPS")) {
 		return OptimizerType::DUPLICATE_GROUPS;
 	}
+	if (StringUtil::Equals(value, "EAGER_AGGREGATION")) {
+		return OptimizerType::EAGER_AGGREGATION;
+	}
+	if (StringUtil::Equals(value, "COUNT_STAR")) {
+		return OptimizerType::COUNT_STAR;
+	}
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
@@ -6973,6 +7013,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::EXPRESSION_FILTER:
+		return "EXPRESSION_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6998,6 +7040,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "EXPRESSION_FILTER")) {
+		return TableFilterType::EXPRESSION_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -29,6 +29,8 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"build_side_probe_side", OptimizerType::BUILD_SIDE_PROBE_SIDE},
     {"compressed_materialization", OptimizerType::COMPRESSED_MATERIALIZATION},
     {"duplicate_groups", OptimizerType::DUPLICATE_GROUPS},
+    {"eager_aggregation", OptimizerType::EAGER_AGGREGATION},
+    {"count_star", OptimizerType::COUNT_STAR},
     {"reorder_filter", OptimizerType::REORDER_FILTER},
     {"extension", OptimizerType::EXTENSION},
     {nullptr, OptimizerType::INVALID}};
@@ -4,7 +4,9 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread_wait_times.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -362,6 +364,12 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Read (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, vector<ReadRequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, request.nr_bytes, request.location);
+	}
+}
+
 bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 	// This is not a required method. Derived FileSystems may optionally override/implement.
 	return false;
@@ -550,7 +558,12 @@ FileHandle::~FileHandle() {
 }
 
 int64_t FileHandle::Read(void *buffer, idx_t nr_bytes) {
-	return file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes));
+	Profiler wait_timer;
+	wait_timer.Start();
+	auto bytes_read = file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes));
+	wait_timer.End();
+	ThreadWaitTimes::Get().io_wait += wait_timer.Elapsed();
+	return bytes_read;
 }
 
 bool FileHandle::Trim(idx_t offset_bytes, idx_t length_bytes) {
@@ -562,7 +575,11 @@ int64_t FileHandle::Write(void *buffer, idx_t nr_bytes) {
 }
 
 void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
+	Profiler wait_timer;
+	wait_timer.Start();
 	file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
+	wait_timer.End();
+	ThreadWaitTimes::Get().io_wait += wait_timer.Elapsed();
 }
 
 void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
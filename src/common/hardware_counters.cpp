@@ -0,0 +1,109 @@
+#include "duckdb/common/hardware_counters.hpp"
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+#ifdef __linux__
+
+static int PerfEventOpen(uint64_t event_config) {
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = event_config;
+	attr.disabled = 1;
+	// only measure user space so that no elevated perf_event_paranoid level is required
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	// measure the calling thread on any CPU
+	return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+HardwareCounterProfiler::HardwareCounterProfiler() {
+	static constexpr uint64_t EVENT_CONFIGS[COUNTER_COUNT] = {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+	                                                          PERF_COUNT_HW_BRANCH_MISSES};
+	bool success = true;
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		counter_fds[i] = PerfEventOpen(EVENT_CONFIGS[i]);
+		if (counter_fds[i] < 0) {
+			success = false;
+		}
+	}
+	if (!success) {
+		// not all counters could be opened - mark the profiler as unsupported
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			if (counter_fds[i] >= 0) {
+				close(counter_fds[i]);
+			}
+			counter_fds[i] = -1;
+		}
+	}
+}
+
+HardwareCounterProfiler::~HardwareCounterProfiler() {
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		if (counter_fds[i] >= 0) {
+			close(counter_fds[i]);
+		}
+	}
+}
+
+void HardwareCounterProfiler::Start() {
+	if (!IsSupported()) {
+		return;
+	}
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		ioctl(counter_fds[i], PERF_EVENT_IOC_RESET, 0);
+		ioctl(counter_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+void HardwareCounterProfiler::End() {
+	elapsed = HardwareCounters();
+	if (!IsSupported()) {
+		return;
+	}
+	uint64_t values[COUNTER_COUNT];
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		ioctl(counter_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+		if (read(counter_fds[i], &values[i], sizeof(uint64_t)) != sizeof(uint64_t)) {
+			values[i] = 0;
+		}
+	}
+	elapsed.instructions = values[0];
+	elapsed.llc_misses = values[1];
+	elapsed.branch_misses = values[2];
+}
+
+#else
+
+HardwareCounterProfiler::HardwareCounterProfiler() {
+	for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+		counter_fds[i] = -1;
+	}
+}
+
+HardwareCounterProfiler::~HardwareCounterProfiler() {
+}
+
+void HardwareCounterProfiler::Start() {
+}
+
+void HardwareCounterProfiler::End() {
+	elapsed = HardwareCounters();
+}
+
+#endif
+
+bool HardwareCounterProfiler::IsSupported() const {
+	return counter_fds[0] >= 0;
+}
+
+} // namespace duckdb
@@ -1,10 +1,10 @@
 #include "duckdb/common/hive_partitioning.hpp"
 
+#include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/uhugeint.hpp"
 #include "duckdb/execution/expression_executor.hpp"
-#include "duckdb/optimizer/filter_combiner.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
-#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
@@ -39,28 +39,6 @@ static unordered_map<column_t, string> GetKnownColumnValues(string &filename,
 	return result;
 }
 
-// Takes an expression and converts a list of known column_refs to constants
-static void ConvertKnownColRefToConstants(unique_ptr<Expression> &expr,
-                                          unordered_map<column_t, string> &known_column_values, idx_t table_index) {
-	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
-		auto &bound_colref = expr->Cast<BoundColumnRefExpression>();
-
-		// This bound column ref is for another table
-		if (table_index != bound_colref.binding.table_index) {
-			return;
-		}
-
-		auto lookup = known_column_values.find(bound_colref.binding.column_index);
-		if (lookup != known_column_values.end()) {
-			expr = make_uniq<BoundConstantExpression>(Value(lookup->second).DefaultCastAs(bound_colref.return_type));
-		}
-	} else {
-		ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
-			ConvertKnownColRefToConstants(child, known_column_values, table_index);
-		});
-	}
-}
-
 // matches hive partitions in file name. For example:
 // 	- s3://bucket/var1=value1/bla/bla/var2=value2
 //  - http(s)://domain(:port)/lala/kasdl/var1=value1/?not-a-var=not-a-value
@@ -87,58 +65,144 @@ std::map<string, string> HivePartitioning::Parse(const string &filename) {
 	return Parse(filename, regex);
 }
 
+// Rewrites the column references of "table_index" into references into the chunk that holds the (string) partition
+// values of a batch of files, adding casts to the referenced types; returns false if the expression references a
+// column for which no value is known, meaning the filter cannot be evaluated from the partition values alone
+static bool RewriteHiveFilter(ClientContext &context, unique_ptr<Expression> &expr,
+                              const unordered_map<column_t, idx_t> &value_positions, idx_t table_index) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &bound_colref = expr->Cast<BoundColumnRefExpression>();
+		if (table_index != bound_colref.binding.table_index) {
+			// This bound column ref is for another table
+			return false;
+		}
+		auto lookup = value_positions.find(bound_colref.binding.column_index);
+		if (lookup == value_positions.end()) {
+			return false;
+		}
+		unique_ptr<Expression> value_ref = make_uniq<BoundReferenceExpression>(LogicalType::VARCHAR, lookup->second);
+		expr = BoundCastExpression::AddCastToType(context, std::move(value_ref), bound_colref.return_type);
+		return true;
+	}
+	bool success = true;
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		if (!RewriteHiveFilter(context, child, value_positions, table_index)) {
+			success = false;
+		}
+	});
+	return success;
+}
+
 // TODO: this can still be improved by removing the parts of filter expressions that are true for all remaining files.
 //		 currently, only expressions that cannot be evaluated during pushdown are removed.
 void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<string> &files,
                                               vector<unique_ptr<Expression>> &filters,
                                               unordered_map<string, column_t> &column_map, LogicalGet &get,
                                               bool hive_enabled, bool filename_enabled) {
+	if ((!filename_enabled && !hive_enabled) || filters.empty()) {
+		return;
+	}
 
-	vector<string> pruned_files;
-	vector<bool> have_preserved_filter(filters.size(), false);
-	vector<unique_ptr<Expression>> pruned_filters;
-	unordered_set<idx_t> filters_applied_to_files;
 	duckdb_re2::RE2 regex(RegexString());
 	auto table_index = get.table_index;
 
-	if ((!filename_enabled && !hive_enabled) || filters.empty()) {
-		return;
+	// parse the partition values of every file and group the files by the set of columns they provide values for:
+	// within such a group, every filter is either evaluable for all of the files or for none of them
+	vector<unordered_map<column_t, string>> known_values(files.size());
+	map<vector<column_t>, vector<idx_t>> file_groups;
+	for (idx_t i = 0; i < files.size(); i++) {
+		known_values[i] = GetKnownColumnValues(files[i], column_map, regex, filename_enabled, hive_enabled);
+		vector<column_t> signature;
+		for (auto &entry : known_values[i]) {
+			signature.push_back(entry.first);
+		}
+		std::sort(signature.begin(), signature.end());
+		file_groups[std::move(signature)].push_back(i);
 	}
 
-	for (idx_t i = 0; i < files.size(); i++) {
-		auto &file = files[i];
-		bool should_prune_file = false;
-		auto known_values = GetKnownColumnValues(file, column_map, regex, filename_enabled, hive_enabled);
+	vector<bool> keep_file(files.size(), true);
+	vector<bool> have_preserved_filter(filters.size(), false);
+	vector<bool> filter_pruned_a_file(filters.size(), false);
 
-		FilterCombiner combiner(context);
+	for (auto &group : file_groups) {
+		auto &signature = group.first;
+		auto &file_idxs = group.second;
 
+		// compile each filter once against the known columns of this group - the per-file expression copying and
+		// constant folding this replaces used to dominate bind time on large partitioned file lists
+		unordered_map<column_t, idx_t> value_positions;
+		for (idx_t pos = 0; pos < signature.size(); pos++) {
+			value_positions[signature[pos]] = pos;
+		}
+		vector<unique_ptr<Expression>> compiled_filters;
+		vector<idx_t> compiled_filter_idxs;
 		for (idx_t j = 0; j < filters.size(); j++) {
-			auto &filter = filters[j];
-			unique_ptr<Expression> filter_copy = filter->Copy();
-			ConvertKnownColRefToConstants(filter_copy, known_values, table_index);
-			// Evaluate the filter, if it can be evaluated here, we can not prune this filter
-			Value result_value;
-
-			if (!filter_copy->IsScalar() || !filter_copy->IsFoldable() ||
-			    !ExpressionExecutor::TryEvaluateScalar(context, *filter_copy, result_value)) {
+			auto filter_copy = filters[j]->Copy();
+			if (signature.empty() || filters[j]->IsVolatile() || filters[j]->HasSubquery() ||
+			    !RewriteHiveFilter(context, filter_copy, value_positions, table_index)) {
 				// can not be evaluated only with the filename/hive columns added, we can not prune this filter
-				if (!have_preserved_filter[j]) {
-					pruned_filters.emplace_back(filter->Copy());
-					have_preserved_filter[j] = true;
+				have_preserved_filter[j] = true;
+				continue;
+			}
+			compiled_filters.push_back(std::move(filter_copy));
+			compiled_filter_idxs.push_back(j);
+		}
+		if (compiled_filters.empty()) {
+			continue;
+		}
+
+		// evaluate the compiled filters over the partition values of the group, a batch of files at a time
+		vector<LogicalType> chunk_types(signature.size(), LogicalType::VARCHAR);
+		DataChunk partition_values;
+		partition_values.Initialize(Allocator::Get(context), chunk_types);
+		vector<unique_ptr<ExpressionExecutor>> executors;
+		for (auto &compiled_filter : compiled_filters) {
+			executors.push_back(make_uniq<ExpressionExecutor>(context, *compiled_filter));
+		}
+		Vector filter_result(LogicalType::BOOLEAN);
+		for (idx_t offset = 0; offset < file_idxs.size(); offset += STANDARD_VECTOR_SIZE) {
+			idx_t count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, file_idxs.size() - offset);
+			partition_values.Reset();
+			for (idx_t pos = 0; pos < signature.size(); pos++) {
+				auto value_data = FlatVector::GetData<string_t>(partition_values.data[pos]);
+				for (idx_t i = 0; i < count; i++) {
+					auto &value = known_values[file_idxs[offset + i]][signature[pos]];
+					value_data[i] = StringVector::AddString(partition_values.data[pos], value);
 				}
-			} else if (!result_value.GetValue<bool>()) {
-				// filter evaluates to false
-				should_prune_file = true;
-				// convert the filter to a table filter.
-				if (filters_applied_to_files.find(j) == filters_applied_to_files.end()) {
-					get.extra_info.file_filters += filter->ToString();
-					filters_applied_to_files.insert(j);
+			}
+			partition_values.SetCardinality(count);
+
+			for (idx_t filter_idx = 0; filter_idx < compiled_filters.size(); filter_idx++) {
+				executors[filter_idx]->ExecuteExpression(partition_values, filter_result);
+				UnifiedVectorFormat result_format;
+				filter_result.ToUnifiedFormat(count, result_format);
+				auto result_data = UnifiedVectorFormat::GetData<bool>(result_format);
+				for (idx_t i = 0; i < count; i++) {
+					auto result_idx = result_format.sel->get_index(i);
+					if (!result_format.validity.RowIsValid(result_idx) || !result_data[result_idx]) {
+						// filter evaluates to false (or NULL) - prune the file
+						keep_file[file_idxs[offset + i]] = false;
+						filter_pruned_a_file[compiled_filter_idxs[filter_idx]] = true;
+					}
 				}
 			}
 		}
+	}
 
-		if (!should_prune_file) {
-			pruned_files.push_back(file);
+	// build the pruned file list (in the original file order) and the list of preserved filters
+	vector<string> pruned_files;
+	for (idx_t i = 0; i < files.size(); i++) {
+		if (keep_file[i]) {
+			pruned_files.push_back(std::move(files[i]));
+		}
+	}
+	vector<unique_ptr<Expression>> pruned_filters;
+	for (idx_t j = 0; j < filters.size(); j++) {
+		if (filter_pruned_a_file[j]) {
+			get.extra_info.file_filters += filters[j]->ToString();
+		}
+		if (have_preserved_filter[j]) {
+			pruned_filters.push_back(std::move(filters[j]));
 		}
 	}
 
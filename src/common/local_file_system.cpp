@@ -58,6 +58,16 @@ extern "C" WINBASEAPI BOOL QueryFullProcessImageNameW(HANDLE, DWORD, LPWSTR, PDW
 #include <restartmanager.h>
 #endif
 
+// io_uring support for batched reads (Linux only, and only when the kernel headers are available)
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define DUCKDB_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
 namespace duckdb {
 
 #ifndef _WIN32
@@ -342,15 +352,15 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 		}
 		throw IOException("Cannot open file \"%s\": %s", {{"errno", std::to_string(errno)}}, path, strerror(errno));
 	}
-	// #if defined(__DARWIN__) || defined(__APPLE__)
-	// 	if (flags & FileFlags::FILE_FLAGS_DIRECT_IO) {
-	// 		// OSX requires fcntl for Direct IO
-	// 		rc = fcntl(fd, F_NOCACHE, 1);
-	// 		if (fd == -1) {
-	// 			throw IOException("Could not enable direct IO for file \"%s\": %s", path, strerror(errno));
-	// 		}
-	// 	}
-	// #endif
+#if defined(__DARWIN__) || defined(__APPLE__)
+	if (flags.DirectIO()) {
+		// OSX requires fcntl for Direct IO
+		rc = fcntl(fd, F_NOCACHE, 1);
+		if (rc == -1) {
+			throw IOException("Could not enable direct IO for file \"%s\": %s", path, strerror(errno));
+		}
+	}
+#endif
 	if (flags.Lock() != FileLockType::NO_LOCK) {
 		// set lock on file
 		// but only if it is not an input/output stream
@@ -437,6 +447,172 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+#ifdef DUCKDB_IO_URING
+static int IoUringSetup(unsigned entries, struct io_uring_params *params) {
+	return NumericCast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+	return NumericCast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+//! A minimal io_uring wrapper that submits batches of positional reads and waits for their completion.
+//! If the kernel does not support io_uring the ring fails to initialize and the caller falls back to pread.
+class IoUringReader {
+public:
+	//! The size of the submission/completion rings (i.e. the maximum number of reads in flight)
+	static constexpr unsigned RING_ENTRIES = 64;
+
+public:
+	IoUringReader() {
+		struct io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ring_fd = IoUringSetup(RING_ENTRIES, &params);
+		if (ring_fd < 0) {
+			return;
+		}
+		if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+			// pre-5.4 kernel that requires separate ring mappings - not worth supporting
+			close(ring_fd);
+			ring_fd = -1;
+			return;
+		}
+		ring_size = MaxValue<size_t>(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+		                             params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+		ring_ptr = mmap(nullptr, ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		                IORING_OFF_SQ_RING);
+		sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+		sqes_ptr = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		                IORING_OFF_SQES);
+		if (ring_ptr == MAP_FAILED || sqes_ptr == MAP_FAILED) {
+			Close();
+			return;
+		}
+		auto ring = static_cast<data_ptr_t>(ring_ptr);
+		sq_tail = reinterpret_cast<unsigned *>(ring + params.sq_off.tail);
+		sq_mask = reinterpret_cast<unsigned *>(ring + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(ring + params.sq_off.array);
+		cq_head = reinterpret_cast<unsigned *>(ring + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(ring + params.cq_off.tail);
+		cq_mask = reinterpret_cast<unsigned *>(ring + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<struct io_uring_cqe *>(ring + params.cq_off.cqes);
+		sqes = reinterpret_cast<struct io_uring_sqe *>(sqes_ptr);
+	}
+
+	~IoUringReader() {
+		Close();
+	}
+
+	bool Initialized() const {
+		return ring_fd >= 0;
+	}
+
+	//! Submit all requests against the given fd and wait for their completion.
+	//! Returns false if submission failed entirely; failed or short individual reads are retried with pread by
+	//! the caller through the 'incomplete' indices.
+	bool TryReadBatch(int fd, vector<ReadRequest> &requests, vector<idx_t> &incomplete) {
+		vector<struct iovec> iovecs(requests.size());
+		for (idx_t request_idx = 0; request_idx < requests.size(); request_idx += RING_ENTRIES) {
+			unsigned count = NumericCast<unsigned>(MinValue<idx_t>(requests.size() - request_idx, RING_ENTRIES));
+			// fill the submission queue
+			unsigned tail = *sq_tail;
+			for (unsigned i = 0; i < count; i++) {
+				auto &request = requests[request_idx + i];
+				auto &iov = iovecs[request_idx + i];
+				iov.iov_base = request.buffer;
+				iov.iov_len = UnsafeNumericCast<size_t>(request.nr_bytes);
+				unsigned index = tail & *sq_mask;
+				auto &sqe = sqes[index];
+				memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_READV;
+				sqe.fd = fd;
+				sqe.addr = reinterpret_cast<uintptr_t>(&iov);
+				sqe.len = 1;
+				sqe.off = request.location;
+				sqe.user_data = request_idx + i;
+				sq_array[index] = index;
+				tail++;
+			}
+			__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+			// submit the batch and wait for all completions
+			unsigned completed = 0;
+			while (completed < count) {
+				unsigned to_submit = completed == 0 ? count : 0;
+				auto ret = IoUringEnter(ring_fd, to_submit, count - completed, IORING_ENTER_GETEVENTS);
+				if (ret < 0) {
+					return false;
+				}
+				// drain the completion queue
+				unsigned head = *cq_head;
+				while (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+					auto &cqe = cqes[head & *cq_mask];
+					auto &request = requests[cqe.user_data];
+					if (cqe.res < 0 || cqe.res != request.nr_bytes) {
+						// read error or short read: retry this request synchronously
+						incomplete.push_back(UnsafeNumericCast<idx_t>(cqe.user_data));
+					}
+					head++;
+					completed++;
+				}
+				__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+			}
+		}
+		return true;
+	}
+
+private:
+	void Close() {
+		if (ring_ptr && ring_ptr != MAP_FAILED) {
+			munmap(ring_ptr, ring_size);
+		}
+		if (sqes_ptr && sqes_ptr != MAP_FAILED) {
+			munmap(sqes_ptr, sqes_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+		ring_ptr = nullptr;
+		sqes_ptr = nullptr;
+		ring_fd = -1;
+	}
+
+private:
+	int ring_fd = -1;
+	void *ring_ptr = nullptr;
+	size_t ring_size = 0;
+	void *sqes_ptr = nullptr;
+	size_t sqes_size = 0;
+	unsigned *sq_tail = nullptr;
+	unsigned *sq_mask = nullptr;
+	unsigned *sq_array = nullptr;
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned *cq_mask = nullptr;
+	struct io_uring_cqe *cqes = nullptr;
+	struct io_uring_sqe *sqes = nullptr;
+};
+#endif
+
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<ReadRequest> &requests) {
+#ifdef DUCKDB_IO_URING
+	// one ring per thread, so batches from different scan threads do not contend on a shared ring
+	static thread_local IoUringReader io_uring_reader;
+	if (io_uring_reader.Initialized() && requests.size() > 1) {
+		int fd = handle.Cast<UnixFileHandle>().fd;
+		vector<idx_t> incomplete;
+		if (io_uring_reader.TryReadBatch(fd, requests, incomplete)) {
+			// retry any failed or short reads synchronously so they throw a proper error
+			for (auto request_idx : incomplete) {
+				auto &request = requests[request_idx];
+				Read(handle, request.buffer, request.nr_bytes, request.location);
+			}
+			return;
+		}
+	}
+#endif
+	FileSystem::ReadBatch(handle, requests);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -875,6 +1051,11 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<ReadRequest> &requests) {
+	// no asynchronous I/O backend on Windows (yet): perform the reads one by one
+	FileSystem::ReadBatch(handle, requests);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
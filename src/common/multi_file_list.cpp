@@ -8,6 +8,9 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/storage/object_cache.hpp"
 
 #include <algorithm>
 
@@ -267,14 +270,63 @@ string GlobMultiFileList::GetFileInternal(idx_t i) {
 	return expanded_files[i];
 }
 
+//! Cached expansion of a single glob pattern, stored in the ObjectCache when it is enabled
+//! Entries expire after a short TTL so that newly added files are picked up eventually
+class GlobCacheEntry : public ObjectCacheEntry {
+public:
+	static constexpr int64_t CACHE_VALID_MICROS = 30 * Interval::MICROS_PER_SEC;
+
+	GlobCacheEntry(vector<string> files_p, int64_t expires_at_p) : files(std::move(files_p)), expires_at(expires_at_p) {
+	}
+
+	//! The expanded (and sorted) files the pattern produced
+	vector<string> files;
+	//! Timestamp (in microseconds) after which the entry is stale
+	int64_t expires_at;
+
+public:
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	static string ObjectType() {
+		return "glob_cache";
+	}
+};
+
+vector<string> GlobMultiFileList::GlobFilesInternal(const string &path) {
+	if (!ObjectCache::ObjectCacheEnabled(context)) {
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto glob_files = fs.GlobFiles(path, context, glob_options);
+		std::sort(glob_files.begin(), glob_files.end());
+		return glob_files;
+	}
+	// the object cache is enabled - cache the expansion keyed by (pattern, glob settings)
+	// repeated binds of the same pattern (e.g. dashboard queries over large hive datasets) skip re-globbing
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto key = StringUtil::Format("glob_cache:%d:%s", static_cast<int>(glob_options), path);
+	auto now = Timestamp::GetCurrentTimestamp().value;
+	auto cache_entry = cache.Get<GlobCacheEntry>(key);
+	if (cache_entry && now < cache_entry->expires_at) {
+		return cache_entry->files;
+	}
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto glob_files = fs.GlobFiles(path, context, glob_options);
+	std::sort(glob_files.begin(), glob_files.end());
+	if (cache_entry) {
+		// stale entry - remove it so that Put can insert the fresh one
+		cache.Delete(key);
+	}
+	cache.Put(key, make_shared_ptr<GlobCacheEntry>(glob_files, now + GlobCacheEntry::CACHE_VALID_MICROS));
+	return glob_files;
+}
+
 bool GlobMultiFileList::ExpandPathInternal() {
 	if (IsFullyExpanded()) {
 		return false;
 	}
 
-	auto &fs = FileSystem::GetFileSystem(context);
-	auto glob_files = fs.GlobFiles(paths[current_path], context, glob_options);
-	std::sort(glob_files.begin(), glob_files.end());
+	auto glob_files = GlobFilesInternal(paths[current_path]);
 	expanded_files.insert(expanded_files.end(), glob_files.begin(), glob_files.end());
 
 	current_path++;
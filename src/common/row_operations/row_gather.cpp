@@ -11,10 +11,81 @@
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/common/uhugeint.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace duckdb {
 
 using ValidityBytes = RowLayout::ValidityBytes;
 
+#if defined(__AVX2__)
+//! Gather 8-byte values from four rows at a time using a hardware gather
+static void GatherWords64(const data_ptr_t ptrs[], const SelectionVector &row_sel, uint64_t *data,
+                          const SelectionVector &col_sel, const idx_t count, const idx_t col_offset) {
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		auto addresses =
+		    _mm256_set_epi64x(reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i + 3)] + col_offset),
+		                      reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i + 2)] + col_offset),
+		                      reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i + 1)] + col_offset),
+		                      reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i)] + col_offset));
+		auto gathered = _mm256_i64gather_epi64(nullptr, addresses, 1);
+		uint64_t values[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(values), gathered);
+		for (idx_t j = 0; j < 4; j++) {
+			data[col_sel.get_index(i + j)] = values[j];
+		}
+	}
+	for (; i < count; i++) {
+		data[col_sel.get_index(i)] = Load<uint64_t>(ptrs[row_sel.get_index(i)] + col_offset);
+	}
+}
+
+//! Gather 4-byte values from four rows at a time using a hardware gather
+static void GatherWords32(const data_ptr_t ptrs[], const SelectionVector &row_sel, uint32_t *data,
+                          const SelectionVector &col_sel, const idx_t count, const idx_t col_offset) {
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		auto addresses =
+		    _mm256_set_epi64x(reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i + 3)] + col_offset),
+		                      reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i + 2)] + col_offset),
+		                      reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i + 1)] + col_offset),
+		                      reinterpret_cast<int64_t>(ptrs[row_sel.get_index(i)] + col_offset));
+		auto gathered = _mm256_i64gather_epi32(nullptr, addresses, 1);
+		uint32_t values[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(values), gathered);
+		for (idx_t j = 0; j < 4; j++) {
+			data[col_sel.get_index(i + j)] = values[j];
+		}
+	}
+	for (; i < count; i++) {
+		data[col_sel.get_index(i)] = Load<uint32_t>(ptrs[row_sel.get_index(i)] + col_offset);
+	}
+}
+#endif
+
+//! Gather the fixed-width column data without touching the validity masks.
+//! This loop is branch-free so the compiler can vectorize it; on AVX2 targets the
+//! 4- and 8-byte widths use an explicit hardware gather instead.
+template <class T>
+static void GatherFixedData(const data_ptr_t ptrs[], const SelectionVector &row_sel, T *data,
+                            const SelectionVector &col_sel, const idx_t count, const idx_t col_offset) {
+#if defined(__AVX2__)
+	if (sizeof(T) == 8) {
+		GatherWords64(ptrs, row_sel, reinterpret_cast<uint64_t *>(data), col_sel, count, col_offset);
+		return;
+	}
+	if (sizeof(T) == 4) {
+		GatherWords32(ptrs, row_sel, reinterpret_cast<uint32_t *>(data), col_sel, count, col_offset);
+		return;
+	}
+#endif
+	for (idx_t i = 0; i < count; i++) {
+		data[col_sel.get_index(i)] = Load<T>(ptrs[row_sel.get_index(i)] + col_offset);
+	}
+}
+
 template <class T>
 static void TemplatedGatherLoop(Vector &rows, const SelectionVector &row_sel, Vector &col,
                                 const SelectionVector &col_sel, idx_t count, const RowLayout &layout, idx_t col_no,
@@ -30,13 +101,14 @@ static void TemplatedGatherLoop(Vector &rows, const SelectionVector &row_sel, Ve
 	auto data = FlatVector::GetData<T>(col);
 	auto &col_mask = FlatVector::Validity(col);
 
+	// first move the data, then apply the row validity to the column mask in a separate pass
+	GatherFixedData<T>(ptrs, row_sel, data, col_sel, count, col_offset);
 	for (idx_t i = 0; i < count; i++) {
 		auto row_idx = row_sel.get_index(i);
 		auto row = ptrs[row_idx];
-		auto col_idx = col_sel.get_index(i);
-		data[col_idx] = Load<T>(row + col_offset);
 		ValidityBytes row_mask(row);
 		if (!row_mask.RowIsValid(row_mask.GetValidityEntry(entry_idx), idx_in_entry)) {
+			auto col_idx = col_sel.get_index(i);
 			if (build_size > STANDARD_VECTOR_SIZE && col_mask.AllValid()) {
 				//! We need to initialize the mask with the vector size.
 				col_mask.Initialize(build_size);
@@ -47,6 +47,102 @@ static idx_t TemplatedMatch(Vector &, const TupleDataVectorFormat &lhs_format, S
 	return match_count;
 }
 
+template <bool NO_MATCH_SEL, class A, class B, class OP>
+static idx_t TemplatedFusedMatch(DataChunk &lhs, const vector<TupleDataVectorFormat> &lhs_formats, SelectionVector &sel,
+                                 const idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
+                                 SelectionVector *no_match_sel, idx_t &no_match_count) {
+	using COMPARISON_OP = ComparisonOperationWrapper<OP>;
+
+	// LHS
+	const auto &a_sel = *lhs_formats[0].unified.sel;
+	const auto &b_sel = *lhs_formats[1].unified.sel;
+	const auto a_data = UnifiedVectorFormat::GetData<A>(lhs_formats[0].unified);
+	const auto b_data = UnifiedVectorFormat::GetData<B>(lhs_formats[1].unified);
+	const auto &a_validity = lhs_formats[0].unified.validity;
+	const auto &b_validity = lhs_formats[1].unified.validity;
+
+	// RHS
+	const auto rhs_locations = FlatVector::GetData<data_ptr_t>(rhs_row_locations);
+	const auto a_offset_in_row = rhs_layout.GetOffsets()[0];
+	const auto b_offset_in_row = rhs_layout.GetOffsets()[1];
+	idx_t a_entry_idx;
+	idx_t a_idx_in_entry;
+	ValidityBytes::GetEntryIndex(0, a_entry_idx, a_idx_in_entry);
+	idx_t b_entry_idx;
+	idx_t b_idx_in_entry;
+	ValidityBytes::GetEntryIndex(1, b_entry_idx, b_idx_in_entry);
+
+	idx_t match_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+
+		const auto &rhs_location = rhs_locations[idx];
+		const ValidityBytes rhs_mask(rhs_location);
+
+		const auto a_idx = a_sel.get_index(idx);
+		const auto a_null = a_validity.AllValid() ? false : !a_validity.RowIsValid(a_idx);
+		const auto a_rhs_null = !rhs_mask.RowIsValid(rhs_mask.GetValidityEntryUnsafe(a_entry_idx), a_idx_in_entry);
+		bool match = COMPARISON_OP::template Operation<A>(a_data[a_idx], Load<A>(rhs_location + a_offset_in_row), a_null,
+		                                                  a_rhs_null);
+		if (match) {
+			// the second column is only compared if the first column matched, while the row is still hot in cache
+			const auto b_idx = b_sel.get_index(idx);
+			const auto b_null = b_validity.AllValid() ? false : !b_validity.RowIsValid(b_idx);
+			const auto b_rhs_null = !rhs_mask.RowIsValid(rhs_mask.GetValidityEntryUnsafe(b_entry_idx), b_idx_in_entry);
+			match = COMPARISON_OP::template Operation<B>(b_data[b_idx], Load<B>(rhs_location + b_offset_in_row), b_null,
+			                                             b_rhs_null);
+		}
+
+		if (match) {
+			sel.set_index(match_count++, idx);
+		} else if (NO_MATCH_SEL) {
+			no_match_sel->set_index(no_match_count++, idx);
+		}
+	}
+	return match_count;
+}
+
+template <bool NO_MATCH_SEL, class A, class B>
+static fused_match_function_t GetFusedMatchFunction(const ExpressionType predicate) {
+	switch (predicate) {
+	case ExpressionType::COMPARE_EQUAL:
+		return TemplatedFusedMatch<NO_MATCH_SEL, A, B, Equals>;
+	case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+		return TemplatedFusedMatch<NO_MATCH_SEL, A, B, NotDistinctFrom>;
+	default:
+		return nullptr;
+	}
+}
+
+template <bool NO_MATCH_SEL, class A>
+static fused_match_function_t GetFusedMatchFunction(const PhysicalType second_type, const ExpressionType predicate) {
+	switch (second_type) {
+	case PhysicalType::INT32:
+		return GetFusedMatchFunction<NO_MATCH_SEL, A, int32_t>(predicate);
+	case PhysicalType::INT64:
+		return GetFusedMatchFunction<NO_MATCH_SEL, A, int64_t>(predicate);
+	default:
+		return nullptr;
+	}
+}
+
+template <bool NO_MATCH_SEL>
+static fused_match_function_t GetFusedMatchFunction(const TupleDataLayout &layout,
+                                                    const RowMatcher::Predicates &predicates) {
+	if (predicates.size() != 2 || predicates[0] != predicates[1]) {
+		return nullptr;
+	}
+	// only fuse the hottest fixed-width key types; other layouts go through the per-column functions
+	switch (layout.GetTypes()[0].InternalType()) {
+	case PhysicalType::INT32:
+		return GetFusedMatchFunction<NO_MATCH_SEL, int32_t>(layout.GetTypes()[1].InternalType(), predicates[0]);
+	case PhysicalType::INT64:
+		return GetFusedMatchFunction<NO_MATCH_SEL, int64_t>(layout.GetTypes()[1].InternalType(), predicates[0]);
+	default:
+		return nullptr;
+	}
+}
+
 template <bool NO_MATCH_SEL, class OP>
 static idx_t StructMatchEquality(Vector &lhs_vector, const TupleDataVectorFormat &lhs_format, SelectionVector &sel,
                                  const idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
@@ -196,6 +292,9 @@ void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layo
 	for (idx_t col_idx = 0; col_idx < predicates.size(); col_idx++) {
 		match_functions.push_back(GetMatchFunction(no_match_sel, layout.GetTypes()[col_idx], predicates[col_idx]));
 	}
+	// for common two-column fixed-width key layouts we can compare both columns in a single pass over the rows
+	fused_function =
+	    no_match_sel ? GetFusedMatchFunction<true>(layout, predicates) : GetFusedMatchFunction<false>(layout, predicates);
 }
 
 void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layout, const Predicates &predicates,
@@ -218,6 +317,9 @@ idx_t RowMatcher::Match(DataChunk &lhs, const vector<TupleDataVectorFormat> &lhs
                         idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
                         SelectionVector *no_match_sel, idx_t &no_match_count) {
 	D_ASSERT(!match_functions.empty());
+	if (fused_function) {
+		return fused_function(lhs, lhs_formats, sel, count, rhs_layout, rhs_row_locations, no_match_sel, no_match_count);
+	}
 	for (idx_t col_idx = 0; col_idx < match_functions.size(); col_idx++) {
 		const auto &match_function = match_functions[col_idx];
 		count =
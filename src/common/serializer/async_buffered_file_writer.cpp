@@ -0,0 +1,145 @@
+#include "duckdb/common/serializer/async_buffered_file_writer.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/typedefs.hpp"
+#include <cstring>
+
+namespace duckdb {
+
+AsyncBufferedFileWriter::AsyncBufferedFileWriter(FileSystem &fs, const string &path, FileOpenFlags open_flags)
+    : BufferedFileWriter(fs, path, open_flags) {
+}
+
+AsyncBufferedFileWriter::~AsyncBufferedFileWriter() {
+	{
+		lock_guard<mutex> guard(flush_lock);
+		shutdown = true;
+	}
+	flush_cv.notify_all();
+	if (flush_thread) {
+		// the flush loop completes any pending write before shutting down
+		// the file handle outlives us - it is owned by the base class
+		flush_thread->join();
+	}
+}
+
+void AsyncBufferedFileWriter::WriteData(const_data_ptr_t buffer, idx_t write_size) {
+	if (write_size >= (2ULL * FILE_BUFFER_SIZE - offset)) {
+		idx_t to_copy = 0;
+		// fill and flush the current buffer first to avoid a small write (see BufferedFileWriter::WriteData)
+		if (offset != 0) {
+			to_copy = FILE_BUFFER_SIZE - offset;
+			memcpy(data.get() + offset, buffer, to_copy);
+			offset += to_copy;
+			Flush();
+		}
+		// the remainder is written directly, bypassing the buffers
+		// wait for the background write so the writes do not interleave
+		WaitForDrain();
+		idx_t remaining_to_write = write_size - to_copy;
+		fs.Write(*handle, const_cast<data_ptr_t>(buffer + to_copy), // NOLINT: wrong API in Write
+		         UnsafeNumericCast<int64_t>(remaining_to_write));
+		total_written += remaining_to_write;
+	} else {
+		// first copy anything we can from the buffer
+		const_data_ptr_t end_ptr = buffer + write_size;
+		while (buffer < end_ptr) {
+			idx_t to_write = MinValue<idx_t>(UnsafeNumericCast<idx_t>((end_ptr - buffer)), FILE_BUFFER_SIZE - offset);
+			D_ASSERT(to_write > 0);
+			memcpy(data.get() + offset, buffer, to_write);
+			offset += to_write;
+			buffer += to_write;
+			if (offset == FILE_BUFFER_SIZE) {
+				Flush();
+			}
+		}
+	}
+}
+
+void AsyncBufferedFileWriter::Flush() {
+	if (offset == 0) {
+		return;
+	}
+	// wait until the background thread is done with the other buffer before rotating
+	WaitForDrain();
+	if (!flush_buffer) {
+		flush_buffer = make_unsafe_uniq_array<data_t>(FILE_BUFFER_SIZE);
+	}
+	std::swap(data, flush_buffer);
+	{
+		lock_guard<mutex> guard(flush_lock);
+		flush_size = offset;
+		flush_pending = true;
+	}
+	total_written += offset;
+	offset = 0;
+	if (!flush_thread) {
+		flush_thread = make_uniq<thread>(&AsyncBufferedFileWriter::FlushLoop, this);
+	}
+	flush_cv.notify_all();
+}
+
+void AsyncBufferedFileWriter::FlushLoop() {
+	unique_lock<mutex> guard(flush_lock);
+	while (true) {
+		flush_cv.wait(guard, [&]() { return flush_pending || shutdown; });
+		if (flush_pending) {
+			guard.unlock();
+			ErrorData error;
+			try {
+				fs.Write(*handle, flush_buffer.get(), UnsafeNumericCast<int64_t>(flush_size));
+			} catch (std::exception &ex) { // LCOV_EXCL_START
+				error = ErrorData(ex);
+			} // LCOV_EXCL_STOP
+			guard.lock();
+			if (error.HasError() && !has_flush_error) {
+				flush_error = std::move(error);
+				has_flush_error = true;
+			}
+			flush_pending = false;
+			flush_cv.notify_all();
+		}
+		if (shutdown && !flush_pending) {
+			break;
+		}
+	}
+}
+
+void AsyncBufferedFileWriter::WaitForDrain() {
+	unique_lock<mutex> guard(flush_lock);
+	flush_cv.wait(guard, [&]() { return !flush_pending; });
+	if (has_flush_error) {
+		auto error = std::move(flush_error);
+		flush_error = ErrorData();
+		has_flush_error = false;
+		guard.unlock();
+		error.Throw();
+	}
+}
+
+void AsyncBufferedFileWriter::Sync() {
+	Flush();
+	WaitForDrain();
+	handle->Sync();
+}
+
+void AsyncBufferedFileWriter::Close() {
+	Flush();
+	WaitForDrain();
+	handle->Close();
+	handle.reset();
+}
+
+void AsyncBufferedFileWriter::Truncate(idx_t size) {
+	// the truncation is relative to the file size on disk - wait until the pending write has landed
+	WaitForDrain();
+	BufferedFileWriter::Truncate(size);
+}
+
+idx_t AsyncBufferedFileWriter::GetFileSize() {
+	// the pending background write is not yet reflected in the size on disk
+	WaitForDrain();
+	return BufferedFileWriter::GetFileSize();
+}
+
+} // namespace duckdb
@@ -239,6 +239,30 @@ void MergeSorter::GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_i
 	}
 }
 
+//! Computes the interleaving of constant-size sorting keys, with the comparison width templated for the common
+//! normalized key sizes, so the comparisons compile to fixed-width compares instead of calls with a run-time size.
+//! A COMP_WIDTH of 0 indicates an uncommon width, which falls back to FastMemcmp.
+template <idx_t COMP_WIDTH>
+static void TemplatedComputeConstantMerge(const SortLayout &sort_layout, SBScanState &l, SBScanState &r,
+                                          data_ptr_t l_radix_ptr, data_ptr_t r_radix_ptr, const idx_t &l_count,
+                                          const idx_t &r_count, bool left_smaller[], idx_t &compared,
+                                          const idx_t &count) {
+	for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
+		if (COMP_WIDTH == 0) {
+			left_smaller[compared] = FastMemcmp(l_radix_ptr, r_radix_ptr, sort_layout.comparison_size) < 0;
+		} else {
+			left_smaller[compared] = memcmp(l_radix_ptr, r_radix_ptr, COMP_WIDTH) < 0;
+		}
+		const bool &l_smaller = left_smaller[compared];
+		const bool r_smaller = !l_smaller;
+		// Use comparison bool (0 or 1) to increment entries and pointers
+		l.entry_idx += l_smaller;
+		r.entry_idx += r_smaller;
+		l_radix_ptr += l_smaller * sort_layout.entry_size;
+		r_radix_ptr += r_smaller * sort_layout.entry_size;
+	}
+}
+
 void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
 	auto &l = *left;
 	auto &r = *right;
@@ -283,15 +307,35 @@ void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
 		// Compute the merge
 		if (sort_layout.all_constant) {
 			// All sorting columns are constant size
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] = FastMemcmp(l_radix_ptr, r_radix_ptr, sort_layout.comparison_size) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
+			switch (sort_layout.comparison_size) {
+			case 4:
+				TemplatedComputeConstantMerge<4>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                 left_smaller, compared, count);
+				break;
+			case 5:
+				TemplatedComputeConstantMerge<5>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                 left_smaller, compared, count);
+				break;
+			case 8:
+				TemplatedComputeConstantMerge<8>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                 left_smaller, compared, count);
+				break;
+			case 9:
+				TemplatedComputeConstantMerge<9>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                 left_smaller, compared, count);
+				break;
+			case 12:
+				TemplatedComputeConstantMerge<12>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                  left_smaller, compared, count);
+				break;
+			case 16:
+				TemplatedComputeConstantMerge<16>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                  left_smaller, compared, count);
+				break;
+			default:
+				TemplatedComputeConstantMerge<0>(sort_layout, l, r, l_radix_ptr, r_radix_ptr, l_count, r_count,
+				                                 left_smaller, compared, count);
+				break;
 			}
 		} else {
 			// Pin the blob data
@@ -570,20 +614,26 @@ void MergeSorter::MergeData(SortedData &result_data, SortedData &l_data, SortedD
 	}
 }
 
-void MergeSorter::MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr,
-                            idx_t &r_entry_idx, const idx_t &r_count, RowDataBlock &target_block,
-                            data_ptr_t &target_ptr, const idx_t &entry_size, const bool left_smaller[], idx_t &copied,
-                            const idx_t &count) {
+//! Merges rows of a constant width, with the width templated for narrow entries (sorting keys and narrow payloads),
+//! so the copies compile to fixed-width moves. An ENTRY_SIZE of 0 indicates an uncommon width (FastMemcpy fallback).
+template <idx_t ENTRY_SIZE>
+static void TemplatedMergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr,
+                               idx_t &r_entry_idx, const idx_t &r_count, RowDataBlock &target_block,
+                               data_ptr_t &target_ptr, const idx_t &entry_size, const bool left_smaller[],
+                               idx_t &copied, const idx_t &count) {
 	const idx_t next = MinValue(count - copied, target_block.capacity - target_block.count);
 	idx_t i;
 	for (i = 0; i < next && l_entry_idx < l_count && r_entry_idx < r_count; i++) {
 		const bool &l_smaller = left_smaller[copied + i];
 		const bool r_smaller = !l_smaller;
 		// Use comparison bool (0 or 1) to copy an entry from either side
-		FastMemcpy(
-		    target_ptr,
-		    reinterpret_cast<data_ptr_t>(l_smaller * CastPointerToValue(l_ptr) + r_smaller * CastPointerToValue(r_ptr)),
-		    entry_size);
+		const auto source_ptr =
+		    reinterpret_cast<data_ptr_t>(l_smaller * CastPointerToValue(l_ptr) + r_smaller * CastPointerToValue(r_ptr));
+		if (ENTRY_SIZE == 0) {
+			FastMemcpy(target_ptr, source_ptr, entry_size);
+		} else {
+			memcpy(target_ptr, source_ptr, ENTRY_SIZE);
+		}
 		target_ptr += entry_size;
 		// Use the comparison bool to increment entries and pointers
 		l_entry_idx += l_smaller;
@@ -596,6 +646,32 @@ void MergeSorter::MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &
 	copied += i;
 }
 
+void MergeSorter::MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr,
+                            idx_t &r_entry_idx, const idx_t &r_count, RowDataBlock &target_block,
+                            data_ptr_t &target_ptr, const idx_t &entry_size, const bool left_smaller[], idx_t &copied,
+                            const idx_t &count) {
+	switch (entry_size) {
+	case 8:
+		return TemplatedMergeRows<8>(l_ptr, l_entry_idx, l_count, r_ptr, r_entry_idx, r_count, target_block, target_ptr,
+		                             entry_size, left_smaller, copied, count);
+	case 9:
+		return TemplatedMergeRows<9>(l_ptr, l_entry_idx, l_count, r_ptr, r_entry_idx, r_count, target_block, target_ptr,
+		                             entry_size, left_smaller, copied, count);
+	case 12:
+		return TemplatedMergeRows<12>(l_ptr, l_entry_idx, l_count, r_ptr, r_entry_idx, r_count, target_block,
+		                              target_ptr, entry_size, left_smaller, copied, count);
+	case 13:
+		return TemplatedMergeRows<13>(l_ptr, l_entry_idx, l_count, r_ptr, r_entry_idx, r_count, target_block,
+		                              target_ptr, entry_size, left_smaller, copied, count);
+	case 16:
+		return TemplatedMergeRows<16>(l_ptr, l_entry_idx, l_count, r_ptr, r_entry_idx, r_count, target_block,
+		                              target_ptr, entry_size, left_smaller, copied, count);
+	default:
+		return TemplatedMergeRows<0>(l_ptr, l_entry_idx, l_count, r_ptr, r_entry_idx, r_count, target_block, target_ptr,
+		                             entry_size, left_smaller, copied, count);
+	}
+}
+
 void MergeSorter::FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
                             RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
                             const idx_t &count) {
@@ -106,31 +106,48 @@ static void ComputeTies(data_ptr_t dataptr, const idx_t &count, const idx_t &col
 	}
 }
 
+//! Copies a row during the radix sort. The sorting entries are narrow (key, row index) pairs, so we template the
+//! common widths, which compiles to a couple of fixed-width moves instead of a call with a run-time size.
+//! A ROW_WIDTH of 0 indicates an uncommon width, which falls back to FastMemcpy.
+template <idx_t ROW_WIDTH>
+static inline void CopyRow(const data_ptr_t &target, const data_ptr_t &source, const idx_t &row_width) {
+	if (ROW_WIDTH == 0) {
+		FastMemcpy(target, source, row_width);
+	} else {
+		memcpy(target, source, ROW_WIDTH);
+	}
+}
+
 //! Textbook LSD radix sort
-void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
-                  const idx_t &row_width, const idx_t &sorting_size) {
+template <idx_t ROW_WIDTH>
+static void TemplatedRadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count,
+                                  const idx_t &col_offset, const idx_t &row_width, const idx_t &sorting_size) {
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate(count * row_width);
 	bool swap = false;
 
-	idx_t counts[SortConstants::VALUES_PER_RADIX];
+	// Collect the counts of all digits in a single pass over the data (digit frequencies don't change between passes)
+	D_ASSERT(sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD);
+	idx_t counts[SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD][SortConstants::VALUES_PER_RADIX];
+	memset(counts, 0, sorting_size * sizeof(counts[0]));
+	data_ptr_t offset_ptr = dataptr + col_offset;
+	for (idx_t i = 0; i < count; i++) {
+		for (idx_t r = 0; r < sorting_size; r++) {
+			counts[r][offset_ptr[r]]++;
+		}
+		offset_ptr += row_width;
+	}
+
 	for (idx_t r = 1; r <= sorting_size; r++) {
-		// Init counts to 0
-		memset(counts, 0, sizeof(counts));
 		// Const some values for convenience
 		const data_ptr_t source_ptr = swap ? temp_block.get() : dataptr;
 		const data_ptr_t target_ptr = swap ? dataptr : temp_block.get();
 		const idx_t offset = col_offset + sorting_size - r;
-		// Collect counts
-		data_ptr_t offset_ptr = source_ptr + offset;
-		for (idx_t i = 0; i < count; i++) {
-			counts[*offset_ptr]++;
-			offset_ptr += row_width;
-		}
 		// Compute offsets from counts
-		idx_t max_count = counts[0];
+		idx_t *offsets = counts[sorting_size - r];
+		idx_t max_count = offsets[0];
 		for (idx_t val = 1; val < SortConstants::VALUES_PER_RADIX; val++) {
-			max_count = MaxValue<idx_t>(max_count, counts[val]);
-			counts[val] = counts[val] + counts[val - 1];
+			max_count = MaxValue<idx_t>(max_count, offsets[val]);
+			offsets[val] = offsets[val] + offsets[val - 1];
 		}
 		if (max_count == count) {
 			continue;
@@ -138,8 +155,8 @@ void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, cons
 		// Re-order the data in temporary array
 		data_ptr_t row_ptr = source_ptr + (count - 1) * row_width;
 		for (idx_t i = 0; i < count; i++) {
-			idx_t &radix_offset = --counts[*(row_ptr + offset)];
-			FastMemcpy(target_ptr + radix_offset * row_width, row_ptr, row_width);
+			idx_t &radix_offset = --offsets[*(row_ptr + offset)];
+			CopyRow<ROW_WIDTH>(target_ptr + radix_offset * row_width, row_ptr, row_width);
 			row_ptr -= row_width;
 		}
 		swap = !swap;
@@ -151,9 +168,10 @@ void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, cons
 }
 
 //! Insertion sort, used when count of values is low
-inline void InsertionSort(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count,
-                          const idx_t &col_offset, const idx_t &row_width, const idx_t &total_comp_width,
-                          const idx_t &offset, bool swap) {
+template <idx_t ROW_WIDTH>
+static inline void InsertionSort(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count,
+                                 const idx_t &col_offset, const idx_t &row_width, const idx_t &total_comp_width,
+                                 const idx_t &offset, bool swap) {
 	const data_ptr_t source_ptr = swap ? temp_ptr : orig_ptr;
 	const data_ptr_t target_ptr = swap ? orig_ptr : temp_ptr;
 	if (count > 1) {
@@ -162,14 +180,14 @@ inline void InsertionSort(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr,
 		const data_ptr_t val = temp_val.get();
 		const auto comp_width = total_comp_width - offset;
 		for (idx_t i = 1; i < count; i++) {
-			FastMemcpy(val, source_ptr + i * row_width, row_width);
+			CopyRow<ROW_WIDTH>(val, source_ptr + i * row_width, row_width);
 			idx_t j = i;
 			while (j > 0 &&
 			       FastMemcmp(source_ptr + (j - 1) * row_width + total_offset, val + total_offset, comp_width) > 0) {
-				FastMemcpy(source_ptr + j * row_width, source_ptr + (j - 1) * row_width, row_width);
+				CopyRow<ROW_WIDTH>(source_ptr + j * row_width, source_ptr + (j - 1) * row_width, row_width);
 				j--;
 			}
-			FastMemcpy(source_ptr + j * row_width, val, row_width);
+			CopyRow<ROW_WIDTH>(source_ptr + j * row_width, val, row_width);
 		}
 	}
 	if (swap) {
@@ -178,8 +196,10 @@ inline void InsertionSort(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr,
 }
 
 //! MSD radix sort that switches to insertion sort with low bucket sizes
-void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count, const idx_t &col_offset,
-                  const idx_t &row_width, const idx_t &comp_width, const idx_t &offset, idx_t locations[], bool swap) {
+template <idx_t ROW_WIDTH>
+static void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const idx_t &count,
+                         const idx_t &col_offset, const idx_t &row_width, const idx_t &comp_width, const idx_t &offset,
+                         idx_t locations[], bool swap) {
 	const data_ptr_t source_ptr = swap ? temp_ptr : orig_ptr;
 	const data_ptr_t target_ptr = swap ? orig_ptr : temp_ptr;
 	// Init counts to 0
@@ -203,7 +223,7 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 		data_ptr_t row_ptr = source_ptr;
 		for (idx_t i = 0; i < count; i++) {
 			const idx_t &radix_offset = locations[*(row_ptr + total_offset)]++;
-			FastMemcpy(target_ptr + radix_offset * row_width, row_ptr, row_width);
+			CopyRow<ROW_WIDTH>(target_ptr + radix_offset * row_width, row_ptr, row_width);
 			row_ptr += row_width;
 		}
 		swap = !swap;
@@ -216,8 +236,8 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 		return;
 	}
 	if (max_count == count) {
-		RadixSortMSD(orig_ptr, temp_ptr, count, col_offset, row_width, comp_width, offset + 1,
-		             locations + SortConstants::MSD_RADIX_LOCATIONS, swap);
+		RadixSortMSD<ROW_WIDTH>(orig_ptr, temp_ptr, count, col_offset, row_width, comp_width, offset + 1,
+		                        locations + SortConstants::MSD_RADIX_LOCATIONS, swap);
 		return;
 	}
 	// Recurse
@@ -225,17 +245,38 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 	for (idx_t radix = 0; radix < SortConstants::VALUES_PER_RADIX; radix++) {
 		const idx_t loc = (locations[radix] - radix_count) * row_width;
 		if (radix_count > SortConstants::INSERTION_SORT_THRESHOLD) {
-			RadixSortMSD(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width, offset + 1,
-			             locations + SortConstants::MSD_RADIX_LOCATIONS, swap);
+			RadixSortMSD<ROW_WIDTH>(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width,
+			                        offset + 1, locations + SortConstants::MSD_RADIX_LOCATIONS, swap);
 		} else if (radix_count != 0) {
-			InsertionSort(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width, offset + 1,
-			              swap);
+			InsertionSort<ROW_WIDTH>(orig_ptr + loc, temp_ptr + loc, radix_count, col_offset, row_width, comp_width,
+			                         offset + 1, swap);
 		}
 		radix_count = locations[radix + 1] - locations[radix];
 	}
 }
 
 //! Calls different sort functions, depending on the count and sorting sizes
+template <idx_t ROW_WIDTH>
+static void TemplatedRadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count,
+                               const idx_t &col_offset, const idx_t &sorting_size, const SortLayout &sort_layout) {
+	if (count <= SortConstants::INSERTION_SORT_THRESHOLD) {
+		return InsertionSort<ROW_WIDTH>(dataptr, nullptr, count, col_offset, sort_layout.entry_size, sorting_size, 0,
+		                                false);
+	}
+
+	if (sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD) {
+		return TemplatedRadixSortLSD<ROW_WIDTH>(buffer_manager, dataptr, count, col_offset, sort_layout.entry_size,
+		                                        sorting_size);
+	}
+
+	const auto block_size = buffer_manager.GetBlockSize();
+	auto temp_block =
+	    buffer_manager.Allocate(MemoryTag::ORDER_BY, MaxValue(count * sort_layout.entry_size, block_size));
+	auto pre_allocated_array = make_unsafe_uniq_array<idx_t>(sorting_size * SortConstants::MSD_RADIX_LOCATIONS);
+	RadixSortMSD<ROW_WIDTH>(dataptr, temp_block.Ptr(), count, col_offset, sort_layout.entry_size, sorting_size, 0,
+	                        pre_allocated_array.get(), false);
+}
+
 void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                const idx_t &sorting_size, const SortLayout &sort_layout, bool contains_string) {
 
@@ -246,20 +287,22 @@ void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const i
 		return duckdb_pdqsort::pdqsort_branchless(begin, begin + count, constants);
 	}
 
-	if (count <= SortConstants::INSERTION_SORT_THRESHOLD) {
-		return InsertionSort(dataptr, nullptr, count, col_offset, sort_layout.entry_size, sorting_size, 0, false);
+	// A sorting entry is the normalized key followed by a 4-byte row index: these are the entry sizes of single
+	// fixed-width key columns (with and without a validity byte), which cover the bulk of ORDER BY queries
+	switch (sort_layout.entry_size) {
+	case 8:
+		return TemplatedRadixSort<8>(buffer_manager, dataptr, count, col_offset, sorting_size, sort_layout);
+	case 9:
+		return TemplatedRadixSort<9>(buffer_manager, dataptr, count, col_offset, sorting_size, sort_layout);
+	case 12:
+		return TemplatedRadixSort<12>(buffer_manager, dataptr, count, col_offset, sorting_size, sort_layout);
+	case 13:
+		return TemplatedRadixSort<13>(buffer_manager, dataptr, count, col_offset, sorting_size, sort_layout);
+	case 16:
+		return TemplatedRadixSort<16>(buffer_manager, dataptr, count, col_offset, sorting_size, sort_layout);
+	default:
+		return TemplatedRadixSort<0>(buffer_manager, dataptr, count, col_offset, sorting_size, sort_layout);
 	}
-
-	if (sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD) {
-		return RadixSortLSD(buffer_manager, dataptr, count, col_offset, sort_layout.entry_size, sorting_size);
-	}
-
-	const auto block_size = buffer_manager.GetBlockSize();
-	auto temp_block =
-	    buffer_manager.Allocate(MemoryTag::ORDER_BY, MaxValue(count * sort_layout.entry_size, block_size));
-	auto pre_allocated_array = make_unsafe_uniq_array<idx_t>(sorting_size * SortConstants::MSD_RADIX_LOCATIONS);
-	RadixSortMSD(dataptr, temp_block.Ptr(), count, col_offset, sort_layout.entry_size, sorting_size, 0,
-	             pre_allocated_array.get(), false);
 }
 
 //! Identifies sequences of rows that are tied, and calls radix sort on these
@@ -283,6 +326,22 @@ static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t da
 	}
 }
 
+//! Returns true if the radix sorting data is already in sorted order, in which case the sort can be skipped.
+//! If the keys contain variable-size columns, the prefixes must be strictly increasing:
+//! tied prefixes would still have to be broken by comparing the full keys.
+static bool RadixDataIsSorted(const data_ptr_t &dataptr, const idx_t &count, const SortLayout &sort_layout) {
+	const auto &entry_size = sort_layout.entry_size;
+	data_ptr_t entry_ptr = dataptr;
+	for (idx_t i = 1; i < count; i++) {
+		const auto comp = FastMemcmp(entry_ptr, entry_ptr + entry_size, sort_layout.comparison_size);
+		if (comp > 0 || (comp == 0 && !sort_layout.all_constant)) {
+			return false;
+		}
+		entry_ptr += entry_size;
+	}
+	return true;
+}
+
 void LocalSortState::SortInMemory() {
 	auto &sb = *sorted_blocks.back();
 	auto &block = *sb.radix_sorting_data.back();
@@ -295,6 +354,11 @@ void LocalSortState::SortInMemory() {
 		Store<uint32_t>(i, idx_dataptr);
 		idx_dataptr += sort_layout->entry_size;
 	}
+	// Nearly-sorted input is common: a single linear comparison pass over the normalized keys
+	// detects it and lets us feed the block straight to the merge phase
+	if (RadixDataIsSorted(dataptr, count, *sort_layout)) {
+		return;
+	}
 	// Radix sort and break ties until no more ties, or until all columns are sorted
 	idx_t sorting_size = 0;
 	idx_t col_offset = 0;
@@ -0,0 +1,10 @@
+#include "duckdb/common/thread_wait_times.hpp"
+
+namespace duckdb {
+
+ThreadWaitTimes &ThreadWaitTimes::Get() {
+	static thread_local ThreadWaitTimes wait_times;
+	return wait_times;
+}
+
+} // namespace duckdb
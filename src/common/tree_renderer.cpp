@@ -500,6 +500,23 @@ unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const ProfilingNode &op) {
 	result->extra_text += "\n" + to_string(op.GetProfilingInfo().metrics.operator_cardinality);
 	string timing = StringUtil::Format("%.2f", op.GetProfilingInfo().metrics.operator_timing);
 	result->extra_text += "\n(" + timing + "s)";
+	if (op.GetProfilingInfo().Enabled(MetricsType::OPERATOR_INSTRUCTIONS)) {
+		result->extra_text += "\n" + to_string(op.GetProfilingInfo().metrics.operator_instructions) + " instr";
+	}
+	if (op.GetProfilingInfo().Enabled(MetricsType::OPERATOR_LLC_MISSES)) {
+		result->extra_text += "\n" + to_string(op.GetProfilingInfo().metrics.operator_llc_misses) + " LLC misses";
+	}
+	if (op.GetProfilingInfo().Enabled(MetricsType::OPERATOR_BRANCH_MISSES)) {
+		result->extra_text += "\n" + to_string(op.GetProfilingInfo().metrics.operator_branch_misses) + " br misses";
+	}
+	if (op.GetProfilingInfo().Enabled(MetricsType::OPERATOR_IO_WAIT)) {
+		string io_wait = StringUtil::Format("%.2f", op.GetProfilingInfo().metrics.operator_io_wait);
+		result->extra_text += "\n(io_wait " + io_wait + "s)";
+	}
+	if (op.GetProfilingInfo().Enabled(MetricsType::OPERATOR_BUFFER_WAIT)) {
+		string buffer_wait = StringUtil::Format("%.2f", op.GetProfilingInfo().metrics.operator_buffer_wait);
+		result->extra_text += "\n(buffer_wait " + buffer_wait + "s)";
+	}
 	return result;
 }
 
@@ -224,6 +224,13 @@ void ColumnDataAllocator::DeleteBlock(uint32_t block_id) {
 	blocks[block_id].handle->SetCanDestroy(true);
 }
 
+void ColumnDataAllocator::SetRetentionHint(BlockRetentionHint hint) {
+	lock_guard<mutex> guard(lock);
+	for (auto &block : blocks) {
+		block.handle->SetRetentionHint(hint);
+	}
+}
+
 Allocator &ColumnDataAllocator::GetAllocator() {
 	return type == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR ? *alloc.allocator
 	                                                            : alloc.buffer_manager->GetBufferAllocator();
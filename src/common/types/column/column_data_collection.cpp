@@ -119,6 +119,12 @@ idx_t ColumnDataCollection::AllocationSize() const {
 	return total_size;
 }
 
+void ColumnDataCollection::SetRetentionHint(BlockRetentionHint hint) {
+	for (auto &segment : segments) {
+		segment->allocator->SetRetentionHint(hint);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // ColumnDataRow
 //===--------------------------------------------------------------------===//
@@ -143,15 +149,18 @@ ColumnDataRowCollection::ColumnDataRowCollection(const ColumnDataCollection &col
 	if (collection.Count() == 0) {
 		return;
 	}
-	// read all the chunks
-	ColumnDataScanState temp_scan_state;
-	collection.InitializeScan(temp_scan_state, ColumnDataScanProperties::DISALLOW_ZERO_COPY);
-	while (true) {
+	// hold on to the allocators so the blocks we reference stay alive for as long as the rows
+	// (combined collections can hold segments with different allocators)
+	for (auto &segment : collection.segments) {
+		allocators.push_back(segment->allocator);
+	}
+	// read all the chunks, referencing the underlying blocks directly and keeping them pinned
+	scan_state.current_chunk_state.properties = ColumnDataScanProperties::ALLOW_ZERO_COPY;
+	auto chunk_count = collection.ChunkCount();
+	for (idx_t chunk_idx = 0; chunk_idx < chunk_count; chunk_idx++) {
 		auto chunk = make_uniq<DataChunk>();
 		collection.InitializeScanChunk(*chunk);
-		if (!collection.Scan(temp_scan_state, *chunk)) {
-			break;
-		}
+		collection.FetchChunk(chunk_idx, *chunk, scan_state.current_chunk_state);
 		chunks.push_back(std::move(chunk));
 	}
 	// now create all of the column data rows
@@ -1001,6 +1010,24 @@ void ColumnDataCollection::FetchChunk(idx_t chunk_idx, DataChunk &result) const
 	throw InternalException("Failed to find chunk in ColumnDataCollection");
 }
 
+void ColumnDataCollection::FetchChunk(idx_t chunk_idx, DataChunk &result, ChunkManagementState &state) const {
+	D_ASSERT(chunk_idx < ChunkCount());
+	vector<column_t> column_ids;
+	column_ids.reserve(types.size());
+	for (idx_t i = 0; i < types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	for (auto &segment : segments) {
+		if (chunk_idx >= segment->ChunkCount()) {
+			chunk_idx -= segment->ChunkCount();
+		} else {
+			segment->FetchChunk(chunk_idx, result, column_ids, state);
+			return;
+		}
+	}
+	throw InternalException("Failed to find chunk in ColumnDataCollection");
+}
+
 //===--------------------------------------------------------------------===//
 // Helpers
 //===--------------------------------------------------------------------===//
@@ -275,6 +275,22 @@ void ColumnDataCollectionSegment::FetchChunk(idx_t chunk_idx, DataChunk &result,
 	ReadChunk(chunk_idx, state, result, column_ids);
 }
 
+void ColumnDataCollectionSegment::FetchChunk(idx_t chunk_idx, DataChunk &result, const vector<column_t> &column_ids,
+                                             ChunkManagementState &state) {
+	D_ASSERT(chunk_idx < chunk_data.size());
+	// read the chunk using a local state: InitializeChunkState releases pins that the current chunk does not
+	// reference, but the caller's state must keep the blocks of all previously fetched chunks pinned
+	ChunkManagementState chunk_state;
+	chunk_state.properties = ColumnDataScanProperties::ALLOW_ZERO_COPY;
+	ReadChunk(chunk_idx, chunk_state, result, column_ids);
+	// transfer the pins of this chunk into the caller's state
+	for (auto &handle : chunk_state.handles) {
+		if (state.handles.find(handle.first) == state.handles.end()) {
+			state.handles[handle.first] = std::move(handle.second);
+		}
+	}
+}
+
 void ColumnDataCollectionSegment::Verify() {
 #ifdef DEBUG
 	idx_t total_count = 0;
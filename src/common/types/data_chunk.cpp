@@ -19,7 +19,7 @@
 
 namespace duckdb {
 
-DataChunk::DataChunk() : count(0), capacity(STANDARD_VECTOR_SIZE) {
+DataChunk::DataChunk() : count(0), capacity(STANDARD_VECTOR_SIZE), vector_cache_capacity(STANDARD_VECTOR_SIZE) {
 }
 
 DataChunk::~DataChunk() {
@@ -51,6 +51,7 @@ void DataChunk::Initialize(Allocator &allocator, vector<LogicalType>::const_iter
 	D_ASSERT(data.empty());                   // can only be initialized once
 	D_ASSERT(std::distance(begin, end) != 0); // empty chunk not allowed
 	capacity = capacity_p;
+	vector_cache_capacity = capacity_p;
 	for (; begin != end; begin++) {
 		VectorCache cache(allocator, *begin, capacity);
 		data.emplace_back(cache);
@@ -82,7 +83,7 @@ void DataChunk::Reset() {
 	for (idx_t i = 0; i < ColumnCount(); i++) {
 		data[i].ResetFromCache(vector_caches[i]);
 	}
-	capacity = STANDARD_VECTOR_SIZE;
+	capacity = vector_cache_capacity;
 	SetCardinality(0);
 }
 
@@ -70,8 +70,50 @@ hash_t Hash(const char *str) {
 	return Hash(str, strlen(str));
 }
 
+//! Word-at-a-time equivalent of HashBytes for inlined strings, which are guaranteed to be zero-padded
+//! up to the inlined capacity (string equality comparisons rely on the same property).
+//! Must produce results identical to HashBytes
+static inline hash_t HashInlinedString(const string_t &val) noexcept {
+	static constexpr uint64_t M = UINT64_C(0xc6a4a7935bd1e995);
+	static constexpr uint64_t SEED = UINT64_C(0xe17a1465);
+	static constexpr unsigned int R = 47;
+
+	const uint64_t len = val.GetSize();
+	const auto data = const_data_ptr_cast(val.GetData());
+
+	uint64_t h = SEED ^ (len * M);
+
+	uint64_t tail;
+	if (len >= 8) {
+		auto k = Load<uint64_t>(data);
+		k *= M;
+		k ^= k >> R;
+		k *= M;
+		h ^= k;
+		h *= M;
+		// bytes [8, 12) of the inlined data, zero-padded past the length
+		tail = Load<uint64_t>(data + 4) >> 32U;
+	} else {
+		// all bytes fit in a single word, zero-padded past the length
+		tail = Load<uint64_t>(data);
+	}
+	if (len & 7U) {
+		h ^= tail;
+		h *= M;
+	}
+
+	h ^= h >> R;
+	h *= M;
+	h ^= h >> R;
+	return static_cast<hash_t>(h);
+}
+
 template <>
 hash_t Hash(string_t val) {
+	if (val.IsInlined()) {
+		// short-string fast path: whole words instead of the per-byte tail handling of HashBytes
+		return HashInlinedString(val);
+	}
 	return Hash(val.GetData(), val.GetSize());
 }
 
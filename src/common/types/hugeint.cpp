@@ -499,59 +499,6 @@ hugeint_t Hugeint::Modulo<false>(hugeint_t lhs, hugeint_t rhs) {
 	return remainder;
 }
 
-//===--------------------------------------------------------------------===//
-// Add/Subtract
-//===--------------------------------------------------------------------===//
-bool Hugeint::TryAddInPlace(hugeint_t &lhs, hugeint_t rhs) {
-	int overflow = lhs.lower + rhs.lower < lhs.lower;
-	if (rhs.upper >= 0) {
-		// RHS is positive: check for overflow
-		if (lhs.upper > (std::numeric_limits<int64_t>::max() - rhs.upper - overflow)) {
-			return false;
-		}
-		lhs.upper = lhs.upper + overflow + rhs.upper;
-	} else {
-		// RHS is negative: check for underflow
-		if (lhs.upper < std::numeric_limits<int64_t>::min() - rhs.upper - overflow) {
-			return false;
-		}
-		lhs.upper = lhs.upper + (overflow + rhs.upper);
-	}
-	lhs.lower += rhs.lower;
-	return true;
-}
-
-bool Hugeint::TrySubtractInPlace(hugeint_t &lhs, hugeint_t rhs) {
-	// underflow
-	int underflow = lhs.lower - rhs.lower > lhs.lower;
-	if (rhs.upper >= 0) {
-		// RHS is positive: check for underflow
-		if (lhs.upper < (std::numeric_limits<int64_t>::min() + rhs.upper + underflow)) {
-			return false;
-		}
-		lhs.upper = (lhs.upper - rhs.upper) - underflow;
-	} else {
-		// RHS is negative: check for overflow
-		if (lhs.upper > std::numeric_limits<int64_t>::min() &&
-		    lhs.upper - 1 >= (std::numeric_limits<int64_t>::max() + rhs.upper + underflow)) {
-			return false;
-		}
-		lhs.upper = lhs.upper - (rhs.upper + underflow);
-	}
-	lhs.lower -= rhs.lower;
-	return true;
-}
-
-template <>
-hugeint_t Hugeint::Add<false>(hugeint_t lhs, hugeint_t rhs) {
-	return lhs + rhs;
-}
-
-template <>
-hugeint_t Hugeint::Subtract<false>(hugeint_t lhs, hugeint_t rhs) {
-	return lhs - rhs;
-}
-
 //===--------------------------------------------------------------------===//
 // Hugeint Cast/Conversion
 //===--------------------------------------------------------------------===//
@@ -803,14 +750,6 @@ bool hugeint_t::operator>=(const hugeint_t &rhs) const {
 	return Hugeint::GreaterThanEquals(*this, rhs);
 }
 
-hugeint_t hugeint_t::operator+(const hugeint_t &rhs) const {
-	return hugeint_t(upper + rhs.upper + ((lower + rhs.lower) < lower), lower + rhs.lower);
-}
-
-hugeint_t hugeint_t::operator-(const hugeint_t &rhs) const {
-	return hugeint_t(upper - rhs.upper - ((lower - rhs.lower) > lower), lower - rhs.lower);
-}
-
 hugeint_t hugeint_t::operator*(const hugeint_t &rhs) const {
 	hugeint_t result = *this;
 	result *= rhs;
@@ -905,14 +844,6 @@ hugeint_t hugeint_t::operator~() const {
 	return result;
 }
 
-hugeint_t &hugeint_t::operator+=(const hugeint_t &rhs) {
-	*this = *this + rhs;
-	return *this;
-}
-hugeint_t &hugeint_t::operator-=(const hugeint_t &rhs) {
-	*this = *this - rhs;
-	return *this;
-}
 hugeint_t &hugeint_t::operator*=(const hugeint_t &rhs) {
 	*this = Hugeint::Multiply<false>(*this, rhs);
 	return *this;
@@ -48,6 +48,13 @@ unique_ptr<HyperLogLog> HyperLogLog::Merge(HyperLogLog &other) {
 	return unique_ptr<HyperLogLog>(new HyperLogLog(new_hll));
 }
 
+void HyperLogLog::MergeInPlace(HyperLogLog &other) {
+	// both counters are always dense (see the constructor), so we can max the registers in-place
+	if (duckdb_hll::hll_merge_dense(hll, other.hll) != HLL_C_OK) {
+		throw InternalException("Could not merge HLLs");
+	}
+}
+
 HyperLogLog *HyperLogLog::MergePointer(HyperLogLog &other) {
 	duckdb_hll::robj *hlls[2];
 	hlls[0] = hll;
@@ -197,11 +197,14 @@ void PartitionedTupleData::BuildPartitionSel(PartitionedTupleDataAppendState &st
 		for (idx_t i = 0; i < append_count; i++) {
 			const auto index = append_sel.get_index(i);
 			const auto &partition_index = partition_indices[index];
-			auto partition_entry = partition_entries.find(partition_index);
-			if (partition_entry == partition_entries.end()) {
-				partition_entries[partition_index] = list_entry_t(0, 1);
+			// single probe per row: operator[] inserts the entry if it was not there yet,
+			// which we detect through the map size
+			const auto size_before = partition_entries.size();
+			auto &partition_entry = partition_entries[partition_index];
+			if (partition_entries.size() != size_before) {
+				partition_entry = list_entry_t(0, 1);
 			} else {
-				GETTER::GetValue(partition_entry).length++;
+				partition_entry.length++;
 			}
 		}
 		break;
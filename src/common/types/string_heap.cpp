@@ -49,6 +49,49 @@ string_t StringHeap::AddBlob(const string_t &data) {
 	return AddBlob(data.GetData(), data.GetSize());
 }
 
+void StringHeap::AddBlobs(const string_t *source, const SelectionVector &sel, idx_t offset, string_t *targets,
+                          idx_t count) {
+	// compute the combined payload size of the strings that are not inlined
+	idx_t total_size = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto &str = source[sel.get_index(offset + i)];
+		if (!str.IsInlined()) {
+			total_size += str.GetSize();
+		}
+	}
+	if (total_size == 0) {
+		// all strings are inlined - no heap space required
+		for (idx_t i = 0; i < count; i++) {
+			targets[i] = source[sel.get_index(offset + i)];
+		}
+		return;
+	}
+	if (total_size > string_t::MAX_STRING_SIZE) {
+		// the combined payload could overflow a single string - verify the sizes individually
+		for (idx_t i = 0; i < count; i++) {
+			auto &str = source[sel.get_index(offset + i)];
+			if (str.GetSize() > string_t::MAX_STRING_SIZE) {
+				throw OutOfRangeException(
+				    "Cannot create a string of size: '%d', the maximum supported string size is: '%d'", str.GetSize(),
+				    string_t::MAX_STRING_SIZE);
+			}
+		}
+	}
+	// reserve the combined payload once, then copy the data and patch the string pointers in a tight loop
+	auto insert_pos = char_ptr_cast(allocator.Allocate(total_size));
+	for (idx_t i = 0; i < count; i++) {
+		auto &str = source[sel.get_index(offset + i)];
+		if (str.IsInlined()) {
+			targets[i] = str;
+			continue;
+		}
+		auto len = str.GetSize();
+		memcpy(insert_pos, str.GetData(), len);
+		targets[i] = string_t(insert_pos, UnsafeNumericCast<uint32_t>(len));
+		insert_pos += len;
+	}
+}
+
 string_t StringHeap::EmptyString(idx_t len) {
 	D_ASSERT(len > string_t::INLINE_LENGTH);
 	if (len > string_t::MAX_STRING_SIZE) {
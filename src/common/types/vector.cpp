@@ -1923,6 +1923,17 @@ string_t StringVector::AddStringOrBlob(Vector &vector, string_t data) {
 	return string_buffer.AddBlob(data);
 }
 
+void StringVector::AddStringsOrBlobs(Vector &vector, const string_t *source, const SelectionVector &sel, idx_t offset,
+                                     string_t *targets, idx_t count) {
+	D_ASSERT(vector.GetType().InternalType() == PhysicalType::VARCHAR);
+	if (!vector.auxiliary) {
+		vector.auxiliary = make_buffer<VectorStringBuffer>();
+	}
+	D_ASSERT(vector.auxiliary->GetBufferType() == VectorBufferType::STRING_BUFFER);
+	auto &string_buffer = vector.auxiliary->Cast<VectorStringBuffer>();
+	string_buffer.AddBlobs(source, sel, offset, targets, count);
+}
+
 string_t StringVector::EmptyString(Vector &vector, idx_t len) {
 	D_ASSERT(vector.GetType().InternalType() == PhysicalType::VARCHAR);
 	if (len <= string_t::INLINE_LENGTH) {
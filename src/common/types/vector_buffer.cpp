@@ -73,7 +73,8 @@ void VectorListBuffer::Reserve(idx_t to_reserve) {
 			new_capacity = to_reserve;
 		}
 		D_ASSERT(new_capacity >= to_reserve);
-		child->Resize(capacity, new_capacity);
+		// only the entries up to "size" hold data - growing the child does not have to copy the slack beyond that
+		child->Resize(size, new_capacity);
 		capacity = new_capacity;
 	}
 }
@@ -92,10 +93,7 @@ void VectorListBuffer::Append(const Vector &to_append, const SelectionVector &se
 }
 
 void VectorListBuffer::PushBack(const Value &insert) {
-	while (size + 1 > capacity) {
-		child->Resize(capacity, capacity * 2);
-		capacity *= 2;
-	}
+	Reserve(size + 1);
 	child->SetValue(size++, insert);
 }
 
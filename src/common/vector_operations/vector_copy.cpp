@@ -158,11 +158,16 @@ void VectorOperations::Copy(const Vector &source_p, Vector &target, const Select
 	case PhysicalType::VARCHAR: {
 		auto ldata = FlatVector::GetData<string_t>(*source);
 		auto tdata = FlatVector::GetData<string_t>(target);
-		for (idx_t i = 0; i < copy_count; i++) {
-			auto source_idx = sel->get_index(source_offset + i);
-			auto target_idx = target_offset + i;
-			if (tmask.RowIsValid(target_idx)) {
-				tdata[target_idx] = StringVector::AddStringOrBlob(target, ldata[source_idx]);
+		if (tmask.AllValid()) {
+			// no NULL values: add all strings to the heap in one go
+			StringVector::AddStringsOrBlobs(target, ldata, *sel, source_offset, tdata + target_offset, copy_count);
+		} else {
+			for (idx_t i = 0; i < copy_count; i++) {
+				auto source_idx = sel->get_index(source_offset + i);
+				auto target_idx = target_offset + i;
+				if (tmask.RowIsValid(target_idx)) {
+					tdata[target_idx] = StringVector::AddStringOrBlob(target, ldata[source_idx]);
+				}
 			}
 		}
 		break;
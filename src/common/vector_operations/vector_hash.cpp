@@ -61,6 +61,50 @@ static inline void TemplatedLoopHash(Vector &input, Vector &result, const Select
 	}
 }
 
+//! Find the highest dictionary index referenced by the input rows, or DConstants::INVALID_INDEX if hashing
+//! through the dictionary is not worthwhile (i.e. the dictionary is not any smaller than the input itself)
+template <bool HAS_RSEL>
+static inline idx_t GetReferencedDictionarySize(const UnifiedVectorFormat &idata, const SelectionVector *rsel,
+                                                idx_t count) {
+	idx_t max_index = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		max_index = MaxValue<idx_t>(max_index, idata.sel->get_index(ridx));
+	}
+	if (max_index >= count || max_index >= STANDARD_VECTOR_SIZE) {
+		return DConstants::INVALID_INDEX;
+	}
+	return max_index + 1;
+}
+
+//! Hash each distinct dictionary string once, then fan the hashes out over the rows.
+//! Dictionary vectors over strings are common (e.g. scans of dictionary-compressed columns), and for those
+//! hashing the small dictionary beats hashing every row's string.
+template <bool HAS_RSEL>
+static inline void DictionaryStringLoopHash(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
+	D_ASSERT(input.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	UnifiedVectorFormat idata;
+	input.ToUnifiedFormat(count, idata);
+	auto ldata = UnifiedVectorFormat::GetData<string_t>(idata);
+	auto result_data = FlatVector::GetData<hash_t>(result);
+
+	auto dict_count = GetReferencedDictionarySize<HAS_RSEL>(idata, rsel, count);
+	if (dict_count == DConstants::INVALID_INDEX) {
+		TightLoopHash<HAS_RSEL, string_t>(ldata, result_data, rsel, count, idata.sel, idata.validity);
+		return;
+	}
+	hash_t dict_hashes[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < dict_count; i++) {
+		dict_hashes[i] = HashOp::Operation(ldata[i], !idata.validity.RowIsValid(i));
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		result_data[ridx] = dict_hashes[idata.sel->get_index(ridx)];
+	}
+}
+
 template <bool HAS_RSEL, bool FIRST_HASH>
 static inline void StructLoopHash(Vector &input, Vector &hashes, const SelectionVector *rsel, idx_t count) {
 	auto &children = StructVector::GetEntries(input);
@@ -291,7 +335,11 @@ static inline void HashTypeSwitch(Vector &input, Vector &result, const Selection
 		TemplatedLoopHash<HAS_RSEL, interval_t>(input, result, rsel, count);
 		break;
 	case PhysicalType::VARCHAR:
-		TemplatedLoopHash<HAS_RSEL, string_t>(input, result, rsel, count);
+		if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+			DictionaryStringLoopHash<HAS_RSEL>(input, result, rsel, count);
+		} else {
+			TemplatedLoopHash<HAS_RSEL, string_t>(input, result, rsel, count);
+		}
 		break;
 	case PhysicalType::STRUCT:
 		StructLoopHash<HAS_RSEL, true>(input, result, rsel, count);
@@ -385,6 +433,45 @@ void TemplatedLoopCombineHash(Vector &input, Vector &hashes, const SelectionVect
 	}
 }
 
+//! CombineHash counterpart of DictionaryStringLoopHash
+template <bool HAS_RSEL>
+static inline void DictionaryStringLoopCombineHash(Vector &input, Vector &hashes, const SelectionVector *rsel,
+                                                   idx_t count) {
+	D_ASSERT(input.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+
+	UnifiedVectorFormat idata;
+	input.ToUnifiedFormat(count, idata);
+	auto ldata = UnifiedVectorFormat::GetData<string_t>(idata);
+
+	auto dict_count = GetReferencedDictionarySize<HAS_RSEL>(idata, rsel, count);
+	if (dict_count == DConstants::INVALID_INDEX) {
+		TemplatedLoopCombineHash<HAS_RSEL, string_t>(input, hashes, rsel, count);
+		return;
+	}
+	hash_t dict_hashes[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < dict_count; i++) {
+		dict_hashes[i] = HashOp::Operation(ldata[i], !idata.validity.RowIsValid(i));
+	}
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		// mix constant with non-constant, first get the constant value
+		auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
+		// now re-initialize the hashes vector to an empty flat vector
+		hashes.SetVectorType(VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(constant_hash, dict_hashes[idata.sel->get_index(ridx)]);
+		}
+	} else {
+		D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			hash_data[ridx] = CombineHashScalar(hash_data[ridx], dict_hashes[idata.sel->get_index(ridx)]);
+		}
+	}
+}
+
 template <bool HAS_RSEL>
 static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const SelectionVector *rsel, idx_t count) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
@@ -430,7 +517,11 @@ static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const Se
 		TemplatedLoopCombineHash<HAS_RSEL, interval_t>(input, hashes, rsel, count);
 		break;
 	case PhysicalType::VARCHAR:
-		TemplatedLoopCombineHash<HAS_RSEL, string_t>(input, hashes, rsel, count);
+		if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+			DictionaryStringLoopCombineHash<HAS_RSEL>(input, hashes, rsel, count);
+		} else {
+			TemplatedLoopCombineHash<HAS_RSEL, string_t>(input, hashes, rsel, count);
+		}
 		break;
 	case PhysicalType::STRUCT:
 		StructLoopHash<HAS_RSEL, false>(input, hashes, rsel, count);
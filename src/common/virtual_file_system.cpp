@@ -50,6 +50,10 @@ void VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes,
 	handle.file_system.Read(handle, buffer, nr_bytes, location);
 }
 
+void VirtualFileSystem::ReadBatch(FileHandle &handle, vector<ReadRequest> &requests) {
+	handle.file_system.ReadBatch(handle, requests);
+}
+
 void VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	handle.file_system.Write(handle, buffer, nr_bytes, location);
 }
@@ -57,6 +57,12 @@ struct ApproximateQuantileBindData : public FunctionData {
 struct ApproxQuantileOperation {
 	using SAVE_TYPE = duckdb_tdigest::Value;
 
+	//! Accuracy/size trade-off of the sketch - the number of centroids kept is roughly twice this
+	static constexpr duckdb_tdigest::Value COMPRESSION = 100;
+	//! Size of the insertion buffer - the t-digest default of 8x the compression dominates the per-group
+	//! memory footprint, so we use a smaller buffer at the cost of slightly more frequent merges
+	static constexpr duckdb_tdigest::Index BUFFER_SIZE = 256;
+
 	template <class STATE>
 	static void Initialize(STATE &state) {
 		state.pos = 0;
@@ -66,9 +72,16 @@ struct ApproxQuantileOperation {
 	template <class INPUT_TYPE, class STATE, class OP>
 	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
 	                              idx_t count) {
-		for (idx_t i = 0; i < count; i++) {
-			Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		auto val = Cast::template Operation<INPUT_TYPE, SAVE_TYPE>(input);
+		if (!Value::DoubleIsFinite(val)) {
+			return;
+		}
+		if (!state.h) {
+			state.h = new duckdb_tdigest::TDigest(COMPRESSION, BUFFER_SIZE);
 		}
+		// a constant vector collapses into a single weighted centroid
+		state.h->add(val, duckdb_tdigest::Weight(count));
+		state.pos += count;
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
@@ -78,7 +91,7 @@ struct ApproxQuantileOperation {
 			return;
 		}
 		if (!state.h) {
-			state.h = new duckdb_tdigest::TDigest(100);
+			state.h = new duckdb_tdigest::TDigest(COMPRESSION, BUFFER_SIZE);
 		}
 		state.h->add(val);
 		state.pos++;
@@ -91,7 +104,7 @@ struct ApproxQuantileOperation {
 		}
 		D_ASSERT(source.h);
 		if (!target.h) {
-			target.h = new duckdb_tdigest::TDigest(100);
+			target.h = new duckdb_tdigest::TDigest(COMPRESSION, BUFFER_SIZE);
 		}
 		target.h->merge(source.h);
 		target.pos += source.pos;
@@ -819,7 +819,8 @@ void DecodeSortKeyList(DecodeSortKeyData &decode_data, SortKeyVectorData &vector
 	// loop until we find the list delimiter
 	while (decode_data.data[decode_data.position] != list_delimiter) {
 		// found a valid entry here - decode it
-		// first reserve space for it
+		// first reserve space for it, keeping the size current so the decoded entries survive the resize
+		ListVector::SetListSize(result, new_list_size);
 		new_list_size++;
 		ListVector::Reserve(result, new_list_size);
 
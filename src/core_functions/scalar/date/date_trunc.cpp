@@ -25,6 +25,15 @@ struct DateTrunc {
 		UnaryExecutor::Execute<TA, TR>(left, result, count, UnaryFunction<TA, TR, OP>);
 	}
 
+	//! Truncate a timestamp to a multiple of "unit" microseconds, rounding towards -infinity.
+	//! Every caller passes a constant unit, so the division compiles to a multiply-shift.
+	static inline timestamp_t TruncateToUnit(timestamp_t input, int64_t unit) {
+		int64_t remainder = input.value % unit;
+		// the remainder of integer division rounds towards zero - compensate for negative timestamps
+		remainder += unit & -int64_t(remainder < 0);
+		return timestamp_t(input.value - remainder);
+	}
+
 	struct MillenniumOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
@@ -66,7 +75,9 @@ struct DateTrunc {
 	struct MonthOperator {
 		template <class TA, class TR>
 		static inline TR Operation(TA input) {
-			return Date::FromDate(Date::ExtractYear(input), Date::ExtractMonth(input), 1);
+			int32_t yyyy, mm, dd;
+			Date::Convert(input, yyyy, mm, dd);
+			return Date::FromDate(yyyy, mm, 1);
 		}
 	};
 
@@ -284,7 +295,7 @@ timestamp_t DateTrunc::DayOperator::Operation(date_t input) {
 
 template <>
 timestamp_t DateTrunc::DayOperator::Operation(timestamp_t input) {
-	return DayOperator::Operation<date_t, timestamp_t>(Timestamp::GetDate(input));
+	return TruncateToUnit(input, Interval::MICROS_PER_DAY);
 }
 
 template <>
@@ -297,11 +308,21 @@ timestamp_t DateTrunc::HourOperator::Operation(date_t input) {
 	return DayOperator::Operation<date_t, timestamp_t>(input);
 }
 
+template <>
+timestamp_t DateTrunc::HourOperator::Operation(timestamp_t input) {
+	return TruncateToUnit(input, Interval::MICROS_PER_HOUR);
+}
+
 template <>
 date_t DateTrunc::HourOperator::Operation(timestamp_t input) {
 	return Timestamp::GetDate(HourOperator::Operation<timestamp_t, timestamp_t>(input));
 }
 
+template <>
+timestamp_t DateTrunc::MinuteOperator::Operation(timestamp_t input) {
+	return TruncateToUnit(input, Interval::MICROS_PER_MINUTE);
+}
+
 template <>
 date_t DateTrunc::MinuteOperator::Operation(date_t input) {
 	return DayOperator::Operation<date_t, date_t>(input);
@@ -317,6 +338,11 @@ date_t DateTrunc::MinuteOperator::Operation(timestamp_t input) {
 	return Timestamp::GetDate(HourOperator::Operation<timestamp_t, timestamp_t>(input));
 }
 
+template <>
+timestamp_t DateTrunc::SecondOperator::Operation(timestamp_t input) {
+	return TruncateToUnit(input, Interval::MICROS_PER_SEC);
+}
+
 template <>
 date_t DateTrunc::SecondOperator::Operation(date_t input) {
 	return DayOperator::Operation<date_t, date_t>(input);
@@ -332,6 +358,11 @@ date_t DateTrunc::SecondOperator::Operation(timestamp_t input) {
 	return Timestamp::GetDate(DayOperator::Operation<timestamp_t, timestamp_t>(input));
 }
 
+template <>
+timestamp_t DateTrunc::MillisecondOperator::Operation(timestamp_t input) {
+	return TruncateToUnit(input, Interval::MICROS_PER_MSEC);
+}
+
 template <>
 date_t DateTrunc::MillisecondOperator::Operation(date_t input) {
 	return DayOperator::Operation<date_t, date_t>(input);
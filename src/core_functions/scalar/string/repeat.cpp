@@ -59,6 +59,8 @@ static void RepeatListFunction(DataChunk &args, ExpressionState &, Vector &resul
 		    idx_t copy_count = cnt <= 0 || list_input.length == 0 ? 0 : UnsafeNumericCast<idx_t>(cnt);
 		    idx_t result_length = list_input.length * copy_count;
 		    idx_t new_size = current_size + result_length;
+		    // set the size before growing so the entries of the previous rows are carried over to the resized child
+		    ListVector::SetListSize(result, current_size);
 		    ListVector::Reserve(result, new_size);
 		    list_entry_t result_list;
 		    result_list.offset = current_size;
@@ -4,6 +4,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "utf8proc.hpp"
+#include "utf8proc_wrapper.hpp"
 
 #include <string.h>
 
@@ -16,6 +17,28 @@ struct TrimOperator {
 		auto data = input.GetData();
 		auto size = input.GetSize();
 
+		if (Utf8Proc::IsAscii(data, size)) {
+			// fast path: the only ASCII character in the Unicode space separator category is the space itself,
+			// so we can scan the (relevant) ends of the string directly instead of decoding every codepoint
+			idx_t begin = 0;
+			idx_t end = size;
+			if (LTRIM) {
+				while (begin < size && data[begin] == ' ') {
+					begin++;
+				}
+			}
+			if (RTRIM) {
+				while (end > begin && data[end - 1] == ' ') {
+					end--;
+				}
+			}
+			auto target = StringVector::EmptyString(result, end - begin);
+			auto output = target.GetDataWriteable();
+			memcpy(output, data + begin, end - begin);
+			target.Finalize();
+			return target;
+		}
+
 		utf8proc_int32_t codepoint;
 		auto str = reinterpret_cast<const utf8proc_uint8_t *>(data);
 
@@ -1,12 +1,14 @@
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/pair.hpp"
 #include "duckdb/common/vector.hpp"
 
 namespace duckdb {
 
 AdaptiveFilter::AdaptiveFilter(const Expression &expr)
-    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true), observation_count(0) {
 	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
 	D_ASSERT(conj_expr.children.size() > 1);
 	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
@@ -19,14 +21,61 @@ AdaptiveFilter::AdaptiveFilter(const Expression &expr)
 }
 
 AdaptiveFilter::AdaptiveFilter(TableFilterSet *table_filters)
-    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true) {
+    : iteration_count(0), observe_interval(10), execute_interval(20), warmup(true), observation_count(0) {
 	for (auto &table_filter : table_filters->filters) {
 		permutation.push_back(table_filter.first);
 		swap_likeliness.push_back(100);
+		FilterStats stats;
+		stats.filter_idx = table_filter.first;
+		filter_stats.push_back(stats);
 	}
 	swap_likeliness.pop_back();
 	right_random_border = 100 * (table_filters->filters.size() - 1);
 }
+
+void AdaptiveFilter::ObserveFilter(idx_t filter_idx, idx_t input_count, idx_t output_count, double duration) {
+	for (auto &stats : filter_stats) {
+		if (stats.filter_idx == filter_idx) {
+			stats.observed_count += double(input_count);
+			stats.passed_count += double(output_count);
+			stats.time += duration;
+			return;
+		}
+	}
+}
+
+void AdaptiveFilter::AdaptTableFilterOrder() {
+	if (filter_stats.size() <= 1) {
+		return;
+	}
+	if (++observation_count < REORDER_INTERVAL) {
+		return;
+	}
+	observation_count = 0;
+	// order the filters by rank = cost per tuple / fraction of tuples filtered out, so that cheap and selective
+	// filters run first; this minimizes the expected total filtering cost for independent filters
+	vector<pair<double, idx_t>> ranks;
+	for (auto &stats : filter_stats) {
+		double rank = 0;
+		if (stats.observed_count > 0) {
+			auto selectivity = stats.passed_count / stats.observed_count;
+			auto cost = stats.time / stats.observed_count;
+			rank = cost / MaxValue<double>(1.0 - selectivity, 0.001);
+		}
+		ranks.emplace_back(rank, stats.filter_idx);
+	}
+	std::stable_sort(ranks.begin(), ranks.end(),
+	                 [](const pair<double, idx_t> &a, const pair<double, idx_t> &b) { return a.first < b.first; });
+	for (idx_t i = 0; i < ranks.size(); i++) {
+		permutation[i] = ranks[i].second;
+	}
+	// decay the history so the ordering keeps adapting when the data distribution changes
+	for (auto &stats : filter_stats) {
+		stats.observed_count /= 2;
+		stats.passed_count /= 2;
+		stats.time /= 2;
+	}
+}
 void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
 	iteration_count++;
 	runtime_sum += duration;
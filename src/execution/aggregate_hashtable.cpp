@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/null_value.hpp"
@@ -72,6 +73,7 @@ void GroupedAggregateHashTable::InitializePartitionedData() {
 	D_ASSERT(GetLayout().GetRowWidth() == layout.GetRowWidth());
 
 	partitioned_data->InitializeAppendState(state.append_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	last_group.is_set = false;
 }
 
 unique_ptr<PartitionedTupleData> &GroupedAggregateHashTable::GetPartitionedData() {
@@ -156,6 +158,8 @@ void GroupedAggregateHashTable::Verify() {
 
 void GroupedAggregateHashTable::ClearPointerTable() {
 	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
+	// the pointer table is cleared when the data is moved out of this HT, so the cached group row may dangle
+	last_group.is_set = false;
 }
 
 void GroupedAggregateHashTable::ResetCount() {
@@ -246,7 +250,14 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	}
 #endif
 
-	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+	idx_t new_group_count;
+	if (TryUseCachedGroup(groups, group_hashes, state.addresses)) {
+		// every row in this chunk belongs to the same group as the previous chunk - the probe was skipped entirely
+		new_group_count = 0;
+	} else {
+		new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+		UpdateCachedGroup(groups, group_hashes);
+	}
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
@@ -281,6 +292,53 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	return new_group_count;
 }
 
+bool GroupedAggregateHashTable::TryUseCachedGroup(DataChunk &groups, Vector &group_hashes_v, Vector &addresses_v) {
+	if (!last_group.is_set) {
+		return false;
+	}
+	const auto chunk_size = groups.size();
+
+	UnifiedVectorFormat hash_data;
+	group_hashes_v.ToUnifiedFormat(chunk_size, hash_data);
+	auto hashes = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+	for (idx_t i = 0; i < chunk_size; i++) {
+		if (hashes[hash_data.sel->get_index(i)] != last_group.hash) {
+			// on input that is not clustered on the group columns this almost always exits on the first row
+			return false;
+		}
+	}
+
+	// all hashes match the cached group - verify that the group values themselves match too
+	for (idx_t col_idx = 0; col_idx < groups.ColumnCount(); col_idx++) {
+		Vector cached_key(last_group.key[col_idx]);
+		if (VectorOperations::NotDistinctFrom(groups.data[col_idx], cached_key, nullptr, chunk_size, nullptr,
+		                                      nullptr) != chunk_size) {
+			// hash collision between different group keys
+			return false;
+		}
+	}
+
+	// the entire chunk belongs to the cached group - fill in its row pointer directly
+	addresses_v.SetVectorType(VectorType::FLAT_VECTOR);
+	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
+	for (idx_t i = 0; i < chunk_size; i++) {
+		addresses[i] = last_group.address;
+	}
+	return true;
+}
+
+void GroupedAggregateHashTable::UpdateCachedGroup(DataChunk &groups, Vector &group_hashes_v) {
+	// FindOrCreateGroups flattened the hashes and addresses
+	const auto last_idx = groups.size() - 1;
+	last_group.is_set = true;
+	last_group.hash = FlatVector::GetData<hash_t>(group_hashes_v)[last_idx];
+	last_group.address = FlatVector::GetData<data_ptr_t>(state.addresses)[last_idx];
+	last_group.key.clear();
+	for (idx_t col_idx = 0; col_idx < groups.ColumnCount(); col_idx++) {
+		last_group.key.push_back(groups.GetValue(col_idx, last_idx));
+	}
+}
+
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
 #ifdef DEBUG
 	groups.Verify();
@@ -328,6 +386,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 
 	// Compute the entry in the table based on the hash using a modulo,
 	// and precompute the hash salts for faster comparison below
+	// also prefetch the entry slots: for high-cardinality aggregates the table does not fit in cache, so issuing
+	// the prefetches a full pass ahead lets the misses of the probe loop below overlap instead of serializing
 	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
 	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
 	for (idx_t r = 0; r < groups.size(); r++) {
@@ -335,6 +395,7 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 		ht_offsets[r] = ApplyBitMask(hash);
 		D_ASSERT(ht_offsets[r] == hash % capacity);
 		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
+		DUCKDB_PREFETCH_READ(entries + ht_offsets[r]);
 	}
 
 	// we start out with all entries [0, 1, 2, ..., groups.size()]
@@ -424,11 +485,13 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 		}
 
 		if (need_compare_count != 0) {
-			// Get the pointers to the rows that need to be compared
+			// Get the pointers to the rows that need to be compared,
+			// prefetching the rows so the group comparison does not stall on the data-dependent loads
 			for (idx_t need_compare_idx = 0; need_compare_idx < need_compare_count; need_compare_idx++) {
 				const auto index = state.group_compare_vector.get_index(need_compare_idx);
 				const auto &entry = entries[ht_offsets[index]];
 				addresses[index] = entry.GetPointer();
+				DUCKDB_PREFETCH_READ(addresses[index]);
 			}
 
 			// Perform group comparisons
@@ -436,13 +499,15 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 			                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
 		}
 
-		// Linear probing: each of the entries that do not match move to the next entry in the HT
+		// Linear probing: each of the entries that do not match move to the next entry in the HT,
+		// prefetching the next entry so it is (being) loaded by the time the next iteration reads it
 		for (idx_t i = 0; i < no_match_count; i++) {
 			const auto index = state.no_match_vector.get_index(i);
 			auto &ht_offset = ht_offsets[index];
 			if (++ht_offset >= capacity) {
 				ht_offset = 0;
 			}
+			DUCKDB_PREFETCH_READ(entries + ht_offset);
 		}
 		sel_vector = &state.no_match_vector;
 		remaining_entries = no_match_count;
@@ -556,6 +621,8 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 void GroupedAggregateHashTable::UnpinData() {
 	partitioned_data->FlushAppendState(state.append_state);
 	partitioned_data->Unpin();
+	// the cached group row may be unpinned now
+	last_group.is_set = false;
 }
 
 } // namespace duckdb
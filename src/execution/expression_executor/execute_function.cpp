@@ -1,3 +1,6 @@
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
@@ -10,11 +13,64 @@ ExecuteFunctionState::ExecuteFunctionState(const Expression &expr, ExpressionExe
 ExecuteFunctionState::~ExecuteFunctionState() {
 }
 
+//! Whether or not an operation can participate in a fused loop: only plain floating point
+//! +, - and * qualify, since those are free of overflow checks and extra function state
+static bool IsFusableFunction(const BoundFunctionExpression &expr) {
+	if (expr.children.size() != 2) {
+		return false;
+	}
+	auto physical_type = expr.return_type.InternalType();
+	if (physical_type != PhysicalType::FLOAT && physical_type != PhysicalType::DOUBLE) {
+		return false;
+	}
+	if (expr.function.name != "+" && expr.function.name != "-" && expr.function.name != "*") {
+		return false;
+	}
+	if (expr.function.init_local_state || expr.bind_info) {
+		return false;
+	}
+	if (expr.function.null_handling != FunctionNullHandling::DEFAULT_NULL_HANDLING) {
+		return false;
+	}
+	for (auto &child : expr.children) {
+		if (child->return_type != expr.return_type) {
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<ExecuteFunctionState>(expr, root);
-	for (auto &child : expr.children) {
-		result->AddChild(child.get());
+	if (IsFusableFunction(expr)) {
+		// try to fuse a child operation into this function's loop, so that e.g. a * b + c runs as a single
+		// loop over three inputs instead of materializing an intermediate vector for a * b
+		for (idx_t child_idx = 0; child_idx < expr.children.size(); child_idx++) {
+			auto &child = *expr.children[child_idx];
+			if (child.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+				continue;
+			}
+			auto &child_function = child.Cast<BoundFunctionExpression>();
+			if (!IsFusableFunction(child_function)) {
+				continue;
+			}
+			result->fused_child = &child_function;
+			result->fused_child_index = child_idx;
+			break;
+		}
+	}
+	if (result->fused_child) {
+		// the operands of the fused child are evaluated directly into this state's intermediate chunk,
+		// followed by the remaining child of this function
+		for (auto &child : result->fused_child->children) {
+			result->AddChild(child.get());
+		}
+		result->AddChild(expr.children[1 - result->fused_child_index].get());
+	} else {
+		for (auto &child : expr.children) {
+			result->AddChild(child.get());
+		}
 	}
 	result->Finalize();
 	if (expr.function.init_local_state) {
@@ -56,8 +112,110 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 #endif
 }
 
+template <class T, class INNER_OP, class OUTER_OP, bool FUSED_LEFT>
+static void TernaryFusedLoop(Vector &x, Vector &y, Vector &z, Vector &result, idx_t count) {
+	UnifiedVectorFormat xdata, ydata, zdata;
+	x.ToUnifiedFormat(count, xdata);
+	y.ToUnifiedFormat(count, ydata);
+	z.ToUnifiedFormat(count, zdata);
+	auto x_ptr = UnifiedVectorFormat::GetData<T>(xdata);
+	auto y_ptr = UnifiedVectorFormat::GetData<T>(ydata);
+	auto z_ptr = UnifiedVectorFormat::GetData<T>(zdata);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	if (xdata.validity.AllValid() && ydata.validity.AllValid() && zdata.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			auto inner = INNER_OP::template Operation<T, T, T>(x_ptr[xdata.sel->get_index(i)],
+			                                                   y_ptr[ydata.sel->get_index(i)]);
+			auto other = z_ptr[zdata.sel->get_index(i)];
+			result_data[i] = FUSED_LEFT ? OUTER_OP::template Operation<T, T, T>(inner, other)
+			                            : OUTER_OP::template Operation<T, T, T>(other, inner);
+		}
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto x_idx = xdata.sel->get_index(i);
+		auto y_idx = ydata.sel->get_index(i);
+		auto z_idx = zdata.sel->get_index(i);
+		if (!xdata.validity.RowIsValid(x_idx) || !ydata.validity.RowIsValid(y_idx) ||
+		    !zdata.validity.RowIsValid(z_idx)) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		auto inner = INNER_OP::template Operation<T, T, T>(x_ptr[x_idx], y_ptr[y_idx]);
+		result_data[i] = FUSED_LEFT ? OUTER_OP::template Operation<T, T, T>(inner, z_ptr[z_idx])
+		                            : OUTER_OP::template Operation<T, T, T>(z_ptr[z_idx], inner);
+	}
+}
+
+template <class T, class INNER_OP, class OUTER_OP>
+static void FusedLoopSwitchSide(bool fused_left, Vector &x, Vector &y, Vector &z, Vector &result, idx_t count) {
+	if (fused_left) {
+		TernaryFusedLoop<T, INNER_OP, OUTER_OP, true>(x, y, z, result, count);
+	} else {
+		TernaryFusedLoop<T, INNER_OP, OUTER_OP, false>(x, y, z, result, count);
+	}
+}
+
+template <class T, class INNER_OP>
+static void FusedLoopSwitchOuter(const string &outer_name, bool fused_left, Vector &x, Vector &y, Vector &z,
+                                 Vector &result, idx_t count) {
+	if (outer_name == "+") {
+		FusedLoopSwitchSide<T, INNER_OP, AddOperator>(fused_left, x, y, z, result, count);
+	} else if (outer_name == "-") {
+		FusedLoopSwitchSide<T, INNER_OP, SubtractOperator>(fused_left, x, y, z, result, count);
+	} else {
+		D_ASSERT(outer_name == "*");
+		FusedLoopSwitchSide<T, INNER_OP, MultiplyOperator>(fused_left, x, y, z, result, count);
+	}
+}
+
+template <class T>
+static void FusedLoopSwitchInner(const string &inner_name, const string &outer_name, bool fused_left, Vector &x,
+                                 Vector &y, Vector &z, Vector &result, idx_t count) {
+	if (inner_name == "+") {
+		FusedLoopSwitchOuter<T, AddOperator>(outer_name, fused_left, x, y, z, result, count);
+	} else if (inner_name == "-") {
+		FusedLoopSwitchOuter<T, SubtractOperator>(outer_name, fused_left, x, y, z, result, count);
+	} else {
+		D_ASSERT(inner_name == "*");
+		FusedLoopSwitchOuter<T, MultiplyOperator>(outer_name, fused_left, x, y, z, result, count);
+	}
+}
+
+void ExpressionExecutor::ExecuteFused(const BoundFunctionExpression &expr, ExecuteFunctionState &state,
+                                      const SelectionVector *sel, idx_t count, Vector &result) {
+	state.intermediate_chunk.Reset();
+	auto &arguments = state.intermediate_chunk;
+	auto &fused_child = *state.fused_child;
+	// evaluate the operands of the fused child, followed by the remaining child of this function
+	Execute(*fused_child.children[0], state.child_states[0].get(), sel, count, arguments.data[0]);
+	Execute(*fused_child.children[1], state.child_states[1].get(), sel, count, arguments.data[1]);
+	Execute(*expr.children[1 - state.fused_child_index], state.child_states[2].get(), sel, count, arguments.data[2]);
+	arguments.SetCardinality(count);
+	arguments.Verify();
+
+	auto fused_left = state.fused_child_index == 0;
+	if (expr.return_type.InternalType() == PhysicalType::FLOAT) {
+		FusedLoopSwitchInner<float>(fused_child.function.name, expr.function.name, fused_left, arguments.data[0],
+		                            arguments.data[1], arguments.data[2], result, count);
+	} else {
+		D_ASSERT(expr.return_type.InternalType() == PhysicalType::DOUBLE);
+		FusedLoopSwitchInner<double>(fused_child.function.name, expr.function.name, fused_left, arguments.data[0],
+		                             arguments.data[1], arguments.data[2], result, count);
+	}
+	D_ASSERT(result.GetType() == expr.return_type);
+}
+
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
+	auto &function_state = state->Cast<ExecuteFunctionState>();
+	if (function_state.fused_child) {
+		ExecuteFused(expr, function_state, sel, count, result);
+		return;
+	}
 	state->intermediate_chunk.Reset();
 	auto &arguments = state->intermediate_chunk;
 	if (!state->types.empty()) {
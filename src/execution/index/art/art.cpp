@@ -495,6 +495,70 @@ bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_ide
 	return true;
 }
 
+//===--------------------------------------------------------------------===//
+// Bulk Append
+//===--------------------------------------------------------------------===//
+
+unique_ptr<ARTBulkAppendState> ART::InitializeBulkAppend() {
+	D_ASSERT(index_constraint_type == IndexConstraintType::NONE);
+
+	auto state = make_uniq<ARTBulkAppendState>(BufferAllocator::Get(db));
+	state->expression_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	state->chunk_keys = vector<ARTKey>(STANDARD_VECTOR_SIZE);
+	return state;
+}
+
+void ART::CollectBulkAppend(ARTBulkAppendState &state, DataChunk &input, row_t row_start) {
+	// first resolve the expressions for the index
+	ExecuteExpressions(input, state.expression_chunk);
+	GenerateKeys<>(state.arena_allocator, state.expression_chunk, state.chunk_keys);
+
+	for (idx_t i = 0; i < state.expression_chunk.size(); i++) {
+		if (state.chunk_keys[i].Empty()) {
+			// nothing to append for NULL values
+			continue;
+		}
+		state.keys.push_back(state.chunk_keys[i]);
+		state.row_ids.push_back(row_start + UnsafeNumericCast<row_t>(i));
+	}
+}
+
+void ART::FinishBulkAppend(ARTBulkAppendState &state) {
+	if (state.keys.empty()) {
+		return;
+	}
+
+	// sort the collected keys: constructing an ART requires them in ascending order
+	auto &keys = state.keys;
+	vector<idx_t> sort_order(keys.size());
+	for (idx_t i = 0; i < sort_order.size(); i++) {
+		sort_order[i] = i;
+	}
+	std::sort(sort_order.begin(), sort_order.end(),
+	          [&keys](const idx_t lhs, const idx_t rhs) { return keys[rhs] > keys[lhs]; });
+
+	vector<ARTKey> sorted_keys(keys.size());
+	Vector sorted_row_ids(LogicalType::ROW_TYPE, keys.size());
+	auto sorted_row_id_data = FlatVector::GetData<row_t>(sorted_row_ids);
+	for (idx_t i = 0; i < sort_order.size(); i++) {
+		sorted_keys[i] = keys[sort_order[i]];
+		sorted_row_id_data[i] = state.row_ids[sort_order[i]];
+	}
+
+	// construct an ART from the sorted keys; sharing the allocators allows merging its nodes
+	// into this tree without copying them
+	auto batch_art =
+	    make_uniq<ART>(name, index_constraint_type, column_ids, table_io_manager, unbound_expressions, db, allocators);
+	if (!batch_art->ConstructFromSorted(sorted_keys.size(), sorted_keys, sorted_row_ids)) {
+		throw InternalException("Constraint violation while bulk appending to an index without constraints");
+	}
+
+	// merge the batch into the tree; without constraints, the merge cannot run into a constraint violation
+	if (!BoundIndex::MergeIndexes(*batch_art)) {
+		throw InternalException("Failed to merge a bulk append batch into the index");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Insert / Verification / Constraint Checking
 //===--------------------------------------------------------------------===//
@@ -930,7 +994,7 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	if (scan_state.values[1].IsNull()) {
 
 		// single predicate
-		lock_guard<mutex> l(lock);
+		auto l = lock.GetSharedLock();
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			success = SearchEqual(key, max_count, row_ids);
@@ -954,7 +1018,7 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	} else {
 
 		// two predicates
-		lock_guard<mutex> l(lock);
+		auto l = lock.GetSharedLock();
 
 		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
@@ -1038,7 +1102,8 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
 
 	// don't alter the index during constraint checking
-	lock_guard<mutex> l(lock);
+	// note that we cannot take a shared lock here, as we execute the (shared) index expressions
+	auto l = lock.GetExclusiveLock();
 
 	// first resolve the expressions for the index
 	DataChunk expression_chunk;
@@ -214,45 +214,32 @@ bool Leaf::Remove(ART &art, reference<Node> &node, const row_t row_id) {
 	return false;
 }
 
-idx_t Leaf::TotalCount(ART &art, const Node &node) {
-
-	D_ASSERT(node.HasMetadata());
-	if (node.GetType() == NType::LEAF_INLINED) {
-		return 1;
-	}
-
-	idx_t count = 0;
-	reference<const Node> node_ref(node);
-	while (node_ref.get().HasMetadata()) {
-		auto &leaf = Node::Ref<const Leaf>(art, node_ref, NType::LEAF);
-		count += leaf.count;
-		node_ref = leaf.ptr;
-	}
-	return count;
-}
-
 bool Leaf::GetRowIds(ART &art, const Node &node, vector<row_t> &result_ids, idx_t max_count) {
 
-	// adding more elements would exceed the maximum count
 	D_ASSERT(node.HasMetadata());
-	if (result_ids.size() + TotalCount(art, node) > max_count) {
-		return false;
-	}
 
 	if (node.GetType() == NType::LEAF_INLINED) {
+		// adding another element would exceed the maximum count
+		if (result_ids.size() + 1 > max_count) {
+			return false;
+		}
 		// push back the inlined row ID of this leaf
 		result_ids.push_back(node.GetRowId());
+		return true;
+	}
 
-	} else {
-		// push back all the row IDs of this leaf
-		reference<const Node> last_leaf_ref(node);
-		while (last_leaf_ref.get().HasMetadata()) {
-			auto &leaf = Node::Ref<const Leaf>(art, last_leaf_ref, NType::LEAF);
-			for (idx_t i = 0; i < leaf.count; i++) {
-				result_ids.push_back(leaf.row_ids[i]);
-			}
-			last_leaf_ref = leaf.ptr;
+	// push back all the row IDs of this leaf chain, one segment at a time
+	auto initial_count = result_ids.size();
+	reference<const Node> last_leaf_ref(node);
+	while (last_leaf_ref.get().HasMetadata()) {
+		auto &leaf = Node::Ref<const Leaf>(art, last_leaf_ref, NType::LEAF);
+		if (result_ids.size() + leaf.count > max_count) {
+			// adding more elements would exceed the maximum count
+			result_ids.resize(initial_count);
+			return false;
 		}
+		result_ids.insert(result_ids.end(), leaf.row_ids, leaf.row_ids + leaf.count);
+		last_leaf_ref = leaf.ptr;
 	}
 
 	return true;
@@ -37,7 +37,7 @@ constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
     : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), block_pointer(),
-      block_handle(nullptr) {
+      block_handle(nullptr), loaded(true) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, block_manager.GetBlockSize(), false, &block_handle);
@@ -46,13 +46,20 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), segment_count(segment_count), allocation_size(allocation_size), dirty(false),
-      vacuum(false), block_pointer(block_pointer) {
+      vacuum(false), block_pointer(block_pointer), loaded(false) {
 
 	D_ASSERT(block_pointer.IsValid());
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 }
 
+FixedSizeBuffer::FixedSizeBuffer(FixedSizeBuffer &&other) noexcept
+    : block_manager(other.block_manager), segment_count(other.segment_count), allocation_size(other.allocation_size),
+      dirty(other.dirty), vacuum(other.vacuum), block_pointer(other.block_pointer),
+      buffer_handle(std::move(other.buffer_handle)), block_handle(std::move(other.block_handle)),
+      loaded(other.loaded.load()) {
+}
+
 void FixedSizeBuffer::Destroy() {
 	if (InMemory()) {
 		// we can have multiple readers on a pinned block, and unpinning the buffer handle
@@ -115,6 +122,7 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 	partial_block_manager.RegisterPartialBlock(std::move(allocation));
 
 	// resetting this buffer
+	loaded = false;
 	buffer_handle.Destroy();
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
@@ -0,0 +1,53 @@
+#include "duckdb/execution/join_bloom_filter.hpp"
+
+#include "duckdb/common/numeric_utils.hpp"
+
+namespace duckdb {
+
+JoinBloomFilter::JoinBloomFilter(idx_t estimated_count)
+    : complete(false), disabled(false), probed_count(0), passed_count(0) {
+	// aim for ~16 bits per key (4 keys per 64-bit block) for a low false-positive rate with three probe bits
+	auto block_count = NextPowerOfTwo(estimated_count / 4 + 1);
+	block_count = MinValue(MaxValue(block_count, MINIMUM_BLOCK_COUNT), MAXIMUM_BLOCK_COUNT);
+	block_index_mask = block_count - 1;
+	blocks = unique_ptr<atomic<uint64_t>[]>(new atomic<uint64_t>[block_count]);
+	for (idx_t i = 0; i < block_count; i++) {
+		blocks[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+void JoinBloomFilter::Insert(Vector &hashes, const SelectionVector &sel, idx_t count) {
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hash_data[sel.get_index(i)];
+		blocks[BlockIndex(hash)].fetch_or(BlockMask(hash), std::memory_order_relaxed);
+	}
+}
+
+void JoinBloomFilter::SetComplete() {
+	complete.store(true, std::memory_order_release);
+}
+
+idx_t JoinBloomFilter::Filter(Vector &hashes, idx_t count, SelectionVector &result_sel) {
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hash_data[i];
+		const auto mask = BlockMask(hash);
+		if ((blocks[BlockIndex(hash)].load(std::memory_order_relaxed) & mask) == mask) {
+			result_sel.set_index(result_count++, i);
+		}
+	}
+	// keep track of the pass rate: if the filter barely drops anything, hashing the probe rows is wasted work
+	const auto probed = probed_count.fetch_add(count, std::memory_order_relaxed) + count;
+	const auto passed = passed_count.fetch_add(result_count, std::memory_order_relaxed) + result_count;
+	if (probed >= SELECTIVITY_CHECK_INTERVAL &&
+	    static_cast<double>(passed) > MAXIMUM_PASS_RATE * static_cast<double>(probed)) {
+		disabled.store(true, std::memory_order_relaxed);
+	}
+	return result_count;
+}
+
+} // namespace duckdb
@@ -1,10 +1,12 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/column/column_data_collection_segment.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
+#include "duckdb/execution/join_bloom_filter.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -179,12 +181,15 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	idx_t non_empty_count = 0;
 
 	// first, filter out the empty rows and calculate the offset
+	// also prefetch the entry slots: for out-of-cache hash tables the loads in the loops below miss on nearly every
+	// probe, so issuing the prefetches a full pass ahead lets the misses overlap instead of serializing
 	for (idx_t i = 0; i < count; i++) {
 		const auto row_index = sel.get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
 		auto ht_offset = hashes[uvf_index] & ht->bitmask;
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
+		DUCKDB_PREFETCH_READ(entries + ht_offset);
 	}
 
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
@@ -263,6 +268,10 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+
+			// prefetch the row the entry points to: the key comparison below chases this data-dependent pointer,
+			// and prefetching a nullptr (empty entry) is harmless
+			DUCKDB_PREFETCH_READ(row_ptr_insert_to[row_index]);
 		}
 
 		if (salt_match_count != 0) {
@@ -282,12 +291,14 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 				match_count++;
 			}
 
-			// Linear probing: each of the entries that do not match move to the next entry in the HT
+			// Linear probing: each of the entries that do not match move to the next entry in the HT,
+			// prefetching the chain target so it is (being) loaded by the time the next iteration reads it
 			for (idx_t i = 0; i < key_no_match_count; i++) {
 				const auto row_index = state.key_no_match_sel.get_index(i);
 				auto &ht_offset = ht_offsets[row_index];
 
 				IncrementAndWrap(ht_offset, ht->bitmask);
+				DUCKDB_PREFETCH_READ(entries + ht_offset);
 			}
 		}
 
@@ -297,9 +308,11 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 }
 
 inline bool JoinHashTable::UseSalt() const {
-	// only use salt for large hash tables and if there is only one equality condition as otherwise
-	// we potentially need to compare multiple keys
-	return this->capacity > USE_SALT_THRESHOLD && this->equality_predicate_columns.size() == 1;
+	// only use salt for large hash tables: for small tables that fit in cache the extra salt bookkeeping costs more
+	// than the saved dereferences. The salt is extracted from the hash over all equality columns, so it filters
+	// correctly for multi-key joins as well - and is all the more valuable there, as a salt miss saves comparing
+	// multiple keys through the row pointer
+	return this->capacity > USE_SALT_THRESHOLD;
 }
 
 void JoinHashTable::GetRowPointers(DataChunk &keys, TupleDataChunkState &key_state, ProbeState &state, Vector &hashes_v,
@@ -411,6 +424,11 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	// note that we only hash the keys used in the equality comparison
 	Hash(keys, *current_sel, added_count, hash_values);
 
+	if (bloom_filter) {
+		// insert the hashes into the bloom filter that is pushed down into the probe-side scan
+		bloom_filter->Insert(hash_values, *current_sel, added_count);
+	}
+
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
 	hash_values.ToUnifiedFormat(source_chunk.size(), append_state.chunk_state.vector_data.back().unified);
@@ -1399,25 +1417,71 @@ void JoinHashTable::Repartition(JoinHashTable &global_ht) {
 	global_ht.Merge(*this);
 }
 
+void JoinHashTable::RepartitionRemaining(const idx_t added_bits) {
+	// The partitions that were built in previous rounds have been emptied into the main data collection,
+	// so repartitioning the sink collection only redistributes the remaining partitions
+	radix_bits += added_bits;
+	auto new_sink_collection =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	sink_collection->Repartition(*new_sink_collection);
+	sink_collection = std::move(new_sink_collection);
+	// The radix bits are taken from the top of the hash, so every old partition maps onto a contiguous range
+	// of new partitions, and we can simply scale the partition offsets
+	partition_start <<= added_bits;
+	partition_end <<= added_bits;
+}
+
 void JoinHashTable::Reset() {
 	data_collection->Reset();
 	finalized = false;
 }
 
-bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
+bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size, optional_ptr<ProbeSpill> probe_spill) {
 	if (finalized) {
 		Reset();
 	}
 
-	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-	if (partition_end == num_partitions) {
+	if (partition_end == RadixPartitioning::NumberOfPartitions(radix_bits)) {
 		return false;
 	}
 
 	// Start where we left off
-	auto &partitions = sink_collection->GetPartitions();
 	partition_start = partition_end;
 
+	// If the next partition by itself exceeds the memory limit, the data is heavily skewed, and the uniformity
+	// assumption made by SetRepartitionRadixBits did not hold: recursively repartition with more radix bits
+	if (radix_bits < RadixPartitioning::MAX_RADIX_BITS) {
+		auto &next_partition = *sink_collection->GetPartitions()[partition_start];
+		const auto next_partition_count = next_partition.Count();
+		const auto next_partition_size = next_partition.SizeInBytes();
+		if (next_partition_size + PointerTableSize(next_partition_count) > max_ht_size) {
+			const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
+			idx_t added_bits = 1;
+			for (; added_bits < max_added_bits; added_bits++) {
+				double partition_multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
+
+				auto new_estimated_size = double(next_partition_size) / partition_multiplier;
+				auto new_estimated_count = double(next_partition_count) / partition_multiplier;
+				auto new_estimated_ht_size =
+				    new_estimated_size +
+				    static_cast<double>(PointerTableSize(NumericCast<idx_t>(new_estimated_count)));
+
+				if (new_estimated_ht_size <= double(max_ht_size) / 4) {
+					// Aim for an estimated partition size of max_ht_size / 4
+					break;
+				}
+			}
+			RepartitionRemaining(added_bits);
+			if (probe_spill) {
+				// The spilled probe data is partitioned in the same way as the HT and must follow suit
+				probe_spill->Repartition();
+			}
+		}
+	}
+
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	auto &partitions = sink_collection->GetPartitions();
+
 	// Determine how many partitions we can do next (at least one)
 	idx_t count = 0;
 	idx_t data_size = 0;
@@ -1536,6 +1600,35 @@ void ProbeSpill::Finalize() {
 	local_partition_append_states.clear();
 }
 
+void ProbeSpill::Repartition() {
+	// The remaining build data was repartitioned with more radix bits; redistribute the remaining probe
+	// data accordingly, so that the partition offsets of the HT remain valid for the probe data as well
+	D_ASSERT(local_partitions.empty());
+	auto new_partitions =
+	    make_uniq<RadixPartitionedColumnData>(context, probe_types, ht.radix_bits, probe_types.size() - 1);
+	auto repartitioned = new_partitions->CreateShared();
+	PartitionedColumnDataAppendState append_state;
+	repartitioned->InitializeAppendState(append_state);
+
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(context), probe_types);
+	for (auto &partition : global_partitions->GetPartitions()) {
+		if (!partition || partition->Count() == 0) {
+			// Partitions that were already probed have been moved out of the collection
+			continue;
+		}
+		ColumnDataScanState scan_state;
+		partition->InitializeScan(scan_state);
+		while (partition->Scan(scan_state, chunk)) {
+			repartitioned->Append(append_state, chunk);
+		}
+		partition->Reset();
+	}
+	repartitioned->FlushAppendState(append_state);
+	new_partitions->Combine(*repartitioned);
+	global_partitions = std::move(new_partitions);
+}
+
 void ProbeSpill::PrepareNextProbe() {
 	auto &partitions = global_partitions->GetPartitions();
 	if (partitions.empty() || ht.partition_start == partitions.size()) {
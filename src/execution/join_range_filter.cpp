@@ -0,0 +1,132 @@
+#include "duckdb/execution/join_range_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+JoinRangeFilter::JoinRangeFilter(ExpressionType comparison, const LogicalType &key_type)
+    : comparison(comparison), min_vector(key_type), max_vector(key_type), has_bounds(false), complete(false) {
+	min_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+	max_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+}
+
+bool JoinRangeFilter::SupportedKeyType(const LogicalType &key_type) {
+	switch (key_type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateBounds(UnifiedVectorFormat &vdata, idx_t count, Vector &min_vector, Vector &max_vector,
+                                  bool &has_bounds) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto &min_val = *ConstantVector::GetData<T>(min_vector);
+	auto &max_val = *ConstantVector::GetData<T>(max_vector);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			// NULL keys cannot satisfy the comparison and do not widen the bounds
+			continue;
+		}
+		auto value = data[idx];
+		if (!has_bounds) {
+			min_val = value;
+			max_val = value;
+			has_bounds = true;
+			continue;
+		}
+		if (LessThan::Operation(value, min_val)) {
+			min_val = value;
+		} else if (GreaterThan::Operation(value, max_val)) {
+			max_val = value;
+		}
+	}
+}
+
+void JoinRangeFilter::UpdateBounds(Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+
+	lock_guard<mutex> guard(update_lock);
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateBounds<int8_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateBounds<int16_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateBounds<int32_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateBounds<int64_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateBounds<hugeint_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateBounds<uint8_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateBounds<uint16_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateBounds<uint32_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateBounds<uint64_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateBounds<uhugeint_t>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedUpdateBounds<float>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedUpdateBounds<double>(vdata, count, min_vector, max_vector, has_bounds);
+		break;
+	default:
+		throw InternalException("Unsupported key type for join range filter");
+	}
+}
+
+void JoinRangeFilter::Finish() {
+	lock_guard<mutex> guard(update_lock);
+	if (has_bounds) {
+		complete.store(true, std::memory_order_release);
+	}
+}
+
+idx_t JoinRangeFilter::Filter(Vector &keys, idx_t count, SelectionVector &result_sel) {
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		// the probe key must be less than the build-side maximum to match any build-side key
+		return VectorOperations::LessThan(keys, max_vector, nullptr, count, &result_sel, nullptr);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return VectorOperations::LessThanEquals(keys, max_vector, nullptr, count, &result_sel, nullptr);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		// the probe key must be greater than the build-side minimum to match any build-side key
+		return VectorOperations::GreaterThan(keys, min_vector, nullptr, count, &result_sel, nullptr);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return VectorOperations::GreaterThanEquals(keys, min_vector, nullptr, count, &result_sel, nullptr);
+	default:
+		throw InternalException("Unsupported comparison for join range filter");
+	}
+}
+
+} // namespace duckdb
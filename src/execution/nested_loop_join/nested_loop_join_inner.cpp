@@ -19,6 +19,28 @@ struct InitialNestedLoopJoin {
 		auto ldata = UnifiedVectorFormat::GetData<T>(left_data);
 		auto rdata = UnifiedVectorFormat::GetData<T>(right_data);
 		idx_t result_count = 0;
+
+		// fast path: if neither side contains NULLs, we can broadcast the right value over the left values
+		// and collect the matches branch-free, so the compiler can vectorize the comparison loop
+		if (left_data.validity.AllValid() && right_data.validity.AllValid()) {
+			for (; rpos < right_size; rpos++) {
+				const auto rval = rdata[right_data.sel->get_index(rpos)];
+				const auto iterations = MinValue<idx_t>(left_size - lpos, STANDARD_VECTOR_SIZE - result_count);
+				for (idx_t i = 0; i < iterations; i++, lpos++) {
+					const auto lidx = left_data.sel->get_index(lpos);
+					lvector.set_index(result_count, lpos);
+					rvector.set_index(result_count, rpos);
+					result_count += MATCH_OP::Operation(ldata[lidx], rval, false, false) ? 1 : 0;
+				}
+				if (lpos < left_size) {
+					// out of space!
+					return result_count;
+				}
+				lpos = 0;
+			}
+			return result_count;
+		}
+
 		for (; rpos < right_size; rpos++) {
 			idx_t right_position = right_data.sel->get_index(rpos);
 			bool right_is_valid = right_data.validity.RowIsValid(right_position);
@@ -66,11 +88,11 @@ struct RefineNestedLoopJoin {
 			auto right_idx = right_data.sel->get_index(ridx);
 			bool left_is_valid = left_data.validity.RowIsValid(left_idx);
 			bool right_is_valid = right_data.validity.RowIsValid(right_idx);
-			if (MATCH_OP::Operation(ldata[left_idx], rdata[right_idx], !left_is_valid, !right_is_valid)) {
-				lvector.set_index(result_count, lidx);
-				rvector.set_index(result_count, ridx);
-				result_count++;
-			}
+			// compact the matches in place branch-free: result_count never overtakes i
+			lvector.set_index(result_count, lidx);
+			rvector.set_index(result_count, ridx);
+			bool match = MATCH_OP::Operation(ldata[left_idx], rdata[right_idx], !left_is_valid, !right_is_valid);
+			result_count += match ? 1 : 0;
 		}
 		return result_count;
 	}
@@ -157,12 +157,15 @@ idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
 		}
 		//! Create a new table and assign its index to the aggregate
 		table_map[agg_idx] = table_inputs.size();
+		table_indices.push_back(agg_idx);
 		table_inputs.push_back(std::ref(aggregate));
 	}
 	//! Every distinct aggregate needs to be assigned an index
 	D_ASSERT(table_map.size() == indices.size());
 	//! There can not be more tables than there are distinct aggregates
 	D_ASSERT(table_inputs.size() <= indices.size());
+	//! Every table is created for exactly one aggregate
+	D_ASSERT(table_indices.size() == table_inputs.size());
 
 	return table_inputs.size();
 }
@@ -273,7 +273,9 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 	// Create an empty filter for Sink, since we don't need to update any aggregate states here
 	unsafe_vector<idx_t> empty_filter;
 
-	for (idx_t &idx : distinct_info.indices) {
+	// Aggregates with identical (distinct) arguments and filter share a table - by iterating the table owners
+	// instead of all distinct aggregates, every shared table is sunk into exactly once
+	for (const idx_t idx : distinct_info.table_indices) {
 		auto &aggregate = grouped_aggregate_data.aggregates[idx]->Cast<BoundAggregateExpression>();
 
 		D_ASSERT(distinct_info.table_map.count(idx));
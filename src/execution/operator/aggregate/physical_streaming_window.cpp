@@ -25,7 +25,30 @@ public:
 
 class StreamingWindowState : public OperatorState {
 public:
+	//	We can only stream state that fits within one standard vector
+	static constexpr idx_t MAX_BUFFER = 2048U;
+
 	struct AggregateState {
+		static bool ComputePreceding(ClientContext &context, BoundWindowExpression &wexpr, int64_t &preceding) {
+			D_ASSERT(wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS);
+			auto &start_expr = *wexpr.start_expr;
+			if (start_expr.HasParameter() || !start_expr.IsFoldable()) {
+				return false;
+			}
+			auto start_value = ExpressionExecutor::EvaluateScalar(context, start_expr);
+			if (start_value.IsNull()) {
+				return false;
+			}
+			Value bigint_value;
+			if (!start_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+				return false;
+			}
+			preceding = bigint_value.GetValue<int64_t>();
+
+			//	We can only buffer a bounded number of rows behind the current one
+			return 0 <= preceding && idx_t(preceding) < MAX_BUFFER;
+		}
+
 		AggregateState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator)
 		    : wexpr(wexpr), arena_allocator(Allocator::DefaultAllocator()), executor(client), filter_executor(client),
 		      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), hashes(LogicalType::HASH),
@@ -54,6 +77,18 @@ public:
 				distinct_args.Initialize(allocator, arg_types);
 				distinct_sel.Initialize();
 			}
+			if (wexpr.start == WindowBoundary::EXPR_PRECEDING_ROWS) {
+				int64_t preceding_p = 0;
+				if (!ComputePreceding(client, wexpr, preceding_p)) {
+					throw InternalException("Unsupported bounded frame for StreamingWindow");
+				}
+				preceding = idx_t(preceding_p);
+				if (preceding && !arg_types.empty()) {
+					prev_args.Initialize(allocator, arg_types, preceding);
+					prev_cursor.Initialize(allocator, arg_types);
+					shift_args.Initialize(allocator, arg_types, preceding);
+				}
+			}
 		}
 
 		~AggregateState() {
@@ -65,6 +100,7 @@ public:
 		}
 
 		void Execute(ExecutionContext &context, DataChunk &input, Vector &result);
+		void ExecuteBounded(ExecutionContext &context, DataChunk &input, ValidityMask &filter_mask, Vector &result);
 
 		//! The aggregate expression
 		BoundWindowExpression &wexpr;
@@ -105,12 +141,20 @@ public:
 		SelectionVector distinct_sel;
 		//! Pointers to groups in the hash table.
 		Vector addresses;
+
+		//! The number of preceding rows in the frame, or INVALID_INDEX for a running total
+		idx_t preceding = DConstants::INVALID_INDEX;
+		//! Buffered argument rows from previous chunks (bounded frames only)
+		DataChunk prev_args;
+		//! Argument cursor for the buffered rows (a one element slice of prev_args)
+		DataChunk prev_cursor;
+		//! Copy buffer for shifting the buffered rows
+		DataChunk shift_args;
+		//! The FILTER results of the buffered rows
+		vector<bool> prev_valid;
 	};
 
 	struct LeadLagState {
-		//	Fixed size
-		static constexpr idx_t MAX_BUFFER = 2048U;
-
 		static bool ComputeOffset(ClientContext &context, BoundWindowExpression &wexpr, int64_t &offset) {
 			offset = 1;
 			if (wexpr.offset_expr) {
@@ -287,6 +331,10 @@ public:
 				const_vectors[expr_idx] = make_uniq<Vector>(Value((double)0));
 				break;
 			}
+			case ExpressionType::WINDOW_CUME_DIST: {
+				const_vectors[expr_idx] = make_uniq<Vector>(Value((double)1));
+				break;
+			}
 			case ExpressionType::WINDOW_RANK:
 			case ExpressionType::WINDOW_RANK_DENSE: {
 				const_vectors[expr_idx] = make_uniq<Vector>(Value((int64_t)1));
@@ -338,9 +386,23 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 	}
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
+	case ExpressionType::WINDOW_AGGREGATE: {
+		if (wexpr.end != WindowBoundary::CURRENT_ROW_ROWS) {
+			return false;
+		}
 		// We can stream aggregates if they are "running totals"
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING) {
+			return true;
+		}
+		// We can also stream bounded ROWS frames by buffering the preceding rows,
+		// but DISTINCT requires tracking values that leave the frame
+		if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS || wexpr.distinct) {
+			return false;
+		}
+		int64_t preceding;
+		return StreamingWindowState::AggregateState::ComputePreceding(context, wexpr, preceding);
+	}
+	case ExpressionType::WINDOW_CUME_DIST:
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -390,6 +452,12 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 		}
 	}
 
+	// Bounded frames cannot use a single running state
+	if (preceding != DConstants::INVALID_INDEX) {
+		ExecuteBounded(context, input, filter_mask, result);
+		return;
+	}
+
 	// Check for COUNT(*)
 	if (wexpr.children.empty()) {
 		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
@@ -470,6 +538,131 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	}
 }
 
+void StreamingWindowState::AggregateState::ExecuteBounded(ExecutionContext &context, DataChunk &input,
+                                                          ValidityMask &filter_mask, Vector &result) {
+	//	Re-aggregate the frame for each row. The frame can reach back at most
+	//	`preceding` rows into previous chunks, which we keep buffered in prev_args.
+	const idx_t count = input.size();
+	auto &aggregate = *wexpr.aggregate;
+	auto &aggr_state = *this;
+	auto &statev = aggr_state.statev;
+	const idx_t prev_count = prev_valid.size();
+	D_ASSERT(prev_count <= preceding);
+
+	//	Rows are addressed in the unified space prev_args || input
+	auto row_is_valid = [&](idx_t unified_idx) {
+		if (unified_idx < prev_count) {
+			return bool(prev_valid[unified_idx]);
+		}
+		return filter_mask.RowIsValid(unified_idx - prev_count);
+	};
+
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), aggr_state.arena_allocator);
+	if (wexpr.children.empty()) {
+		// COUNT(*) only needs the number of unfiltered rows in the frame
+		D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
+		auto data = FlatVector::GetData<int64_t>(result);
+		int64_t framed = 0;
+		for (idx_t unified_idx = 0; unified_idx < prev_count; ++unified_idx) {
+			framed += int64_t(row_is_valid(unified_idx));
+		}
+		for (idx_t i = 0; i < count; ++i) {
+			const idx_t unified_idx = prev_count + i;
+			framed += int64_t(row_is_valid(unified_idx));
+			if (unified_idx > preceding) {
+				framed -= int64_t(row_is_valid(unified_idx - preceding - 1));
+			}
+			data[i] = framed;
+		}
+	} else {
+		// Compute the arguments
+		auto &arg_chunk = aggr_state.arg_chunk;
+		executor.Execute(input, arg_chunk);
+		arg_chunk.Flatten();
+
+		// Set up single row cursors over the current and the buffered arguments
+		sel_t curr_s = 0;
+		SelectionVector curr_sel(&curr_s);
+		auto &arg_cursor = aggr_state.arg_cursor;
+		arg_cursor.Reset();
+		arg_cursor.Slice(curr_sel, 1);
+		sel_t prev_s = 0;
+		SelectionVector prev_sel(&prev_s);
+		if (prev_count) {
+			prev_cursor.Reset();
+			prev_cursor.Slice(prev_sel, 1);
+		}
+		// This doesn't work for STRUCTs because the SV
+		// is not copied to the children when you slice
+		vector<column_t> structs;
+		for (column_t col_idx = 0; col_idx < arg_chunk.ColumnCount(); ++col_idx) {
+			DictionaryVector::Child(arg_cursor.data[col_idx]).Reference(arg_chunk.data[col_idx]);
+			if (prev_count) {
+				DictionaryVector::Child(prev_cursor.data[col_idx]).Reference(prev_args.data[col_idx]);
+			}
+			if (arg_cursor.data[col_idx].GetType().InternalType() == PhysicalType::STRUCT) {
+				structs.emplace_back(col_idx);
+			}
+		}
+
+		// Reset the state and re-aggregate the frame one row at a time.
+		for (idx_t i = 0; i < count; ++i) {
+			if (dtor) {
+				dtor(statev, aggr_input_data, 1);
+			}
+			aggregate.initialize(state.data());
+
+			const idx_t unified_idx = prev_count + i;
+			const idx_t frame_start = unified_idx > preceding ? unified_idx - preceding : 0;
+			for (idx_t f = frame_start; f <= unified_idx; ++f) {
+				if (!row_is_valid(f)) {
+					continue;
+				}
+				const bool buffered = f < prev_count;
+				auto &cursor = buffered ? prev_cursor : arg_cursor;
+				auto &source = buffered ? prev_args : arg_chunk;
+				auto &sel = buffered ? prev_sel : curr_sel;
+				sel.set_index(0, buffered ? f : f - prev_count);
+				for (const auto struct_idx : structs) {
+					cursor.data[struct_idx].Slice(source.data[struct_idx], sel, 1);
+				}
+				aggregate.update(cursor.data.data(), aggr_input_data, cursor.ColumnCount(), statev, 1);
+			}
+			aggregate.finalize(statev, aggr_input_data, result, 1, i);
+		}
+	}
+
+	//	Buffer the trailing rows for the next chunk
+	const idx_t new_count = MinValue<idx_t>(preceding, prev_count + count);
+	const idx_t from_curr = MinValue<idx_t>(count, new_count);
+	const idx_t keep_prev = new_count - from_curr;
+	if (!wexpr.children.empty() && preceding) {
+		auto &arg_chunk = aggr_state.arg_chunk;
+		if (keep_prev) {
+			//	Shift the tail of the old buffer down through the copy buffer
+			shift_args.Reset();
+			for (column_t col_idx = 0; col_idx < prev_args.ColumnCount(); ++col_idx) {
+				VectorOperations::Copy(prev_args.data[col_idx], shift_args.data[col_idx], prev_count,
+				                       prev_count - keep_prev, 0);
+			}
+			shift_args.SetCardinality(keep_prev);
+		}
+		prev_args.Reset();
+		for (column_t col_idx = 0; col_idx < prev_args.ColumnCount(); ++col_idx) {
+			if (keep_prev) {
+				VectorOperations::Copy(shift_args.data[col_idx], prev_args.data[col_idx], keep_prev, 0, 0);
+			}
+			VectorOperations::Copy(arg_chunk.data[col_idx], prev_args.data[col_idx], count, count - from_curr,
+			                       keep_prev);
+		}
+		prev_args.SetCardinality(new_count);
+	}
+	prev_valid.erase(prev_valid.begin(), prev_valid.begin() + NumericCast<int64_t>(prev_count - keep_prev));
+	for (idx_t i = count - from_curr; i < count; ++i) {
+		prev_valid.push_back(filter_mask.RowIsValid(i));
+	}
+}
+
 void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataChunk &chunk, DataChunk &delayed,
                                                GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
@@ -486,6 +679,7 @@ void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataCh
 		case ExpressionType::WINDOW_AGGREGATE:
 			state.aggregate_states[expr_idx]->Execute(context, chunk, result);
 			break;
+		case ExpressionType::WINDOW_CUME_DIST:
 		case ExpressionType::WINDOW_FIRST_VALUE:
 		case ExpressionType::WINDOW_PERCENT_RANK:
 		case ExpressionType::WINDOW_RANK:
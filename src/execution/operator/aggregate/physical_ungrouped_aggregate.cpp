@@ -216,13 +216,14 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, DataChu
 	D_ASSERT(distinct_data);
 	auto &distinct_state = *global_sink.distinct_state;
 	auto &distinct_info = *distinct_collection_info;
-	auto &distinct_indices = distinct_info.Indices();
 
 	DataChunk empty_chunk;
 
 	auto &distinct_filter = distinct_info.Indices();
 
-	for (auto &idx : distinct_indices) {
+	// Aggregates with identical (distinct) arguments and filter share a table - by iterating the table owners
+	// instead of all distinct aggregates, every shared table is sunk into exactly once
+	for (const idx_t idx : distinct_info.table_indices) {
 		auto &aggregate = aggregates[idx]->Cast<BoundAggregateExpression>();
 
 		idx_t table_idx = distinct_info.table_map[idx];
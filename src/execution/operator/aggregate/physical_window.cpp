@@ -96,6 +96,8 @@ public:
 	unique_ptr<WindowPartitionGlobalSinkState> global_partition;
 	//! The execution functions
 	Executors executors;
+	//! For each executor, the executor with an equivalent frame that computes its bounds (possibly itself)
+	vector<idx_t> bounds_sources;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
@@ -211,6 +213,18 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		executors.emplace_back(std::move(wexec));
 	}
 
+	// executors with equivalent frames can reuse the bounds computed by the first of their group
+	for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
+		idx_t source_idx = expr_idx;
+		for (idx_t other_idx = 0; other_idx < expr_idx; ++other_idx) {
+			if (executors[other_idx]->CanShareBounds(*executors[expr_idx])) {
+				source_idx = other_idx;
+				break;
+			}
+		}
+		bounds_sources.emplace_back(source_idx);
+	}
+
 	global_partition = make_uniq<WindowPartitionGlobalSinkState>(*this, wexpr);
 }
 
@@ -284,6 +298,8 @@ public:
 
 	//! Get the next task
 	Task NextTask(idx_t hash_bin);
+	//! Help an in-progress partition build instead of just spinning. Returns true if any work was done.
+	bool HelpBuild();
 
 	//! Context for executing computations
 	ClientContext &context;
@@ -299,6 +315,10 @@ public:
 	atomic<idx_t> tasks_remaining;
 	//! The number of rows returned
 	atomic<idx_t> returned;
+	//! The partition that is currently being built, if any
+	atomic<WindowPartitionSourceState *> currently_building;
+	//! The number of threads helping with the current build
+	atomic<idx_t> build_helpers;
 
 public:
 	idx_t MaxThreads() override {
@@ -311,7 +331,8 @@ private:
 };
 
 WindowGlobalSourceState::WindowGlobalSourceState(ClientContext &context_p, WindowGlobalSinkState &gsink_p)
-    : context(context_p), gsink(gsink_p), next_build(0), tasks_remaining(0), returned(0) {
+    : context(context_p), gsink(gsink_p), next_build(0), tasks_remaining(0), returned(0), currently_building(nullptr),
+      build_helpers(0) {
 	auto &gpart = gsink.global_partition;
 	auto &window_hash_groups = gsink.global_partition->window_hash_groups;
 
@@ -504,6 +525,9 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gsink, co
 	if (!scanner) {
 		return;
 	}
+	//	Publish ourselves so that waiting threads can help with the expensive parts of the build.
+	//	(If several partitions are being built at once, only the last registered one gets help.)
+	gsource.currently_building = this;
 	idx_t input_idx = 0;
 	while (true) {
 		input_chunk.Reset();
@@ -524,6 +548,12 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gsink, co
 		executors[w]->Finalize(*gestates[w]);
 	}
 
+	//	Unregister and wait until all helpers have let go of the partition
+	gsource.currently_building = nullptr;
+	while (gsource.build_helpers) {
+		TaskScheduler::YieldThread();
+	}
+
 	// External scanning assumes all blocks are swizzled.
 	scanner->ReSwizzle();
 
@@ -592,6 +622,28 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::CreateTask(idx_t hash_bin
 	return Task();
 }
 
+bool WindowGlobalSourceState::HelpBuild() {
+	//	Register before reading the partition so the builder waits for us before releasing it
+	++build_helpers;
+	auto partition_source = currently_building.load();
+	if (!partition_source) {
+		--build_helpers;
+		return false;
+	}
+
+	const auto &executors = gsink.executors;
+	auto &gestates = partition_source->window_hash_group->gestates;
+	bool any_work = false;
+	for (idx_t w = 0; w < executors.size(); ++w) {
+		while (executors[w]->TryFinalizeTask(*gestates[w])) {
+			any_work = true;
+		}
+	}
+
+	--build_helpers;
+	return any_work;
+}
+
 WindowGlobalSourceState::Task WindowGlobalSourceState::StealWork() {
 	for (idx_t hash_bin = 0; hash_bin < built.size(); ++hash_bin) {
 		lock_guard<mutex> built_guard(built_lock);
@@ -665,6 +717,12 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 			return result;
 		}
 
+		//	Try to help any pending build before yielding,
+		//	so a single large partition does not pin one core while the rest of us spin.
+		if (HelpBuild()) {
+			continue;
+		}
+
 		//	If there is nothing to steal but there are unfinished partitions,
 		//	yield until any pending builds are done.
 		TaskScheduler::YieldThread();
@@ -736,7 +794,12 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 		auto &gstate = *gestates[expr_idx];
 		auto &lstate = *read_states[expr_idx];
 		auto &result = output_chunk.data[expr_idx];
-		executor.Evaluate(position, input_chunk, result, lstate, gstate);
+		optional_ptr<const WindowExecutorLocalState> bounds_source;
+		const auto source_idx = gsource.gsink.bounds_sources[expr_idx];
+		if (source_idx != expr_idx) {
+			bounds_source = read_states[source_idx].get();
+		}
+		executor.Evaluate(position, input_chunk, result, lstate, gstate, bounds_source);
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
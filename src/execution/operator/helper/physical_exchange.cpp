@@ -0,0 +1,194 @@
+#include "duckdb/execution/operator/helper/physical_exchange.hpp"
+
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+
+namespace duckdb {
+
+ExchangeTransport::~ExchangeTransport() {
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+PhysicalExchangeSink::PhysicalExchangeSink(vector<LogicalType> types,
+                                           vector<unique_ptr<Expression>> partition_expressions_p,
+                                           idx_t partition_count_p, shared_ptr<ExchangeTransport> transport_p,
+                                           idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::EXTENSION, std::move(types), estimated_cardinality),
+      partition_expressions(std::move(partition_expressions_p)), partition_count(partition_count_p),
+      transport(std::move(transport_p)) {
+	D_ASSERT(partition_count > 0);
+	D_ASSERT(!partition_expressions.empty());
+}
+
+string PhysicalExchangeSink::GetName() const {
+	return "EXCHANGE_SINK";
+}
+
+class ExchangeSinkLocalState : public LocalSinkState {
+public:
+	//! The amount of buffered rows per partition after which the partition is serialized and sent
+	static constexpr const idx_t FLUSH_ROW_COUNT = 8 * STANDARD_VECTOR_SIZE;
+
+public:
+	ExchangeSinkLocalState(ExecutionContext &context, const PhysicalExchangeSink &op)
+	    : executor(context.client), hashes(LogicalType::HASH) {
+		vector<LogicalType> partition_types;
+		for (auto &expr : op.partition_expressions) {
+			executor.AddExpression(*expr);
+			partition_types.push_back(expr->return_type);
+		}
+		partition_chunk.Initialize(context.client, partition_types);
+		auto &child_types = op.children[0]->GetTypes();
+		slice_chunk.Initialize(context.client, child_types);
+		for (idx_t partition_idx = 0; partition_idx < op.partition_count; partition_idx++) {
+			partitions.push_back(make_uniq<ColumnDataCollection>(context.client, child_types));
+			partition_appends.emplace_back();
+			partitions.back()->InitializeAppend(partition_appends.back());
+			partition_sel.emplace_back(STANDARD_VECTOR_SIZE);
+			partition_counts.push_back(0);
+		}
+	}
+
+	//! Serialize the buffered chunks of a partition and hand them to the transport
+	void FlushPartition(const PhysicalExchangeSink &op, idx_t partition_idx) {
+		auto &partition = *partitions[partition_idx];
+		if (partition.Count() == 0) {
+			return;
+		}
+		for (auto &chunk : partition.Chunks()) {
+			MemoryStream stream;
+			BinarySerializer serializer(stream);
+			serializer.Begin();
+			chunk.Serialize(serializer);
+			serializer.End();
+			op.transport->Send(partition_idx, stream.GetData(), stream.GetPosition());
+		}
+		partition.Reset();
+		partition_appends[partition_idx] = ColumnDataAppendState();
+		partition.InitializeAppend(partition_appends[partition_idx]);
+	}
+
+	//! Executor for the partition expressions
+	ExpressionExecutor executor;
+	//! The result of executing the partition expressions
+	DataChunk partition_chunk;
+	//! The combined hash of the partition expressions
+	Vector hashes;
+	//! Chunk used for slicing the input per partition
+	DataChunk slice_chunk;
+	//! The buffered rows per target partition
+	vector<unique_ptr<ColumnDataCollection>> partitions;
+	vector<ColumnDataAppendState> partition_appends;
+	//! The rows of the current input chunk that belong to each partition
+	vector<SelectionVector> partition_sel;
+	vector<idx_t> partition_counts;
+};
+
+unique_ptr<LocalSinkState> PhysicalExchangeSink::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<ExchangeSinkLocalState>(context, *this);
+}
+
+SinkResultType PhysicalExchangeSink::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<ExchangeSinkLocalState>();
+	auto count = chunk.size();
+
+	// compute the combined hash of the partition expressions
+	lstate.partition_chunk.Reset();
+	lstate.executor.Execute(chunk, lstate.partition_chunk);
+	VectorOperations::Hash(lstate.partition_chunk.data[0], lstate.hashes, count);
+	for (idx_t col_idx = 1; col_idx < lstate.partition_chunk.ColumnCount(); col_idx++) {
+		VectorOperations::CombineHash(lstate.hashes, lstate.partition_chunk.data[col_idx], count);
+	}
+	lstate.hashes.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(lstate.hashes);
+
+	// bucket the rows per target partition
+	for (idx_t i = 0; i < count; i++) {
+		auto partition_idx = hash_data[i] % partition_count;
+		lstate.partition_sel[partition_idx].set_index(lstate.partition_counts[partition_idx]++, i);
+	}
+
+	// append each bucket to its partition buffer, sending buffers that have accumulated enough rows
+	for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+		auto bucket_count = lstate.partition_counts[partition_idx];
+		lstate.partition_counts[partition_idx] = 0;
+		if (bucket_count == 0) {
+			continue;
+		}
+		lstate.slice_chunk.Reset();
+		lstate.slice_chunk.Slice(chunk, lstate.partition_sel[partition_idx], bucket_count);
+		lstate.partitions[partition_idx]->Append(lstate.partition_appends[partition_idx], lstate.slice_chunk);
+		if (lstate.partitions[partition_idx]->Count() >= ExchangeSinkLocalState::FLUSH_ROW_COUNT) {
+			lstate.FlushPartition(*this, partition_idx);
+		}
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalExchangeSink::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &lstate = input.local_state.Cast<ExchangeSinkLocalState>();
+	// send any remaining buffered rows
+	for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+		lstate.FlushPartition(*this, partition_idx);
+	}
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalExchangeSink::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                OperatorSinkFinalizeInput &input) const {
+	// all local states have been combined: signal the transport that this node is done sending
+	transport->FinishSending();
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+PhysicalExchangeSource::PhysicalExchangeSource(vector<LogicalType> types, shared_ptr<ExchangeTransport> transport_p,
+                                               idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::EXTENSION, std::move(types), estimated_cardinality),
+      transport(std::move(transport_p)) {
+}
+
+string PhysicalExchangeSource::GetName() const {
+	return "EXCHANGE_SOURCE";
+}
+
+class ExchangeSourceState : public GlobalSourceState {
+public:
+	//! Reused buffer that received serialized chunks are read into
+	vector<data_t> buffer;
+};
+
+unique_ptr<GlobalSourceState> PhysicalExchangeSource::GetGlobalSourceState(ClientContext &context) const {
+	return make_uniq<ExchangeSourceState>();
+}
+
+SourceResultType PhysicalExchangeSource::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                 OperatorSourceInput &input) const {
+	auto &gstate = input.global_state.Cast<ExchangeSourceState>();
+	while (true) {
+		if (!transport->Receive(gstate.buffer)) {
+			return SourceResultType::FINISHED;
+		}
+		if (gstate.buffer.empty()) {
+			continue;
+		}
+		MemoryStream stream(gstate.buffer.data(), gstate.buffer.size());
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		chunk.Deserialize(deserializer);
+		deserializer.End();
+		if (chunk.size() != 0) {
+			return SourceResultType::HAVE_MORE_OUTPUT;
+		}
+	}
+}
+
+} // namespace duckdb
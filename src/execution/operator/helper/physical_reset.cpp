@@ -3,6 +3,9 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 
 namespace duckdb {
 
@@ -32,6 +35,8 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 			D_ASSERT(entry != config.extension_parameters.end());
 		}
 		ResetExtensionVariable(context, config, entry->second);
+		DatabaseInstance::GetDatabase(context.client).GetResultCache().Clear();
+		ClientData::Get(context.client).plan_cache->Clear();
 		return SourceResultType::FINISHED;
 	}
 
@@ -65,6 +70,9 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 		throw InternalException("Unsupported SetScope for variable");
 	}
 
+	// settings can affect query results without any catalog change - drop all cached results
+	DatabaseInstance::GetDatabase(context.client).GetResultCache().Clear();
+	ClientData::Get(context.client).plan_cache->Clear();
 	return SourceResultType::FINISHED;
 }
 
@@ -3,6 +3,9 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 
 namespace duckdb {
 
@@ -36,6 +39,8 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 			D_ASSERT(entry != config.extension_parameters.end());
 		}
 		SetExtensionVariable(context.client, entry->second, name, scope, value);
+		DatabaseInstance::GetDatabase(context.client).GetResultCache().Clear();
+		ClientData::Get(context.client).plan_cache->Clear();
 		return SourceResultType::FINISHED;
 	}
 	SetScope variable_scope = scope;
@@ -69,6 +74,9 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 		throw InternalException("Unsupported SetScope for variable");
 	}
 
+	// settings can affect query results without any catalog change - drop all cached results
+	DatabaseInstance::GetDatabase(context.client).GetResultCache().Clear();
+	ClientData::Get(context.client).plan_cache->Clear();
 	return SourceResultType::FINISHED;
 }
 
@@ -28,6 +28,8 @@ public:
 	}
 
 	std::atomic<idx_t> current_offset;
+	//! The total amount of rows to read from the input (limit + offset), if known up-front
+	optional_idx max_element;
 };
 
 unique_ptr<OperatorState> PhysicalStreamingLimit::GetOperatorState(ExecutionContext &context) const {
@@ -35,7 +37,15 @@ unique_ptr<OperatorState> PhysicalStreamingLimit::GetOperatorState(ExecutionCont
 }
 
 unique_ptr<GlobalOperatorState> PhysicalStreamingLimit::GetGlobalOperatorState(ClientContext &context) const {
-	return make_uniq<StreamingLimitGlobalState>();
+	auto result = make_uniq<StreamingLimitGlobalState>();
+	if (limit_val.Type() == LimitNodeType::CONSTANT_VALUE && offset_val.Type() != LimitNodeType::EXPRESSION_VALUE) {
+		idx_t max_element = limit_val.GetConstantValue();
+		if (offset_val.Type() == LimitNodeType::CONSTANT_VALUE) {
+			max_element += offset_val.GetConstantValue();
+		}
+		result->max_element = max_element;
+	}
+	return std::move(result);
 }
 
 OperatorResultType PhysicalStreamingLimit::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
@@ -56,6 +66,15 @@ OperatorResultType PhysicalStreamingLimit::Execute(ExecutionContext &context, Da
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
+bool PhysicalStreamingLimit::OperatorFinished(GlobalOperatorState &gstate_p) const {
+	auto &gstate = gstate_p.Cast<StreamingLimitGlobalState>();
+	if (!gstate.max_element.IsValid()) {
+		return false;
+	}
+	// all rows the limit will ever emit have been consumed - sibling tasks can stop scanning
+	return gstate.current_offset >= gstate.max_element.GetIndex();
+}
+
 OrderPreservationType PhysicalStreamingLimit::OperatorOrder() const {
 	return OrderPreservationType::FIXED_ORDER;
 }
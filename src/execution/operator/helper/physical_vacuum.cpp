@@ -3,6 +3,7 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
 namespace duckdb {
@@ -23,10 +24,16 @@ public:
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (HistogramStatistics::TypeIsSupported(column.GetType())) {
+				column_histogram_stats.push_back(make_uniq<HistogramStatistics>());
+			} else {
+				column_histogram_stats.push_back(nullptr);
+			}
 		}
 	};
 
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	vector<unique_ptr<HistogramStatistics>> column_histogram_stats;
 };
 
 unique_ptr<LocalSinkState> PhysicalVacuum::GetLocalSinkState(ExecutionContext &context) const {
@@ -43,11 +50,17 @@ public:
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (HistogramStatistics::TypeIsSupported(column.GetType())) {
+				column_histogram_stats.push_back(make_uniq<HistogramStatistics>());
+			} else {
+				column_histogram_stats.push_back(nullptr);
+			}
 		}
 	};
 
 	mutex stats_lock;
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	vector<unique_ptr<HistogramStatistics>> column_histogram_stats;
 };
 
 unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &context) const {
@@ -59,10 +72,12 @@ SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk,
 	D_ASSERT(lstate.column_distinct_stats.size() == column_id_map.size());
 
 	for (idx_t col_idx = 0; col_idx < chunk.data.size(); col_idx++) {
-		if (!DistinctStatistics::TypeIsSupported(chunk.data[col_idx].GetType())) {
-			continue;
+		if (DistinctStatistics::TypeIsSupported(chunk.data[col_idx].GetType())) {
+			lstate.column_distinct_stats[col_idx]->Update(chunk.data[col_idx], chunk.size(), false);
+		}
+		if (lstate.column_histogram_stats[col_idx]) {
+			lstate.column_histogram_stats[col_idx]->Update(chunk.data[col_idx], chunk.size());
 		}
-		lstate.column_distinct_stats[col_idx]->Update(chunk.data[col_idx], chunk.size(), false);
 	}
 
 	return SinkResultType::NEED_MORE_INPUT;
@@ -80,6 +95,10 @@ SinkCombineResultType PhysicalVacuum::Combine(ExecutionContext &context, Operato
 			D_ASSERT(l_state.column_distinct_stats[col_idx]);
 			g_state.column_distinct_stats[col_idx]->Merge(*l_state.column_distinct_stats[col_idx]);
 		}
+		if (g_state.column_histogram_stats[col_idx]) {
+			D_ASSERT(l_state.column_histogram_stats[col_idx]);
+			g_state.column_histogram_stats[col_idx]->Merge(*l_state.column_histogram_stats[col_idx]);
+		}
 	}
 
 	return SinkCombineResultType::FINISHED;
@@ -92,6 +111,11 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	auto tbl = table;
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
+		if (sink.column_histogram_stats[col_idx]) {
+			sink.column_histogram_stats[col_idx]->Finalize();
+			tbl->GetStorage().SetHistogram(column_id_map.at(col_idx),
+			                               std::move(sink.column_histogram_stats[col_idx]));
+		}
 	}
 
 	return SinkFinalizeType::READY;
@@ -382,6 +382,7 @@ public:
 	unique_ptr<SBIterator> right_itr;
 	unique_ptr<PayloadScanner> rhs_scanner;
 	DataChunk rhs_payload;
+	SelectionVector rhs_sel;
 
 	idx_t lhs_match_count;
 	bool fetch_next_left;
@@ -402,6 +403,7 @@ AsOfProbeBuffer::AsOfProbeBuffer(ClientContext &context, const PhysicalAsOfJoin
 	rhs_payload.Initialize(allocator, op.children[1]->types);
 
 	lhs_sel.Initialize();
+	rhs_sel.Initialize();
 	left_outer.Initialize(STANDARD_VECTOR_SIZE);
 }
 
@@ -571,23 +573,35 @@ void AsOfProbeBuffer::ResolveComplexJoin(ExecutionContext &context, DataChunk &c
 	idx_t matches[STANDARD_VECTOR_SIZE];
 	ResolveJoin(nullptr, matches);
 
-	for (idx_t i = 0; i < lhs_match_count; ++i) {
-		const auto idx = lhs_sel[i];
-		const auto match_pos = matches[idx];
-		// Skip to the range containing the match
+	//	The match positions are non-decreasing because the right iterator only moves forwards,
+	//	so we can gather all the matches inside each scanned range with one copy per column.
+	idx_t begin = 0;
+	while (begin < lhs_match_count) {
+		// Skip to the range containing the next match
+		auto match_pos = matches[lhs_sel[begin]];
 		while (match_pos >= rhs_scanner->Scanned()) {
 			rhs_payload.Reset();
 			rhs_scanner->Scan(rhs_payload);
 		}
-		// Append the individual values
-		// TODO: Batch the copies
-		const auto source_offset = match_pos - (rhs_scanner->Scanned() - rhs_payload.size());
+		// Collect the matches that land in this range
+		const auto range_begin = rhs_scanner->Scanned() - rhs_payload.size();
+		idx_t end = begin;
+		do {
+			rhs_sel.set_index(end - begin, match_pos - range_begin);
+			if (++end >= lhs_match_count) {
+				break;
+			}
+			match_pos = matches[lhs_sel[end]];
+		} while (match_pos < rhs_scanner->Scanned());
+		// Batch the copies
+		const auto gather_count = end - begin;
 		for (column_t col_idx = 0; col_idx < op.right_projection_map.size(); ++col_idx) {
 			const auto rhs_idx = op.right_projection_map[col_idx];
 			auto &source = rhs_payload.data[rhs_idx];
 			auto &target = chunk.data[lhs_payload.ColumnCount() + col_idx];
-			VectorOperations::Copy(source, target, source_offset + 1, source_offset, i);
+			VectorOperations::Copy(source, target, rhs_sel, gather_count, 0, begin);
 		}
+		begin = end;
 	}
 
 	//	Slice the left payload into the result
@@ -2,6 +2,8 @@
 
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/join_bloom_filter.hpp"
+#include "duckdb/execution/operator/join/tiny_build_join_executor.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -90,7 +92,8 @@ public:
 	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
 	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_update_count(0),
-	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
+	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context, op.GetName())),
+	      finalized(false),
 	      scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
 
@@ -120,6 +123,8 @@ public:
 	unique_ptr<JoinHashTable> hash_table;
 	//! The perfect hash join executor (if any)
 	unique_ptr<PerfectHashJoinExecutor> perfect_join_executor;
+	//! The tiny build join executor (if any)
+	unique_ptr<TinyBuildJoinExecutor> tiny_build_executor;
 	//! Whether or not the hash table has been finalized
 	bool finalized = false;
 
@@ -221,6 +226,8 @@ unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &c
 			info.result_chunk.Initialize(allocator, delim_payload_types);
 		}
 	}
+	// all hash tables (global and thread-local) share the bloom filter, so every build row is inserted
+	result->bloom_filter = bloom_filter;
 	return result;
 }
 
@@ -451,7 +458,7 @@ public:
 		sink.hash_table->GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
 		sink.temporary_memory_state->SetMinimumReservation(max_partition_size +
 		                                                   JoinHashTable::PointerTableSize(max_partition_count));
-		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation(), nullptr);
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
 };
@@ -461,6 +468,11 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (bloom_filter) {
+		// all build rows have been sunk: the probe-side scan may now use the bloom filter
+		bloom_filter->SetComplete();
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
@@ -484,7 +496,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 				ht.Merge(*local_ht);
 			}
 			sink.local_hash_tables.clear();
-			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation(), nullptr);
 			sink.ScheduleFinalize(pipeline, event);
 		}
 		sink.finalized = true;
@@ -508,7 +520,13 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
-		sink.ScheduleFinalize(pipeline, event);
+		// For a handful of build rows, probing with direct comparisons beats the hash table
+		if (TinyBuildJoinExecutor::CanDoTinyBuildJoin(*this, ht)) {
+			sink.tiny_build_executor = make_uniq<TinyBuildJoinExecutor>(*this, ht);
+			sink.tiny_build_executor->BuildTinyTable();
+		} else {
+			sink.ScheduleFinalize(pipeline, event);
+		}
 	}
 	sink.finalized = true;
 	if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
@@ -531,6 +549,7 @@ public:
 	ExpressionExecutor probe_executor;
 	unique_ptr<JoinHashTable::ScanStructure> scan_structure;
 	unique_ptr<OperatorState> perfect_hash_join_state;
+	unique_ptr<OperatorState> tiny_build_join_state;
 
 	bool initialized;
 	JoinHashTable::ProbeSpillLocalAppendState spill_state;
@@ -550,6 +569,8 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 	auto state = make_uniq<HashJoinOperatorState>(context.client);
 	if (sink.perfect_join_executor) {
 		state->perfect_hash_join_state = sink.perfect_join_executor->GetOperatorState(context);
+	} else if (sink.tiny_build_executor) {
+		state->tiny_build_join_state = sink.tiny_build_executor->GetOperatorState(context);
 	} else {
 		state->join_keys.Initialize(allocator, condition_types);
 		for (auto &cond : conditions) {
@@ -590,6 +611,11 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 		return sink.perfect_join_executor->ProbePerfectHashTable(context, input, chunk, *state.perfect_hash_join_state);
 	}
 
+	if (sink.tiny_build_executor) {
+		D_ASSERT(!sink.external);
+		return sink.tiny_build_executor->ProbeTinyBuild(context, input, chunk, *state.tiny_build_join_state);
+	}
+
 	if (state.scan_structure) {
 		// still have elements remaining (i.e. we got >STANDARD_VECTOR_SIZE elements in the previous probe)
 		state.scan_structure->Next(state.join_keys, input, chunk);
@@ -805,7 +831,8 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	sink.temporary_memory_state->SetRemainingSize(sink.context, ht.GetRemainingSize());
 
 	// Try to put the next partitions in the block collection of the HT
-	if (!sink.external || !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation())) {
+	if (!sink.external ||
+	    !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation(), sink.probe_spill.get())) {
 		global_stage = HashJoinSourceStage::DONE;
 		sink.temporary_memory_state->SetRemainingSize(sink.context, 0);
 		return;
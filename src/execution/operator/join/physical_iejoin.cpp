@@ -4,6 +4,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -790,12 +791,116 @@ void PhysicalIEJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &re
 
 class IEJoinGlobalSourceState : public GlobalSourceState {
 public:
+	using GlobalSortedTable = PhysicalRangeJoin::GlobalSortedTable;
+
+	//! Process block pairs in square tiles of this many blocks per side,
+	//! so the blocks the active pairs need stay cache resident
+	static constexpr idx_t PAIR_TILE_SIZE = 8;
+
+	//! Per-block bounds of the secondary join key
+	struct BlockYStats {
+		//! Whether the block contains any non-NULL secondary keys
+		bool any = false;
+		//! The smallest secondary key in the block
+		Value min_y;
+		//! The largest secondary key in the block
+		Value max_y;
+	};
+
 	explicit IEJoinGlobalSourceState(const PhysicalIEJoin &op)
 	    : op(op), initialized(false), next_pair(0), completed(0), left_outers(0), next_left(0), right_outers(0),
 	      next_right(0) {
 	}
 
-	void Initialize(IEJoinGlobalState &sink_state) {
+	//! Compute the per-block minimum and maximum of the secondary join key
+	void BuildBlockStats(ClientContext &client, GlobalSortedTable &table, const idx_t child,
+	                     vector<BlockYStats> &stats) {
+		auto &gstate = table.global_sort_state;
+		const auto &order2 = child ? op.rhs_orders[1] : op.lhs_orders[1];
+
+		ExpressionExecutor executor(client);
+		executor.AddExpression(*order2.expression);
+
+		DataChunk scanned;
+		scanned.Initialize(Allocator::DefaultAllocator(), gstate.payload_layout.GetTypes());
+		DataChunk keys;
+		keys.Initialize(Allocator::DefaultAllocator(), {order2.expression->return_type});
+
+		const auto block_count = table.BlockCount();
+		stats.resize(block_count);
+		for (idx_t block_idx = 0; block_idx < block_count; ++block_idx) {
+			auto &entry = stats[block_idx];
+			PayloadScanner scanner(gstate, block_idx);
+			for (;;) {
+				scanned.Reset();
+				scanner.Scan(scanned);
+				const auto count = scanned.size();
+				if (!count) {
+					break;
+				}
+				keys.Reset();
+				executor.Execute(scanned, keys);
+				auto &y = keys.data[0];
+				for (idx_t i = 0; i < count; ++i) {
+					auto value = y.GetValue(i);
+					if (value.IsNull()) {
+						continue;
+					}
+					if (!entry.any) {
+						entry.min_y = value;
+						entry.max_y = value;
+						entry.any = true;
+					} else if (ValueOperations::LessThan(value, entry.min_y)) {
+						entry.min_y = std::move(value);
+					} else if (ValueOperations::GreaterThan(value, entry.max_y)) {
+						entry.max_y = std::move(value);
+					}
+				}
+			}
+		}
+	}
+
+	//! Can this pair of blocks produce any matches at all?
+	bool PairCanMatch(IEJoinGlobalState &gstate, SBIterator &bounds1, SBIterator &bounds2, idx_t b1, idx_t b2) {
+		auto &left_table = *gstate.tables[0];
+		auto &right_table = *gstate.tables[1];
+		if (!left_table.BlockSize(b1) || !right_table.BlockSize(b2)) {
+			return false;
+		}
+
+		// t1.X[0] op1 t2.X'[-1]
+		// (the sort order matches op1, so the extremes of each block bound the rest)
+		bounds1.SetIndex(bounds1.block_capacity * b1);
+		bounds2.SetIndex(bounds2.block_capacity * b2 + right_table.BlockSize(b2) - 1);
+		if (!bounds1.Compare(bounds2)) {
+			return false;
+		}
+
+		// The secondary key is not ordered within a block, so compare the min/max
+		if (left_stats.empty() || right_stats.empty()) {
+			return true;
+		}
+		const auto &lstats = left_stats[b1];
+		const auto &rstats = right_stats[b2];
+		if (!lstats.any || !rstats.any) {
+			// All secondary keys are NULL, so no comparison can be TRUE
+			return false;
+		}
+		switch (op.conditions[1].comparison) {
+		case ExpressionType::COMPARE_LESSTHAN:
+			return ValueOperations::LessThan(lstats.min_y, rstats.max_y);
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			return ValueOperations::LessThanEquals(lstats.min_y, rstats.max_y);
+		case ExpressionType::COMPARE_GREATERTHAN:
+			return ValueOperations::GreaterThan(lstats.max_y, rstats.min_y);
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return ValueOperations::GreaterThanEquals(lstats.max_y, rstats.min_y);
+		default:
+			return true;
+		}
+	}
+
+	void Initialize(ClientContext &client, IEJoinGlobalState &sink_state) {
 		lock_guard<mutex> initializing(lock);
 		if (initialized) {
 			return;
@@ -829,6 +934,34 @@ public:
 			right_outers = right_blocks;
 		}
 
+		// When there are multiple pairs, it pays off to scan the secondary key
+		// once so that pairs without overlap can be pruned before scheduling
+		if (left_blocks * right_blocks > 1) {
+			BuildBlockStats(client, left_table, 0, left_stats);
+			BuildBlockStats(client, right_table, 1, right_stats);
+		}
+
+		// Schedule the surviving pairs tile by tile instead of in row-major order,
+		// so that concurrent threads keep hitting the same handful of blocks
+		if (left_blocks && right_blocks) {
+			const auto &cmp1 = op.conditions[0].comparison;
+			SBIterator bounds1(left_table.global_sort_state, cmp1);
+			SBIterator bounds2(right_table.global_sort_state, cmp1);
+			for (idx_t tile_l = 0; tile_l < left_blocks; tile_l += PAIR_TILE_SIZE) {
+				const auto end_l = MinValue<idx_t>(tile_l + PAIR_TILE_SIZE, left_blocks);
+				for (idx_t tile_r = 0; tile_r < right_blocks; tile_r += PAIR_TILE_SIZE) {
+					const auto end_r = MinValue<idx_t>(tile_r + PAIR_TILE_SIZE, right_blocks);
+					for (idx_t b1 = tile_l; b1 < end_l; ++b1) {
+						for (idx_t b2 = tile_r; b2 < end_r; ++b2) {
+							if (PairCanMatch(sink_state, bounds1, bounds2, b1, b2)) {
+								pairs.emplace_back(b1, b2);
+							}
+						}
+					}
+				}
+			}
+		}
+
 		// Ready for action
 		initialized = true;
 	}
@@ -844,15 +977,13 @@ public:
 		auto &left_table = *gstate.tables[0];
 		auto &right_table = *gstate.tables[1];
 
-		const auto left_blocks = left_table.BlockCount();
-		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
+		const auto pair_count = pairs.size();
 
 		// Regular block
 		const auto i = next_pair++;
 		if (i < pair_count) {
-			const auto b1 = i / right_blocks;
-			const auto b2 = i % right_blocks;
+			const auto b1 = pairs[i].first;
+			const auto b2 = pairs[i].second;
 
 			lstate.left_block_index = b1;
 			lstate.left_base = left_bases[b1];
@@ -924,6 +1055,13 @@ public:
 	vector<idx_t> left_bases;
 	vector<idx_t> right_bases;
 
+	// Per-block bounds of the secondary key, for pruning
+	vector<BlockYStats> left_stats;
+	vector<BlockYStats> right_stats;
+
+	// The block pairs that survived pruning, in tile order
+	vector<pair<idx_t, idx_t>> pairs;
+
 	// Outer joins
 	idx_t left_outers;
 	std::atomic<idx_t> next_left;
@@ -947,7 +1085,7 @@ SourceResultType PhysicalIEJoin::GetData(ExecutionContext &context, DataChunk &r
 	auto &ie_gstate = input.global_state.Cast<IEJoinGlobalSourceState>();
 	auto &ie_lstate = input.local_state.Cast<IEJoinLocalSourceState>();
 
-	ie_gstate.Initialize(ie_sink);
+	ie_gstate.Initialize(context.client, ie_sink);
 
 	if (!ie_lstate.joiner && !ie_lstate.left_matches && !ie_lstate.right_matches) {
 		ie_gstate.GetNextPair(context.client, ie_sink, ie_lstate);
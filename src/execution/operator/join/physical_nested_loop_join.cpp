@@ -6,6 +6,7 @@
 #include "duckdb/execution/nested_loop_join.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/execution/operator/join/outer_join_marker.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
 
 namespace duckdb {
 
@@ -216,6 +217,9 @@ SinkFinalizeType PhysicalNestedLoopJoin::Finalize(Pipeline &pipeline, Event &eve
 	if (gstate.right_payload_data.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
 		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
 	}
+	// the materialized RHS is re-scanned for every probe chunk: hint the buffer pool to retain its blocks
+	gstate.right_payload_data.SetRetentionHint(BlockRetentionHint::WILL_REACCESS);
+	gstate.right_condition_data.SetRetentionHint(BlockRetentionHint::WILL_REACCESS);
 	return SinkFinalizeType::READY;
 }
 
@@ -7,6 +7,7 @@
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/join_range_filter.hpp"
 #include "duckdb/execution/operator/join/outer_join_marker.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/event.hpp"
@@ -115,6 +116,13 @@ SinkResultType PhysicalPiecewiseMergeJoin::Sink(ExecutionContext &context, DataC
 
 	gstate.Sink(chunk, lstate);
 
+	if (range_filter) {
+		// the sorting keys of this chunk are still in the local table's key chunk,
+		// with the NULLs of all conditions merged into the validity of the primary
+		auto &keys = lstate.table.keys;
+		range_filter->UpdateBounds(keys.data[0], keys.size());
+	}
+
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -139,6 +147,10 @@ SinkFinalizeType PhysicalPiecewiseMergeJoin::Finalize(Pipeline &pipeline, Event
 	auto &gstate = input.global_state.Cast<MergeJoinGlobalState>();
 	auto &global_sort_state = gstate.table->global_sort_state;
 
+	if (range_filter) {
+		// the build side is complete: the probe-side scan can now filter on the key bounds
+		range_filter->Finish();
+	}
 	if (PropagatesBuildSide(join_type)) {
 		// for FULL/RIGHT OUTER JOIN, initialize found_match to false for every tuple
 		gstate.table->IntializeMatches();
@@ -0,0 +1,144 @@
+#include "duckdb/execution/operator/join/tiny_build_join_executor.hpp"
+
+#include "duckdb/execution/nested_loop_join.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+
+namespace duckdb {
+
+TinyBuildJoinExecutor::TinyBuildJoinExecutor(const PhysicalHashJoin &join_p, JoinHashTable &ht_p)
+    : join(join_p), ht(ht_p) {
+}
+
+bool TinyBuildJoinExecutor::CanDoTinyBuildJoin(const PhysicalHashJoin &join, JoinHashTable &ht) {
+	if (join.join_type != JoinType::INNER) {
+		return false;
+	}
+	if (ht.Count() == 0 || ht.Count() > TINY_BUILD_THRESHOLD) {
+		return false;
+	}
+	for (auto &cond : join.conditions) {
+		// The comparison loop does not support nested types
+		switch (cond.left->return_type.InternalType()) {
+		case PhysicalType::STRUCT:
+		case PhysicalType::LIST:
+		case PhysicalType::ARRAY:
+			return false;
+		default:
+			break;
+		}
+		// Nor IS NOT DISTINCT FROM
+		switch (cond.comparison) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_DISTINCT_FROM:
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Build
+//===--------------------------------------------------------------------===//
+void TinyBuildJoinExecutor::BuildTinyTable() {
+	auto &data_collection = ht.GetDataCollection();
+	const auto count = ht.Count();
+	D_ASSERT(count > 0 && count <= TINY_BUILD_THRESHOLD);
+
+	// Fill the tuple addresses with a full scan of the hash table
+	Vector tuple_addresses(LogicalType::POINTER, count);
+	JoinHTScanState join_ht_state(data_collection, 0, data_collection.ChunkCount(),
+	                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	const auto key_count = ht.FillWithHTOffsets(join_ht_state, tuple_addresses);
+	D_ASSERT(key_count == count);
+	(void)key_count;
+
+	// Gather the condition and payload columns into flat chunks
+	auto &allocator = Allocator::DefaultAllocator();
+	const auto &sequential_sel = *FlatVector::IncrementalSelectionVector();
+	build_conditions.Initialize(allocator, join.condition_types);
+	for (idx_t col_idx = 0; col_idx < join.condition_types.size(); col_idx++) {
+		data_collection.Gather(tuple_addresses, sequential_sel, count, col_idx, build_conditions.data[col_idx],
+		                       sequential_sel, nullptr);
+	}
+	build_conditions.SetCardinality(count);
+
+	if (!join.rhs_output_types.empty()) {
+		build_payload.Initialize(allocator, join.rhs_output_types);
+		for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
+			const auto output_col_idx = ht.output_columns[i];
+			D_ASSERT(build_payload.data[i].GetType() == ht.layout.GetTypes()[output_col_idx]);
+			data_collection.Gather(tuple_addresses, sequential_sel, count, output_col_idx, build_payload.data[i],
+			                       sequential_sel, nullptr);
+		}
+	}
+	build_payload.SetCardinality(count);
+}
+
+//===--------------------------------------------------------------------===//
+// Probe
+//===--------------------------------------------------------------------===//
+class TinyBuildJoinState : public OperatorState {
+public:
+	TinyBuildJoinState(ClientContext &context, const PhysicalHashJoin &join)
+	    : probe_executor(context), lvector(STANDARD_VECTOR_SIZE), rvector(STANDARD_VECTOR_SIZE) {
+		join_keys.Initialize(Allocator::Get(context), join.condition_types);
+		for (auto &cond : join.conditions) {
+			probe_executor.AddExpression(*cond.left);
+		}
+	}
+
+	DataChunk join_keys;
+	ExpressionExecutor probe_executor;
+	//! Positions for resuming the comparison loop within an input chunk
+	idx_t left_tuple = 0;
+	idx_t right_tuple = 0;
+	//! Whether the next call starts a fresh input chunk
+	bool fetch_next_left = true;
+	SelectionVector lvector;
+	SelectionVector rvector;
+};
+
+unique_ptr<OperatorState> TinyBuildJoinExecutor::GetOperatorState(ExecutionContext &context) {
+	auto state = make_uniq<TinyBuildJoinState>(context.client, join);
+	return std::move(state);
+}
+
+OperatorResultType TinyBuildJoinExecutor::ProbeTinyBuild(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                         OperatorState &state_p) {
+	auto &state = state_p.Cast<TinyBuildJoinState>();
+
+	if (state.fetch_next_left) {
+		// resolve the join keys for the input chunk
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		state.left_tuple = 0;
+		state.right_tuple = 0;
+		state.fetch_next_left = false;
+	}
+
+	// compare the probe keys against each of the build rows
+	idx_t match_count;
+	do {
+		match_count = NestedLoopJoinInner::Perform(state.left_tuple, state.right_tuple, state.join_keys,
+		                                           build_conditions, state.lvector, state.rvector, join.conditions);
+		if (match_count > 0) {
+			chunk.Slice(input, state.lvector, match_count);
+			chunk.Slice(build_payload, state.rvector, match_count, input.ColumnCount());
+		}
+		if (state.right_tuple >= build_conditions.size()) {
+			// we compared against all build rows: move on to the next input chunk
+			state.fetch_next_left = true;
+			return OperatorResultType::NEED_MORE_INPUT;
+		}
+	} while (match_count == 0);
+	return OperatorResultType::HAVE_MORE_OUTPUT;
+}
+
+} // namespace duckdb
@@ -485,8 +485,8 @@ SinkResultType PhysicalBatchInsert::Sink(ExecutionContext &context, DataChunk &c
 		}
 	}
 	if (!lstate.current_collection) {
-		lock_guard<mutex> l(gstate.lock);
 		// no collection yet: create a new one
+		// this is thread-local state - the optimistic writer set is synchronized in the local storage itself
 		lstate.CreateNewCollection(table, insert_types);
 		if (!lstate.writer) {
 			lstate.writer = &table.GetStorage().CreateOptimisticWriter(context.client);
@@ -532,7 +532,7 @@ SinkCombineResultType PhysicalBatchInsert::Combine(ExecutionContext &context, Op
 		}
 	}
 	if (lstate.writer) {
-		lock_guard<mutex> l(gstate.lock);
+		// the optimistic writer set is synchronized in the local storage - no need to hold the global sink lock
 		gstate.table.GetStorage().FinalizeOptimisticWriter(context.client, *lstate.writer);
 	}
 
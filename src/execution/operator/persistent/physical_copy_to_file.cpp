@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
@@ -15,6 +16,13 @@ namespace duckdb {
 struct PartitionWriteInfo {
 	unique_ptr<GlobalFunctionData> global_state;
 	idx_t active_writes = 0;
+	//! The file offset for this partition (i.e. how many files were written for it before)
+	idx_t file_offset = 0;
+	//! Protects the creation of the global state - the file open happens outside of the global partition lock,
+	//! so that threads opening different partitions do not serialize on each other
+	mutex initialize_lock;
+	atomic<bool> initialized {false};
+	atomic<bool> failed {false};
 };
 
 struct VectorOfValuesHashFunction {
@@ -54,6 +62,8 @@ public:
 	atomic<idx_t> rows_copied;
 	atomic<idx_t> last_file_offset;
 	unique_ptr<GlobalFunctionData> global_state;
+	//! Lock protecting created_directories
+	mutex directory_lock;
 	//! Created directories
 	unordered_set<string> created_directories;
 	//! shared state for HivePartitionedColumnData
@@ -64,6 +74,7 @@ public:
 	idx_t max_open_files;
 
 	void CreateDir(const string &dir_path, FileSystem &fs) {
+		lock_guard<mutex> guard(directory_lock);
 		if (created_directories.find(dir_path) != created_directories.end()) {
 			// already attempted to create this directory
 			return;
@@ -111,58 +122,83 @@ public:
 
 	PartitionWriteInfo &GetPartitionWriteInfo(ExecutionContext &context, const PhysicalCopyToFile &op,
 	                                          const vector<Value> &values) {
-		auto global_lock = lock.GetExclusiveLock();
-		// check if we have already started writing this partition
-		auto active_write_entry = active_partitioned_writes.find(values);
-		if (active_write_entry != active_partitioned_writes.end()) {
-			// we have - continue writing in this partition
-			active_write_entry->second->active_writes++;
-			return *active_write_entry->second;
-		}
-		// check if we need to close any writers before we can continue
-		if (active_partitioned_writes.size() >= max_open_files) {
-			// we need to! try to close writers
-			for (auto &entry : active_partitioned_writes) {
-				if (entry.second->active_writes == 0) {
-					// we can evict this entry - evict the partition
-					FinalizePartition(context.client, op, *entry.second);
-					++previous_partitions[entry.first];
-					active_partitioned_writes.erase(entry.first);
-					break;
+		optional_ptr<PartitionWriteInfo> result;
+		unique_lock<mutex> initialize_guard;
+		{
+			auto global_lock = lock.GetExclusiveLock();
+			// check if we have already started writing this partition
+			auto active_write_entry = active_partitioned_writes.find(values);
+			if (active_write_entry != active_partitioned_writes.end()) {
+				// we have - continue writing in this partition
+				active_write_entry->second->active_writes++;
+				result = active_write_entry->second.get();
+			} else {
+				// check if we need to close any writers before we can continue
+				if (active_partitioned_writes.size() >= max_open_files) {
+					// we need to! try to close writers
+					for (auto &entry : active_partitioned_writes) {
+						if (entry.second->active_writes == 0) {
+							// we can evict this entry - evict the partition
+							FinalizePartition(context.client, op, *entry.second);
+							++previous_partitions[entry.first];
+							active_partitioned_writes.erase(entry.first);
+							break;
+						}
+					}
+				}
+				// register the partition - the file itself is opened outside of the global lock below, so that
+				// threads opening writers for different partitions do not serialize on each other
+				auto info = make_uniq<PartitionWriteInfo>();
+				info->active_writes = 1;
+				auto prev_offset = previous_partitions.find(values);
+				if (prev_offset != previous_partitions.end()) {
+					info->file_offset = prev_offset->second;
 				}
+				result = info.get();
+				// grab the initialize lock before publishing the entry so other threads wait for the open
+				initialize_guard = unique_lock<mutex>(info->initialize_lock);
+				active_partitioned_writes.insert(make_pair(values, std::move(info)));
 			}
 		}
-		idx_t offset = 0;
-		auto prev_offset = previous_partitions.find(values);
-		if (prev_offset != previous_partitions.end()) {
-			offset = prev_offset->second;
-		}
-		auto &fs = FileSystem::GetFileSystem(context.client);
-		// Create a writer for the current file
-		auto trimmed_path = op.GetTrimmedPath(context.client);
-		string hive_path = GetOrCreateDirectory(op.partition_columns, op.names, values, trimmed_path, fs);
-		string full_path(op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset));
-		if (op.overwrite_mode == CopyOverwriteMode::COPY_APPEND) {
-			// when appending, we first check if the file exists
-			while (fs.FileExists(full_path)) {
-				// file already exists - re-generate name
-				if (!op.filename_pattern.HasUUID()) {
-					throw InternalException("CopyOverwriteMode::COPY_APPEND without {uuid} - and file exists");
+		if (initialize_guard.owns_lock()) {
+			// we registered this partition - create the writer
+			try {
+				auto &fs = FileSystem::GetFileSystem(context.client);
+				auto trimmed_path = op.GetTrimmedPath(context.client);
+				string hive_path = GetOrCreateDirectory(op.partition_columns, op.names, values, trimmed_path, fs);
+				string full_path(
+				    op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, result->file_offset));
+				if (op.overwrite_mode == CopyOverwriteMode::COPY_APPEND) {
+					// when appending, we first check if the file exists
+					while (fs.FileExists(full_path)) {
+						// file already exists - re-generate name
+						if (!op.filename_pattern.HasUUID()) {
+							throw InternalException("CopyOverwriteMode::COPY_APPEND without {uuid} - and file exists");
+						}
+						full_path = op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension,
+						                                               result->file_offset);
+					}
+				}
+				if (op.return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST) {
+					auto global_lock = lock.GetExclusiveLock();
+					AddFileName(*global_lock, full_path);
 				}
-				full_path = op.filename_pattern.CreateFilename(fs, hive_path, op.file_extension, offset);
+				result->global_state = op.function.copy_to_initialize_global(context.client, *op.bind_data, full_path);
+				result->initialized = true;
+			} catch (...) {
+				// mark the partition as failed so that waiting threads do not touch the missing writer
+				result->failed = true;
+				result->initialized = true;
+				throw;
 			}
+		} else if (!result->initialized) {
+			// another thread is currently opening the writer for this partition - wait for it to finish
+			lock_guard<mutex> wait_guard(result->initialize_lock);
 		}
-		if (op.return_type == CopyFunctionReturnType::CHANGED_ROWS_AND_FILE_LIST) {
-			AddFileName(*global_lock, full_path);
+		if (result->failed) {
+			throw IOException("Opening the partition file failed in another thread");
 		}
-		// initialize writes
-		auto info = make_uniq<PartitionWriteInfo>();
-		info->global_state = op.function.copy_to_initialize_global(context.client, *op.bind_data, full_path);
-		auto &result = *info;
-		info->active_writes = 1;
-		// store in active write map
-		active_partitioned_writes.insert(make_pair(values, std::move(info)));
-		return result;
+		return *result;
 	}
 
 	void FinishPartitionWrite(PartitionWriteInfo &info) {
@@ -68,6 +68,14 @@ SinkResultType PhysicalDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkFinalizeType PhysicalDelete::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                          OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<DeleteGlobalState>();
+	// register the deleted rows so that drifted distinct statistics can be rebuilt
+	table.RegisterChangedRows(context, gstate.deleted_count);
+	return SinkFinalizeType::READY;
+}
+
 unique_ptr<GlobalSinkState> PhysicalDelete::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<DeleteGlobalState>(context, GetTypes());
 }
@@ -156,6 +156,14 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkFinalizeType PhysicalUpdate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                          OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<UpdateGlobalState>();
+	// register the updated rows so that drifted distinct statistics can be rebuilt
+	table.RegisterChangedRows(context, gstate.updated_count);
+	return SinkFinalizeType::READY;
+}
+
 unique_ptr<GlobalSinkState> PhysicalUpdate::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<UpdateGlobalState>(context, GetTypes());
 }
@@ -2,6 +2,9 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/join_bloom_filter.hpp"
+#include "duckdb/execution/join_range_filter.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
@@ -85,9 +88,30 @@ SourceResultType PhysicalTableScan::GetData(ExecutionContext &context, DataChunk
 	auto &gstate = input.global_state.Cast<TableScanGlobalSourceState>();
 	auto &state = input.local_state.Cast<TableScanLocalSourceState>();
 
-	TableFunctionInput data(bind_data.get(), state.local_state.get(), gstate.global_state.get());
-	if (function.function) {
-		function.function(context.client, data, chunk);
+	TableFunctionInput data(bind_data.get(), state.local_state.get(), gstate.global_state.get(),
+	                        input.interrupt_state);
+	if (function.function || function.async_function) {
+		while (true) {
+			if (function.async_function) {
+				auto source_result = function.async_function(context.client, data, chunk);
+				if (source_result == SourceResultType::BLOCKED) {
+					// the function is waiting for data and has registered a callback on the interrupt state
+					return source_result;
+				}
+			} else {
+				function.function(context.client, data, chunk);
+			}
+			if (chunk.size() == 0 || (bloom_filters.empty() && range_filters.empty())) {
+				break;
+			}
+			ApplyBloomFilters(chunk);
+			ApplyRangeFilters(chunk);
+			if (chunk.size() != 0) {
+				break;
+			}
+			// all scanned rows were filtered out: scan the next batch instead of reporting exhaustion
+			chunk.Reset();
+		}
 	} else {
 		if (gstate.in_out_final) {
 			function.in_out_function_final(context, data, chunk);
@@ -102,6 +126,42 @@ SourceResultType PhysicalTableScan::GetData(ExecutionContext &context, DataChunk
 	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
 }
 
+void PhysicalTableScan::ApplyBloomFilters(DataChunk &chunk) const {
+	for (auto &bloom_filter : bloom_filters) {
+		if (chunk.size() == 0) {
+			break;
+		}
+		if (!bloom_filter.filter->Enabled()) {
+			continue;
+		}
+		// hash the probe column the same way the join build side hashes its keys
+		Vector hashes(LogicalType::HASH);
+		VectorOperations::Hash(chunk.data[bloom_filter.column_index], hashes, chunk.size());
+		hashes.Flatten(chunk.size());
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		const auto result_count = bloom_filter.filter->Filter(hashes, chunk.size(), sel);
+		if (result_count != chunk.size()) {
+			chunk.Slice(sel, result_count);
+		}
+	}
+}
+
+void PhysicalTableScan::ApplyRangeFilters(DataChunk &chunk) const {
+	for (auto &range_filter : range_filters) {
+		if (chunk.size() == 0) {
+			break;
+		}
+		if (!range_filter.filter->Enabled()) {
+			continue;
+		}
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		const auto result_count = range_filter.filter->Filter(chunk.data[range_filter.column_index], chunk.size(), sel);
+		if (result_count != chunk.size()) {
+			chunk.Slice(sel, result_count);
+		}
+	}
+}
+
 double PhysicalTableScan::GetProgress(ClientContext &context, GlobalSourceState &gstate_p) const {
 	auto &gstate = gstate_p.Cast<TableScanGlobalSourceState>();
 	if (function.table_scan_progress) {
@@ -35,6 +35,10 @@ class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	//! Global index to be added to the table
 	unique_ptr<BoundIndex> global_index;
+	//! Stack of intermediate indexes - combining threads merge these pairwise, so that merging the
+	//! (large) per-thread subtrees runs in parallel instead of being a serial chain of merges
+	mutex merge_lock;
+	vector<unique_ptr<BoundIndex>> merge_stack;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
@@ -144,12 +148,26 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
-	// merge the local index into the global index
-	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	// merge the local index with the intermediate indexes of the other threads:
+	// as long as there is an index on the merge stack, we take it and merge it into our index,
+	// otherwise, we leave our index on the stack for another thread (or Finalize) to pick up.
+	// the pairwise merges of different threads run in parallel this way
+	auto index = std::move(l_state.local_index);
+	while (true) {
+		unique_ptr<BoundIndex> other_index;
+		{
+			lock_guard<mutex> merge_guard(g_state.merge_lock);
+			if (g_state.merge_stack.empty()) {
+				g_state.merge_stack.push_back(std::move(index));
+				return SinkCombineResultType::FINISHED;
+			}
+			other_index = std::move(g_state.merge_stack.back());
+			g_state.merge_stack.pop_back();
+		}
+		if (!index->MergeIndexes(*other_index)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
 	}
-
-	return SinkCombineResultType::FINISHED;
 }
 
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -158,6 +176,15 @@ SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &eve
 	// here, we set the resulting global index as the newly created index of the table
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 
+	// merge the remaining intermediate index into the global index
+	// the pairwise merges in Combine leave at most one index on the stack
+	for (auto &index : state.merge_stack) {
+		if (!state.global_index->MergeIndexes(*index)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
+	state.merge_stack.clear();
+
 	// vacuum excess memory and verify
 	state.global_index->Vacuum();
 	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
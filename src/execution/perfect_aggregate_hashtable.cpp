@@ -24,26 +24,28 @@ PerfectAggregateHashTable::PerfectAggregateHashTable(ClientContext &context, All
 	layout.Initialize(std::move(aggregate_objects_p));
 	tuple_size = layout.GetRowWidth();
 
-	// allocate and null initialize the data
-	owned_data = make_unsafe_uniq_array<data_t>(tuple_size * total_groups);
-	data = owned_data.get();
+	// allocate and initialize the aggregate states
+	// the states are stored columnar: one contiguous array per aggregate function, so that updating a single
+	// aggregate for many groups touches consecutive memory regardless of how wide the aggregate list is
+	auto &aggregates = layout.GetAggregates();
+	aggregate_data.reserve(aggregates.size());
+	state_strides.reserve(aggregates.size());
+	for (auto &aggr : aggregates) {
+		// align the stride so that every state in the array is as aligned as the allocation itself
+		auto stride = AlignValue(aggr.payload_size);
+		auto states = make_unsafe_uniq_array<data_t>(stride * total_groups);
+		auto state_ptr = states.get();
+		for (idx_t i = 0; i < total_groups; i++) {
+			aggr.function.initialize(state_ptr);
+			state_ptr += stride;
+		}
+		state_strides.push_back(stride);
+		aggregate_data.push_back(std::move(states));
+	}
 
-	// set up the empty payloads for every tuple, and initialize the "occupied" flag to false
+	// initialize the "occupied" flag to false for every group
 	group_is_set = make_unsafe_uniq_array<bool>(total_groups);
 	memset(group_is_set.get(), 0, total_groups * sizeof(bool));
-
-	// initialize the hash table for each entry
-	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
-	idx_t init_count = 0;
-	for (idx_t i = 0; i < total_groups; i++) {
-		address_data[init_count] = uintptr_t(data) + (tuple_size * i);
-		init_count++;
-		if (init_count == STANDARD_VECTOR_SIZE) {
-			RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
-			init_count = 0;
-		}
-	}
-	RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
 }
 
 PerfectAggregateHashTable::~PerfectAggregateHashTable() {
@@ -68,6 +70,12 @@ static void ComputeGroupLocationTemplated(UnifiedVectorFormat &group_data, Value
 				address_data[i] += adjusted_value << current_shift;
 			}
 		}
+	} else if (!group_data.sel->IsSet()) {
+		// no null values and no selection vector: tight loop over consecutive values that auto-vectorizes
+		for (idx_t i = 0; i < count; i++) {
+			auto adjusted_value = UnsafeNumericCast<uintptr_t>((data[i] - min_val) + 1);
+			address_data[i] += adjusted_value << current_shift;
+		}
 	} else {
 		// no null values: we can directly compute the addresses
 		for (idx_t i = 0; i < count; i++) {
@@ -114,33 +122,37 @@ static void ComputeGroupLocation(Vector &group, Value &min, uintptr_t *address_d
 
 void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload) {
 	// first we need to find the location in the HT of each of the groups
-	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
-	// zero-initialize the address data
-	memset(address_data, 0, groups.size() * sizeof(uintptr_t));
+	uintptr_t group_indices[STANDARD_VECTOR_SIZE];
+	// zero-initialize the group indices
+	memset(group_indices, 0, groups.size() * sizeof(uintptr_t));
 	D_ASSERT(groups.ColumnCount() == group_minima.size());
 
 	// then compute the actual group location by iterating over each of the groups
 	idx_t current_shift = total_required_bits;
 	for (idx_t i = 0; i < groups.ColumnCount(); i++) {
 		current_shift -= required_bits[i];
-		ComputeGroupLocation(groups.data[i], group_minima[i], address_data, current_shift, groups.size());
+		ComputeGroupLocation(groups.data[i], group_minima[i], group_indices, current_shift, groups.size());
 	}
-	// now we have the HT entry number for every tuple
-	// compute the actual pointer to the data by adding it to the base HT pointer and multiplying by the tuple size
+	// now we have the HT entry number for every tuple: mark the groups as occupied
 	for (idx_t i = 0; i < groups.size(); i++) {
-		const auto group = address_data[i];
-		D_ASSERT(group < total_groups);
-		group_is_set[group] = true;
-		address_data[i] = uintptr_t(data) + group * tuple_size;
+		D_ASSERT(group_indices[i] < total_groups);
+		group_is_set[group_indices[i]] = true;
 	}
 
 	// after finding the group location we update the aggregates
+	auto address_data = FlatVector::GetData<uintptr_t>(addresses);
 	idx_t payload_idx = 0;
 	auto &aggregates = layout.GetAggregates();
 	RowOperationsState row_state(*aggregate_allocator);
 	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
 		auto &aggregate = aggregates[aggr_idx];
 		auto input_count = (idx_t)aggregate.child_count;
+		// compute the state address of every group within this aggregate's state array
+		const auto base = uintptr_t(aggregate_data[aggr_idx].get());
+		const auto stride = state_strides[aggr_idx];
+		for (idx_t i = 0; i < groups.size(); i++) {
+			address_data[i] = base + group_indices[i] * stride;
+		}
 		if (aggregate.filter) {
 			RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(aggr_idx), aggregate, addresses,
 			                                    payload, payload_idx);
@@ -149,7 +161,6 @@ void PerfectAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload)
 		}
 		// move to the next aggregate
 		payload_idx += input_count;
-		VectorOperations::AddInPlace(addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), payload.size());
 	}
 }
 
@@ -163,27 +174,41 @@ void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
 	auto target_addresses_ptr = FlatVector::GetData<data_ptr_t>(target_addresses);
 
 	// iterate over all entries of both hash tables and call combine for all entries that can be combined
-	data_ptr_t source_ptr = other.data;
-	data_ptr_t target_ptr = data;
-	idx_t combine_count = 0;
-	RowOperationsState row_state(*aggregate_allocator);
+	// this is done one aggregate state array at a time
+	auto &aggregates = layout.GetAggregates();
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx];
+		D_ASSERT(aggr.function.combine);
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), *aggregate_allocator,
+		                                   AggregateCombineType::ALLOW_DESTRUCTIVE);
+		const auto stride = state_strides[aggr_idx];
+		data_ptr_t source_ptr = other.aggregate_data[aggr_idx].get();
+		data_ptr_t target_ptr = aggregate_data[aggr_idx].get();
+		idx_t combine_count = 0;
+		for (idx_t i = 0; i < total_groups; i++) {
+			// we only have any work to do if the source has an entry for this group
+			if (other.group_is_set[i]) {
+				source_addresses_ptr[combine_count] = source_ptr;
+				target_addresses_ptr[combine_count] = target_ptr;
+				combine_count++;
+				if (combine_count == STANDARD_VECTOR_SIZE) {
+					aggr.function.combine(source_addresses, target_addresses, aggr_input_data, combine_count);
+					combine_count = 0;
+				}
+			}
+			source_ptr += stride;
+			target_ptr += stride;
+		}
+		if (combine_count > 0) {
+			aggr.function.combine(source_addresses, target_addresses, aggr_input_data, combine_count);
+		}
+	}
+	// mark all groups that the source has an entry for as occupied
 	for (idx_t i = 0; i < total_groups; i++) {
-		auto has_entry_source = other.group_is_set[i];
-		// we only have any work to do if the source has an entry for this group
-		if (has_entry_source) {
+		if (other.group_is_set[i]) {
 			group_is_set[i] = true;
-			source_addresses_ptr[combine_count] = source_ptr;
-			target_addresses_ptr[combine_count] = target_ptr;
-			combine_count++;
-			if (combine_count == STANDARD_VECTOR_SIZE) {
-				RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
-				combine_count = 0;
-			}
 		}
-		source_ptr += tuple_size;
-		target_ptr += tuple_size;
 	}
-	RowOperations::CombineStates(row_state, layout, source_addresses, target_addresses, combine_count);
 
 	// FIXME: after moving the arena allocator, we currently have to ensure that the pointer is not nullptr, because the
 	// FIXME: Destroy()-function of the hash table expects an allocator in some cases (e.g., for sorted aggregates)
@@ -246,7 +271,6 @@ static void ReconstructGroupVector(uint32_t group_values[], Value &min, idx_t re
 }
 
 void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
-	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
 	uint32_t group_values[STANDARD_VECTOR_SIZE];
 
 	// iterate over the HT until we either have exhausted the entire HT, or
@@ -254,7 +278,6 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	for (; scan_position < total_groups; scan_position++) {
 		if (group_is_set[scan_position]) {
 			// this group is set: add it to the set of groups to extract
-			data_pointers[entry_count] = data + tuple_size * scan_position;
 			group_values[entry_count] = NumericCast<uint32_t>(scan_position);
 			entry_count++;
 			if (entry_count == STANDARD_VECTOR_SIZE) {
@@ -273,40 +296,50 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 		shift -= required_bits[i];
 		ReconstructGroupVector(group_values, group_minima[i], required_bits[i], shift, entry_count, result.data[i]);
 	}
-	// then construct the payloads
+	// then construct the payloads, one aggregate state array at a time
 	result.SetCardinality(entry_count);
-	RowOperationsState row_state(*aggregate_allocator);
-	RowOperations::FinalizeStates(row_state, layout, addresses, result, grouping_columns);
+	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
+	auto &aggregates = layout.GetAggregates();
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx];
+		const auto base = aggregate_data[aggr_idx].get();
+		const auto stride = state_strides[aggr_idx];
+		for (idx_t i = 0; i < entry_count; i++) {
+			data_pointers[i] = base + group_values[i] * stride;
+		}
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), *aggregate_allocator);
+		aggr.function.finalize(addresses, aggr_input_data, result.data[grouping_columns + aggr_idx], entry_count, 0);
+	}
 }
 
 void PerfectAggregateHashTable::Destroy() {
-	// check if there is any destructor to call
-	bool has_destructor = false;
-	for (auto &aggr : layout.GetAggregates()) {
-		if (aggr.function.destructor) {
-			has_destructor = true;
-		}
-	}
-	if (!has_destructor) {
-		return;
-	}
-	// there are aggregates with destructors: loop over the hash table
-	// and call the destructor method for each of the aggregates
+	// for all aggregates with destructors: loop over their state arrays
+	// and call the destructor method for every state
 	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
-	idx_t count = 0;
+	auto &aggregates = layout.GetAggregates();
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx];
+		if (!aggr.function.destructor) {
+			continue;
+		}
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), *aggregate_allocator);
+		const auto stride = state_strides[aggr_idx];
+		data_ptr_t state_ptr = aggregate_data[aggr_idx].get();
+		idx_t count = 0;
 
-	// iterate over all initialised slots of the hash table
-	RowOperationsState row_state(*aggregate_allocator);
-	data_ptr_t payload_ptr = data;
-	for (idx_t i = 0; i < total_groups; i++) {
-		data_pointers[count++] = payload_ptr;
-		if (count == STANDARD_VECTOR_SIZE) {
-			RowOperations::DestroyStates(row_state, layout, addresses, count);
-			count = 0;
+		// iterate over all initialised states of this aggregate
+		for (idx_t i = 0; i < total_groups; i++) {
+			data_pointers[count++] = state_ptr;
+			if (count == STANDARD_VECTOR_SIZE) {
+				aggr.function.destructor(addresses, aggr_input_data, count);
+				count = 0;
+			}
+			state_ptr += stride;
+		}
+		if (count > 0) {
+			aggr.function.destructor(addresses, aggr_input_data, count);
 		}
-		payload_ptr += tuple_size;
 	}
-	RowOperations::DestroyStates(row_state, layout, addresses, count);
 }
 
 } // namespace duckdb
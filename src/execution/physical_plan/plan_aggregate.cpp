@@ -59,17 +59,20 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		if (!stats) {
 			// no stats, but we might still be able to use perfect hashing if the type is small enough
 			// for small types we can just set the stats to [type_min, type_max]
-			switch (group_type.InternalType()) {
-			case PhysicalType::INT8:
-			case PhysicalType::INT16:
-			case PhysicalType::UINT8:
-			case PhysicalType::UINT16:
-				break;
-			default:
-				// type is too large and there are no stats: skip perfect hashing
-				return false;
+			if (group_type.id() != LogicalTypeId::ENUM) {
+				switch (group_type.InternalType()) {
+				case PhysicalType::INT8:
+				case PhysicalType::INT16:
+				case PhysicalType::UINT8:
+				case PhysicalType::UINT16:
+					break;
+				default:
+					// type is too large and there are no stats: skip perfect hashing
+					return false;
+				}
 			}
 			// construct stats with the min and max value of the type
+			// for enums the domain is bounded by the dictionary size regardless of the physical type
 			stats = NumericStats::CreateUnknown(group_type).ToUnique();
 			NumericStats::SetMin(*stats, Value::MinimumValue(group_type));
 			NumericStats::SetMax(*stats, Value::MaximumValue(group_type));
@@ -4,6 +4,9 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/join_bloom_filter.hpp"
+#include "duckdb/execution/join_range_filter.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
@@ -125,6 +128,95 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+//! Walk down the probe side of a join to find the table scan that produces the probe column,
+//! mapping the column index through any intermediate projections
+static optional_ptr<PhysicalTableScan> ResolveProbeColumnScan(PhysicalOperator &op, idx_t &column_index) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if ((!scan.function.function && !scan.function.async_function) || scan.function.in_out_function) {
+			return nullptr;
+		}
+		if (column_index >= scan.GetTypes().size()) {
+			return nullptr;
+		}
+		return &scan;
+	}
+	case PhysicalOperatorType::PROJECTION: {
+		auto &projection = op.Cast<PhysicalProjection>();
+		if (column_index >= projection.select_list.size()) {
+			return nullptr;
+		}
+		auto &expr = *projection.select_list[column_index];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_index = expr.Cast<BoundReferenceExpression>().index;
+		return ResolveProbeColumnScan(*op.children[0], column_index);
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//! Try to push a bloom filter over the build-side key hashes into the probe-side table scan,
+//! so rows that cannot match any build key are dropped before they reach the probe
+static void TryPushBloomFilterIntoScan(PhysicalHashJoin &hash_join, idx_t build_cardinality) {
+	if (hash_join.join_type != JoinType::INNER || hash_join.conditions.size() != 1) {
+		// only for inner joins with a single condition is the probe-column hash equal to the build-key hash
+		return;
+	}
+	auto &condition = hash_join.conditions[0];
+	if (condition.comparison != ExpressionType::COMPARE_EQUAL) {
+		return;
+	}
+	auto &probe_expr = *condition.left;
+	if (probe_expr.type != ExpressionType::BOUND_REF) {
+		return;
+	}
+	idx_t column_index = probe_expr.Cast<BoundReferenceExpression>().index;
+	auto scan = ResolveProbeColumnScan(*hash_join.children[0], column_index);
+	if (!scan) {
+		return;
+	}
+	hash_join.bloom_filter = make_shared_ptr<JoinBloomFilter>(build_cardinality);
+	scan->bloom_filters.push_back(PushedDownBloomFilter {hash_join.bloom_filter, column_index});
+}
+
+//! Try to push the build-side key bounds of a merge join into the probe-side table scan,
+//! so rows that cannot satisfy the range condition are dropped before they reach the sort
+static void TryPushRangeFilterIntoScan(PhysicalPiecewiseMergeJoin &merge_join) {
+	if (merge_join.join_type != JoinType::INNER) {
+		// only for inner joins can probe rows outside the bounds be dropped entirely
+		return;
+	}
+	// the primary condition determines the sort order, and is the only one we can bound
+	auto &condition = merge_join.conditions[0];
+	switch (condition.comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		break;
+	default:
+		return;
+	}
+	auto &probe_expr = *condition.left;
+	if (probe_expr.type != ExpressionType::BOUND_REF) {
+		return;
+	}
+	if (!JoinRangeFilter::SupportedKeyType(probe_expr.return_type)) {
+		return;
+	}
+	idx_t column_index = probe_expr.Cast<BoundReferenceExpression>().index;
+	auto scan = ResolveProbeColumnScan(*merge_join.children[0], column_index);
+	if (!scan) {
+		return;
+	}
+	merge_join.range_filter = make_shared_ptr<JoinRangeFilter>(condition.comparison, probe_expr.return_type);
+	scan->range_filters.push_back(PushedDownRangeFilter {merge_join.range_filter, column_index});
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -201,7 +293,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
 		                                   op.join_type, op.left_projection_map, op.right_projection_map,
 		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
-
+		TryPushBloomFilterIntoScan(plan->Cast<PhysicalHashJoin>(), rhs_cardinality);
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
 		    right->estimated_cardinality <= client_config.nested_loop_join_threshold) {
@@ -222,6 +314,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 			plan =
 			    make_uniq<PhysicalPiecewiseMergeJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
 			                                          op.join_type, op.estimated_cardinality);
+			TryPushRangeFilterIntoScan(plan->Cast<PhysicalPiecewiseMergeJoin>());
 		} else if (PhysicalNestedLoopJoin::IsSupported(op.conditions, op.join_type)) {
 			// inequality join: use nested loop
 			plan = make_uniq<PhysicalNestedLoopJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
@@ -102,10 +102,14 @@ public:
 	void SetRadixBits(idx_t radix_bits_p);
 	bool SetRadixBitsToExternal();
 	idx_t GetRadixBits() const;
+	//! Grow from unpartitioned to the thread-based fan-out once the observed group cardinality
+	//! shows that the aggregation will not stay cache-resident
+	void SetRadixBitsForCardinality(idx_t observed_groups);
 
 private:
 	void SetRadixBitsInternal(const idx_t radix_bits_p, bool external);
 	static idx_t InitialSinkRadixBits(ClientContext &context);
+	static idx_t CardinalitySinkRadixBits(ClientContext &context);
 	static idx_t MaximumSinkRadixBits(ClientContext &context);
 	static idx_t ExternalRadixBits(const idx_t &maximum_sink_radix_bits_p);
 	static idx_t SinkCapacity(ClientContext &context);
@@ -129,6 +133,8 @@ private:
 	RadixHTGlobalSinkState &sink;
 	//! Current thread-global sink radix bits
 	atomic<idx_t> sink_radix_bits;
+	//! Sink radix bits to move to once the observed cardinality warrants partitioning (based on number of threads)
+	const idx_t cardinality_sink_radix_bits;
 	//! Maximum Sink radix bits (set based on number of threads)
 	const idx_t maximum_sink_radix_bits;
 	//! Radix bits if we go external
@@ -142,6 +148,8 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! Start partitioning once the observed number of groups exceeds this ratio of the sink capacity
+	static constexpr const double ADAPTIVE_RADIX_CAPACITY_RATIO = 0.5;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -168,6 +176,8 @@ public:
 	atomic<bool> external;
 	//! Threads that have called Sink
 	atomic<idx_t> active_threads;
+	//! Upper-bound estimate of the unique groups observed across all threads (input to the adaptive fan-out)
+	atomic<idx_t> observed_group_count;
 	//! Number of threads (from TaskScheduler)
 	const idx_t number_of_threads;
 	//! If any thread has called combine
@@ -194,8 +204,9 @@ public:
 };
 
 RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const RadixPartitionedHashTable &radix_ht_p)
-    : context(context_p), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
+    : context(context_p), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context, "HASH_GROUP_BY")),
       radix_ht(radix_ht_p), config(context, *this), finalized(false), external(false), active_threads(0),
+      observed_group_count(0),
       number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
       any_combined(false), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
       count_before_combining(0), max_partition_size(0) {
@@ -253,6 +264,7 @@ void RadixHTGlobalSinkState::Destroy() {
 
 RadixHTConfig::RadixHTConfig(ClientContext &context, RadixHTGlobalSinkState &sink_p)
     : sink(sink_p), sink_radix_bits(InitialSinkRadixBits(context)),
+      cardinality_sink_radix_bits(CardinalitySinkRadixBits(context)),
       maximum_sink_radix_bits(MaximumSinkRadixBits(context)),
       external_radix_bits(ExternalRadixBits(maximum_sink_radix_bits)), sink_capacity(SinkCapacity(context)) {
 }
@@ -288,10 +300,26 @@ void RadixHTConfig::SetRadixBitsInternal(const idx_t radix_bits_p, bool external
 }
 
 idx_t RadixHTConfig::InitialSinkRadixBits(ClientContext &context) {
+	// start unpartitioned: low-cardinality aggregations never pay the partitioning cost this way,
+	// SetRadixBitsForCardinality moves to the thread-based fan-out when the observed cardinality calls for it
+	return 0;
+}
+
+idx_t RadixHTConfig::CardinalitySinkRadixBits(ClientContext &context) {
 	const auto active_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	return MinValue(RadixPartitioning::RadixBits(NextPowerOfTwo(active_threads)), MAXIMUM_INITIAL_SINK_RADIX_BITS);
 }
 
+void RadixHTConfig::SetRadixBitsForCardinality(idx_t observed_groups) {
+	if (sink_radix_bits != 0 || cardinality_sink_radix_bits == 0) {
+		return; // we already moved away from the unpartitioned state
+	}
+	if (static_cast<double>(observed_groups) < ADAPTIVE_RADIX_CAPACITY_RATIO * static_cast<double>(sink_capacity)) {
+		return; // still few enough groups that an unpartitioned cache-resident hash table wins
+	}
+	SetRadixBits(cardinality_sink_radix_bits);
+}
+
 idx_t RadixHTConfig::MaximumSinkRadixBits(ClientContext &context) {
 	const auto active_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	return MinValue(RadixPartitioning::RadixBits(NextPowerOfTwo(active_threads)), MAXIMUM_FINAL_SINK_RADIX_BITS);
@@ -410,6 +438,9 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 		return false;
 	}
 
+	// We started unpartitioned: check whether the observed cardinality warrants partitioning by now
+	config.SetRadixBitsForCardinality(gstate.observed_group_count.load());
+
 	const auto partition_count = partitioned_data->PartitionCount();
 	const auto current_radix_bits = RadixPartitioning::RadixBits(partition_count);
 	D_ASSERT(current_radix_bits <= config.GetRadixBits());
@@ -448,7 +479,10 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
+	const auto new_groups = ht.AddChunk(group_chunk, payload_input, filter);
+	if (new_groups != 0) {
+		gstate.observed_group_count += new_groups;
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
@@ -535,6 +569,13 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 				gstate.partitions.back()->state = AggregatePartitionState::READY_TO_SCAN;
 			}
 		}
+
+		// Tasks pick up partitions in order: start the largest merges first, so that long-running merges overlap
+		// with many small ones instead of forming a serial tail at the end of the source phase
+		std::sort(gstate.partitions.begin(), gstate.partitions.end(),
+		          [](const unique_ptr<AggregatePartition> &lhs, const unique_ptr<AggregatePartition> &rhs) {
+			          return lhs->data->Count() > rhs->data->Count();
+		          });
 	} else {
 		gstate.count_before_combining = 0;
 	}
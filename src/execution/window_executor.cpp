@@ -623,6 +623,7 @@ public:
 	}
 
 	virtual void UpdateBounds(idx_t row_idx, DataChunk &input_chunk, const WindowInputColumn &range);
+	void CopyBounds(const WindowExecutorBoundsState &source);
 
 	// Frame management
 	const ValidityMask &partition_mask;
@@ -654,6 +655,12 @@ void WindowExecutorBoundsState::UpdateBounds(idx_t row_idx, DataChunk &input_chu
 	state.Bounds(bounds, row_idx, range, count, boundary_start, boundary_end, partition_mask, order_mask);
 }
 
+void WindowExecutorBoundsState::CopyBounds(const WindowExecutorBoundsState &source) {
+	// copy instead of referencing: some executors adjust their bounds while applying exclusion
+	bounds.Reset();
+	source.bounds.Copy(bounds);
+}
+
 //===--------------------------------------------------------------------===//
 // ExclusionFilter
 //===--------------------------------------------------------------------===//
@@ -935,10 +942,38 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+bool WindowExecutor::CanShareBounds(const WindowExecutor &other) const {
+	auto &lhs = wexpr;
+	auto &rhs = other.wexpr;
+	if (!lhs.KeysAreCompatible(rhs)) {
+		return false;
+	}
+	if (lhs.start != rhs.start || lhs.end != rhs.end) {
+		return false;
+	}
+	if (!Expression::Equals(lhs.start_expr, rhs.start_expr) || !Expression::Equals(lhs.end_expr, rhs.end_expr)) {
+		return false;
+	}
+	// the peer bounds are only filled in when they are needed (see WindowBoundariesState::Bounds)
+	if (WindowBoundariesState::ExpressionNeedsPeer(lhs.type) != WindowBoundariesState::ExpressionNeedsPeer(rhs.type)) {
+		return false;
+	}
+	if ((lhs.exclude_clause >= WindowExcludeMode::GROUP) != (rhs.exclude_clause >= WindowExcludeMode::GROUP)) {
+		return false;
+	}
+	return true;
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-                              WindowExecutorGlobalState &gstate) const {
+                              WindowExecutorGlobalState &gstate,
+                              optional_ptr<const WindowExecutorLocalState> bounds_source) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
-	lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	if (bounds_source) {
+		// an executor with an equivalent frame already computed the bounds for this chunk
+		lbstate.CopyBounds(bounds_source->Cast<WindowExecutorBoundsState>());
+	} else {
+		lbstate.UpdateBounds(row_idx, input_chunk, gstate.range);
+	}
 
 	const auto count = input_chunk.size();
 	EvaluateInternal(gstate, lstate, result, count, row_idx);
@@ -1112,6 +1147,12 @@ void WindowAggregateExecutor::Finalize(WindowExecutorGlobalState &gstate) const
 	aggregator->Finalize(*gsink, stats);
 }
 
+bool WindowAggregateExecutor::TryFinalizeTask(WindowExecutorGlobalState &gstate) const {
+	auto &gastate = gstate.Cast<WindowAggregateExecutorGlobalState>();
+	D_ASSERT(gastate.aggregator);
+	return gastate.aggregator->TryFinalizeTask(*gastate.gsink);
+}
+
 class WindowAggregateExecutorLocalState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateExecutorLocalState(const WindowExecutorGlobalState &gstate, const WindowAggregator &aggregator)
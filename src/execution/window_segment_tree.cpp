@@ -4,6 +4,7 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/merge_sort_tree.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
 
@@ -78,6 +79,10 @@ void WindowAggregator::Sink(WindowAggregatorState &gsink, DataChunk &payload_chu
 void WindowAggregator::Finalize(WindowAggregatorState &gstate, const FrameStats &stats) {
 }
 
+bool WindowAggregator::TryFinalizeTask(WindowAggregatorState &gsink) const {
+	return false;
+}
+
 //===--------------------------------------------------------------------===//
 // WindowConstantAggregator
 //===--------------------------------------------------------------------===//
@@ -702,11 +707,15 @@ void WindowNaiveAggregator::Evaluate(const WindowAggregatorState &gsink, WindowA
 class WindowSegmentTreeGlobalState : public WindowAggregatorGlobalState {
 public:
 	WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count)
-	    : WindowAggregatorGlobalState(aggregator, group_count), tree(aggregator), internal_nodes(0) {
+	    : WindowAggregatorGlobalState(aggregator, group_count), tree(aggregator), internal_nodes(0),
+	      build_active(false), build_next(0), build_completed(0), leaf_nodes(0) {
 	}
 	~WindowSegmentTreeGlobalState() override;
 
 	void ConstructTree();
+	//! Builds a range of leaf (level 0) nodes. Can be called by any thread while a build is active.
+	//! Returns true if any work was done.
+	bool TryBuildLeafNodes();
 
 	//! The owning aggregator
 	const WindowSegmentTree &tree;
@@ -717,8 +726,23 @@ public:
 	//! The total number of internal nodes of the tree, stored in levels_flat_native
 	idx_t internal_nodes;
 
+	//! Whether a leaf level build is in progress (published after the node array has been allocated)
+	atomic<bool> build_active;
+	//! The next leaf node range to build
+	atomic<idx_t> build_next;
+	//! The number of leaf nodes that have been built
+	atomic<idx_t> build_completed;
+	//! The number of leaf nodes
+	idx_t leaf_nodes;
+	//! The aggregate states may point into the arenas of the threads that built them,
+	//! so they are kept alive here for as long as the tree
+	mutex build_lock;
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The number of leaf nodes a build task processes at a time
+	static constexpr idx_t BUILD_TASK_NODES = 4096;
 };
 
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const vector<LogicalType> &arg_types,
@@ -740,6 +764,11 @@ void WindowSegmentTree::Finalize(WindowAggregatorState &gsink, const FrameStats
 	}
 }
 
+bool WindowSegmentTree::TryFinalizeTask(WindowAggregatorState &gsink) const {
+	auto &gasink = gsink.Cast<WindowSegmentTreeGlobalState>();
+	return gasink.TryBuildLeafNodes();
+}
+
 WindowSegmentTreeGlobalState::~WindowSegmentTreeGlobalState() {
 	if (!tree.aggr.function.destructor) {
 		// nothing to destroy
@@ -964,12 +993,40 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 	}
 }
 
+bool WindowSegmentTreeGlobalState::TryBuildLeafNodes() {
+	if (!build_active) {
+		return false;
+	}
+	const auto build_begin = build_next.fetch_add(BUILD_TASK_NODES);
+	if (build_begin >= leaf_nodes) {
+		return false;
+	}
+	const auto build_end = MinValue<idx_t>(leaf_nodes, build_begin + BUILD_TASK_NODES);
+
+	//	Aggregate into the claimed range of leaf nodes using a thread-local part
+	auto local_state = make_uniq<WindowAggregatorState>();
+	WindowSegmentTreePart part(local_state->allocator, tree.aggr, inputs, filter_mask);
+	const auto count = inputs.size();
+	for (idx_t leaf_idx = build_begin; leaf_idx < build_end; ++leaf_idx) {
+		data_ptr_t state_ptr = levels_flat_native.get() + (leaf_idx * tree.state_size);
+		part.aggr.function.initialize(state_ptr);
+		const auto pos = leaf_idx * TREE_FANOUT;
+		part.WindowSegmentValue(*this, 0, pos, MinValue<idx_t>(count, pos + TREE_FANOUT), state_ptr);
+	}
+	part.FlushStates(false);
+
+	//	The leaf states may reference the arena, so keep it alive for as long as the tree
+	{
+		lock_guard<mutex> build_guard(build_lock);
+		build_states.emplace_back(std::move(local_state));
+	}
+	build_completed += build_end - build_begin;
+	return true;
+}
+
 void WindowSegmentTreeGlobalState::ConstructTree() {
 	D_ASSERT(inputs.ColumnCount() > 0);
 
-	//	Single part for constructing the tree
-	WindowSegmentTreePart gtstate(allocator, tree.aggr, inputs, filter_mask);
-
 	// compute space required to store internal nodes of segment tree
 	internal_nodes = 0;
 	idx_t level_nodes = inputs.size();
@@ -980,19 +1037,40 @@ void WindowSegmentTreeGlobalState::ConstructTree() {
 	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * tree.state_size);
 	levels_flat_start.push_back(0);
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
+	// Corner case: single element in the window
+	if (inputs.size() <= 1) {
+		tree.aggr.function.initialize(levels_flat_native.get());
+		return;
+	}
+
+	//	Build the leaf level cooperatively: it is the bulk of the work,
+	//	and threads that are waiting for this partition can claim node ranges through TryFinalizeTask
+	leaf_nodes = (inputs.size() + (TREE_FANOUT - 1)) / TREE_FANOUT;
+	build_next = 0;
+	build_completed = 0;
+	build_active = true;
+	while (TryBuildLeafNodes()) {
+	}
+	//	Wait until the helpers have finished their claimed ranges
+	while (build_completed < leaf_nodes) {
+		TaskScheduler::YieldThread();
+	}
+	build_active = false;
+	levels_flat_start.push_back(leaf_nodes);
+
+	//	The upper levels are at most 1/TREE_FANOUT of the work, so build them serially
+	WindowSegmentTreePart gtstate(allocator, tree.aggr, inputs, filter_mask);
+	idx_t levels_flat_offset = leaf_nodes;
+	idx_t level_current = 1;
 	idx_t level_size;
 	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
+	while ((level_size = levels_flat_offset - levels_flat_start[level_current - 1]) > 1) {
 		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
 			// compute the aggregate for this entry in the segment tree
 			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * tree.state_size);
 			gtstate.aggr.function.initialize(state_ptr);
 			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
+			gtstate.FlushStates(true);
 
 			levels_flat_offset++;
 		}
@@ -1000,11 +1078,6 @@ void WindowSegmentTreeGlobalState::ConstructTree() {
 		levels_flat_start.push_back(levels_flat_offset);
 		level_current++;
 	}
-
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		gtstate.aggr.function.initialize(levels_flat_native.get());
-	}
 }
 
 void WindowSegmentTree::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
@@ -1,3 +1,5 @@
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_search_path.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -192,6 +194,51 @@ string PragmaUserAgent(ClientContext &context, const FunctionParameters &paramet
 	return "SELECT * FROM pragma_user_agent()";
 }
 
+string PragmaClusterTable(ClientContext &context, const FunctionParameters &parameters) {
+	auto qualified_name = QualifiedName::Parse(parameters.values[0].ToString());
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, qualified_name.catalog, qualified_name.schema,
+	                                                   qualified_name.name);
+	if (!table.IsDuckTable()) {
+		throw NotImplementedException("PRAGMA cluster can only cluster DuckDB tables");
+	}
+	string order_by;
+	for (idx_t i = 1; i < parameters.values.size(); i++) {
+		auto column_name = parameters.values[i].ToString();
+		if (!table.ColumnExists(column_name)) {
+			throw BinderException("Column \"%s\" of table \"%s\" referenced in PRAGMA cluster does not exist",
+			                      column_name, table.name);
+		}
+		if (!order_by.empty()) {
+			order_by += ", ";
+		}
+		order_by += KeywordHelper::WriteOptionallyQuoted(column_name);
+	}
+	// only the physical columns are rewritten - generated columns cannot be inserted into
+	string column_list;
+	for (auto &col : table.GetColumns().Physical()) {
+		if (!column_list.empty()) {
+			column_list += ", ";
+		}
+		column_list += KeywordHelper::WriteOptionallyQuoted(col.Name());
+	}
+	auto table_name =
+	    StringUtil::Format("%s.%s.%s", KeywordHelper::WriteOptionallyQuoted(table.ParentCatalog().GetName()),
+	                       KeywordHelper::WriteOptionallyQuoted(table.ParentSchema().name),
+	                       KeywordHelper::WriteOptionallyQuoted(table.name));
+	// rewrite the table in sorted order, so that the zone maps of the row groups cover disjoint value ranges;
+	// the explicit transaction makes the rewrite atomic, and fails up front (before anything is modified) when the
+	// pragma is run inside another transaction
+	return StringUtil::Format(R"(
+	BEGIN TRANSACTION;
+	CREATE OR REPLACE TEMPORARY TABLE __duckdb_cluster_tmp AS SELECT %s FROM %s ORDER BY %s;
+	DELETE FROM %s;
+	INSERT INTO %s (%s) SELECT %s FROM __duckdb_cluster_tmp;
+	DROP TABLE __duckdb_cluster_tmp;
+	COMMIT;
+	)",
+	                          column_list, table_name, order_by, table_name, table_name, column_list, column_list);
+}
+
 void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaCall("table_info", PragmaTableInfo, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaCall("storage_info", PragmaStorageInfo, {LogicalType::VARCHAR}));
@@ -207,6 +254,8 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("database_size", PragmaDatabaseSize));
 	set.AddFunction(PragmaFunction::PragmaStatement("functions", PragmaFunctionsQuery));
 	set.AddFunction(PragmaFunction::PragmaCall("import_database", PragmaImportDatabase, {LogicalType::VARCHAR}));
+	set.AddFunction(PragmaFunction::PragmaCall("cluster", PragmaClusterTable,
+	                                           {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::VARCHAR));
 	set.AddFunction(
 	    PragmaFunction::PragmaCall("copy_database", PragmaCopyDatabase, {LogicalType::VARCHAR, LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("all_profiling_output", PragmaAllProfiling));
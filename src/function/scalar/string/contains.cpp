@@ -2,7 +2,9 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
 
 namespace duckdb {
 
@@ -151,11 +153,36 @@ struct ContainsOperator {
 	}
 };
 
+static unique_ptr<BaseStatistics> ContainsPropagateStats(ClientContext &context, FunctionStatisticsInput &input) {
+	auto &expr = input.expr;
+	D_ASSERT(input.child_stats.size() == 2);
+	// we can only prune if the needle is a constant
+	if (expr.children[1]->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return nullptr;
+	}
+	auto &needle = expr.children[1]->Cast<BoundConstantExpression>();
+	auto &haystack_stats = input.child_stats[0];
+	if (needle.value.IsNull() || haystack_stats.GetType().id() != LogicalTypeId::VARCHAR) {
+		return nullptr;
+	}
+	if (haystack_stats.CanHaveNull()) {
+		// a NULL haystack results in NULL, not false - we can only fold to a constant if there are no NULLs
+		return nullptr;
+	}
+	auto prune = StringStats::CheckContains(haystack_stats, StringValue::Get(needle.value));
+	if (prune == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		// the ngram filter shows the needle cannot occur in any of the strings
+		*input.expr_ptr = make_uniq<BoundConstantExpression>(Value::BOOLEAN(false));
+	}
+	return nullptr;
+}
+
 ScalarFunction ContainsFun::GetFunction() {
 	return ScalarFunction("contains",                                   // name of the function
 	                      {LogicalType::VARCHAR, LogicalType::VARCHAR}, // argument list
 	                      LogicalType::BOOLEAN,                         // return type
-	                      ScalarFunction::BinaryFunction<string_t, string_t, bool, ContainsOperator>);
+	                      ScalarFunction::BinaryFunction<string_t, string_t, bool, ContainsOperator>, nullptr, nullptr,
+	                      ContainsPropagateStats);
 }
 
 void ContainsFun::RegisterFunction(BuiltinFunctions &set) {
@@ -149,34 +149,42 @@ struct LikeMatcher : public FunctionData {
 
 	static unique_ptr<LikeMatcher> CreateLikeMatcher(string like_pattern, char escape = '\0') {
 		vector<LikeSegment> segments;
-		idx_t last_non_pattern = 0;
+		string current_segment;
 		bool has_start_percentage = false;
 		bool has_end_percentage = false;
 		for (idx_t i = 0; i < like_pattern.size(); i++) {
 			auto ch = like_pattern[i];
-			if (ch == escape || ch == '%' || ch == '_') {
-				// special character, push a constant pattern
-				if (i > last_non_pattern) {
-					segments.emplace_back(like_pattern.substr(last_non_pattern, i - last_non_pattern));
-				}
-				last_non_pattern = i + 1;
-				if (ch == escape || ch == '_') {
-					// escape or underscore: could not create efficient like matcher
-					// FIXME: we could handle escaped percentages here
+			if (escape != '\0' && ch == escape) {
+				// escape character: match the next character literally
+				i++;
+				if (i == like_pattern.size()) {
+					// pattern ends in an escape character - the per-row path throws for this
 					return nullptr;
-				} else {
-					// sample_size
-					if (i == 0) {
-						has_start_percentage = true;
-					}
-					if (i + 1 == like_pattern.size()) {
-						has_end_percentage = true;
-					}
 				}
+				current_segment += like_pattern[i];
+				continue;
+			}
+			if (ch == '_') {
+				// underscore: could not create efficient like matcher
+				return nullptr;
+			}
+			if (ch == '%') {
+				if (i == 0) {
+					has_start_percentage = true;
+				}
+				if (i + 1 == like_pattern.size()) {
+					has_end_percentage = true;
+				}
+				if (!current_segment.empty()) {
+					segments.emplace_back(std::move(current_segment));
+					current_segment = string();
+				}
+				continue;
 			}
+			current_segment += ch;
 		}
-		if (last_non_pattern < like_pattern.size()) {
-			segments.emplace_back(like_pattern.substr(last_non_pattern, like_pattern.size() - last_non_pattern));
+		if (!current_segment.empty()) {
+			segments.emplace_back(std::move(current_segment));
 		}
 		if (segments.empty()) {
 			return nullptr;
@@ -212,6 +220,26 @@ static unique_ptr<FunctionData> LikeBindFunction(ClientContext &context, ScalarF
 	return nullptr;
 }
 
+static unique_ptr<FunctionData> LikeEscapeBindFunction(ClientContext &context, ScalarFunction &bound_function,
+                                                       vector<unique_ptr<Expression>> &arguments) {
+	// if both the pattern and the escape are constant, we can prepare the matcher at bind time
+	D_ASSERT(arguments.size() == 3);
+	if (!arguments[1]->IsFoldable() || !arguments[2]->IsFoldable()) {
+		return nullptr;
+	}
+	Value pattern_str = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+	Value escape_str = ExpressionExecutor::EvaluateScalar(context, *arguments[2]);
+	if (pattern_str.IsNull() || escape_str.IsNull()) {
+		return nullptr;
+	}
+	auto escape = escape_str.ToString();
+	if (escape.size() > 1) {
+		// invalid escape string - the per-row path throws for this
+		return nullptr;
+	}
+	return LikeMatcher::CreateLikeMatcher(pattern_str.ToString(), escape.empty() ? '\0' : escape[0]);
+}
+
 bool LikeOperatorFunction(const char *s, idx_t slen, const char *pattern, idx_t plen, char escape) {
 	return TemplatedLikeOperator<'%', '_', true>(s, slen, pattern, plen, escape);
 }
@@ -473,12 +501,21 @@ struct GlobOperator {
 };
 
 // This can be moved to the scalar_function class
-template <typename FUNC>
+template <typename FUNC, bool INVERT>
 static void LikeEscapeFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &str = args.data[0];
 	auto &pattern = args.data[1];
 	auto &escape = args.data[2];
 
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	if (func_expr.bind_info) {
+		auto &matcher = func_expr.bind_info->Cast<LikeMatcher>();
+		// use fast like matcher
+		UnaryExecutor::Execute<string_t, bool>(str, result, args.size(), [&](string_t input) {
+			return INVERT ? !matcher.Match(input) : matcher.Match(input);
+		});
+		return;
+	}
 	TernaryExecutor::Execute<string_t, string_t, string_t, bool>(
 	    str, pattern, escape, result, args.size(), FUNC::template Operation<string_t, string_t, string_t>);
 }
@@ -538,17 +575,19 @@ void LikeEscapeFun::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(GetLikeEscapeFun());
 	set.AddFunction({"not_like_escape"},
 	                ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
-	                               LogicalType::BOOLEAN, LikeEscapeFunction<NotLikeEscapeOperator>));
+	                               LogicalType::BOOLEAN, LikeEscapeFunction<NotLikeEscapeOperator, true>,
+	                               LikeEscapeBindFunction));
 
-	set.AddFunction({"ilike_escape"}, ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
-	                                                 LogicalType::BOOLEAN, LikeEscapeFunction<ILikeEscapeOperator>));
+	set.AddFunction({"ilike_escape"},
+	                ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
+	                               LogicalType::BOOLEAN, LikeEscapeFunction<ILikeEscapeOperator, false>));
 	set.AddFunction({"not_ilike_escape"},
 	                ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
-	                               LogicalType::BOOLEAN, LikeEscapeFunction<NotILikeEscapeOperator>));
+	                               LogicalType::BOOLEAN, LikeEscapeFunction<NotILikeEscapeOperator, true>));
 }
 
 ScalarFunction LikeEscapeFun::GetLikeEscapeFun() {
 	return ScalarFunction("like_escape", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
-	                      LogicalType::BOOLEAN, LikeEscapeFunction<LikeEscapeOperator>);
+	                      LogicalType::BOOLEAN, LikeEscapeFunction<LikeEscapeOperator, false>, LikeEscapeBindFunction);
 }
 } // namespace duckdb
@@ -8,6 +8,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "re2/regexp.h"
 #include "utf8proc_wrapper.hpp"
 
 namespace duckdb {
@@ -49,6 +50,50 @@ unique_ptr<FunctionLocalState> RegexInitLocalState(ExpressionState &state, const
 //===--------------------------------------------------------------------===//
 // Regexp Matches
 //===--------------------------------------------------------------------===//
+//! Extract the longest literal substring that any match of "regexp" must contain,
+//! or an empty string if no such literal can be found
+static string FindRequiredLiteral(duckdb_re2::Regexp *regexp) {
+	switch (regexp->op()) {
+	case duckdb_re2::kRegexpLiteral:
+	case duckdb_re2::kRegexpLiteralString: {
+		if (regexp->parse_flags() & duckdb_re2::Regexp::FoldCase) {
+			// a case-insensitive literal is not a fixed byte sequence
+			return string();
+		}
+		string literal;
+		auto nrunes = regexp->op() == duckdb_re2::kRegexpLiteral ? idx_t(1) : idx_t(regexp->nrunes());
+		for (idx_t i = 0; i < nrunes; i++) {
+			auto rune = regexp->op() == duckdb_re2::kRegexpLiteral ? regexp->rune() : regexp->runes()[i];
+			int sz = 0;
+			char utf8_str[4];
+			if (!Utf8Proc::CodepointToUtf8(rune, sz, utf8_str)) {
+				// invalid codepoint
+				return string();
+			}
+			literal.append(utf8_str, idx_t(sz));
+		}
+		return literal;
+	}
+	case duckdb_re2::kRegexpConcat:
+	case duckdb_re2::kRegexpCapture:
+	case duckdb_re2::kRegexpPlus: {
+		// every child of a concatenation must match in sequence, and the body of a capture group
+		// or a plus repetition must match at least once - take the longest literal of the children
+		string longest;
+		for (int i = 0; i < regexp->nsub(); i++) {
+			auto literal = FindRequiredLiteral(regexp->sub()[i]);
+			if (literal.size() > longest.size()) {
+				longest = std::move(literal);
+			}
+		}
+		return longest;
+	}
+	default:
+		// alternations, optional parts, etc. do not guarantee the presence of any literal
+		return string();
+	}
+}
+
 RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, string constant_string_p,
                                              bool constant_pattern)
     : RegexpBaseBindData(options, std::move(constant_string_p), constant_pattern) {
@@ -59,6 +104,7 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 		}
 
 		range_success = pattern->PossibleMatchRange(&range_min, &range_max, 1000);
+		required_literal = FindRequiredLiteral(pattern->Regexp());
 	} else {
 		range_success = false;
 	}
@@ -72,8 +118,10 @@ RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options, s
 }
 
 unique_ptr<FunctionData> RegexpMatchesBindData::Copy() const {
-	return make_uniq<RegexpMatchesBindData>(options, constant_string, constant_pattern, range_min, range_max,
-	                                        range_success);
+	auto copy = make_uniq<RegexpMatchesBindData>(options, constant_string, constant_pattern, range_min, range_max,
+	                                             range_success);
+	copy->required_literal = required_literal;
+	return std::move(copy);
 }
 
 unique_ptr<FunctionData> RegexpMatchesBind(ClientContext &context, ScalarFunction &bound_function,
@@ -114,6 +162,19 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
+		if (!info.required_literal.empty()) {
+			// every match must contain this literal - skip regex evaluation for rows that cannot match
+			auto literal = const_uchar_ptr_cast(info.required_literal.c_str());
+			auto literal_size = info.required_literal.size();
+			UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+				if (ContainsFun::Find(const_uchar_ptr_cast(input.GetData()), input.GetSize(), literal, literal_size) ==
+				    DConstants::INVALID_INDEX) {
+					return false;
+				}
+				return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
+			});
+			return;
+		}
 		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
 			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
 		});
@@ -76,6 +76,8 @@ void ExtractSingleTuple(const string_t &string, duckdb_re2::RE2 &pattern, int32_
 
 		// Make sure we have enough room for the new entries
 		if (current_list_size + 1 >= current_list_capacity) {
+			// set the size before growing so the entries of this tuple are carried over to the resized child
+			ListVector::SetListSize(result, current_list_size);
 			ListVector::Reserve(result, current_list_capacity * 2);
 			current_list_capacity = ListVector::GetListCapacity(result);
 			list_content = FlatVector::GetData<string_t>(child_vector);
@@ -155,6 +155,66 @@ static vector<unique_ptr<Expression>> CreateCastExpressions(WriteCSVData &bind_d
 	return expressions;
 }
 
+//! Returns whether the text rendering of "type" can never require quotes, i.e. none of the bytes it can consist of
+//! require quoting and it can never be mistaken for the null string
+static bool CanNeverRequireQuotes(WriteCSVData &csv_data, const LogicalType &type) {
+	const char *possible_chars;
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+		possible_chars = "0123456789-";
+		break;
+	case LogicalTypeId::DECIMAL:
+		possible_chars = "0123456789-.";
+		break;
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		// the letters cover "nan" and "inf"
+		possible_chars = "0123456789-+.eanif";
+		break;
+	case LogicalTypeId::DATE:
+		// covers "infinity" and the " (BC)" suffix for negative years
+		possible_chars = "0123456789- (BC)infty";
+		break;
+	case LogicalTypeId::TIME:
+		possible_chars = "0123456789:.";
+		break;
+	case LogicalTypeId::TIME_TZ:
+		possible_chars = "0123456789:.+-";
+		break;
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+		possible_chars = "0123456789-: .(BC)infty";
+		break;
+	case LogicalTypeId::TIMESTAMP_TZ:
+		possible_chars = "0123456789-: .+(BC)infty";
+		break;
+	default:
+		return false;
+	}
+	for (auto ptr = possible_chars; *ptr; ptr++) {
+		if (csv_data.requires_quotes[static_cast<uint8_t>(*ptr)]) {
+			return false;
+		}
+	}
+	// if the null string consists solely of bytes the type can render, a value could match it and would need quotes
+	auto &null_str = csv_data.options.null_str[0];
+	if (!null_str.empty() && null_str.find_first_not_of(possible_chars) == string::npos) {
+		return false;
+	}
+	return true;
+}
+
 static unique_ptr<FunctionData> WriteCSVBind(ClientContext &context, CopyFunctionBindInput &input,
                                              const vector<string> &names, const vector<LogicalType> &sql_types) {
 	auto bind_data = make_uniq<WriteCSVData>(input.info.file_path, sql_types, names);
@@ -187,6 +247,19 @@ static unique_ptr<FunctionData> WriteCSVBind(ClientContext &context, CopyFunctio
 	if (!bind_data->options.write_newline.empty()) {
 		bind_data->newline = TransformNewLine(bind_data->options.write_newline);
 	}
+
+	// for columns whose rendered text can never require quotes we can skip the per-value quote scan entirely
+	bool has_dateformat = !bind_data->options.write_date_format[LogicalTypeId::DATE].IsNull();
+	bool has_timestampformat = !bind_data->options.write_date_format[LogicalTypeId::TIMESTAMP].IsNull();
+	bind_data->quote_safe_columns.reserve(sql_types.size());
+	for (idx_t i = 0; i < sql_types.size(); i++) {
+		auto &type = sql_types[i];
+		bool is_timestamp = type.id() == LogicalTypeId::TIMESTAMP || type.id() == LogicalTypeId::TIMESTAMP_TZ;
+		// columns written through a user-supplied strftime format can render arbitrary text
+		bool has_format = (has_dateformat && type.id() == LogicalTypeId::DATE) || (has_timestampformat && is_timestamp);
+		bind_data->quote_safe_columns.push_back(!has_format && !bind_data->options.force_quote[i] &&
+		                                        CanNeverRequireQuotes(*bind_data, type));
+	}
 	return std::move(bind_data);
 }
 
@@ -464,9 +537,11 @@ static void WriteCSVChunkInternal(ClientContext &context, FunctionData &bind_dat
 
 			// non-null value, fetch the string value from the cast chunk
 			auto str_data = FlatVector::GetData<string_t>(cast_chunk.data[col_idx]);
-			// FIXME: we could gain some performance here by checking for certain types if they ever require quotes
-			// (e.g. integers only require quotes if the delimiter is a number, decimals only require quotes if the
-			// delimiter is a number or "." character)
+			if (csv_data.quote_safe_columns[col_idx]) {
+				// this column's type can never render a byte that requires quoting - write it verbatim
+				writer.WriteData(const_data_ptr_cast(str_data[row_idx].GetData()), str_data[row_idx].GetSize());
+				continue;
+			}
 			WriteQuotedString(writer, csv_data, str_data[row_idx].GetData(), str_data[row_idx].GetSize(),
 			                  csv_data.options.force_quote[col_idx]);
 		}
@@ -0,0 +1,65 @@
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/sampling_profiler.hpp"
+
+namespace duckdb {
+
+struct DuckDBProfilingSamplesData : public GlobalTableFunctionState {
+	DuckDBProfilingSamplesData() : offset(0) {
+	}
+
+	vector<ProfilingSample> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBProfilingSamplesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("time");
+	return_types.emplace_back(LogicalType::TIMESTAMP);
+
+	names.emplace_back("thread_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("operator_type");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBProfilingSamplesInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBProfilingSamplesData>();
+
+	result->entries = SamplingProfiler::Get(context).GetSamples();
+	return std::move(result);
+}
+
+void DuckDBProfilingSamplesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBProfilingSamplesData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// time, TIMESTAMP
+		output.SetValue(col++, count, Value::TIMESTAMP(entry.time));
+		// thread_id, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.thread_id)));
+		// operator_type, VARCHAR
+		output.SetValue(col++, count, Value(EnumUtil::ToString(entry.operator_type)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBProfilingSamplesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_profiling_samples", {}, DuckDBProfilingSamplesFunction,
+	                              DuckDBProfilingSamplesBind, DuckDBProfilingSamplesInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,80 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBSpillEventsData : public GlobalTableFunctionState {
+	DuckDBSpillEventsData() : offset(0) {
+	}
+
+	vector<SpillEvent> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBSpillEventsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("time");
+	return_types.emplace_back(LogicalType::TIMESTAMP);
+
+	names.emplace_back("operator");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("remaining_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reservation");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("peak_reservation");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reason");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBSpillEventsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBSpillEventsData>();
+
+	result->entries = TemporaryMemoryManager::Get(context).GetSpillEvents();
+	return std::move(result);
+}
+
+void DuckDBSpillEventsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBSpillEventsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// time, TIMESTAMP
+		output.SetValue(col++, count, Value::TIMESTAMP(entry.time));
+		// operator, VARCHAR
+		output.SetValue(col++, count, Value(entry.operator_name));
+		// remaining_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.remaining_size)));
+		// reservation, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.reservation)));
+		// peak_reservation, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.peak_reservation)));
+		// reason, VARCHAR
+		output.SetValue(col++, count, Value(entry.reason));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBSpillEventsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_spill_events", {}, DuckDBSpillEventsFunction, DuckDBSpillEventsBind, DuckDBSpillEventsInit));
+}
+
+} // namespace duckdb
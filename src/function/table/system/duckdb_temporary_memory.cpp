@@ -0,0 +1,75 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBTemporaryMemoryData : public GlobalTableFunctionState {
+	DuckDBTemporaryMemoryData() : offset(0) {
+	}
+
+	vector<TemporaryMemoryStateInfo> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBTemporaryMemoryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("operator");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("remaining_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("minimum_reservation");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reservation");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("peak_reservation");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBTemporaryMemoryInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBTemporaryMemoryData>();
+
+	result->entries = TemporaryMemoryManager::Get(context).GetStateInfo();
+	return std::move(result);
+}
+
+void DuckDBTemporaryMemoryFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBTemporaryMemoryData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// operator, VARCHAR
+		output.SetValue(col++, count, Value(entry.operator_name));
+		// remaining_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.remaining_size)));
+		// minimum_reservation, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.minimum_reservation)));
+		// reservation, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.reservation)));
+		// peak_reservation, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.peak_reservation)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBTemporaryMemoryFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_temporary_memory", {}, DuckDBTemporaryMemoryFunction,
+	                              DuckDBTemporaryMemoryBind, DuckDBTemporaryMemoryInit));
+}
+
+} // namespace duckdb
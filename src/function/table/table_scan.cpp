@@ -73,7 +73,7 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		auto storage_idx = GetStorageIndex(bind_data.table, col);
 		col = storage_idx;
 	}
-	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	result->scan_state.Initialize(std::move(column_ids), context.client, input.filters.get());
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
 		auto &tsgs = gstate->Cast<TableScanGlobalState>();
@@ -241,7 +241,7 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
 	}
 
-	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
+	result->local_storage_state.Initialize(result->column_ids, context, input.filters.get());
 	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
 
 	result->finished = false;
@@ -256,7 +256,8 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 
 	if (!state.finished) {
 		auto remaining = state.row_ids_count - state.row_ids_offset;
-		auto scan_count = remaining < STANDARD_VECTOR_SIZE ? remaining : STANDARD_VECTOR_SIZE;
+		// never fetch more rows than fit in the output chunk: the executor may hand us a narrowed chunk
+		auto scan_count = remaining < output.GetCapacity() ? remaining : output.GetCapacity();
 
 		Vector row_ids(state.row_ids, state.row_ids_offset, state.row_ids_offset + scan_count);
 		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, row_ids, scan_count,
@@ -495,6 +495,24 @@ typedef void (*duckdb_table_function_init_t)(duckdb_init_info info);
 //! The main function of the table function.
 typedef void (*duckdb_table_function_t)(duckdb_function_info info, duckdb_data_chunk output);
 
+//! An interrupt state that can be used to resume a blocked asynchronous table function.
+//! The state is only valid from the moment the function returns DUCKDB_SOURCE_RESULT_BLOCKED until the scan
+//! is resumed.
+typedef struct _duckdb_interrupt_state {
+	void *__val;
+} * duckdb_interrupt_state;
+
+//! The result of a call to an asynchronous table function.
+typedef enum duckdb_source_result_type {
+	DUCKDB_SOURCE_RESULT_HAVE_MORE_OUTPUT = 0,
+	DUCKDB_SOURCE_RESULT_FINISHED = 1,
+	DUCKDB_SOURCE_RESULT_BLOCKED = 2
+} duckdb_source_result_type;
+
+//! The asynchronous main function of the table function.
+typedef duckdb_source_result_type (*duckdb_table_function_async_t)(duckdb_function_info info,
+                                                                   duckdb_data_chunk output);
+
 //===--------------------------------------------------------------------===//
 // Replacement scan types
 //===--------------------------------------------------------------------===//
@@ -2479,6 +2497,24 @@ Sets the main function of the table function.
 DUCKDB_API void duckdb_table_function_set_function(duckdb_table_function table_function,
                                                    duckdb_table_function_t function);
 
+/*!
+Sets the asynchronous main function of the table function. If set, this function is used instead of the main function.
+
+Unlike a regular main function, an asynchronous function can return DUCKDB_SOURCE_RESULT_BLOCKED instead of
+blocking the executing thread while waiting for data. Before returning blocked, the function must fetch its
+interrupt state through `duckdb_function_get_interrupt_state`, and signal that state through
+`duckdb_interrupt_state_callback` once data becomes available - this reschedules the scan.
+Returning DUCKDB_SOURCE_RESULT_HAVE_MORE_OUTPUT with an empty chunk is not allowed, and an empty chunk together
+with DUCKDB_SOURCE_RESULT_FINISHED marks exhaustion of the source.
+
+The preferred number of rows per call is `duckdb_vector_size()` - the capacity of the output chunk.
+
+* table_function: The table function
+* function: The function
+*/
+DUCKDB_API void duckdb_table_function_set_function_async(duckdb_table_function table_function,
+                                                         duckdb_table_function_async_t function);
+
 /*!
 Sets whether or not the given table function supports projection pushdown.
 
@@ -2696,6 +2732,26 @@ Report that an error has occurred while executing the function.
 */
 DUCKDB_API void duckdb_function_set_error(duckdb_function_info info, const char *error);
 
+/*!
+Retrieves the interrupt state of the currently executing asynchronous table function.
+
+The state must be fetched before returning DUCKDB_SOURCE_RESULT_BLOCKED, and is only valid until the scan is
+resumed through `duckdb_interrupt_state_callback`.
+
+* info: The info object
+* returns: The interrupt state, or nullptr if the function was not invoked through the asynchronous interface
+*/
+DUCKDB_API duckdb_interrupt_state duckdb_function_get_interrupt_state(duckdb_function_info info);
+
+/*!
+Signals an interrupt state, rescheduling the blocked table function that it belongs to.
+
+This function can be called from any thread.
+
+* state: The interrupt state
+*/
+DUCKDB_API void duckdb_interrupt_state_callback(duckdb_interrupt_state state);
+
 //===--------------------------------------------------------------------===//
 // Replacement Scans
 //===--------------------------------------------------------------------===//
@@ -3364,6 +3420,24 @@ It is not known beforehand how many chunks will be returned by this result.
 */
 DUCKDB_API duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result);
 
+/*!
+Fetches a batch of up to `chunk_count` data chunks from a materialized result. The fetched chunks reference the
+result's internal data directly instead of copying it, avoiding the per-chunk conversion cost of
+`duckdb_result_get_chunk`.
+
+The returned chunks are owned by the result and must NOT be destroyed with `duckdb_destroy_data_chunk`. They remain
+valid until the next call to `duckdb_result_fetch_chunks` on the same result, or until the result is destroyed.
+
+This function can only be used on materialized results. Repeated calls fetch consecutive batches; fewer than
+`chunk_count` chunks are returned when the end of the result is reached.
+
+* result: The result object to fetch the data chunks from.
+* out_chunks: An array of at least `chunk_count` entries that receives the fetched chunks.
+* chunk_count: The maximum amount of chunks to fetch.
+* returns: The amount of chunks fetched. Returns 0 if the result is exhausted or not materialized.
+*/
+DUCKDB_API idx_t duckdb_result_fetch_chunks(duckdb_result result, duckdb_data_chunk *out_chunks, idx_t chunk_count);
+
 #ifdef __cplusplus
 }
 #endif
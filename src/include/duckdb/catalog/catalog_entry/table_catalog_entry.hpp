@@ -107,10 +107,17 @@ public:
 	virtual void BindUpdateConstraints(Binder &binder, LogicalGet &get, LogicalProjection &proj, LogicalUpdate &update,
 	                                   ClientContext &context);
 
+	//! Whether the table is unlogged
+	bool IsUnlogged() const {
+		return unlogged;
+	}
+
 protected:
 	//! A list of columns that are part of this table
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! Whether the table is unlogged: changes to its data bypass the WAL
+	bool unlogged;
 };
 } // namespace duckdb
@@ -16,6 +16,7 @@
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/parser/column_definition.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/catalog/catalog_transaction.hpp"
 #include "duckdb/catalog/similar_catalog_entry.hpp"
@@ -117,7 +118,7 @@ public:
 
 	void UpdateTimestamp(CatalogEntry &entry, transaction_t timestamp);
 
-	mutex &GetCatalogLock() {
+	StorageLock &GetCatalogLock() {
 		return catalog_lock;
 	}
 
@@ -133,27 +134,28 @@ private:
 	optional_ptr<CatalogEntry> CreateCommittedEntry(unique_ptr<CatalogEntry> entry);
 
 	//! Create all default entries
-	void CreateDefaultEntries(CatalogTransaction transaction, unique_lock<mutex> &lock);
+	void CreateDefaultEntries(CatalogTransaction transaction, unique_ptr<StorageLockKey> &lock);
 	//! Attempt to create a default entry with the specified name. Returns the entry if successful, nullptr otherwise.
 	optional_ptr<CatalogEntry> CreateDefaultEntry(CatalogTransaction transaction, const string &name,
-	                                              unique_lock<mutex> &lock);
+	                                              unique_ptr<StorageLockKey> &lock);
 
 	bool DropEntryInternal(CatalogTransaction transaction, const string &name, bool allow_drop_internal = false);
 
 	bool CreateEntryInternal(CatalogTransaction transaction, const string &name, unique_ptr<CatalogEntry> value,
-	                         unique_lock<mutex> &read_lock, bool should_be_empty = true);
+	                         unique_ptr<StorageLockKey> &read_lock, bool should_be_empty = true);
 	void CheckCatalogEntryInvariants(CatalogEntry &value, const string &name);
 	//! Verify that the previous entry in the chain is dropped.
 	bool VerifyVacancy(CatalogTransaction transaction, CatalogEntry &entry);
 	//! Start the catalog entry chain with a dummy node
-	bool StartChain(CatalogTransaction transaction, const string &name, unique_lock<mutex> &read_lock);
+	bool StartChain(CatalogTransaction transaction, const string &name, unique_ptr<StorageLockKey> &read_lock);
 	bool RenameEntryInternal(CatalogTransaction transaction, CatalogEntry &old, const string &new_name,
-	                         AlterInfo &alter_info, unique_lock<mutex> &read_lock);
+	                         AlterInfo &alter_info, unique_ptr<StorageLockKey> &read_lock);
 
 private:
 	DuckCatalog &catalog;
-	//! The catalog lock is used to make changes to the data
-	mutex catalog_lock;
+	//! The catalog lock protects the catalog set - lookups and scans take a shared lock so that read-mostly binding
+	//! can proceed concurrently, modifications take an exclusive lock
+	StorageLock catalog_lock;
 	CatalogEntryMap map;
 	//! The generator used to generate default internal entries
 	unique_ptr<DefaultGenerator> defaults;
@@ -85,6 +85,10 @@ class Allocator {
 	// 281TB ought to be enough for anybody
 	static constexpr const idx_t MAXIMUM_ALLOC_SIZE = 281474976710656ULL;
 
+public:
+	//! The size of a huge page (2MB) - allocations of at least this size can be backed by huge pages
+	static constexpr const idx_t HUGE_PAGE_SIZE = 2097152ULL;
+
 public:
 	DUCKDB_API Allocator();
 	DUCKDB_API Allocator(allocate_function_ptr_t allocate_function_p, free_function_ptr_t free_function_p,
@@ -121,6 +125,8 @@ public:
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	static bool HugePagesEnabled();
+	static void SetHugePages(bool enable);
 
 private:
 	allocate_function_ptr_t allocate_function;
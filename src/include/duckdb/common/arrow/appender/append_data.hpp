@@ -75,6 +75,15 @@ struct ArrowAppendData {
 	//! Offset used to keep data positions when producing a mix of inlined and not-inlined arrow string views.
 	idx_t offset = 0;
 
+	//! Vector buffers that are referenced zero-copy by this array, kept alive until the array is released
+	vector<buffer_ptr<VectorBuffer>> owned_buffers;
+	//! Validity masks that are referenced zero-copy by this array
+	vector<ValidityMask> owned_validities;
+	//! Data that is referenced directly instead of copied into the main buffer (if any)
+	data_ptr_t zero_copy_data = nullptr;
+	//! Validity mask that is referenced directly instead of copied into the validity buffer (if any)
+	data_ptr_t zero_copy_validity = nullptr;
+
 private:
 	//! The buffers of the arrow vector
 	vector<ArrowBuffer> arrow_buffers;
@@ -135,4 +144,38 @@ static void AppendValidity(ArrowAppendData &append_data, UnifiedVectorFormat &fo
 	}
 }
 
+//! Exports a flat vector by referencing its data directly instead of copying it into the arrow buffers. This is only
+//! possible for the first append into an array, and only when the physical layout of the vector matches the arrow
+//! layout exactly; the referenced buffers are kept alive until the arrow array is released.
+static bool TryAppendZeroCopy(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to) {
+	if (!append_data.options.arrow_allow_zero_copy) {
+		// the appended chunks may be modified or recycled before the arrow array is released - we have to copy
+		return false;
+	}
+	if (append_data.row_count != 0 || from != 0) {
+		// the array already holds data - we can only reference a vector that covers the full array
+		return false;
+	}
+	if (input.GetVectorType() != VectorType::FLAT_VECTOR || !input.GetBuffer()) {
+		return false;
+	}
+	if (input.GetData() != input.GetBuffer()->GetData()) {
+		// the vector references data it does not own (e.g. a zero-copy scan of a collection) - holding on to the
+		// vector buffer would not keep the data alive
+		return false;
+	}
+	// keep the vector buffer alive and reference its data directly
+	append_data.owned_buffers.push_back(input.GetBuffer());
+	append_data.zero_copy_data = input.GetData();
+	auto &validity = FlatVector::Validity(input);
+	if (!validity.AllValid()) {
+		// the validity mask uses the same bit layout as arrow - reference it directly as well
+		append_data.owned_validities.push_back(validity);
+		append_data.zero_copy_validity = data_ptr_cast(validity.GetData());
+		append_data.null_count += to - validity.CountValid(to);
+	}
+	append_data.row_count += to;
+	return true;
+}
+
 } // namespace duckdb
@@ -95,9 +95,54 @@ struct ArrowScalarData : public ArrowScalarBaseData<TGT, SRC, OP> {
 		result.GetMainBuffer().reserve(capacity * sizeof(TGT));
 	}
 
+	static void Append(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to, idx_t input_size) {
+		if (std::is_same<TGT, SRC>::value && std::is_same<OP, ArrowScalarConverter>::value) {
+			// the physical layout of the vector matches the arrow layout exactly - try to append zero-copy
+			if (TryAppendZeroCopy(append_data, input, from, to)) {
+				return;
+			}
+			if (append_data.zero_copy_data) {
+				// a previous append was zero-copy, but more data is being appended - fall back to copying
+				MaterializeZeroCopy(append_data);
+			}
+		}
+		ArrowScalarBaseData<TGT, SRC, OP>::Append(append_data, input, from, to, input_size);
+	}
+
+	//! Copies previously zero-copy referenced data into owned buffers so more data can be appended after it
+	static void MaterializeZeroCopy(ArrowAppendData &append_data) {
+		auto row_count = append_data.row_count;
+		auto &main_buffer = append_data.GetMainBuffer();
+		D_ASSERT(main_buffer.size() == 0);
+		main_buffer.resize(row_count * sizeof(TGT));
+		memcpy(main_buffer.data(), append_data.zero_copy_data, row_count * sizeof(TGT));
+		if (append_data.zero_copy_validity) {
+			auto &validity_buffer = append_data.GetValidityBuffer();
+			ResizeValidity(validity_buffer, row_count);
+			auto byte_count = (row_count + 7) / 8;
+			memcpy(validity_buffer.data(), append_data.zero_copy_validity, byte_count);
+			// the trailing bits of the referenced mask are unspecified - mark them as valid again
+			auto validity_data = validity_buffer.GetData<uint8_t>();
+			for (idx_t row_idx = row_count; row_idx < byte_count * 8; row_idx++) {
+				validity_data[row_idx / 8] |= static_cast<uint8_t>(uint8_t(1) << (row_idx % 8));
+			}
+		}
+		append_data.zero_copy_data = nullptr;
+		append_data.zero_copy_validity = nullptr;
+		append_data.owned_buffers.clear();
+		append_data.owned_validities.clear();
+	}
+
 	static void Finalize(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result) {
 		result->n_buffers = 2;
-		result->buffers[1] = append_data.GetMainBuffer().data();
+		if (append_data.zero_copy_data) {
+			result->buffers[1] = append_data.zero_copy_data;
+			if (append_data.zero_copy_validity) {
+				result->buffers[0] = append_data.zero_copy_validity;
+			}
+		} else {
+			result->buffers[1] = append_data.GetMainBuffer().data();
+		}
 	}
 };
 
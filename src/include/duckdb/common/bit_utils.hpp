@@ -75,6 +75,32 @@ struct CountZeros<uint32_t> {
 	}
 };
 
+template <class T>
+struct CountBits {};
+
+template <>
+struct CountBits<uint64_t> {
+	// branch-free SWAR popcount, compiles down to a popcnt instruction where available
+	inline static idx_t Count(const uint64_t value_in) {
+		uint64_t value = value_in;
+		value = value - ((value >> 1) & 0x5555555555555555ULL);
+		value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+		value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		auto result = (value * 0x0101010101010101ULL) >> 56;
+#ifdef __clang__
+		D_ASSERT(result == static_cast<uint64_t>(__builtin_popcountll(value_in)));
+#endif
+		return result;
+	}
+};
+
+template <>
+struct CountBits<uint32_t> {
+	inline static idx_t Count(const uint32_t value) {
+		return CountBits<uint64_t>::Count(static_cast<uint64_t>(value));
+	}
+};
+
 template <>
 struct CountZeros<hugeint_t> {
 	inline static idx_t Leading(hugeint_t value) {
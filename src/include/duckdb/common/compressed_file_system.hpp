@@ -9,7 +9,13 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class CompressedFile;
@@ -29,6 +35,15 @@ struct StreamData {
 	idx_t out_buf_size = 0;
 };
 
+//! A buffer of decompressed data produced by the background read-ahead thread
+struct DecompressedChunk {
+	unsafe_unique_array<data_t> data;
+	//! The number of decompressed bytes in the buffer
+	idx_t size = 0;
+	//! The number of bytes already consumed by the reader
+	idx_t offset = 0;
+};
+
 struct StreamWrapper {
 	DUCKDB_API virtual ~StreamWrapper();
 
@@ -74,7 +89,29 @@ public:
 	DUCKDB_API void Close() override;
 
 private:
+	//! Decompress the next chunk of data into "chunk" - returns true if the end of the stream was reached
+	bool DecompressChunk(DecompressedChunk &chunk);
+	//! The background read-ahead loop - decompresses chunks into the (bounded) ring of read-ahead chunks
+	void ReadAheadLoop();
+
+private:
+	//! The maximum number of decompressed chunks to read ahead of the consumer
+	static constexpr idx_t READ_AHEAD_CHUNKS = 8;
+
 	unique_ptr<StreamWrapper> stream_wrapper;
+	//! Ring of decompressed chunks, produced by the read-ahead thread and consumed in order by ReadData
+	deque<DecompressedChunk> read_ahead_chunks;
+	//! Whether the read-ahead thread should shut down
+	bool shutdown = false;
+	//! Whether the read-ahead thread has decompressed the entire stream
+	bool read_ahead_done = false;
+	//! Error raised by the read-ahead thread (if any) - re-thrown on the consuming thread
+	ErrorData read_error;
+	bool has_read_error = false;
+	mutex read_ahead_lock;
+	std::condition_variable read_ahead_cv;
+	//! The background read-ahead thread - started lazily on the first read
+	unique_ptr<thread> read_ahead_thread;
 };
 
 } // namespace duckdb
@@ -33,6 +33,8 @@ enum class OptimizerType : uint32_t {
 	TOP_N,
 	COMPRESSED_MATERIALIZATION,
 	DUPLICATE_GROUPS,
+	EAGER_AGGREGATION,
+	COUNT_STAR,
 	REORDER_FILTER,
 	EXTENSION
 };
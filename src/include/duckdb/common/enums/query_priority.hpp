@@ -0,0 +1,19 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/query_priority.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The scheduling priority class of a query: queries of a higher class get a larger share of the worker threads
+//! when tasks of multiple classes are queued (set per connection via "SET priority = 'low'/'normal'/'high'")
+enum class QueryPriority : uint8_t { LOW = 0, NORMAL = 1, HIGH = 2 };
+
+} // namespace duckdb
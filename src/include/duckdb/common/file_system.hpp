@@ -98,6 +98,16 @@ public:
 	string path;
 };
 
+//! A single positional read that is part of a batch submitted through FileSystem::ReadBatch
+struct ReadRequest {
+	//! The buffer to read into
+	void *buffer;
+	//! The exact number of bytes to read
+	int64_t nr_bytes;
+	//! The location in the file to read from
+	idx_t location;
+};
+
 class FileSystem {
 public:
 	DUCKDB_API virtual ~FileSystem();
@@ -113,6 +123,10 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	DUCKDB_API virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Read a batch of locations from the file, failing if any request could not be read completely. File systems
+	//! that support asynchronous I/O submit the entire batch to the device at once and wait for all completions;
+	//! the default implementation performs the reads one by one.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<ReadRequest> &requests);
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
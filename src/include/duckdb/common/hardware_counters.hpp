@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The values of the hardware performance counters gathered during a measurement
+struct HardwareCounters {
+	idx_t instructions = 0;
+	idx_t llc_misses = 0;
+	idx_t branch_misses = 0;
+};
+
+//! The HardwareCounterProfiler measures hardware performance counters of the calling thread.
+//! Counters are read through perf_event_open on Linux - on other platforms, or when the counters cannot be
+//! opened (e.g. because of perf_event_paranoid), IsSupported() returns false and measurements yield zero.
+class HardwareCounterProfiler {
+public:
+	HardwareCounterProfiler();
+	~HardwareCounterProfiler();
+
+	//! Whether or not hardware counters can be measured
+	bool IsSupported() const;
+	//! Start measuring the hardware counters of the calling thread
+	void Start();
+	//! Finish measuring - the measured counters can be obtained through Elapsed()
+	void End();
+	//! Returns the counter values gathered between the last Start() and End() pair
+	const HardwareCounters &Elapsed() const {
+		return elapsed;
+	}
+
+private:
+	//! The number of counters that are measured (instructions, LLC misses, branch misses)
+	static constexpr idx_t COUNTER_COUNT = 3;
+
+	//! The perf event file descriptors, or -1 when unsupported
+	int counter_fds[COUNTER_COUNT];
+	//! The counter values of the last measurement
+	HardwareCounters elapsed;
+};
+
+} // namespace duckdb
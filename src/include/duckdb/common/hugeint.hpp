@@ -36,8 +36,14 @@ public:
 	DUCKDB_API bool operator>=(const hugeint_t &rhs) const;
 
 	// arithmetic operators
-	DUCKDB_API hugeint_t operator+(const hugeint_t &rhs) const;
-	DUCKDB_API hugeint_t operator-(const hugeint_t &rhs) const;
+	// the two-limb add/subtract kernels are defined inline so that per-row DECIMAL arithmetic
+	// does not pay an out-of-line call per value
+	hugeint_t operator+(const hugeint_t &rhs) const {
+		return hugeint_t(upper + rhs.upper + ((lower + rhs.lower) < lower), lower + rhs.lower);
+	}
+	hugeint_t operator-(const hugeint_t &rhs) const {
+		return hugeint_t(upper - rhs.upper - ((lower - rhs.lower) > lower), lower - rhs.lower);
+	}
 	DUCKDB_API hugeint_t operator*(const hugeint_t &rhs) const;
 	DUCKDB_API hugeint_t operator/(const hugeint_t &rhs) const;
 	DUCKDB_API hugeint_t operator%(const hugeint_t &rhs) const;
@@ -52,8 +58,14 @@ public:
 	DUCKDB_API hugeint_t operator~() const;
 
 	// in-place operators
-	DUCKDB_API hugeint_t &operator+=(const hugeint_t &rhs);
-	DUCKDB_API hugeint_t &operator-=(const hugeint_t &rhs);
+	hugeint_t &operator+=(const hugeint_t &rhs) {
+		*this = *this + rhs;
+		return *this;
+	}
+	hugeint_t &operator-=(const hugeint_t &rhs) {
+		*this = *this - rhs;
+		return *this;
+	}
 	DUCKDB_API hugeint_t &operator*=(const hugeint_t &rhs);
 	DUCKDB_API hugeint_t &operator/=(const hugeint_t &rhs);
 	DUCKDB_API hugeint_t &operator%=(const hugeint_t &rhs);
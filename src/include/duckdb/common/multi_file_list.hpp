@@ -136,6 +136,8 @@ protected:
 
 	//! Get the i-th expanded file
 	string GetFileInternal(idx_t i);
+	//! Expands a single glob pattern, consulting the glob cache when the object cache is enabled
+	vector<string> GlobFilesInternal(const string &path);
 	//! Grabs the next path and expands it into Expanded paths: returns false if no more files to expand
 	bool ExpandPathInternal();
 	//! Whether all files have been expanded
@@ -0,0 +1,17 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#if __GNUC__
+//! Hint to the CPU to load the cache line holding "ptr" ahead of time (read-only, high temporal locality).
+//! Prefetching is best-effort: invalid addresses (including nullptr) do not fault.
+#define DUCKDB_PREFETCH_READ(ptr) __builtin_prefetch((ptr), 0, 3)
+#else
+#define DUCKDB_PREFETCH_READ(ptr) ((void)(ptr))
+#endif
@@ -30,6 +30,11 @@ struct MatchFunction {
 	vector<MatchFunction> child_functions;
 };
 
+typedef idx_t (*fused_match_function_t)(DataChunk &lhs, const vector<TupleDataVectorFormat> &lhs_formats,
+                                        SelectionVector &sel, const idx_t count, const TupleDataLayout &rhs_layout,
+                                        Vector &rhs_row_locations, SelectionVector *no_match_sel,
+                                        idx_t &no_match_count);
+
 struct RowMatcher {
 public:
 	using Predicates = vector<ExpressionType>;
@@ -70,6 +75,8 @@ private:
 
 private:
 	vector<MatchFunction> match_functions;
+	//! Single-pass kernel for common two-column fixed-width key layouts, nullptr if the layout does not qualify
+	fused_match_function_t fused_function = nullptr;
 };
 
 } // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/serializer/async_buffered_file_writer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include <condition_variable>
+
+namespace duckdb {
+
+//! A BufferedFileWriter that rotates between two buffers and drains full buffers on a background thread,
+//! so that serialization can proceed while the previous buffer is being written to disk
+class AsyncBufferedFileWriter : public BufferedFileWriter {
+public:
+	DUCKDB_API AsyncBufferedFileWriter(FileSystem &fs, const string &path,
+	                                   FileOpenFlags open_flags = DEFAULT_OPEN_FLAGS);
+	DUCKDB_API ~AsyncBufferedFileWriter() override;
+
+public:
+	DUCKDB_API void WriteData(const_data_ptr_t buffer, idx_t write_size) override;
+	//! Hand the current buffer to the background thread and rotate to the other buffer
+	DUCKDB_API void Flush() override;
+	//! Flush, wait for the pending background write and fsync the file to disk
+	DUCKDB_API void Sync() override;
+	//! Flush, wait for the pending background write and close the file
+	DUCKDB_API void Close() override;
+	//! Truncate the size to a previous size - waits for any pending background write first
+	DUCKDB_API void Truncate(idx_t size) override;
+	//! Returns the current size of the file - waits for any pending background write first
+	DUCKDB_API idx_t GetFileSize() override;
+
+private:
+	//! Block until the pending background write (if any) has completed, re-throwing any write error
+	void WaitForDrain();
+	//! The background flush loop
+	void FlushLoop();
+
+private:
+	//! The buffer currently owned by the background thread
+	unsafe_unique_array<data_t> flush_buffer;
+	//! The number of bytes to write from the flush buffer
+	idx_t flush_size = 0;
+	//! Whether a background write is pending
+	bool flush_pending = false;
+	//! Whether the background thread should shut down
+	bool shutdown = false;
+	//! Error raised by the background thread (if any) - re-thrown on the producing thread
+	ErrorData flush_error;
+	bool has_flush_error = false;
+	mutex flush_lock;
+	std::condition_variable flush_cv;
+	//! The background flush thread - started lazily on the first flush
+	unique_ptr<thread> flush_thread;
+};
+
+} // namespace duckdb
@@ -33,15 +33,15 @@ public:
 public:
 	DUCKDB_API void WriteData(const_data_ptr_t buffer, idx_t write_size) override;
 	//! Flush all changes to the file and then close the file
-	DUCKDB_API void Close();
+	DUCKDB_API virtual void Close();
 	//! Flush all changes and fsync the file to disk
-	DUCKDB_API void Sync();
+	DUCKDB_API virtual void Sync();
 	//! Flush the buffer to the file (without sync)
-	DUCKDB_API void Flush();
+	DUCKDB_API virtual void Flush();
 	//! Returns the current size of the file
-	DUCKDB_API idx_t GetFileSize();
+	DUCKDB_API virtual idx_t GetFileSize();
 	//! Truncate the size to a previous size (given that size <= GetFileSize())
-	DUCKDB_API void Truncate(idx_t size);
+	DUCKDB_API virtual void Truncate(idx_t size);
 
 	DUCKDB_API idx_t GetTotalWritten();
 };
@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/thread_wait_times.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! Thread-local accounting of the time the current thread spent waiting on the file system and on the
+//! buffer manager. The counters only ever grow - the OperatorProfiler snapshots them around every operator
+//! invocation to attribute the waits to the operator that incurred them.
+struct ThreadWaitTimes {
+	//! The time (in seconds) spent reading through the file system
+	double io_wait = 0;
+	//! The time (in seconds) spent evicting and loading blocks in BufferManager::Pin, excluding the file
+	//! system reads issued while loading (those are counted as io_wait)
+	double buffer_wait = 0;
+
+	//! Returns the wait times of the calling thread
+	DUCKDB_API static ThreadWaitTimes &Get();
+};
+
+} // namespace duckdb
@@ -72,6 +72,9 @@ public:
 	//! Deletes the block with the given id
 	void DeleteBlock(uint32_t block_id);
 
+	//! Sets a retention hint on all blocks of this allocator (no-op for an IN_MEMORY_ALLOCATOR)
+	void SetRetentionHint(BlockRetentionHint hint);
+
 private:
 	void AllocateEmptyBlock(idx_t size);
 	BufferHandle AllocateBlock(idx_t size);
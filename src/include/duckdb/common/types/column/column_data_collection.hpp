@@ -14,6 +14,7 @@
 namespace duckdb {
 class BufferManager;
 class BlockHandle;
+enum class BlockRetentionHint : uint8_t;
 class ClientContext;
 struct ColumnDataCopyFunction;
 class ColumnDataAllocator;
@@ -66,6 +67,10 @@ public:
 	//! The allocation size (in bytes) of this ColumnDataCollection - this property is cached
 	idx_t AllocationSize() const;
 
+	//! Hints to the buffer pool that the blocks of this collection will be accessed again, e.g. by an operator
+	//! that repeatedly re-scans the collection (no-op for in-memory collections)
+	DUCKDB_API void SetRetentionHint(BlockRetentionHint hint);
+
 	//! Get the allocator
 	DUCKDB_API Allocator &GetAllocator() const;
 
@@ -116,6 +121,10 @@ public:
 	DUCKDB_API idx_t ChunkCount() const;
 	//! Fetch an individual chunk from the ColumnDataCollection
 	DUCKDB_API void FetchChunk(idx_t chunk_idx, DataChunk &result) const;
+	//! Fetch an individual chunk without copying fixed-size data: the fetched chunk references the collection's
+	//! data directly, and the required blocks are pinned in the provided chunk management state. The chunk is only
+	//! valid as long as both the state and the collection are kept alive.
+	DUCKDB_API void FetchChunk(idx_t chunk_idx, DataChunk &result, ChunkManagementState &state) const;
 
 	//! Constructs a class that can be iterated over to fetch individual chunks
 	//! Iterating over this is syntactic sugar over just calling Scan
@@ -160,6 +169,9 @@ public:
 	static unique_ptr<ColumnDataCollection> Deserialize(Deserializer &deserializer);
 
 private:
+	//! The row collection references block data directly and shares ownership of the allocator
+	friend class ColumnDataRowCollection;
+
 	//! Creates a new segment within the ColumnDataCollection
 	void CreateSegment();
 
@@ -222,7 +234,10 @@ public:
 private:
 	vector<ColumnDataRow> rows;
 	vector<unique_ptr<DataChunk>> chunks;
+	//! Holds the pins of the blocks that the chunks reference
 	ColumnDataScanState scan_state;
+	//! Shares ownership of the allocators so the referenced blocks outlive the source collection
+	vector<shared_ptr<ColumnDataAllocator>> allocators;
 };
 
 } // namespace duckdb
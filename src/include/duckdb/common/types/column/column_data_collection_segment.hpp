@@ -133,6 +133,9 @@ public:
 
 	void FetchChunk(idx_t chunk_idx, DataChunk &result);
 	void FetchChunk(idx_t chunk_idx, DataChunk &result, const vector<column_t> &column_ids);
+	//! Fetch a chunk zero-copy, accumulating the pins of the blocks it references in the provided state
+	void FetchChunk(idx_t chunk_idx, DataChunk &result, const vector<column_t> &column_ids,
+	                ChunkManagementState &state);
 
 	void Verify();
 
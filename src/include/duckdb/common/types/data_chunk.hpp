@@ -66,6 +66,9 @@ public:
 	inline void SetCapacity(idx_t capacity_p) {
 		this->capacity = capacity_p;
 	}
+	inline idx_t GetCapacity() const {
+		return capacity;
+	}
 	inline void SetCapacity(const DataChunk &other) {
 		SetCapacity(other.capacity);
 	}
@@ -169,6 +172,8 @@ private:
 	idx_t count;
 	//! The amount of tuples that can be stored in the data chunk
 	idx_t capacity;
+	//! The capacity of the vector caches, i.e. the capacity the chunk is restored to by DataChunk::Reset
+	idx_t vector_cache_capacity;
 	//! Vector caches, used to store data when ::Initialize is called
 	vector<VectorCache> vector_caches;
 };
@@ -101,7 +101,26 @@ public:
 		return Modulo<false>(lhs, rhs);
 	}
 
-	static bool TryAddInPlace(hugeint_t &lhs, hugeint_t rhs);
+	//! In-place addition with overflow detection - defined inline so that overflow-checked
+	//! addition loops (e.g. SUM over DECIMAL) do not pay an out-of-line call per value
+	inline static bool TryAddInPlace(hugeint_t &lhs, hugeint_t rhs) {
+		int overflow = lhs.lower + rhs.lower < lhs.lower;
+		if (rhs.upper >= 0) {
+			// RHS is positive: check for overflow
+			if (lhs.upper > (NumericLimits<int64_t>::Maximum() - rhs.upper - overflow)) {
+				return false;
+			}
+			lhs.upper = lhs.upper + overflow + rhs.upper;
+		} else {
+			// RHS is negative: check for underflow
+			if (lhs.upper < NumericLimits<int64_t>::Minimum() - rhs.upper - overflow) {
+				return false;
+			}
+			lhs.upper = lhs.upper + (overflow + rhs.upper);
+		}
+		lhs.lower += rhs.lower;
+		return true;
+	}
 
 	template <bool CHECK_OVERFLOW = true>
 	inline static hugeint_t Add(hugeint_t lhs, hugeint_t rhs) {
@@ -111,7 +130,27 @@ public:
 		return lhs;
 	}
 
-	static bool TrySubtractInPlace(hugeint_t &lhs, hugeint_t rhs);
+	//! In-place subtraction with underflow detection - defined inline for the same reason as TryAddInPlace
+	inline static bool TrySubtractInPlace(hugeint_t &lhs, hugeint_t rhs) {
+		// underflow
+		int underflow = lhs.lower - rhs.lower > lhs.lower;
+		if (rhs.upper >= 0) {
+			// RHS is positive: check for underflow
+			if (lhs.upper < (NumericLimits<int64_t>::Minimum() + rhs.upper + underflow)) {
+				return false;
+			}
+			lhs.upper = (lhs.upper - rhs.upper) - underflow;
+		} else {
+			// RHS is negative: check for overflow
+			if (lhs.upper > NumericLimits<int64_t>::Minimum() &&
+			    lhs.upper - 1 >= (NumericLimits<int64_t>::Maximum() + rhs.upper + underflow)) {
+				return false;
+			}
+			lhs.upper = lhs.upper - (rhs.upper + underflow);
+		}
+		lhs.lower -= rhs.lower;
+		return true;
+	}
 
 	template <bool CHECK_OVERFLOW = true>
 	inline static hugeint_t Subtract(hugeint_t lhs, hugeint_t rhs) {
@@ -175,6 +214,17 @@ public:
 	static const hugeint_t POWERS_OF_TEN[40];
 };
 
+// the non-overflow-checking variants reduce to the plain two-limb operators
+template <>
+inline hugeint_t Hugeint::Add<false>(hugeint_t lhs, hugeint_t rhs) {
+	return lhs + rhs;
+}
+
+template <>
+inline hugeint_t Hugeint::Subtract<false>(hugeint_t lhs, hugeint_t rhs) {
+	return lhs - rhs;
+}
+
 template <>
 DUCKDB_API bool Hugeint::TryCast(hugeint_t input, int8_t &result);
 template <>
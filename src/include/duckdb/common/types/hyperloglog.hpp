@@ -37,6 +37,8 @@ public:
 	idx_t Count() const;
 	//! Merge this HyperLogLog counter with another counter to create a new one
 	unique_ptr<HyperLogLog> Merge(HyperLogLog &other);
+	//! Merge another HyperLogLog counter into this one, without allocating a new counter
+	void MergeInPlace(HyperLogLog &other);
 	HyperLogLog *MergePointer(HyperLogLog &other);
 	//! Merge a set of HyperLogLogs to create one big one
 	static unique_ptr<HyperLogLog> Merge(HyperLogLog logs[], idx_t count);
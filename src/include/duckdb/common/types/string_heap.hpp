@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
@@ -35,6 +36,11 @@ public:
 	DUCKDB_API string_t AddBlob(const string_t &data);
 	//! Add a blob to the string heap; blobs can be non-valid UTF8
 	DUCKDB_API string_t AddBlob(const char *data, idx_t len);
+	//! Add a batch of blobs to the string heap at once: space for the combined payload is reserved up-front,
+	//! after which the string data is bulk-copied and the string pointers are patched in a tight loop.
+	//! Sets targets[i] to the heap copy of source[sel.get_index(offset + i)]; inlined strings take up no heap space
+	DUCKDB_API void AddBlobs(const string_t *source, const SelectionVector &sel, idx_t offset, string_t *targets,
+	                         idx_t count);
 	//! Allocates space for an empty string of size "len" on the heap
 	DUCKDB_API string_t EmptyString(idx_t len);
 
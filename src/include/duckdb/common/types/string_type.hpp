@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/bswap.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/numeric_utils.hpp"
@@ -199,6 +200,19 @@ public:
 			if (a_prefix != b_prefix) {
 				return byte_swap(a_prefix) > byte_swap(b_prefix);
 			}
+
+			// Check on the remaining inlined bytes -----
+			// If both strings are inlined, the bytes past the prefix are zero-padded as well,
+			// so one more byte-swapped word comparison resolves the ordering without a memcmp
+			if (left.IsInlined() && right.IsInlined()) {
+				uint64_t a_remainder = Load<uint64_t>(const_data_ptr_cast(left.GetPrefix()) + 4u);
+				uint64_t b_remainder = Load<uint64_t>(const_data_ptr_cast(right.GetPrefix()) + 4u);
+				if (a_remainder != b_remainder) {
+					return BSwap(a_remainder) > BSwap(b_remainder);
+				}
+				// all content bytes are equal - the longer string wins
+				return left_length > right_length;
+			}
 #endif
 			auto memcmp_res = memcmp(left.GetData(), right.GetData(), min_length);
 			return memcmp_res > 0 || (memcmp_res == 0 && left_length > right_length);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/to_string.hpp"
 #include "duckdb/common/types.hpp"
@@ -123,11 +124,8 @@ public:
 				continue;
 			}
 
-			// Count partial entry (Kernighan's algorithm)
-			while (entry) {
-				entry &= (entry - 1);
-				++valid;
-			}
+			// Count partial entry
+			valid += CountBits<V>::Count(entry);
 		}
 
 		return valid;
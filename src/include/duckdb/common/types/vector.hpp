@@ -392,6 +392,8 @@ struct ListVector {
 	//! Gets the total capacity of the underlying child-vector of a list
 	DUCKDB_API static idx_t GetListCapacity(const Vector &vector);
 	//! Sets the total capacity of the underlying child-vector of a list
+	//! Reserve the child vector capacity - growth is geometric, and only the entries up to the current list size
+	//! are carried over, so the size must be kept up to date when writing into reserved capacity directly
 	DUCKDB_API static void Reserve(Vector &vec, idx_t required_capacity);
 	DUCKDB_API static void Append(Vector &target, const Vector &source, idx_t source_size, idx_t source_offset = 0);
 	DUCKDB_API static void Append(Vector &target, const Vector &source, const SelectionVector &sel, idx_t source_size,
@@ -426,6 +428,10 @@ struct StringVector {
 	//! Add a string or a blob to the string heap of the vector (auxiliary data)
 	//! This function is the same as ::AddString, except the added data does not need to be valid UTF8
 	DUCKDB_API static string_t AddStringOrBlob(Vector &vector, string_t data);
+	//! Adds a batch of possibly non-UTF-8 strings to the string buffer of the vector in one go.
+	//! Sets targets[i] to the added copy of source[sel.get_index(offset + i)]
+	DUCKDB_API static void AddStringsOrBlobs(Vector &vector, const string_t *source, const SelectionVector &sel,
+	                                         idx_t offset, string_t *targets, idx_t count);
 	//! Allocates an empty string of the specified size, and returns a writable pointer that can be used to store the
 	//! result of an operation
 	DUCKDB_API static string_t EmptyString(Vector &vector, idx_t len);
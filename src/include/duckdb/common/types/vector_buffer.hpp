@@ -179,6 +179,9 @@ public:
 	string_t AddBlob(string_t data) {
 		return heap.AddBlob(data.GetData(), data.GetSize());
 	}
+	void AddBlobs(const string_t *source, const SelectionVector &sel, idx_t offset, string_t *targets, idx_t count) {
+		heap.AddBlobs(source, sel, offset, targets, count);
+	}
 	string_t EmptyString(idx_t len) {
 		return heap.EmptyString(len);
 	}
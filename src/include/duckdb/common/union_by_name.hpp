@@ -11,10 +11,46 @@
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 
 namespace duckdb {
 
+//! Task that constructs (and thereby sniffs the schema of) the reader of a single file
+template <class READER_TYPE, class OPTION_TYPE>
+class UnionReaderTask : public Task {
+public:
+	UnionReaderTask(TaskCounter &counter, ClientContext &context, const string &file_name, idx_t file_idx,
+	                vector<unique_ptr<READER_TYPE>> &readers, OPTION_TYPE &options, mutex &error_lock, ErrorData &error)
+	    : counter(counter), context(context), file_name(file_name), file_idx(file_idx), readers(readers),
+	      options(options), error_lock(error_lock), error(error) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			readers[file_idx] = make_uniq<READER_TYPE>(context, file_name, options);
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(error_lock);
+			if (!error.HasError()) {
+				error = ErrorData(ex);
+			}
+		}
+		counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TaskCounter &counter;
+	ClientContext &context;
+	const string &file_name;
+	const idx_t file_idx;
+	vector<unique_ptr<READER_TYPE>> &readers;
+	OPTION_TYPE &options;
+	mutex &error_lock;
+	ErrorData &error;
+};
+
 class UnionByName {
 public:
 	static void CombineUnionTypes(const vector<string> &new_names, const vector<LogicalType> &new_types,
@@ -26,12 +62,26 @@ public:
 	static vector<typename READER_TYPE::UNION_READER_DATA>
 	UnionCols(ClientContext &context, const vector<string> &files, vector<LogicalType> &union_col_types,
 	          vector<string> &union_col_names, OPTION_TYPE &options) {
+		// construct the readers in parallel on the task scheduler - for auto-detected formats,
+		// constructing a reader sniffs the file, which dominates bind time on large file lists
+		vector<unique_ptr<READER_TYPE>> readers(files.size());
+		ErrorData error;
+		mutex error_lock;
+		TaskCounter counter(TaskScheduler::GetScheduler(context));
+		for (idx_t file_idx = 0; file_idx < files.size(); ++file_idx) {
+			counter.AddTask(make_shared_ptr<UnionReaderTask<READER_TYPE, OPTION_TYPE>>(
+			    counter, context, files[file_idx], file_idx, readers, options, error_lock, error));
+		}
+		counter.Finish();
+		if (error.HasError()) {
+			error.Throw();
+		}
+
+		// the union column order depends on the file order, so combine the schemas serially
 		vector<typename READER_TYPE::UNION_READER_DATA> union_readers;
 		case_insensitive_map_t<idx_t> union_names_map;
 		for (idx_t file_idx = 0; file_idx < files.size(); ++file_idx) {
-			const auto &file_name = files[file_idx];
-			auto reader = make_uniq<READER_TYPE>(context, file_name, options);
-
+			auto reader = std::move(readers[file_idx]);
 			auto &col_names = reader->GetNames();
 			auto &sql_types = reader->GetTypes();
 			CombineUnionTypes(col_names, sql_types, union_col_types, union_col_names, union_names_map);
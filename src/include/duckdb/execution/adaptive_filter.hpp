@@ -19,8 +19,28 @@ public:
 	explicit AdaptiveFilter(const Expression &expr);
 	explicit AdaptiveFilter(TableFilterSet *table_filters);
 	void AdaptRuntimeStatistics(double duration);
+	//! Record the observed selectivity and cost of a single table filter (identified by its index in the filter set)
+	void ObserveFilter(idx_t filter_idx, idx_t input_count, idx_t output_count, double duration);
+	//! Periodically reorder the permutation so that cheap and selective filters run first, based on the
+	//! per-filter observations
+	void AdaptTableFilterOrder();
 	vector<idx_t> permutation;
 
+private:
+	//! The number of vectors we observe between two reorderings of the table filters
+	static constexpr idx_t REORDER_INTERVAL = 100;
+
+	//! The online selectivity and cost observations of a single table filter
+	struct FilterStats {
+		idx_t filter_idx;
+		//! The number of tuples the filter was evaluated on
+		double observed_count = 0;
+		//! The number of tuples that passed the filter
+		double passed_count = 0;
+		//! The total time spent evaluating the filter
+		double time = 0;
+	};
+
 private:
 	//! used for adaptive expression reordering
 	idx_t iteration_count;
@@ -34,5 +54,9 @@ private:
 	bool warmup;
 	vector<idx_t> swap_likeliness;
 	std::default_random_engine generator;
+	//! Per-filter observations, only filled for table filters
+	vector<FilterStats> filter_stats;
+	//! The number of vectors observed since the last reordering
+	idx_t observation_count;
 };
 } // namespace duckdb
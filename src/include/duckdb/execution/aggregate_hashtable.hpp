@@ -118,6 +118,19 @@ private:
 		DataChunk group_chunk;
 	} state;
 
+	//! Cache of the group that the last added row belongs to. When the input is sorted (or merely clustered) on the
+	//! group columns, entire chunks often belong to this single group and can skip the hash table probe altogether.
+	struct LastGroupCache {
+		//! Whether the cache currently holds a group
+		bool is_set = false;
+		//! The hash of the cached group
+		hash_t hash;
+		//! The key values of the cached group
+		vector<Value> key;
+		//! Pointer to the cached group's row
+		data_ptr_t address;
+	} last_group;
+
 	//! The number of radix bits to partition by
 	idx_t radix_bits;
 	//! The data of the HT
@@ -152,6 +165,11 @@ private:
 	//! Apply bitmask to get the entry in the HT
 	inline idx_t ApplyBitMask(hash_t hash) const;
 
+	//! Fills the addresses with the cached group's row pointer if the entire chunk belongs to the cached group
+	bool TryUseCachedGroup(DataChunk &groups, Vector &group_hashes, Vector &addresses);
+	//! Caches the group of the last row of the chunk that was just added
+	void UpdateCachedGroup(DataChunk &groups, Vector &group_hashes);
+
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
@@ -123,6 +123,10 @@ protected:
 	             Vector &result);
 	void Execute(const BoundFunctionExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
+	//! Executes a function with a fused child function (see ExecuteFunctionState::fused_child) in a single loop,
+	//! without materializing an intermediate vector for the child's result
+	void ExecuteFused(const BoundFunctionExpression &expr, ExecuteFunctionState &state, const SelectionVector *sel,
+	                  idx_t count, Vector &result);
 	void Execute(const BoundOperatorExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
 	void Execute(const BoundParameterExpression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
@@ -13,6 +13,7 @@
 #include "duckdb/function/function.hpp"
 
 namespace duckdb {
+class BoundFunctionExpression;
 class Expression;
 class ExpressionExecutor;
 struct ExpressionExecutorState;
@@ -56,6 +57,11 @@ struct ExecuteFunctionState : public ExpressionState {
 	~ExecuteFunctionState() override;
 
 	unique_ptr<FunctionLocalState> local_state;
+	//! The child function that is fused into this function's loop, if any: for chains of floating point
+	//! +, - and * the child operation runs inside the parent's loop and its result is never materialized
+	optional_ptr<const BoundFunctionExpression> fused_child;
+	//! Which of this function's children the fused child is (0 or 1)
+	idx_t fused_child_index = 0;
 
 public:
 	static optional_ptr<FunctionLocalState> GetFunctionState(ExpressionState &state) {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/common/array.hpp"
 
@@ -21,7 +22,6 @@ enum class VerifyExistenceType : uint8_t {
 	DELETE_FK = 2  // delete from a table that has a foreign key
 };
 class ConflictManager;
-class ARTKey;
 class FixedSizeAllocator;
 
 // structs
@@ -31,6 +31,22 @@ struct ARTFlags {
 	vector<idx_t> merge_buffer_counts;
 };
 
+//! Accumulates the keys of a batch of appends to an index without constraints,
+//! which are bulk-merged into the tree at the end of the batch (see ART::InitializeBulkAppend)
+struct ARTBulkAppendState {
+	explicit ARTBulkAppendState(Allocator &allocator) : arena_allocator(allocator) {
+	}
+
+	//! Arena holding the data of the accumulated keys
+	ArenaAllocator arena_allocator;
+	//! The accumulated keys and their matching row identifiers
+	vector<ARTKey> keys;
+	vector<row_t> row_ids;
+	//! Scratch space for generating the keys of a single chunk
+	DataChunk expression_chunk;
+	vector<ARTKey> chunk_keys;
+};
+
 class ART : public BoundIndex {
 public:
 	// Index type name for the ART
@@ -86,6 +102,14 @@ public:
 	//! Construct an ART from a vector of sorted keys
 	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
 
+	//! Initialize a bulk append, which accumulates the keys of a batch of appends to an index without
+	//! constraints, and merges them into the tree as a single bulk-constructed subtree
+	unique_ptr<ARTBulkAppendState> InitializeBulkAppend();
+	//! Collect the keys and row identifiers of a chunk for a bulk append
+	void CollectBulkAppend(ARTBulkAppendState &state, DataChunk &input, row_t row_start);
+	//! Sort the collected keys, construct an ART from them, and merge it into the tree
+	void FinishBulkAppend(ARTBulkAppendState &state);
+
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
 
@@ -60,8 +60,6 @@ public:
 	//! Remove a row ID from a leaf. Returns true, if the leaf is empty after the removal
 	static bool Remove(ART &art, reference<Node> &node, const row_t row_id);
 
-	//! Get the total count of row IDs in the chain of leaves
-	static idx_t TotalCount(ART &art, const Node &node);
 	//! Fill the result_ids vector with the row IDs of this leaf chain, if the total count does not exceed max_count
 	static bool GetRowIds(ART &art, const Node &node, vector<row_t> &result_ids, const idx_t max_count);
 	//! Returns whether the leaf contains the row ID
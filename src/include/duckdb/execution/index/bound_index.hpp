@@ -15,6 +15,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/parser/parsed_expression.hpp"
 #include "duckdb/planner/expression.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/storage/index.hpp"
 
@@ -128,8 +129,9 @@ public: // Index interface
 	vector<unique_ptr<Expression>> unbound_expressions;
 
 protected:
-	//! Lock used for any changes to the index
-	mutex lock;
+	//! Lock used for any changes to the index. Read-only operations
+	//! can hold a shared lock instead, so that they do not block each other
+	StorageLock lock;
 
 	//! Bound expressions used during expression execution
 	vector<unique_ptr<Expression>> bound_expressions;
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
@@ -45,6 +47,9 @@ public:
 	//! Constructor for deserializing buffer metadata from disk
 	FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
 	                const BlockPointer &block_pointer);
+	//! Buffers are stored in a map by value, so they must be movable.
+	//! They are only moved while the index is exclusively locked
+	FixedSizeBuffer(FixedSizeBuffer &&other) noexcept;
 
 	//! Block manager of the database instance
 	BlockManager &block_manager;
@@ -71,10 +76,15 @@ public:
 	inline bool OnDisk() const {
 		return block_pointer.IsValid();
 	}
-	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory
+	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory.
+	//! Readers holding a shared index lock can race to pin an on-disk buffer, so the pin is guarded by a lock
 	inline data_ptr_t Get(const bool dirty_p = true) {
-		if (!InMemory()) {
-			Pin();
+		if (!loaded) {
+			lock_guard<mutex> guard(pin_lock);
+			if (!InMemory()) {
+				Pin();
+			}
+			loaded = true;
 		}
 		if (dirty_p) {
 			dirty = dirty_p;
@@ -98,6 +108,11 @@ private:
 	BufferHandle buffer_handle;
 	//! The block handle of the on-disk buffer
 	shared_ptr<BlockHandle> block_handle;
+	//! True: the buffer is pinned in memory and buffer_handle is safe to read.
+	//! Set after completing a pin so that concurrent readers avoid the pin lock
+	atomic<bool> loaded;
+	//! Guards lazily pinning an on-disk buffer under concurrent readers
+	mutex pin_lock;
 
 private:
 	//! Returns the maximum non-free offset in a bitmask
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/join_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! A blocked bloom filter over join key hashes, built from the build side of a hash join and
+//! pushed into the probe-side table scan so non-matching rows are dropped before they reach the probe.
+//! Insertion is thread-safe; probing is wait-free.
+class JoinBloomFilter {
+public:
+	//! Minimum number of 64-bit blocks (512 bytes)
+	static constexpr idx_t MINIMUM_BLOCK_COUNT = 64;
+	//! Maximum number of 64-bit blocks (16MB)
+	static constexpr idx_t MAXIMUM_BLOCK_COUNT = idx_t(1) << 21;
+	//! Number of probes after which the pass rate is evaluated
+	static constexpr idx_t SELECTIVITY_CHECK_INTERVAL = idx_t(1) << 17;
+	//! The filter disables itself if more than this fraction of probed rows passes
+	static constexpr double MAXIMUM_PASS_RATE = 0.9;
+
+	//! Create a bloom filter sized for the estimated number of build-side rows
+	explicit JoinBloomFilter(idx_t estimated_count);
+
+	//! Insert hashes (at the positions selected by `sel`) into the filter
+	void Insert(Vector &hashes, const SelectionVector &sel, idx_t count);
+	//! Mark the filter as fully built; only then does Enabled() return true
+	void SetComplete();
+	//! Whether the filter is fully built and still considered selective enough
+	bool Enabled() const {
+		return complete.load(std::memory_order_acquire) && !disabled.load(std::memory_order_relaxed);
+	}
+	//! Probe the filter with a flat vector of hashes; fills `result_sel` with the passing indices
+	//! and returns the number of passing rows
+	idx_t Filter(Vector &hashes, idx_t count, SelectionVector &result_sel);
+
+private:
+	static uint64_t BlockMask(hash_t hash) {
+		// set three bits within the block, derived from the low hash bits
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63));
+	}
+	idx_t BlockIndex(hash_t hash) const {
+		// the block index comes from the high hash bits, which the pointer table does not use
+		return (hash >> 32) & block_index_mask;
+	}
+
+private:
+	//! The filter blocks
+	unique_ptr<atomic<uint64_t>[]> blocks;
+	//! Mask to map a hash to a block
+	idx_t block_index_mask;
+	//! Whether the filter is fully built
+	atomic<bool> complete;
+	//! Whether the filter disabled itself because it is not selective enough
+	atomic<bool> disabled;
+	//! Number of rows probed / passed (for the selectivity check)
+	atomic<idx_t> probed_count;
+	atomic<idx_t> passed_count;
+};
+
+} // namespace duckdb
@@ -26,6 +26,7 @@ namespace duckdb {
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
+class JoinBloomFilter;
 struct ColumnDataAppendState;
 struct ClientConfig;
 
@@ -250,6 +251,8 @@ public:
 	bool finalized;
 	//! Whether or not any of the key elements contain NULL
 	bool has_null;
+	//! Optional bloom filter over the build-side key hashes, pushed down into the probe-side table scan
+	shared_ptr<JoinBloomFilter> bloom_filter;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
 
@@ -334,6 +337,9 @@ public:
 		void Append(DataChunk &chunk, ProbeSpillLocalAppendState &local_state);
 		//! Finalize by merging the thread-local accumulated data
 		void Finalize();
+		//! Repartition the spilled probe data to match the hash table again after the remaining
+		//! build data was repartitioned with more radix bits
+		void Repartition();
 
 	public:
 		//! Prepare the next probe round
@@ -397,14 +403,19 @@ public:
 
 	//! Delete blocks that belong to the current partitioned HT
 	void Reset();
-	//! Build HT for the next partitioned probe round
-	bool PrepareExternalFinalize(const idx_t max_ht_size);
+	//! Build HT for the next partitioned probe round. If the next partition by itself no longer fits in memory,
+	//! the remaining build (and spilled probe) data is recursively repartitioned with more radix bits first
+	bool PrepareExternalFinalize(const idx_t max_ht_size, optional_ptr<ProbeSpill> probe_spill);
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	unique_ptr<ScanStructure> ProbeAndSpill(DataChunk &keys, TupleDataChunkState &key_state, ProbeState &probe_state,
 	                                        DataChunk &payload, ProbeSpill &probe_spill,
 	                                        ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk);
 
 private:
+	//! Repartition the remaining sink partitions with more radix bits (for heavily skewed data,
+	//! a single partition can exceed the memory limit even after SetRepartitionRadixBits)
+	void RepartitionRemaining(const idx_t added_bits);
+
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
 
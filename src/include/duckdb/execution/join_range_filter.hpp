@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/join_range_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! The min/max bounds of the build-side keys of a range join, pushed into the probe-side table scan
+//! so rows that fall outside the bound of the comparison are dropped before they reach the sort.
+//! Updating the bounds is thread-safe; filtering is wait-free.
+class JoinRangeFilter {
+public:
+	//! Create a range filter for the given comparison (as seen from the probe side) and key type
+	JoinRangeFilter(ExpressionType comparison, const LogicalType &key_type);
+
+	//! Returns true if bounds can be tracked for the given key type
+	static bool SupportedKeyType(const LogicalType &key_type);
+
+	//! Merge the non-NULL values of a build-side key vector into the running bounds
+	void UpdateBounds(Vector &keys, idx_t count);
+	//! Mark the bounds as fully built; only then does Enabled() return true
+	void Finish();
+	//! Whether the bounds are fully built and non-empty
+	bool Enabled() const {
+		return complete.load(std::memory_order_acquire);
+	}
+	//! Keep the rows whose key can satisfy the comparison against at least one build-side key;
+	//! fills `result_sel` with the passing indices and returns the number of passing rows
+	idx_t Filter(Vector &keys, idx_t count, SelectionVector &result_sel);
+
+private:
+	//! The comparison of the join condition, as seen from the probe side (probe <comparison> build)
+	ExpressionType comparison;
+	//! The running bounds over the build-side keys, as constant vectors of the key type
+	Vector min_vector;
+	Vector max_vector;
+	//! False until the first non-NULL key is merged into the bounds
+	bool has_bounds;
+	//! Guards the running bounds while the build side is sinking in parallel
+	mutex update_lock;
+	//! Whether the build side is complete and the bounds can be used
+	atomic<bool> complete;
+};
+
+} // namespace duckdb
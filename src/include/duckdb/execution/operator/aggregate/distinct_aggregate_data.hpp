@@ -24,7 +24,8 @@ public:
 	unsafe_vector<idx_t> indices;
 	// The amount of radix_tables that are occupied
 	idx_t table_count;
-	//! Occupied tables, not equal to indices if aggregates share input data
+	//! For every occupied table, the index of the aggregate it was created for - not equal to indices if
+	//! aggregates share input data, so sinking per entry here sinks into every shared table exactly once
 	vector<idx_t> table_indices;
 	//! This indirection is used to allow two aggregates to share the same input data
 	unordered_map<idx_t, idx_t> table_map;
@@ -14,6 +14,12 @@
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
 #include "duckdb/common/helper.hpp"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 class CSVFileScan;
@@ -126,10 +132,70 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline bool ContainsZeroByte(uint64_t v) {
+	static inline bool ContainsZeroByte(uint64_t v) {
 		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
 	}
 
+	//! Returns how many bytes of "data" can be skipped because they contain none of the three special characters.
+	//! The special characters are passed as words with the character replicated across all bytes (see
+	//! CSVStateMachineCache). Scans whole blocks at a time and stops at the first block containing a special
+	//! character, so the returned count is a multiple of the block size and the per-byte loops at the call sites
+	//! still handle the tail.
+	static inline idx_t SkipUntilSpecial(const char *data, idx_t remaining, uint64_t special_a, uint64_t special_b,
+	                                     uint64_t special_c) {
+		idx_t skipped = 0;
+#if defined(__AVX2__)
+		const auto special_a_block = _mm256_set1_epi8(static_cast<char>(special_a));
+		const auto special_b_block = _mm256_set1_epi8(static_cast<char>(special_b));
+		const auto special_c_block = _mm256_set1_epi8(static_cast<char>(special_c));
+		while (skipped + 32 <= remaining) {
+			auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + skipped));
+			auto hits = _mm256_or_si256(_mm256_cmpeq_epi8(block, special_a_block),
+			                            _mm256_or_si256(_mm256_cmpeq_epi8(block, special_b_block),
+			                                            _mm256_cmpeq_epi8(block, special_c_block)));
+			if (_mm256_movemask_epi8(hits) != 0) {
+				return skipped;
+			}
+			skipped += 32;
+		}
+#elif defined(__SSE2__)
+		const auto special_a_block = _mm_set1_epi8(static_cast<char>(special_a));
+		const auto special_b_block = _mm_set1_epi8(static_cast<char>(special_b));
+		const auto special_c_block = _mm_set1_epi8(static_cast<char>(special_c));
+		while (skipped + 16 <= remaining) {
+			auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + skipped));
+			auto hits = _mm_or_si128(
+			    _mm_cmpeq_epi8(block, special_a_block),
+			    _mm_or_si128(_mm_cmpeq_epi8(block, special_b_block), _mm_cmpeq_epi8(block, special_c_block)));
+			if (_mm_movemask_epi8(hits) != 0) {
+				return skipped;
+			}
+			skipped += 16;
+		}
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+		const auto special_a_block = vdupq_n_u8(static_cast<uint8_t>(special_a));
+		const auto special_b_block = vdupq_n_u8(static_cast<uint8_t>(special_b));
+		const auto special_c_block = vdupq_n_u8(static_cast<uint8_t>(special_c));
+		while (skipped + 16 <= remaining) {
+			auto block = vld1q_u8(reinterpret_cast<const uint8_t *>(data + skipped));
+			auto hits = vorrq_u8(vceqq_u8(block, special_a_block),
+			                     vorrq_u8(vceqq_u8(block, special_b_block), vceqq_u8(block, special_c_block)));
+			if (vmaxvq_u8(hits) != 0) {
+				return skipped;
+			}
+			skipped += 16;
+		}
+#endif
+		while (skipped + 8 <= remaining) {
+			uint64_t value = Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(data + skipped));
+			if (ContainsZeroByte((value ^ special_a) & (value ^ special_b) & (value ^ special_c))) {
+				return skipped;
+			}
+			skipped += 8;
+		}
+		return skipped;
+	}
+
 	//! Process one chunk
 	template <class T>
 	void Process(T &result) {
@@ -202,14 +268,11 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
+				if (iterator.pos.buffer_pos < to_pos) {
+					iterator.pos.buffer_pos += SkipUntilSpecial(
+					    &buffer_handle_ptr[iterator.pos.buffer_pos], to_pos - iterator.pos.buffer_pos - 1,
+					    state_machine->transition_array.quote, state_machine->transition_array.escape,
+					    state_machine->transition_array.escape);
 				}
 
 				while (state_machine->transition_array
@@ -224,15 +287,11 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
+				if (iterator.pos.buffer_pos < to_pos) {
+					iterator.pos.buffer_pos += SkipUntilSpecial(
+					    &buffer_handle_ptr[iterator.pos.buffer_pos], to_pos - iterator.pos.buffer_pos - 1,
+					    state_machine->transition_array.delimiter, state_machine->transition_array.new_line,
+					    state_machine->transition_array.carriage_return);
 				}
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_exchange.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+//! The ExchangeTransport abstracts how serialized chunk streams move between the partitions of an exchange -
+//! e.g. over the network between the nodes of a cluster. The engine provides the partitioning and the
+//! (de)serialization of the chunks; transports only move opaque byte buffers.
+class ExchangeTransport {
+public:
+	DUCKDB_API virtual ~ExchangeTransport();
+
+	//! Send a buffer holding one serialized DataChunk to the given target partition.
+	//! Can be called concurrently from multiple threads.
+	virtual void Send(idx_t target_partition, const_data_ptr_t buffer, idx_t size) = 0;
+	//! Called exactly once when all data has been sent
+	virtual void FinishSending() = 0;
+	//! Receive the next buffer holding one serialized DataChunk destined for this node.
+	//! Returns false when all senders have finished. May block while waiting for data.
+	virtual bool Receive(vector<data_t> &buffer) = 0;
+};
+
+//! PhysicalExchangeSink partitions its input by a set of expressions and sends the serialized partition streams
+//! over an ExchangeTransport. Together with PhysicalExchangeSource this forms the exchange operator pair that
+//! extensions can place in physical plans to shuffle data between nodes.
+class PhysicalExchangeSink : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::EXTENSION;
+
+public:
+	PhysicalExchangeSink(vector<LogicalType> types, vector<unique_ptr<Expression>> partition_expressions,
+	                     idx_t partition_count, shared_ptr<ExchangeTransport> transport, idx_t estimated_cardinality);
+
+	//! The expressions that the rows are partitioned by (hash-partitioned over their combined hash)
+	vector<unique_ptr<Expression>> partition_expressions;
+	//! The number of target partitions
+	idx_t partition_count;
+	//! The transport that the serialized chunk streams are sent over
+	shared_ptr<ExchangeTransport> transport;
+
+public:
+	string GetName() const override;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return true;
+	}
+};
+
+//! PhysicalExchangeSource receives serialized chunk streams from an ExchangeTransport and emits the
+//! deserialized chunks
+class PhysicalExchangeSource : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::EXTENSION;
+
+public:
+	PhysicalExchangeSource(vector<LogicalType> types, shared_ptr<ExchangeTransport> transport,
+	                       idx_t estimated_cardinality);
+
+	//! The transport that the serialized chunk streams are received from
+	shared_ptr<ExchangeTransport> transport;
+
+public:
+	string GetName() const override;
+
+public:
+	// Source interface
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+};
+
+} // namespace duckdb
@@ -35,6 +35,7 @@ public:
 
 	OrderPreservationType OperatorOrder() const override;
 	bool ParallelOperator() const override;
+	bool OperatorFinished(GlobalOperatorState &gstate) const override;
 };
 
 } // namespace duckdb
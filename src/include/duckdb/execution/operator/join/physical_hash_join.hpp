@@ -51,6 +51,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Optional bloom filter over the build-side key hashes, shared with the probe-side table scan
+	shared_ptr<JoinBloomFilter> bloom_filter;
 
 public:
 	string ParamsToString() const override;
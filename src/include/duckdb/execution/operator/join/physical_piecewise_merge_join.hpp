@@ -13,6 +13,7 @@
 
 namespace duckdb {
 
+class JoinRangeFilter;
 class MergeJoinGlobalState;
 
 //! PhysicalPiecewiseMergeJoin represents a piecewise merge loop join between
@@ -29,6 +30,8 @@ public:
 	vector<LogicalType> join_key_types;
 	vector<BoundOrderByNode> lhs_orders;
 	vector<BoundOrderByNode> rhs_orders;
+	//! The bounds of the build-side keys, pushed down into the probe-side table scan (if any)
+	shared_ptr<JoinRangeFilter> range_filter;
 
 public:
 	// Operator Interface
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/tiny_build_join_executor.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/execution_context.hpp"
+#include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+class PhysicalHashJoin;
+
+//! TinyBuildJoinExecutor replaces the hash probe with direct vectorized comparisons when the
+//! build side holds only a handful of rows, e.g. a dimension table after filters.
+//! For so few rows, hashing the probe keys and chasing pointers costs more than simply
+//! comparing every probe key against every build row.
+class TinyBuildJoinExecutor {
+public:
+	//! Builds with at most this many rows are joined with direct comparisons
+	static constexpr idx_t TINY_BUILD_THRESHOLD = 32;
+
+public:
+	TinyBuildJoinExecutor(const PhysicalHashJoin &join, JoinHashTable &ht);
+
+public:
+	static bool CanDoTinyBuildJoin(const PhysicalHashJoin &join, JoinHashTable &ht);
+
+	//! Materialize the build side rows into columnar chunks
+	void BuildTinyTable();
+
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
+	OperatorResultType ProbeTinyBuild(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                  OperatorState &state);
+
+private:
+	const PhysicalHashJoin &join;
+	JoinHashTable &ht;
+	//! The build side condition columns
+	DataChunk build_conditions;
+	//! The build side payload columns
+	DataChunk build_payload;
+};
+
+} // namespace duckdb
@@ -20,7 +20,7 @@ public:
 	BatchMemoryManager(ClientContext &context, idx_t initial_memory_request)
 	    : context(context), unflushed_memory_usage(0), min_batch_index(0), available_memory(0),
 	      can_increase_memory(true) {
-		memory_state = TemporaryMemoryManager::Get(context).Register(context);
+		memory_state = TemporaryMemoryManager::Get(context).Register(context, "BATCH_SINK");
 		SetMemorySize(initial_memory_request);
 	}
 
@@ -15,6 +15,20 @@
 #include "duckdb/common/extra_operator_info.hpp"
 
 namespace duckdb {
+class JoinBloomFilter;
+class JoinRangeFilter;
+
+//! A bloom filter pushed down from a hash join, together with the scan output column it applies to
+struct PushedDownBloomFilter {
+	shared_ptr<JoinBloomFilter> filter;
+	idx_t column_index;
+};
+
+//! A range filter pushed down from a merge join, together with the scan output column it applies to
+struct PushedDownRangeFilter {
+	shared_ptr<JoinRangeFilter> filter;
+	idx_t column_index;
+};
 
 //! Represents a scan of a base table
 class PhysicalTableScan : public PhysicalOperator {
@@ -46,6 +60,10 @@ public:
 	ExtraOperatorInfo extra_info;
 	//! Parameters
 	vector<Value> parameters;
+	//! Bloom filters pushed down from hash joins above this scan, applied to the scan output
+	vector<PushedDownBloomFilter> bloom_filters;
+	//! Range filters pushed down from merge joins above this scan, applied to the scan output
+	vector<PushedDownRangeFilter> range_filters;
 
 public:
 	string GetName() const override;
@@ -58,6 +76,10 @@ public:
 	                                                 GlobalSourceState &gstate) const override;
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
 	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+	//! Drop scanned rows that cannot match any build-side key of the hash joins above this scan
+	void ApplyBloomFilters(DataChunk &chunk) const;
+	//! Drop scanned rows that fall outside the build-side key bounds of the merge joins above this scan
+	void ApplyRangeFilters(DataChunk &chunk) const;
 	idx_t GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
 	                    LocalSourceState &lstate) const override;
 
@@ -43,10 +43,10 @@ protected:
 	//! The number of grouping columns
 	idx_t grouping_columns;
 
-	// The actual pointer to the data
-	data_ptr_t data;
-	//! The owned data of the HT
-	unsafe_unique_array<data_t> owned_data;
+	//! The aggregate states, stored columnar: one contiguous array of states per aggregate function
+	vector<unsafe_unique_array<data_t>> aggregate_data;
+	//! The stride (in bytes) between consecutive states within each per-aggregate array
+	vector<idx_t> state_strides;
 	//! Information on whether or not a specific group has any entries
 	unsafe_unique_array<bool> group_is_set;
 
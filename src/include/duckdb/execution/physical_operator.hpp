@@ -94,6 +94,12 @@ public:
 		return false;
 	}
 
+	//! Whether the operator is guaranteed to never need more input (e.g. a limit that has been reached globally).
+	//! Pipeline tasks poll this between source chunks so sibling tasks can stop scanning early.
+	virtual bool OperatorFinished(GlobalOperatorState &gstate) const {
+		return false;
+	}
+
 	//! The influence the operator has on order (insertion order means no influence)
 	virtual OrderPreservationType OperatorOrder() const {
 		return OrderPreservationType::INSERTION_ORDER;
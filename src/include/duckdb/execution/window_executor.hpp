@@ -181,8 +181,21 @@ public:
 	virtual void Finalize(WindowExecutorGlobalState &gstate) const {
 	}
 
+	//! Called by threads that are waiting for this partition to help with an in-progress Finalize.
+	//! Returns true if any work was done.
+	virtual bool TryFinalizeTask(WindowExecutorGlobalState &gstate) const {
+		return false;
+	}
+
+	//! Returns true if the other executor computes identical frame bounds,
+	//! in which case the bounds computed by this executor can be reused for it
+	bool CanShareBounds(const WindowExecutor &other) const;
+
+	//! Evaluate the function for a chunk of rows. If bounds_source is set, it is the local state of an
+	//! executor with an equivalent frame that has already computed the bounds for this chunk.
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
-	              WindowExecutorGlobalState &gstate) const;
+	              WindowExecutorGlobalState &gstate,
+	              optional_ptr<const WindowExecutorLocalState> bounds_source = nullptr) const;
 
 	// The function
 	const BoundWindowExpression &wexpr;
@@ -200,6 +213,7 @@ public:
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count,
 	          WindowExecutorGlobalState &gstate) const override;
 	void Finalize(WindowExecutorGlobalState &gstate) const override;
+	bool TryFinalizeTask(WindowExecutorGlobalState &gstate) const override;
 
 	unique_ptr<WindowExecutorGlobalState> GetGlobalState(const idx_t payload_count, const ValidityMask &partition_mask,
 	                                                     const ValidityMask &order_mask) const override;
@@ -50,6 +50,9 @@ public:
 	                                                         const ValidityMask &partition_mask) const;
 	virtual void Sink(WindowAggregatorState &gsink, DataChunk &arg_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(WindowAggregatorState &gsink, const FrameStats &stats);
+	//! Cooperatively work on an in-progress Finalize from another thread.
+	//! Returns true if any work was done.
+	virtual bool TryFinalizeTask(WindowAggregatorState &gsink) const;
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -121,6 +124,7 @@ public:
 	unique_ptr<WindowAggregatorState> GetGlobalState(idx_t group_count,
 	                                                 const ValidityMask &partition_mask) const override;
 	void Finalize(WindowAggregatorState &gsink, const FrameStats &stats) override;
+	bool TryFinalizeTask(WindowAggregatorState &gsink) const override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
@@ -110,6 +110,41 @@ struct VectorDecimalCastOperator {
 	}
 };
 
+struct VectorIntegerToDecimalCastData {
+	VectorIntegerToDecimalCastData(Vector &result, CastParameters &parameters, uint8_t width_p, uint8_t scale_p,
+	                               int64_t max_width_p, int64_t scale_factor_p)
+	    : vector_cast_data(result, parameters), width(width_p), scale(scale_p), max_width(max_width_p),
+	      scale_factor(scale_factor_p) {
+	}
+
+	VectorTryCastData vector_cast_data;
+	uint8_t width;
+	uint8_t scale;
+	//! Overflow bound and scale multiplier, hoisted out of the cast loop
+	int64_t max_width;
+	int64_t scale_factor;
+};
+
+struct VectorIntegerToDecimalCastOperator {
+	template <class INPUT_TYPE, class RESULT_TYPE>
+	static RESULT_TYPE Operation(INPUT_TYPE input, ValidityMask &mask, idx_t idx, void *dataptr) {
+		auto data = reinterpret_cast<VectorIntegerToDecimalCastData *>(dataptr);
+		// same overflow check as StandardNumericToDecimalCast, but against the bound hoisted out of the loop
+		bool overflows;
+		if (NumericLimits<INPUT_TYPE>::IsSigned()) {
+			overflows = int64_t(input) >= data->max_width || int64_t(input) <= -data->max_width;
+		} else {
+			overflows = uint64_t(input) >= uint64_t(data->max_width);
+		}
+		if (DUCKDB_UNLIKELY(overflows)) {
+			return HandleVectorCastError::Operation<RESULT_TYPE>(
+			    StringUtil::Format("Could not cast value %d to DECIMAL(%d,%d)", input, data->width, data->scale), mask,
+			    idx, data->vector_cast_data);
+		}
+		return UnsafeNumericCast<RESULT_TYPE>(RESULT_TYPE(input) * data->scale_factor);
+	}
+};
+
 struct VectorCastHelpers {
 	template <class SRC, class DST, class OP>
 	static bool TemplatedCastLoop(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
@@ -161,18 +196,39 @@ struct VectorCastHelpers {
 		return input.vector_cast_data.all_converted;
 	}
 
+	//! Integer -> decimal: the overflow bound and scale multiplier only depend on the decimal width/scale,
+	//! so they are computed once here instead of per row in TryCastToDecimal
+	template <class SRC, class T>
+	static bool DecimalCastLoop(Vector &source, Vector &result, idx_t count, CastParameters &parameters, uint8_t width,
+	                            uint8_t scale, std::true_type) {
+		VectorIntegerToDecimalCastData input(result, parameters, width, scale,
+		                                     NumericHelper::POWERS_OF_TEN[width - scale],
+		                                     NumericHelper::POWERS_OF_TEN[scale]);
+		UnaryExecutor::GenericExecute<SRC, T, VectorIntegerToDecimalCastOperator>(source, result, count, (void *)&input,
+		                                                                          parameters.error_message);
+		return input.vector_cast_data.all_converted;
+	}
+
+	template <class SRC, class T>
+	static bool DecimalCastLoop(Vector &source, Vector &result, idx_t count, CastParameters &parameters, uint8_t width,
+	                            uint8_t scale, std::false_type) {
+		return TemplatedDecimalCast<SRC, T, TryCastToDecimal>(source, result, count, parameters, width, scale);
+	}
+
 	template <class T>
 	static bool ToDecimalCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+		// booleans, hugeints and floating point types need the type-specific handling of TryCastToDecimal
+		using IS_INTEGER = std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value>;
 		auto &result_type = result.GetType();
 		auto width = DecimalType::GetWidth(result_type);
 		auto scale = DecimalType::GetScale(result_type);
 		switch (result_type.InternalType()) {
 		case PhysicalType::INT16:
-			return TemplatedDecimalCast<T, int16_t, TryCastToDecimal>(source, result, count, parameters, width, scale);
+			return DecimalCastLoop<T, int16_t>(source, result, count, parameters, width, scale, IS_INTEGER());
 		case PhysicalType::INT32:
-			return TemplatedDecimalCast<T, int32_t, TryCastToDecimal>(source, result, count, parameters, width, scale);
+			return DecimalCastLoop<T, int32_t>(source, result, count, parameters, width, scale, IS_INTEGER());
 		case PhysicalType::INT64:
-			return TemplatedDecimalCast<T, int64_t, TryCastToDecimal>(source, result, count, parameters, width, scale);
+			return DecimalCastLoop<T, int64_t>(source, result, count, parameters, width, scale, IS_INTEGER());
 		case PhysicalType::INT128:
 			return TemplatedDecimalCast<T, hugeint_t, TryCastToDecimal>(source, result, count, parameters, width,
 			                                                            scale);
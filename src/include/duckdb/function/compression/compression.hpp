@@ -63,4 +63,9 @@ struct FSSTFun {
 	static bool TypeIsSupported(const CompressionInfo &info);
 };
 
+struct RoaringCompressionFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const CompressionInfo &info);
+};
+
 } // namespace duckdb
@@ -22,6 +22,7 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 struct ColumnSegmentState;
 
 struct ColumnFetchState;
@@ -176,6 +177,15 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
 
+//===--------------------------------------------------------------------===//
+// Zonemap pruning (optional)
+//===--------------------------------------------------------------------===//
+//! Function prototype used for pruning rows using the metadata the compression method stores per group of values,
+//! which is finer-grained than the per-segment zonemap. Should return the number of rows starting at the current
+//! scan position that are guaranteed not to contain any matches for the filter (0 if nothing can be pruned, or if
+//! the filter is not supported).
+typedef idx_t (*compression_zonemap_prune_t)(ColumnSegment &segment, ColumnScanState &state, TableFilter &filter);
+
 //===--------------------------------------------------------------------===//
 // Append (optional)
 //===--------------------------------------------------------------------===//
@@ -216,9 +226,9 @@ public:
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
-	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
-	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      fetch_row(fetch_row), skip(skip), zonemap_prune(nullptr), init_segment(init_segment),
+	      init_append(init_append), append(append), finalize_append(finalize_append), revert_append(revert_append),
+	      serialize_state(serialize_state), deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
 	}
 
 	//! Compression type
@@ -262,6 +272,8 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Prune upcoming rows using the per-group metadata of the compression method (optional)
+	compression_zonemap_prune_t zonemap_prune;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
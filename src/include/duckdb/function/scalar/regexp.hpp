@@ -61,6 +61,9 @@ struct RegexpMatchesBindData : public RegexpBaseBindData {
 	string range_min;
 	string range_max;
 	bool range_success;
+	//! A literal that every match must contain (if non-empty) - used to skip regex evaluation for rows
+	//! that cannot possibly match
+	string required_literal;
 
 	unique_ptr<FunctionData> Copy() const override;
 };
@@ -93,6 +93,10 @@ struct DuckDBOptimizersFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBProfilingSamplesFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSequencesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -101,6 +105,10 @@ struct DuckDBSettingsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBSpillEventsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBTablesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -109,6 +117,10 @@ struct DuckDBTemporaryFilesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBTemporaryMemoryFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBTypesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
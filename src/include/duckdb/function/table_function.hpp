@@ -25,6 +25,7 @@ class LogicalDependencyList;
 class LogicalGet;
 class TableFilterSet;
 class TableCatalogEntry;
+class InterruptState;
 struct MultiFileReader;
 
 struct TableFunctionInfo {
@@ -129,14 +130,19 @@ struct TableFunctionInput {
 public:
 	TableFunctionInput(optional_ptr<const FunctionData> bind_data_p,
 	                   optional_ptr<LocalTableFunctionState> local_state_p,
-	                   optional_ptr<GlobalTableFunctionState> global_state_p)
-	    : bind_data(bind_data_p), local_state(local_state_p), global_state(global_state_p) {
+	                   optional_ptr<GlobalTableFunctionState> global_state_p,
+	                   optional_ptr<InterruptState> interrupt_state_p = nullptr)
+	    : bind_data(bind_data_p), local_state(local_state_p), global_state(global_state_p),
+	      interrupt_state(interrupt_state_p) {
 	}
 
 public:
 	optional_ptr<const FunctionData> bind_data;
 	optional_ptr<LocalTableFunctionState> local_state;
 	optional_ptr<GlobalTableFunctionState> global_state;
+	//! The interrupt state of the current scan - only set when invoked through an async-capable call site
+	//! Async table functions must register a callback on this state before returning BLOCKED
+	optional_ptr<InterruptState> interrupt_state;
 };
 
 enum class ScanType : uint8_t { TABLE, PARQUET };
@@ -192,6 +198,8 @@ typedef unique_ptr<LocalTableFunctionState> (*table_function_init_local_t)(Execu
 typedef unique_ptr<BaseStatistics> (*table_statistics_t)(ClientContext &context, const FunctionData *bind_data,
                                                          column_t column_index);
 typedef void (*table_function_t)(ClientContext &context, TableFunctionInput &data, DataChunk &output);
+typedef SourceResultType (*table_function_async_t)(ClientContext &context, TableFunctionInput &data,
+                                                   DataChunk &output);
 typedef OperatorResultType (*table_in_out_function_t)(ExecutionContext &context, TableFunctionInput &data,
                                                       DataChunk &input, DataChunk &output);
 typedef OperatorFinalizeResultType (*table_in_out_function_final_t)(ExecutionContext &context, TableFunctionInput &data,
@@ -252,6 +260,12 @@ public:
 	table_function_init_local_t init_local;
 	//! The main function
 	table_function_t function;
+	//! The asynchronous main function (optional, takes precedence over `function` if set)
+	//! Instead of blocking the worker thread while waiting for data, this function can return BLOCKED without
+	//! producing output. Before doing so it must register a callback on the interrupt state of the input, so that the
+	//! scan is rescheduled once data becomes available. Returning HAVE_MORE_OUTPUT with an empty chunk is not allowed,
+	//! and an empty chunk with FINISHED marks exhaustion - matching the regular source protocol.
+	table_function_async_t async_function;
 	//! The table in-out function (if this is an in-out function)
 	table_in_out_function_t in_out_function;
 	//! The table in-out final function (if this is an in-out function)
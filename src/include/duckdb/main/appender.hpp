@@ -8,17 +8,24 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/main/table_description.hpp"
 
 namespace duckdb {
 
+class BlockManager;
 class ColumnDataCollection;
 class ClientContext;
 class DuckDB;
+class RowGroupCollection;
 class TableCatalogEntry;
 class Connection;
+struct DataTableInfo;
+struct TableAppendState;
 
 enum class AppenderType : uint8_t {
 	LOGICAL, // Cast input -> LogicalType
@@ -148,6 +155,76 @@ protected:
 	void FlushInternal(ColumnDataCollection &collection) override;
 };
 
+class ParallelAppender;
+
+//! A thread-local appender obtained through ParallelAppender::CreateAppender. Rows are appended into an independent
+//! row group collection without any synchronization; destroying the thread appender hands the collection back to the
+//! parent, which stitches all collections into the table when it is closed.
+class ParallelAppenderThread : public BaseAppender {
+	friend class ParallelAppender;
+
+public:
+	DUCKDB_API ~ParallelAppenderThread() override;
+
+protected:
+	void FlushInternal(ColumnDataCollection &collection) override;
+
+private:
+	explicit ParallelAppenderThread(ParallelAppender &parent);
+
+private:
+	//! The parallel appender that created this thread appender
+	ParallelAppender &parent;
+	//! The row groups filled by this thread appender
+	unique_ptr<RowGroupCollection> row_groups;
+	//! The state of the append into the row groups
+	unique_ptr<TableAppendState> append_state;
+};
+
+//! The ParallelAppender can be used to append to a single table from multiple threads at the same time. Every thread
+//! fills its own set of row groups through a ParallelAppenderThread, after which Close() appends all of the gathered
+//! row groups to the table in a single transaction, writing them to disk optimistically for large appends in the same
+//! manner as batched INSERT statements.
+class ParallelAppender {
+	friend class ParallelAppenderThread;
+
+public:
+	DUCKDB_API ParallelAppender(Connection &con, const string &schema_name, const string &table_name);
+	DUCKDB_API ParallelAppender(Connection &con, const string &table_name);
+	DUCKDB_API ~ParallelAppender();
+
+public:
+	//! Creates an appender for use by a single thread; can safely be called from multiple threads
+	DUCKDB_API unique_ptr<ParallelAppenderThread> CreateAppender();
+	//! Appends all of the gathered row groups to the table; all thread appenders must have been destroyed before the
+	//! parallel appender can be closed
+	DUCKDB_API void Close();
+
+private:
+	//! Called by a thread appender upon destruction to hand its row groups back to the parallel appender
+	void ReturnCollection(unique_ptr<RowGroupCollection> row_groups);
+
+private:
+	//! A reference to the database connection that created this appender
+	shared_ptr<ClientContext> context;
+	//! The table description (including column names)
+	unique_ptr<TableDescription> description;
+	//! The append types
+	vector<LogicalType> types;
+	//! The table info, required to create the per-thread row group collections
+	shared_ptr<DataTableInfo> table_info;
+	//! The block manager that holds the table data
+	optional_ptr<BlockManager> block_manager;
+	//! The number of thread appenders that have not been destroyed yet
+	atomic<idx_t> open_appenders;
+	//! Lock protecting the set of returned row group collections
+	mutex collection_lock;
+	//! The row group collections handed back by destroyed thread appenders
+	vector<unique_ptr<RowGroupCollection>> collections;
+	//! Whether or not the parallel appender has been closed
+	bool closed;
+};
+
 template <>
 DUCKDB_API void BaseAppender::Append(bool value);
 template <>
@@ -43,6 +43,8 @@ struct AttachOptions {
 	AccessMode access_mode;
 	//! The file format type. The default type is a duckdb database file, but other file formats are possible.
 	string db_type;
+	//! Whether to bypass the operating system page cache when reading and writing the database file.
+	bool use_direct_io = false;
 	//! We only set this, if we detect any unrecognized option.
 	string unrecognized_option;
 };
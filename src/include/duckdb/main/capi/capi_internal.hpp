@@ -11,6 +11,7 @@
 #include "duckdb.h"
 #include "duckdb.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/common/types/column/column_data_scan_states.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
@@ -70,12 +71,23 @@ enum class CAPIResultSetType : uint8_t {
 	CAPI_RESULT_TYPE_DEPRECATED
 };
 
+struct DuckDBFetchedChunks {
+	//! The state keeping the blocks referenced by the fetched chunks pinned
+	ChunkManagementState chunk_state;
+	//! The chunks handed out by the last duckdb_result_fetch_chunks call
+	vector<unique_ptr<DataChunk>> chunks;
+	//! The index of the next chunk to fetch
+	idx_t chunk_idx = 0;
+};
+
 struct DuckDBResultData {
 	//! The underlying query result
 	unique_ptr<QueryResult> result;
 	// Results can only use either the new API or the old API, not a mix of the two
 	// They start off as "none" and switch to one or the other when an API method is used
 	CAPIResultSetType result_set_type;
+	//! The zero-copy chunks handed out by duckdb_result_fetch_chunks (if any)
+	unique_ptr<DuckDBFetchedChunks> fetched_chunks;
 };
 
 duckdb_type ConvertCPPTypeToC(const LogicalType &type);
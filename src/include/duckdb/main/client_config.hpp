@@ -12,6 +12,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/main/profiling_info.hpp"
@@ -73,6 +74,8 @@ struct ClientConfig {
 	bool enable_optimizer = true;
 	//! Enable caching operators
 	bool enable_caching_operators = true;
+	//! Whether or not prepared plans of repeated unparameterized statements are cached and reused
+	bool enable_plan_cache = false;
 	//! Force parallelism of small tables, used for testing
 	bool verify_parallelism = false;
 	//! Force out-of-core computation for operators that support it, used for testing
@@ -101,6 +104,9 @@ struct ClientConfig {
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
 	idx_t merge_join_threshold = 1000;
+	//! The minimum number of estimated rows at which an UPDATE rewrites the affected rows
+	//! instead of updating them in-place (DConstants::INVALID_INDEX to disable)
+	idx_t bulk_update_threshold = DConstants::INVALID_INDEX;
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
@@ -123,6 +129,9 @@ struct ClientConfig {
 	//! Output error messages as structured JSON instead of as a raw string
 	bool errors_as_json = false;
 
+	//! The scheduling priority class of queries issued by this connection
+	QueryPriority priority = QueryPriority::NORMAL;
+
 	//! Generic options
 	case_insensitive_map_t<Value> set_variables;
 
@@ -47,6 +47,7 @@ struct CreateScalarFunctionInfo;
 class ScalarFunctionCatalogEntry;
 struct ActiveQueryContext;
 struct ParserOptions;
+struct QueryCachePlanInfo;
 class SimpleBufferedData;
 struct ClientData;
 class ClientContextState;
@@ -278,6 +279,8 @@ private:
 	mutex context_lock;
 	//! The currently active query context
 	unique_ptr<ActiveQueryContext> active_query;
+	//! The tables read by the last prepared statement, gathered for the query result cache
+	unique_ptr<QueryCachePlanInfo> cache_plan_info;
 	//! The current query progress
 	QueryProgress query_progress;
 };
@@ -27,6 +27,7 @@ class QueryProfiler;
 class PreparedStatementData;
 class SchemaCatalogEntry;
 class HTTPLogger;
+class PlanCache;
 struct RandomEngine;
 
 struct ClientData {
@@ -43,6 +44,8 @@ struct ClientData {
 	shared_ptr<AttachedDatabase> temporary_objects;
 	//! The set of bound prepared statements that belong to this client
 	case_insensitive_map_t<shared_ptr<PreparedStatementData>> prepared_statements;
+	//! The cache of plans for repeated unparameterized statements
+	unique_ptr<PlanCache> plan_cache;
 
 	//! The writer used to log queries (if logging is enabled)
 	unique_ptr<BufferedFileWriter> log_query_writer;
@@ -26,5 +26,8 @@ struct ClientProperties {
 	ArrowOffsetSize arrow_offset_size = ArrowOffsetSize::REGULAR;
 	bool arrow_use_list_view = false;
 	bool produce_arrow_string_view = false;
+	//! Whether arrow arrays may reference vector buffers directly instead of copying them; only safe when the
+	//! appended chunks are not modified or recycled until the arrow array is released
+	bool arrow_allow_zero_copy = false;
 };
 } // namespace duckdb
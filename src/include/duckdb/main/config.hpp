@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
@@ -145,6 +146,21 @@ struct DBConfigOptions {
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
+	//! The maximum amount of memory used to keep evicted buffers compressed in memory instead of writing them to
+	//! the temporary directory (in bytes). Default: 0 (disabled).
+	idx_t compressed_buffer_tier_size = 0;
+	//! Whether buffers written to the temporary directory are compressed. Blocks that do not compress well are
+	//! written uncompressed. Default: false.
+	bool temp_file_compression = false;
+	//! The number of vectors table scans read ahead of the current scan position in the background.
+	//! Default: 0 (blocks are only prefetched for remote file systems).
+	idx_t scan_prefetch_depth = 0;
+	//! Whether join cardinalities observed during execution are recorded and reused by the join order optimizer
+	//! when planning subsequent queries over the same tables. Requires profiling to record cardinalities.
+	bool enable_cardinality_feedback = false;
+	//! Whether the join order optimizer measures the selectivity of pushed-down filters against a cached sample of
+	//! each table instead of deriving it from per-column statistics alone.
+	bool enable_selectivity_sampling = false;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = DConstants::INVALID_INDEX;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
@@ -159,6 +175,9 @@ struct DBConfigOptions {
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! Whether the buffer pool grants frequently used blocks a second chance before unloading them,
+	//! so that large scans cannot flush the hot set
+	bool scan_resistant_eviction = false;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
@@ -173,6 +192,8 @@ struct DBConfigOptions {
 	bool object_cache_enable = false;
 	//! Whether or not the global http metadata cache is used
 	bool http_metadata_cache_enable = false;
+	//! Whether or not the query result cache is used to serve repeated queries on unchanged tables
+	bool enable_result_cache = false;
 	//! Force checkpoint when CHECKPOINT is called or on shutdown, even if no changes have been made
 	bool force_checkpoint = false;
 	//! Run a checkpoint on successful shutdown and delete the WAL, to leave only a single database file behind
@@ -190,10 +211,15 @@ struct DBConfigOptions {
 	CompressionType force_compression = CompressionType::COMPRESSION_AUTO;
 	//! Force a specific bitpacking mode to be used when using the bitpacking compression method
 	BitpackingMode force_bitpacking_mode = BitpackingMode::AUTO;
+	//! Reuse each column's previous compression method when checkpointing update-only changes,
+	//! skipping the analyze pass over all compression methods (disable to always re-analyze)
+	bool checkpoint_compression_reuse = true;
 	//! Debug setting for window aggregation mode: (window, combine, separate)
 	WindowAggregationMode window_mode = WindowAggregationMode::WINDOW;
 	//! Whether or not preserving insertion order should be preserved
 	bool preserve_insertion_order = true;
+	//! Whether or not to prefetch all metadata blocks when attaching a database file
+	bool prefetch_all_metadata = false;
 	//! Whether Arrow Arrays use Large or Regular buffers
 	ArrowOffsetSize arrow_offset_size = ArrowOffsetSize::REGULAR;
 	//! Whether LISTs should produce Arrow ListViews
@@ -232,6 +258,10 @@ struct DBConfigOptions {
 	idx_t allocator_flush_threshold = 134217728;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Whether to request huge-page (2MB) backing for large allocations (best effort, Linux-only)
+	bool allocator_huge_pages = false;
+	//! Whether the task scheduler uses NUMA-aware per-node task queues and worker pinning
+	bool numa_task_scheduling = false;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
@@ -242,6 +272,18 @@ struct DBConfigOptions {
 	idx_t default_block_alloc_size = DUCKDB_BLOCK_ALLOC_SIZE;
 	//!  Whether or not to abort if a serialization exception is thrown during WAL playback (when reading truncated WAL)
 	bool abort_on_wal_failure = false;
+	//! Whether to replay the WAL in parallel, partitioning data-level entries by table over the worker threads
+	bool wal_parallel_replay = false;
+	//! Whether concurrently committing transactions combine their WAL flushes into a single disk sync (group commit)
+	bool wal_group_commit = false;
+	//! Whether new WAL files compress large entries, trading CPU for less WAL volume
+	bool wal_compression = false;
+	//! Whether to automatically vacuum the database after transactions that delete many rows
+	bool automatic_vacuum = false;
+	//! Whether to automatically rebuild the distinct statistics of tables after many deletes or updates
+	bool automatic_statistics_refresh = false;
+	//! Whether to persist the set of buffer-pool-resident blocks on shutdown and pre-load them on startup
+	bool warm_restart = false;
 	//! The index_scan_percentage sets a threshold for index scans.
 	//! If fewer than MAX(index_scan_max_count, index_scan_percentage * total_row_count)
 	// rows match, we perform an index scan instead of a table scan.
@@ -265,6 +307,8 @@ public:
 	DUCKDB_API ~DBConfig();
 
 	mutex config_lock;
+	//! Incremented whenever a configuration option is changed, used to invalidate cached plans
+	atomic<idx_t> config_version {0};
 	//! Replacement table scans are automatically attempted when a table name cannot be found in the schema
 	vector<ReplacementScan> replacement_scans;
 
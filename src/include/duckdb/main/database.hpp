@@ -25,6 +25,8 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class QueryResultCache;
+class SamplingProfiler;
 struct AttachInfo;
 struct AttachOptions;
 class DatabaseFileSystem;
@@ -53,6 +55,8 @@ public:
 	DUCKDB_API FileSystem &GetFileSystem();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API QueryResultCache &GetResultCache();
+	DUCKDB_API SamplingProfiler &GetSamplingProfiler();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const string &extension_name, ExtensionInstallInfo &install_info);
@@ -83,6 +87,8 @@ private:
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<QueryResultCache> result_cache;
+	unique_ptr<SamplingProfiler> sampling_profiler;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_map<string, ExtensionInfo> loaded_extensions_info;
 	ValidChecker db_validity;
@@ -80,6 +80,15 @@ public:
 	idx_t ModifyCatalog() {
 		return catalog_version++;
 	}
+	idx_t GetCatalogVersion() {
+		return catalog_version;
+	}
+	idx_t ModifyData() {
+		return data_version++;
+	}
+	idx_t GetDataVersion() {
+		return data_version;
+	}
 	bool HasDefaultDatabase() {
 		return !default_database.empty();
 	}
@@ -96,6 +105,8 @@ private:
 	unique_ptr<CatalogSet> databases;
 	//! The global catalog version, incremented whenever anything changes in the catalog
 	atomic<idx_t> catalog_version;
+	//! The global data version, incremented whenever the data of any attached table changes
+	atomic<idx_t> data_version;
 	//! The current query number
 	atomic<transaction_t> current_query_number;
 	//! The current default database
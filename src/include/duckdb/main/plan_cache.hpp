@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/shared_ptr.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class PreparedStatementData;
+class SQLStatement;
+
+//! The plan cache reuses fully prepared plans for repeated unparameterized statements, skipping the parsing, binding,
+//! optimization and physical planning phases on every call after the first. It is opt-in through the enable_plan_cache
+//! setting and local to a client, so it is always accessed while holding the ClientContext lock. Entries are validated
+//! with the same rebind checks that prepared statements use, plus a configuration version stamp, so catalog changes
+//! and settings changes cause the statement to be planned from scratch again.
+class PlanCache {
+public:
+	//! Whether the plan cache may be consulted for this statement at all
+	static bool CanCacheStatement(ClientContext &context, SQLStatement &statement);
+	//! Whether a prepared plan may be stored in the cache
+	static bool CanCachePlan(PreparedStatementData &plan);
+
+	//! Look up a cached plan; returns nullptr if there is no valid entry for the key
+	shared_ptr<PreparedStatementData> Lookup(ClientContext &context, const string &key);
+	//! Try to store a prepared plan; the configuration version was captured before planning began and the entry is
+	//! only stored if it is still current
+	void Store(ClientContext &context, const string &key, idx_t config_version, shared_ptr<PreparedStatementData> plan);
+	//! Remove all entries from the cache
+	void Clear();
+
+private:
+	struct CacheEntry {
+		//! The cached plan
+		shared_ptr<PreparedStatementData> plan;
+		//! The configuration version the plan was created under
+		idx_t config_version;
+	};
+
+	//! The maximum number of cached plans
+	static constexpr idx_t MAX_CACHED_PLANS = 256;
+
+	//! The cached plans, keyed by statement text
+	unordered_map<string, CacheEntry> entries;
+};
+
+} // namespace duckdb
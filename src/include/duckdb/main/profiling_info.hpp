@@ -18,7 +18,17 @@
 
 namespace duckdb {
 
-enum class MetricsType : uint8_t { CPU_TIME, EXTRA_INFO, OPERATOR_CARDINALITY, OPERATOR_TIMING };
+enum class MetricsType : uint8_t {
+	CPU_TIME,
+	EXTRA_INFO,
+	OPERATOR_CARDINALITY,
+	OPERATOR_TIMING,
+	OPERATOR_INSTRUCTIONS,
+	OPERATOR_LLC_MISSES,
+	OPERATOR_BRANCH_MISSES,
+	OPERATOR_IO_WAIT,
+	OPERATOR_BUFFER_WAIT
+};
 
 struct MetricsTypeHashFunction {
 	uint64_t operator()(const MetricsType &index) const {
@@ -38,6 +48,17 @@ struct SettingSetFunctions {
 		}
 		return false;
 	}
+
+	static bool HardwareCountersEnabled(const profiler_settings_t &settings) {
+		return Enabled(settings, MetricsType::OPERATOR_INSTRUCTIONS) ||
+		       Enabled(settings, MetricsType::OPERATOR_LLC_MISSES) ||
+		       Enabled(settings, MetricsType::OPERATOR_BRANCH_MISSES);
+	}
+
+	static bool WaitTimesEnabled(const profiler_settings_t &settings) {
+		return Enabled(settings, MetricsType::OPERATOR_IO_WAIT) ||
+		       Enabled(settings, MetricsType::OPERATOR_BUFFER_WAIT);
+	}
 };
 
 struct Metrics {
@@ -45,8 +66,15 @@ struct Metrics {
 	string extra_info;
 	idx_t operator_cardinality;
 	double operator_timing;
+	idx_t operator_instructions;
+	idx_t operator_llc_misses;
+	idx_t operator_branch_misses;
+	double operator_io_wait;
+	double operator_buffer_wait;
 
-	Metrics() : cpu_time(0), operator_cardinality(0), operator_timing(0) {
+	Metrics()
+	    : cpu_time(0), operator_cardinality(0), operator_timing(0), operator_instructions(0), operator_llc_misses(0),
+	      operator_branch_misses(0), operator_io_wait(0), operator_buffer_wait(0) {
 	}
 };
 
@@ -11,10 +11,12 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/deque.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread_wait_times.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/winapi.hpp"
@@ -22,6 +24,7 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/profiling_info.hpp"
 #include "duckdb/main/profiling_node.hpp"
+#include "duckdb/main/sampling_profiler.hpp"
 
 #include <stack>
 
@@ -38,6 +41,9 @@ struct OperatorInformation {
 	double time;
 	idx_t elements;
 	string name;
+	HardwareCounters hardware_counters;
+	double io_wait = 0;
+	double buffer_wait = 0;
 
 	void AddTime(double n_time) {
 		this->time += n_time;
@@ -46,6 +52,17 @@ struct OperatorInformation {
 	void AddElements(idx_t n_elements) {
 		this->elements += n_elements;
 	}
+
+	void AddHardwareCounters(const HardwareCounters &n_counters) {
+		hardware_counters.instructions += n_counters.instructions;
+		hardware_counters.llc_misses += n_counters.llc_misses;
+		hardware_counters.branch_misses += n_counters.branch_misses;
+	}
+
+	void AddWaitTimes(double n_io_wait, double n_buffer_wait) {
+		io_wait += n_io_wait;
+		buffer_wait += n_buffer_wait;
+	}
 };
 
 //! The OperatorProfiler measures timings of individual operators
@@ -77,10 +94,19 @@ private:
 	profiler_settings_t settings;
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
+	//! Measures the hardware counters of the individual Physical Operators - only allocated when any of the
+	//! hardware counter metrics are enabled and the platform supports them
+	unique_ptr<HardwareCounterProfiler> hardware_counters;
+	//! Whether or not the wait time metrics are being gathered
+	bool wait_times_enabled = false;
+	//! The thread-local wait times at the start of the current operator
+	ThreadWaitTimes wait_times_baseline;
 	//! The stack of Physical Operators that are currently active
 	optional_ptr<const PhysicalOperator> active_operator;
 	//! A mapping of physical operators to recorded timings
 	reference_map_t<const PhysicalOperator, OperatorInformation> timings;
+	//! The slot into which the current operator is published for the sampling profiler
+	shared_ptr<SamplingProfilerSlot> sample_slot;
 };
 
 //! The QueryProfiler can be used to measure timings of queries
@@ -156,6 +182,8 @@ private:
 
 	//! The root of the query tree
 	unique_ptr<ProfilingNode> root;
+	//! The root of the physical plan that is being profiled, only valid while the query is running
+	optional_ptr<const PhysicalOperator> query_root;
 
 	//! The query string
 	string query;
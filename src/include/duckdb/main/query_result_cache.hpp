@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class MaterializedQueryResult;
+class QueryResult;
+class SQLStatement;
+struct DataTableInfo;
+
+//! The tables read by a query plan, gathered while preparing the statement
+struct QueryCachePlanInfo {
+	//! Whether the plan is cacheable: it only reads non-temporary base tables and contains no volatile functions
+	bool cacheable = true;
+	//! The tables the plan reads from
+	vector<weak_ptr<DataTableInfo>> tables;
+};
+
+//! The query result cache serves repeated queries from previously materialized results, as long as the data of the
+//! tables they read has not changed. It is opt-in through the enable_result_cache setting. Cached entries are keyed
+//! by the session search path and the statement text, and validated against the data version of every referenced
+//! table and the global catalog version, so any write to a referenced table, any DDL and any settings change
+//! invalidates them. Queries over temporary tables are never cached, since those are session-local while the cache
+//! is shared by all sessions.
+class QueryResultCache {
+public:
+	//! Whether the result cache may be consulted for this statement at all
+	static bool CanCacheStatement(ClientContext &context, SQLStatement &statement);
+	//! Compute the cache key of a statement: the session search path plus the statement text
+	static string MakeKey(ClientContext &context, SQLStatement &statement);
+	//! Gather the tables a logical plan reads and determine whether its result can be cached
+	static unique_ptr<QueryCachePlanInfo> AnalyzePlan(LogicalOperator &plan);
+
+	//! Look up a cached result; returns nullptr if there is no valid entry for the key
+	unique_ptr<QueryResult> Lookup(ClientContext &context, const string &key);
+	//! Try to store a materialized result; the catalog and data versions were captured before the query began
+	//! executing and the entry is only stored if they are still current
+	void Store(ClientContext &context, const string &key, unique_ptr<QueryCachePlanInfo> plan_info,
+	           idx_t catalog_version, idx_t data_version, MaterializedQueryResult &result);
+	//! Remove all entries from the cache
+	void Clear();
+
+private:
+	//! The version stamp of a table referenced by a cached entry
+	struct CacheTableVersion {
+		weak_ptr<DataTableInfo> table_info;
+		idx_t data_version;
+	};
+	struct CacheEntry {
+		//! The global catalog version when the entry was stored
+		idx_t catalog_version;
+		//! The version stamps of all tables the query reads
+		vector<CacheTableVersion> table_versions;
+		//! The statement properties of the cached result
+		StatementProperties properties;
+		//! The column names of the cached result
+		vector<string> names;
+		//! The cached result data
+		unique_ptr<ColumnDataCollection> collection;
+	};
+
+	//! The maximum number of cached results
+	static constexpr idx_t MAX_CACHED_RESULTS = 64;
+	//! The maximum size (in bytes) of a single cached result
+	static constexpr idx_t MAX_CACHED_RESULT_SIZE = 16777216;
+
+	mutex lock;
+	unordered_map<string, CacheEntry> entries;
+};
+
+} // namespace duckdb
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/sampling_profiler.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/physical_operator_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+
+//! A single sample taken by the sampling profiler
+struct ProfilingSample {
+	//! The time at which the sample was taken
+	timestamp_t time;
+	//! The id of the worker thread that was sampled
+	idx_t thread_id;
+	//! The operator the worker thread was executing when the sample was taken
+	PhysicalOperatorType operator_type;
+};
+
+//! The per-thread slot into which a worker thread publishes the operator it is currently executing.
+//! Publishing is a single relaxed atomic store so that the worker threads pay no measurement cost.
+class SamplingProfilerSlot {
+public:
+	explicit SamplingProfilerSlot(idx_t thread_id_p)
+	    : thread_id(thread_id_p), active_operator_type(PhysicalOperatorType::INVALID) {
+	}
+
+	void SetActiveOperator(PhysicalOperatorType type) {
+		active_operator_type.store(type, std::memory_order_relaxed);
+	}
+
+private:
+	friend class SamplingProfiler;
+
+	//! The id assigned to the worker thread that owns this slot
+	idx_t thread_id;
+	//! The operator the owning thread is currently executing - INVALID when the thread is idle
+	atomic<PhysicalOperatorType> active_operator_type;
+};
+
+//! The SamplingProfiler periodically samples the active operator of every worker thread from a background
+//! thread into a fixed-size ring buffer. Unlike the QueryProfiler it is always on - the only per-operator
+//! cost on the worker threads is publishing the current operator into their slot.
+class SamplingProfiler {
+public:
+	//! The interval between samples (~100Hz)
+	static constexpr idx_t SAMPLE_INTERVAL_MS = 10;
+	//! The capacity of the sample ring buffer - when full, the oldest samples are overwritten
+	static constexpr idx_t SAMPLE_BUFFER_CAPACITY = 1 << 14;
+
+	SamplingProfiler();
+	~SamplingProfiler();
+
+	DUCKDB_API static SamplingProfiler &Get(ClientContext &context);
+	DUCKDB_API static SamplingProfiler &Get(DatabaseInstance &db);
+
+	//! Register a worker thread with the profiler - the thread is sampled for as long as the slot is alive
+	shared_ptr<SamplingProfilerSlot> RegisterThread();
+	//! Returns a copy of the samples currently held in the ring buffer, ordered from oldest to newest
+	vector<ProfilingSample> GetSamples();
+
+private:
+	//! The main loop of the sampling thread
+	void SamplingLoop();
+	//! Take a single sample of all registered threads (lock must be held)
+	void CollectSample();
+
+	//! The lock protecting the slots, the ring buffer and the shutdown flag
+	mutex lock;
+	//! Signals the sampling thread on shutdown
+	std::condition_variable sampling_cv;
+	//! The slots of the registered worker threads
+	vector<weak_ptr<SamplingProfilerSlot>> slots;
+	//! The sample ring buffer
+	vector<ProfilingSample> samples;
+	//! The position in the ring buffer at which the next sample is written
+	idx_t sample_offset = 0;
+	//! The id to assign to the next registered thread
+	idx_t next_thread_id = 0;
+	//! Whether or not the profiler is shutting down
+	bool shutdown = false;
+	//! The background thread that takes the samples - lazily started on the first registration
+	unique_ptr<thread> sampling_thread;
+};
+
+} // namespace duckdb
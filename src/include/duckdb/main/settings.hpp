@@ -72,6 +72,17 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CheckpointCompressionReuseSetting {
+	static constexpr const char *Name = "checkpoint_compression_reuse";
+	static constexpr const char *Description =
+	    "Reuse each column's previous compression method when checkpointing update-only changes, instead of "
+	    "re-analyzing all compression methods";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -195,6 +206,17 @@ struct DisabledOptimizersSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableCardinalityFeedbackSetting {
+	static constexpr const char *Name = "enable_cardinality_feedback";
+	static constexpr const char *Description =
+	    "Record join cardinalities observed during execution and reuse them in the join order optimizer when "
+	    "planning subsequent queries over the same tables (requires profiling to record cardinalities)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableExternalAccessSetting {
 	static constexpr const char *Name = "enable_external_access";
 	static constexpr const char *Description =
@@ -338,6 +360,37 @@ struct EnableHTTPMetadataCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnablePlanCacheSetting {
+	static constexpr const char *Name = "enable_plan_cache";
+	static constexpr const char *Description =
+	    "Whether or not prepared plans of repeated unparameterized statements are cached and reused";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableResultCacheSetting {
+	static constexpr const char *Name = "enable_result_cache";
+	static constexpr const char *Description =
+	    "Whether or not query results are cached and served again while the underlying tables are unchanged";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableSelectivitySamplingSetting {
+	static constexpr const char *Name = "enable_selectivity_sampling";
+	static constexpr const char *Description =
+	    "Measure the selectivity of pushed-down filters against a cached sample of each table during join order "
+	    "optimization instead of deriving it from column statistics";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableProfilingSetting {
 	static constexpr const char *Name = "enable_profiling";
 	static constexpr const char *Description =
@@ -509,6 +562,17 @@ struct MaximumExpressionDepthSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CompressedBufferTierSizeSetting {
+	static constexpr const char *Name = "compressed_buffer_tier_size";
+	static constexpr const char *Description =
+	    "The maximum amount of memory used to keep evicted buffers compressed in memory instead of writing them to "
+	    "the temporary directory (e.g. 1GB). Defaults to 0 (disabled)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumMemorySetting {
 	static constexpr const char *Name = "max_memory";
 	static constexpr const char *Description = "The maximum memory of the system (e.g. 1GB)";
@@ -538,6 +602,17 @@ struct MaximumTempDirectorySize {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BulkUpdateThreshold {
+	static constexpr const char *Name = "bulk_update_threshold";
+	static constexpr const char *Description =
+	    "The minimum number of estimated rows at which an UPDATE rewrites the affected rows instead of updating them "
+	    "in-place";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MergeJoinThreshold {
 	static constexpr const char *Name = "merge_join_threshold";
 	static constexpr const char *Description = "The number of rows we need on either table to choose a merge join";
@@ -676,6 +751,17 @@ struct PreserveInsertionOrder {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PrefetchAllMetadataSetting {
+	static constexpr const char *Name = "prefetch_all_metadata";
+	static constexpr const char *Description =
+	    "Whether or not to prefetch all metadata blocks with coalesced reads when attaching a database file, instead "
+	    "of reading metadata block-by-block on first reference";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ArrowOutputListView {
 	static constexpr const char *Name = "arrow_output_list_view";
 	static constexpr const char *Description =
@@ -696,6 +782,16 @@ struct ProduceArrowStringView {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct PrioritySetting {
+	static constexpr const char *Name = "priority";
+	static constexpr const char *Description =
+	    "The scheduling priority class of queries issued by this connection (LOW, NORMAL or HIGH)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ProfileOutputSetting {
 	static constexpr const char *Name = "profile_output";
 	static constexpr const char *Description =
@@ -725,6 +821,28 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ScanPrefetchDepthSetting {
+	static constexpr const char *Name = "scan_prefetch_depth";
+	static constexpr const char *Description =
+	    "The number of vectors table scans read ahead of the current scan position in the background (0 = only "
+	    "prefetch for remote file systems)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ScanResistantEvictionSetting {
+	static constexpr const char *Name = "scan_resistant_eviction";
+	static constexpr const char *Description =
+	    "Whether the buffer pool grants frequently used blocks a second chance before unloading them, so that large "
+	    "scans cannot flush the hot set";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -763,6 +881,17 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether blocks written to the temporary directory are compressed. Blocks that do not compress well are "
+	    "written uncompressed. Defaults to false";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -800,6 +929,89 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AllocatorHugePagesSetting {
+	static constexpr const char *Name = "allocator_huge_pages";
+	static constexpr const char *Description =
+	    "Whether to request huge-page backing for large allocations (best effort, Linux-only).";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WalParallelReplaySetting {
+	static constexpr const char *Name = "wal_parallel_replay";
+	static constexpr const char *Description =
+	    "Whether to replay the write-ahead log in parallel, replaying independent tables on the worker threads.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WalGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Whether concurrently committing transactions combine their write-ahead log flushes into a single disk sync.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WalCompressionSetting {
+	static constexpr const char *Name = "wal_compression";
+	static constexpr const char *Description =
+	    "Whether new write-ahead log files compress large entries, trading CPU for less WAL volume.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct AutomaticVacuumSetting {
+	static constexpr const char *Name = "automatic_vacuum";
+	static constexpr const char *Description =
+	    "Whether to automatically compact the database by merging underfull row groups and purging deleted rows "
+	    "after transactions that delete many rows.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct AutomaticStatisticsRefreshSetting {
+	static constexpr const char *Name = "automatic_statistics_refresh";
+	static constexpr const char *Description =
+	    "Whether to automatically rebuild the distinct statistics of a table once a significant fraction of its rows "
+	    "have been deleted or updated since the statistics were last rebuilt.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WarmRestartSetting {
+	static constexpr const char *Name = "warm_restart";
+	static constexpr const char *Description =
+	    "Whether to persist the set of buffer-pool-resident blocks of a database on shutdown and pre-load those "
+	    "blocks again when the database is next loaded.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct NumaTaskSchedulingSetting {
+	static constexpr const char *Name = "numa_task_scheduling";
+	static constexpr const char *Description =
+	    "Whether to use NUMA-aware task scheduling with per-node task queues and worker thread pinning.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/count_star_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class LogicalOperator;
+class Optimizer;
+
+//! Answers an ungrouped COUNT(*) over a bare table scan purely from the row version metadata of the table,
+//! instead of scanning the table
+class CountStarOptimizer {
+public:
+	explicit CountStarOptimizer(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! Whether we can perform the optimization on this operator
+	bool CanOptimize(LogicalOperator &op);
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
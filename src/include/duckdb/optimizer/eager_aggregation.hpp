@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/eager_aggregation.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+
+class BoundColumnRefExpression;
+class LogicalAggregate;
+class Optimizer;
+
+//! The EagerAggregation optimizer pushes a partial aggregation below an inner join when the join keys of one side are
+//! covered by the grouping keys of that side. The partial aggregation shrinks the join input, and a merge aggregation
+//! on top of the join combines the partial states. This is beneficial whenever the grouped side has many rows per group
+class EagerAggregation : public LogicalOperatorVisitor {
+public:
+	explicit EagerAggregation(Optimizer &optimizer) : optimizer(optimizer) {
+	}
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	unique_ptr<LogicalOperator> TryPushAggregate(unique_ptr<LogicalOperator> op);
+
+protected:
+	unique_ptr<Expression> VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) override;
+
+private:
+	Optimizer &optimizer;
+	//! The map of column references, used to remap bindings when a cast projection is added on top of an aggregate
+	column_binding_map_t<vector<reference<BoundColumnRefExpression>>> column_references;
+};
+
+} // namespace duckdb
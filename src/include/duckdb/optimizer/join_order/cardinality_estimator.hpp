@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/optimizer/join_order/query_graph.hpp"
 
@@ -14,6 +15,7 @@
 
 namespace duckdb {
 
+class ClientContext;
 class FilterInfo;
 
 struct DenomInfo {
@@ -88,13 +90,20 @@ public:
 class CardinalityEstimator {
 public:
 	static constexpr double DEFAULT_SEMI_ANTI_SELECTIVITY = 5;
-	explicit CardinalityEstimator() {};
+	explicit CardinalityEstimator(ClientContext &context) : context(context) {};
 
 private:
+	ClientContext &context;
 	vector<RelationsToTDom> relations_to_tdoms;
 	unordered_map<string, CardinalityHelper> relation_set_2_cardinality;
 	JoinRelationSetManager set_manager;
 	vector<RelationStats> relation_stats;
+	//! The qualified base table name of each single relation that is an unfiltered base table scan, used to look up
+	//! cardinalities observed in previous executions
+	unordered_map<idx_t, string> relation_table_names;
+	//! Relations that have a single-relation filter applied to them - the observed cardinality of a previous
+	//! execution does not account for the filter, so feedback cannot be used for joins over these relations
+	unordered_set<idx_t> filtered_relations;
 
 public:
 	void RemoveEmptyTotalDomains();
@@ -115,6 +124,8 @@ public:
 private:
 	double GetNumerator(JoinRelationSet &set);
 	DenomInfo GetDenominator(JoinRelationSet &set);
+	//! Look up the cardinality observed for this relation set during previous executions, if feedback is enabled
+	optional_idx GetFeedbackCardinality(JoinRelationSet &new_set);
 
 	bool SingleColumnFilter(FilterInfo &filter_info);
 	vector<idx_t> DetermineMatchingEquivalentSets(optional_ptr<FilterInfo> filter_info);
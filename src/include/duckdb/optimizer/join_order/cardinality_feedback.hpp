@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/main/query_profiler.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class PhysicalOperator;
+
+//! The CardinalityFeedback cache holds join cardinalities that were observed while executing queries, keyed by the
+//! set of catalog-qualified base tables that were joined. Only joins over unfiltered base table scans are recorded
+//! and looked up, since a filter anywhere in the fragment would make the observed cardinality incomparable between
+//! queries. The join order optimizer consults the cache on subsequent planning of queries over the same tables,
+//! replacing the estimate with the observed value. Entries are refreshed on every execution, so recurring queries
+//! converge to plans based on actual instead of estimated cardinalities.
+class CardinalityFeedback : public ObjectCacheEntry {
+public:
+	//! The maximum amount of observed cardinalities we hold on to
+	static constexpr idx_t MAXIMUM_FEEDBACK_ENTRIES = 16384;
+
+public:
+	//! Get the cardinality feedback cache of the database
+	static CardinalityFeedback &Get(ClientContext &context);
+
+	//! Record the observed cardinalities of all joins in an executed plan
+	void RecordQuery(const PhysicalOperator &root, const QueryProfiler::TreeMap &tree_map);
+	//! Look up the observed cardinality of a join over the given base tables, if any was recorded
+	optional_idx GetObservedCardinality(const vector<string> &table_names);
+
+	static string ObjectType() {
+		return "cardinality_feedback";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	void RecordJoins(const PhysicalOperator &op, const QueryProfiler::TreeMap &tree_map);
+	//! Collect the qualified names of the base tables below the given operator
+	//! Returns false if the subtree contains anything other than unfiltered table scans, projections and joins
+	static bool CollectBaseTables(const PhysicalOperator &op, vector<string> &table_names);
+	//! Whether the plan contains an operator that can stop the query before all rows are produced, in which case
+	//! the observed cardinalities are partial and must not be recorded
+	static bool PlanTerminatesEarly(const PhysicalOperator &op);
+	static string MakeKey(vector<string> table_names);
+
+private:
+	mutex lock;
+	//! Mapping of joined base tables -> observed join cardinality
+	unordered_map<string, idx_t> observed_cardinalities;
+};
+
+} // namespace duckdb
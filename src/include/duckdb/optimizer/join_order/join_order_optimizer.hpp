@@ -25,7 +25,8 @@ namespace duckdb {
 
 class JoinOrderOptimizer {
 public:
-	explicit JoinOrderOptimizer(ClientContext &context) : context(context), query_graph_manager(context) {
+	explicit JoinOrderOptimizer(ClientContext &context)
+	    : context(context), query_graph_manager(context), cardinality_estimator(context) {
 	}
 
 	//! Perform join reordering inside a plan
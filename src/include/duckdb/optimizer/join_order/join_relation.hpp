@@ -9,32 +9,38 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
 //! Set of relations, used in the join graph.
+//! The set and its relation array live in the arena of the JoinRelationSetManager that created it
 struct JoinRelationSet {
-	JoinRelationSet(unsafe_unique_array<idx_t> relations, idx_t count) : relations(std::move(relations)), count(count) {
+	JoinRelationSet(const idx_t *relations, idx_t count) : relations(relations), count(count) {
 	}
 
 	string ToString() const;
 
-	unsafe_unique_array<idx_t> relations;
+	const idx_t *relations;
 	idx_t count;
 
 	static bool IsSubset(JoinRelationSet &super, JoinRelationSet &sub);
 };
 
 //! The JoinRelationTree is a structure holding all the created JoinRelationSet objects and allowing fast lookup on to
-//! them
+//! them. The sets are allocated from an arena that is torn down wholesale when the manager is destroyed
 class JoinRelationSetManager {
 public:
+	JoinRelationSetManager() : arena(Allocator::DefaultAllocator()) {
+	}
+
 	//! Contains a node with a JoinRelationSet and child relations
 	// FIXME: this structure is inefficient, could use a bitmap for lookup instead (todo: profile)
 	struct JoinRelationTreeNode {
-		unique_ptr<JoinRelationSet> relation;
+		optional_ptr<JoinRelationSet> relation;
 		unordered_map<idx_t, unique_ptr<JoinRelationTreeNode>> children;
 	};
 
@@ -44,7 +50,7 @@ public:
 	//! Create or get a JoinRelationSet from a set of relation bindings
 	JoinRelationSet &GetJoinRelation(const unordered_set<idx_t> &bindings);
 	//! Create or get a JoinRelationSet from a (sorted, duplicate-free!) list of relations
-	JoinRelationSet &GetJoinRelation(unsafe_unique_array<idx_t> relations, idx_t count);
+	JoinRelationSet &GetJoinRelation(const idx_t *relations, idx_t count);
 	//! Union two sets of relations together and create a new relation set
 	JoinRelationSet &Union(JoinRelationSet &left, JoinRelationSet &right);
 	// //! Create the set difference of left \ right (i.e. all elements in left that are not in right)
@@ -54,6 +60,10 @@ public:
 
 private:
 	JoinRelationTreeNode root;
+	//! The arena that the JoinRelationSet objects and their relation arrays are allocated from
+	ArenaAllocator arena;
+	//! Scratch space for building sorted relation lists without allocating
+	unsafe_vector<idx_t> scratch;
 };
 
 } // namespace duckdb
@@ -35,6 +35,10 @@ struct RelationStats {
 	// for debug, column names and tables
 	vector<string> column_names;
 	string table_name;
+	//! The catalog-qualified name of the scanned base table - only set for base table scans without any pushed-down
+	//! filters, so the observed cardinality of joins over the relation is comparable across queries (used to look up
+	//! cardinality feedback)
+	string qualified_table_name;
 
 	RelationStats() : cardinality(1), filter_strength(1), stats_initialized(false) {
 	}
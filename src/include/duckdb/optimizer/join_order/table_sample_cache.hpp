@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/table_sample_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+class LogicalGet;
+
+//! The TableSampleCache holds a reservoir sample per base table that the join order optimizer evaluates pushed-down
+//! filters against, measuring their actual selectivity instead of deriving it from per-column statistics and
+//! independence assumptions (which collapse on correlated columns). Samples are stamped with the data version of
+//! their table and rebuilt lazily once the table has been written to. It is opt-in through the
+//! enable_selectivity_sampling setting.
+class TableSampleCache : public ObjectCacheEntry {
+public:
+	//! The number of rows we keep in the reservoir sample of a table
+	static constexpr idx_t SAMPLE_SIZE = 2048;
+
+public:
+	//! Get the table sample cache of the database
+	static TableSampleCache &Get(ClientContext &context);
+
+	//! Estimate the cardinality of a table scan after applying its pushed-down filters by evaluating them against
+	//! a sample of the table; returns an invalid index if the scan cannot be sampled
+	optional_idx EstimateFilteredCardinality(ClientContext &context, LogicalGet &get, idx_t base_cardinality);
+
+	static string ObjectType() {
+		return "table_sample_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct TableSample {
+		//! Protects drawing and replacing the sample of this table, so concurrent planners only serialize when
+		//! they sample the same table
+		mutex sample_lock;
+		//! The data version of the table when the sample was drawn
+		idx_t data_version = DConstants::INVALID_INDEX;
+		//! The sampled rows, covering all physical columns of the table
+		shared_ptr<ColumnDataCollection> rows;
+	};
+
+	//! Get the sample of the table, drawing a fresh one if there is none for the current version of the table
+	shared_ptr<ColumnDataCollection> GetTableSample(ClientContext &context, DuckTableEntry &table);
+
+private:
+	//! Protects the sample map itself - never held while a sample is being drawn
+	mutex lock;
+	//! Mapping of qualified table name -> sample
+	unordered_map<string, unique_ptr<TableSample>> samples;
+};
+
+} // namespace duckdb
@@ -14,12 +14,24 @@ namespace duckdb {
 class LogicalOperator;
 class Optimizer;
 
+class LogicalTopN;
+
 class TopN {
 public:
+	explicit TopN(Optimizer &optimizer);
+
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+private:
+	//! Try to rewrite a Top-N directly over a table scan so that only the sort keys and the row id are sorted,
+	//! and the payload columns of the surviving rows are fetched by joining back on the row id afterwards
+	unique_ptr<LogicalOperator> TryLateMaterialization(unique_ptr<LogicalTopN> topn);
+
+private:
+	Optimizer &optimizer;
 };
 
 } // namespace duckdb
@@ -69,6 +69,8 @@ private:
 	//! The total execution context of this executor
 	ExecutionContext context;
 
+	//! The capacity of the chunks that flow through this pipeline (at most STANDARD_VECTOR_SIZE)
+	idx_t chunk_capacity;
 	//! Intermediate chunks for the operators
 	vector<unique_ptr<DataChunk>> intermediate_chunks;
 	//! Intermediate states for the operators
@@ -117,11 +119,17 @@ private:
 	void StartOperator(PhysicalOperator &op);
 	void EndOperator(PhysicalOperator &op, optional_ptr<DataChunk> chunk);
 
+	//! Computes the capacity of the chunks that flow through this pipeline: for tiny index point look-ups we narrow
+	//! the chunks instead of dragging STANDARD_VECTOR_SIZE-wide buffers through every operator
+	idx_t ComputeChunkCapacity();
+
 	//! Reset the operator index to the first operator
 	void GoToSource(idx_t &current_idx, idx_t initial_idx);
 	SourceResultType FetchFromSource(DataChunk &result);
 
 	void FinishProcessing(int32_t operator_idx = -1);
+	//! Whether any operator in the pipeline signals that it will never need more input
+	bool AnyOperatorFinished();
 	bool IsFinished();
 
 	//! Wrappers for sink/source calls to respective operators
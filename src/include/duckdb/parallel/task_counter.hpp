@@ -31,8 +31,10 @@ public:
 		while (tasks_completed < task_count) {
 			shared_ptr<Task> task;
 			if (scheduler.GetTaskFromProducer(*token, task)) {
-				task->Execute();
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
 				task.reset();
+			} else {
+				TaskScheduler::YieldThread();
 			}
 		}
 	}
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
@@ -25,11 +26,13 @@ class TaskScheduler;
 struct SchedulerThread;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, QueryPriority priority);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
+	//! The priority class that tasks of this producer are scheduled in
+	QueryPriority priority;
 	mutex producer_lock;
 };
 
@@ -45,7 +48,7 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	unique_ptr<ProducerToken> CreateProducer(QueryPriority priority = QueryPriority::NORMAL);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -78,6 +81,13 @@ public:
 	void SetAllocatorFlushTreshold(idx_t threshold);
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
+	//! Enables or disables NUMA-aware scheduling (per-node task queues and worker thread pinning).
+	//! Relaunches the worker threads if the mode changed.
+	void SetNumaAware(bool enable);
+	//! Whether NUMA-aware scheduling is enabled
+	bool IsNumaAware() const {
+		return numa_aware;
+	}
 
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
@@ -100,6 +110,10 @@ private:
 	atomic<idx_t> allocator_flush_threshold;
 	//! Whether allocator background threads are enabled
 	atomic<bool> allocator_background_threads;
+	//! Whether NUMA-aware scheduling is enabled (set by the 'numa_task_scheduling' setting)
+	atomic<bool> numa_aware;
+	//! Round-robin counter used to assign worker threads to NUMA nodes
+	atomic<idx_t> numa_thread_counter;
 	//! Requested thread count (set by the 'threads' setting)
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
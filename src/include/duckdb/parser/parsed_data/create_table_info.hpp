@@ -32,6 +32,9 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! Whether the table is unlogged: changes to its data bypass the WAL, and after a crash the table reverts to its
+	//! state as of the last checkpoint
+	bool unlogged = false;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
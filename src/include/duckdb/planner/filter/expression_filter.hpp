@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/expression_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+class ExpressionExecutor;
+class SelectionVector;
+class Vector;
+
+//! ExpressionFilter holds an arbitrary boolean expression over a single column that is evaluated during the table
+//! scan itself, so that the remaining columns only need to fetch the rows that survive the filter. The expression
+//! references the filtered column through a BoundReferenceExpression with index 0. Since the expression is opaque,
+//! an ExpressionFilter cannot be used to prune segments based on zonemaps.
+class ExpressionFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::EXPRESSION_FILTER;
+
+public:
+	explicit ExpressionFilter(unique_ptr<Expression> expr);
+
+	//! The filter expression
+	unique_ptr<Expression> expr;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	//! Evaluate the expression over the rows of "vector" that "sel" selects, and shrink "sel" and
+	//! "approved_tuple_count" down to the rows for which the expression returned true
+	idx_t Select(Vector &vector, ExpressionExecutor &executor, SelectionVector &sel, idx_t &approved_tuple_count);
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -22,7 +22,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	EXPRESSION_FILTER = 6 // arbitrary boolean expression evaluated during the scan
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
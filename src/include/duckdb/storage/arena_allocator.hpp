@@ -41,6 +41,16 @@ public:
 	//! Increment the internal cursor (if required) so the next allocation is guaranteed to be aligned to 8 bytes
 	DUCKDB_API void AlignNext();
 
+	//! Construct an object of type T in the arena. The destructor of the object is never run - the memory is
+	//! released wholesale when the arena is reset or destroyed - so only trivially destructible types are allowed
+	template <class T, class... ARGS>
+	T &Make(ARGS &&... args) {
+		static_assert(std::is_trivially_destructible<T>::value,
+		              "Arena-allocated objects must be trivially destructible");
+		auto mem = AllocateAligned(sizeof(T));
+		return *(new (mem) T(std::forward<ARGS>(args)...));
+	}
+
 	//! Resets the current head and destroys all previous arena chunks
 	DUCKDB_API void Reset();
 	DUCKDB_API void Destroy();
@@ -86,6 +86,9 @@ public:
 
 	void UnregisterBlock(block_id_t block_id, bool can_destroy);
 
+	//! Returns the ids of the blocks of this block manager that are currently loaded in the buffer pool
+	vector<block_id_t> GetResidentBlockIds();
+
 	//! Returns a reference to the metadata manager of this block manager.
 	MetadataManager &GetMetadataManager();
 	//! Returns the block allocation size of this block manager.
@@ -24,6 +24,11 @@ class DatabaseInstance;
 
 enum class BlockState : uint8_t { BLOCK_UNLOADED = 0, BLOCK_LOADED = 1 };
 
+//! Retention hint that operators can set on blocks they know they will access again, e.g. the inner table of a
+//! nested-loop join that is re-scanned for every probe chunk. Hinted blocks are granted a second trip through
+//! their eviction queue before being unloaded; they remain evictable, so memory limits are unaffected.
+enum class BlockRetentionHint : uint8_t { DEFAULT = 0, WILL_REACCESS = 1 };
+
 struct BufferPoolReservation {
 	MemoryTag tag;
 	idx_t size {0};
@@ -98,6 +103,14 @@ public:
 		can_destroy = can_destroy_p;
 	}
 
+	inline BlockRetentionHint GetRetentionHint() const {
+		return retention_hint;
+	}
+
+	inline void SetRetentionHint(BlockRetentionHint hint) {
+		retention_hint = hint;
+	}
+
 	inline const idx_t &GetMemoryUsage() const {
 		return memory_usage;
 	}
@@ -129,6 +142,11 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! Whether the block already received a second chance in its eviction queue.
+	//! Set and cleared while holding the block-level lock (scan-resistant eviction)
+	bool eviction_second_chance;
+	//! Retention hint set by operators that know they will access the block again
+	atomic<BlockRetentionHint> retention_hint;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
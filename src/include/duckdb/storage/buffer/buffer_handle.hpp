@@ -14,6 +14,7 @@
 namespace duckdb {
 class BlockHandle;
 class FileBuffer;
+enum class BlockRetentionHint : uint8_t;
 
 class BufferHandle {
 public:
@@ -44,6 +45,8 @@ public:
 	DUCKDB_API FileBuffer &GetFileBuffer();
 	//! Destroys the buffer handle
 	DUCKDB_API void Destroy();
+	//! Sets a retention hint on the underlying block. Handle must be valid.
+	DUCKDB_API void SetRetentionHint(BlockRetentionHint hint);
 
 	const shared_ptr<BlockHandle> &GetBlockHandle() const {
 		return handle;
@@ -41,12 +41,14 @@ class BufferPool {
 	friend class StandardBufferManager;
 
 public:
-	explicit BufferPool(idx_t maximum_memory, bool track_eviction_timestamps);
+	explicit BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, bool scan_resistant_eviction);
 	virtual ~BufferPool();
 
 	//! Set a new memory limit to the buffer pool, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
 	void SetLimit(idx_t limit, const char *exception_postscript);
+	//! Enable or disable scan-resistant eviction
+	void SetScanResistantEviction(bool enable);
 
 	void UpdateUsedMemory(MemoryTag tag, int64_t size);
 
@@ -69,6 +71,9 @@ protected:
 		bool success;
 		TempBufferPoolReservation reservation;
 	};
+	//! A block must have been unpinned at least this many times to qualify for a second chance
+	static constexpr idx_t SECOND_CHANCE_MIN_UNPINS = 4;
+
 	virtual EvictionResult EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
 	                                   unique_ptr<FileBuffer> *buffer = nullptr);
 	virtual EvictionResult EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
@@ -137,6 +142,9 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
+	//! Grant frequently used blocks a second trip through their eviction queue before unloading them,
+	//! so that a single large scan cannot flush the hot set
+	atomic<bool> scan_resistant_eviction;
 	//! Eviction queues
 	vector<unique_ptr<EvictionQueue>> queues;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
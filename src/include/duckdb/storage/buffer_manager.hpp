@@ -41,6 +41,9 @@ public:
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	//! Prefetch a series of blocks. Note that this is a performance suggestion.
 	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles) = 0;
+	//! Prefetch a series of blocks without blocking the calling thread.
+	//! The default implementation performs the prefetch synchronously.
+	virtual void PrefetchAsync(vector<shared_ptr<BlockHandle>> handles);
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
 
 	//! Returns the currently allocated memory
@@ -11,6 +11,8 @@
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/storage/table/table_statistics.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -91,10 +93,31 @@ public:
 //! CheckpointWriter is responsible for checkpointing the database
 class SingleFileRowGroupWriter;
 class SingleFileTableDataWriter;
+class StorageLockKey;
+class TableDataWriter;
+
+//! Table data that was written ahead of the catalog serialization, while checkpointing tables in parallel
+struct PreparedTableData {
+	PreparedTableData();
+	//! Destructor must be defined out-of-line, as TableDataWriter is forward declared here
+	~PreparedTableData();
+
+	//! Checkpoint lock on the table, held until the checkpoint completes
+	unique_ptr<StorageLockKey> table_lock;
+	//! The metadata blocks written by the table's metadata writer
+	vector<MetaBlockPointer> table_metadata_pointers;
+	//! The metadata writer holding this table's row group pointers
+	unique_ptr<MetadataWriter> table_data_writer;
+	//! The table data writer that wrote the table data
+	unique_ptr<TableDataWriter> writer;
+	//! The table statistics as of the data write
+	TableStatistics global_stats;
+};
 
 class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileRowGroupWriter;
 	friend class SingleFileTableDataWriter;
+	friend class TableDataCheckpointTask;
 
 public:
 	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type);
@@ -115,9 +138,15 @@ public:
 public:
 	void WriteTable(TableCatalogEntry &table, Serializer &serializer) override;
 
+private:
+	//! Write the data of all tables in parallel using the task scheduler, ahead of the catalog serialization
+	void WriteTableDataInParallel(catalog_entry_vector_t &catalog_entries);
+
 private:
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
+	//! The metadata blocks written by the table data writer
+	vector<MetaBlockPointer> table_metadata_pointers;
 	//! The table data writer is responsible for writing the DataPointers used by the table chunks
 	unique_ptr<MetadataWriter> table_metadata_writer;
 	//! Because this is single-file storage, we can share partial blocks across
@@ -125,6 +154,8 @@ private:
 	PartialBlockManager partial_block_manager;
 	//! Checkpoint type
 	CheckpointType checkpoint_type;
+	//! Tables whose data was written ahead of the catalog serialization
+	reference_map_t<TableCatalogEntry, unique_ptr<PreparedTableData>> prepared_tables;
 };
 
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/bitpacking.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/unordered_map.hpp"
@@ -379,22 +380,26 @@ struct AlpDecompression {
 	                       uint64_t frame_of_reference, uint8_t bit_width) {
 		AlpEncodingIndices encoding_indices = {vector_exponent, vector_factor};
 
-		// Bit Unpacking
-		uint8_t for_decoded[AlpConstants::ALP_VECTOR_SIZE * 8] = {0};
-		if (bit_width > 0) {
+		if (bit_width == 0) {
+			// a bit width of zero means the whole vector is equal to the frame of reference
+			T value = alp::AlpCompression<T, true>::DecodeValue(static_cast<int64_t>(frame_of_reference),
+			                                                    encoding_indices);
+			std::fill(output, output + count, value);
+		} else {
+			// Bit Unpacking
+			uint8_t for_decoded[AlpConstants::ALP_VECTOR_SIZE * 8];
 			BitpackingPrimitives::UnPackBuffer<uint64_t>(for_decoded, for_encoded, count, bit_width);
-		}
-		auto *encoded_integers = reinterpret_cast<uint64_t *>(data_ptr_cast(for_decoded));
-
-		// unFOR
-		for (idx_t i = 0; i < count; i++) {
-			encoded_integers[i] += frame_of_reference;
-		}
-
-		// Decoding
-		for (idx_t i = 0; i < count; i++) {
-			auto encoded_integer = static_cast<int64_t>(encoded_integers[i]);
-			output[i] = alp::AlpCompression<T, true>::DecodeValue(encoded_integer, encoding_indices);
+			auto *encoded_integers = reinterpret_cast<uint64_t *>(data_ptr_cast(for_decoded));
+
+			// unFOR + decoding fused into a single branch-free pass over the unpacked integers,
+			// with the multipliers hoisted out of the loop so the compiler can vectorize it
+			const auto factor = AlpConstants::FACT_ARR[encoding_indices.factor];
+			const auto frac = AlpTypedConstants<T>::FRAC_ARR[encoding_indices.exponent];
+			for (idx_t i = 0; i < count; i++) {
+				auto encoded_integer = static_cast<int64_t>(encoded_integers[i] + frame_of_reference);
+				//! The cast to T is needed to prevent a signed integer overflow
+				output[i] = static_cast<T>(encoded_integer) * factor * frac;
+			}
 		}
 
 		// Exceptions Patching
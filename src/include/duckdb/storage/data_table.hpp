@@ -39,6 +39,7 @@ class TableIOManager;
 class Transaction;
 class WriteAheadLog;
 class TableDataWriter;
+class TableStatistics;
 class ConflictManager;
 class TableScanState;
 struct TableDeleteState;
@@ -71,6 +72,7 @@ public:
 	TableIOManager &GetTableIOManager();
 
 	bool IsTemporary() const;
+	bool IsUnlogged() const;
 
 	//! Returns a list of types of the table
 	vector<LogicalType> GetTypes();
@@ -160,10 +162,15 @@ public:
 	//! Merge a row group collection directly into this table - appending it to the end of the table without copying
 	void MergeStorage(RowGroupCollection &data, TableIndexList &indexes);
 
+	//! Returns true if appends to the given index are deferred by the local storage and applied as a single
+	//! bulk merge when flushing the transaction (see LocalTableStorage::AppendToIndexes)
+	static bool IndexAppendsInBulk(Index &index);
 	//! Append a chunk with the row ids [row_start, ..., row_start + chunk.size()] to all indexes of the table, returns
-	//! whether or not the append succeeded
+	//! whether or not the append succeeded. If skip_bulk_indexes is set, indexes for which IndexAppendsInBulk is
+	//! true are skipped, as the caller appends to these in bulk instead
 	ErrorData AppendToIndexes(DataChunk &chunk, row_t row_start);
-	static ErrorData AppendToIndexes(TableIndexList &indexes, DataChunk &chunk, row_t row_start);
+	static ErrorData AppendToIndexes(TableIndexList &indexes, DataChunk &chunk, row_t row_start,
+	                                 bool skip_bulk_indexes = false);
 	//! Remove a chunk with the row ids [row_start, ..., row_start + chunk.size()] from all indexes of the table
 	void RemoveFromIndexes(TableAppendState &state, DataChunk &chunk, row_t row_start);
 	//! Remove the chunk with the specified set of row identifiers from all indexes of the table
@@ -182,6 +189,17 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Sets the histogram statistics of a physical column within the table
+	void SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram_stats);
+	//! Get a copy of the histogram statistics of a physical column, if the table has been analyzed
+	unique_ptr<HistogramStatistics> GetHistogram(column_t column_id);
+	//! Whether all values of a physical column are known to be sorted in the given direction, without any NULLs
+	bool IsColumnSorted(column_t column_id, OrderType order_type);
+	//! Registers deleted or updated rows. When automatic_statistics_refresh is enabled and enough of the table has
+	//! changed since the distinct statistics were last rebuilt, rebuilds them from the current table contents.
+	void RegisterChangedRows(ClientContext &context, idx_t changed_rows);
+	//! Rebuilds the distinct statistics of all supported columns from the rows visible to the current transaction
+	void RefreshDistinctStatistics(ClientContext &context);
 
 	//! Obtains a shared lock to prevent checkpointing while operations are running
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
@@ -189,11 +207,19 @@ public:
 	unique_ptr<StorageLockKey> GetCheckpointLock();
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
+	//! Write the row group data of the table, filling in the global statistics. This is the expensive part of a
+	//! checkpoint and can run concurrently with the data write of other tables.
+	void CheckpointData(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Write the metadata of a table whose data was written through CheckpointData
+	void FinalizeCheckpoint(TableDataWriter &writer, TableStatistics &global_stats, Serializer &serializer);
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
 	idx_t ColumnCount() const;
 	idx_t GetTotalRows() const;
+	//! Returns the amount of rows visible to the transaction of the given context, computed purely from the row
+	//! version metadata (i.e. without scanning any column data). Does not include transaction-local rows.
+	idx_t GetVisibleRowCount(ClientContext &context);
 
 	vector<ColumnSegmentInfo> GetColumnSegmentInfo();
 	static bool IsForeignKeyIndex(const vector<PhysicalIndex> &fk_keys, Index &index, ForeignKeyType fk_type);
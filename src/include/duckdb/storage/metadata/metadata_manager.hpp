@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/common/set.hpp"
@@ -49,6 +50,8 @@ public:
 	MetadataManager(BlockManager &block_manager, BufferManager &buffer_manager);
 	~MetadataManager();
 
+	//! Allocate a new metadata handle. Safe to call from multiple threads, so several metadata writers can
+	//! allocate blocks concurrently (e.g. when tables are checkpointed in parallel).
 	MetadataHandle AllocateHandle();
 	MetadataHandle Pin(MetadataPointer pointer);
 
@@ -77,10 +80,13 @@ public:
 protected:
 	BlockManager &block_manager;
 	BufferManager &buffer_manager;
+	//! Lock protecting the block map during concurrent allocation/pinning
+	mutex block_lock;
 	unordered_map<block_id_t, MetadataBlock> blocks;
 	unordered_map<block_id_t, idx_t> modified_blocks;
 
 protected:
+	MetadataHandle PinInternal(MetadataPointer pointer);
 	block_id_t AllocateNewBlock();
 	block_id_t PeekNextBlockId();
 	block_id_t GetNextBlockId();
@@ -30,6 +30,10 @@ public:
 	MetadataManager &GetManager() {
 		return manager;
 	}
+	//! Returns the set of blocks the writer has written to so far, if they are being tracked
+	optional_ptr<vector<MetaBlockPointer>> GetWrittenPointers() {
+		return written_pointers;
+	}
 
 protected:
 	virtual MetadataHandle NextHandle();
@@ -12,6 +12,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
@@ -24,6 +25,7 @@ class TemporaryMemoryManager;
 class DatabaseInstance;
 class TemporaryDirectoryHandle;
 struct EvictionQueue;
+struct ProducerToken;
 
 //! The BufferManager is in charge of handling memory management for a single database. It cooperatively shares a
 //! BufferPool with other BufferManagers, belonging to different databases. It hands out memory buffers that can
@@ -43,6 +45,15 @@ public:
 	static unique_ptr<FileBuffer> ReadTemporaryBufferInternal(BufferManager &buffer_manager, FileHandle &handle,
 	                                                          idx_t position, idx_t size,
 	                                                          unique_ptr<FileBuffer> reusable_buffer);
+	//! Compresses a buffer that is about to be written to the temporary directory, setting compressed_size.
+	//! Returns empty data if the buffer does not compress well enough to be worth it.
+	static AllocatedData CompressTemporaryBuffer(Allocator &allocator, FileBuffer &buffer, idx_t &compressed_size);
+	//! Reads back a compressed buffer written by CompressTemporaryBuffer, decompressing it into a managed buffer
+	//! of the original size
+	static unique_ptr<FileBuffer> ReadCompressedTemporaryBufferInternal(BufferManager &buffer_manager,
+	                                                                    FileHandle &handle, idx_t position,
+	                                                                    idx_t compressed_size, idx_t size,
+	                                                                    unique_ptr<FileBuffer> reusable_buffer);
 
 	//! Registers a transient memory buffer.
 	shared_ptr<BlockHandle> RegisterTransientMemory(const idx_t size, const idx_t block_size) final;
@@ -70,6 +81,9 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
 	void Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
+	//! Schedule a prefetch of the given blocks on the task scheduler, so the read overlaps with the calling thread.
+	//! Falls back to a synchronous prefetch when no background threads are available.
+	void PrefetchAsync(vector<shared_ptr<BlockHandle>> handles) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
@@ -122,6 +136,16 @@ protected:
 	BufferPool &GetBufferPool() const final;
 	TemporaryMemoryManager &GetTemporaryMemoryManager() final;
 
+	//! Try to keep an evicted buffer compressed in memory instead of writing it to disk.
+	//! Returns false if the compressed tier is disabled, full, or the buffer does not compress.
+	bool TryWriteCompressedBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer);
+	//! Read a buffer back from the compressed in-memory tier, or return nullptr if the block is not in the tier.
+	//! The reusable buffer is only consumed on a hit.
+	unique_ptr<FileBuffer> TryReadCompressedBuffer(MemoryTag tag, block_id_t id,
+	                                               unique_ptr<FileBuffer> &reusable_buffer);
+	//! Remove a buffer from the compressed in-memory tier. Returns true if the block was found in the tier.
+	bool DeleteCompressedBuffer(block_id_t id);
+
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) final;
 	//! Read a temporary buffer from disk
@@ -164,6 +188,26 @@ protected:
 		optional_idx maximum_swap_space = optional_idx();
 	};
 
+	//! An evicted buffer that is kept in memory in compressed form instead of being written to disk
+	struct CompressedBufferEntry {
+		//! The compressed buffer contents (including the buffer header)
+		AllocatedData compressed_data;
+		//! The size of the compressed data (in bytes)
+		idx_t compressed_size;
+		//! The original (user) size of the buffer
+		idx_t uncompressed_size;
+	};
+
+	//! The in-memory tier of compressed evicted buffers, capped by 'compressed_buffer_tier_size'
+	struct CompressedBufferTier {
+		//! Lock protecting the tier
+		mutex lock;
+		//! Total compressed bytes currently held by the tier
+		idx_t size = 0;
+		//! The compressed buffers, by block id
+		unordered_map<block_id_t, CompressedBufferEntry> buffers;
+	};
+
 protected:
 	//! The database instance
 	DatabaseInstance &db;
@@ -171,6 +215,12 @@ protected:
 	BufferPool &buffer_pool;
 	//! The variables related to temporary file management
 	TemporaryFileData temporary_directory;
+	//! The compressed in-memory tier for evicted buffers
+	CompressedBufferTier compressed_tier;
+	//! Lock protecting the prefetch producer token
+	mutex prefetch_lock;
+	//! Producer token used to schedule background prefetch tasks (lazily created)
+	unique_ptr<ProducerToken> prefetch_producer;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
 	//! Allocator associated with the buffer manager, that passes all allocations through this buffer manager
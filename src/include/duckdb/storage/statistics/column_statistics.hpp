@@ -10,6 +10,8 @@
 
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
+#include "duckdb/storage/statistics/sortedness_statistics.hpp"
 
 namespace duckdb {
 class Serializer;
@@ -32,6 +34,14 @@ public:
 	DistinctStatistics &DistinctStats();
 	void SetDistinct(unique_ptr<DistinctStatistics> distinct_stats);
 
+	bool HasHistogramStats();
+	HistogramStatistics &HistogramStats();
+	void SetHistogram(unique_ptr<HistogramStatistics> histogram_stats);
+
+	bool HasSortednessStats();
+	SortednessStatistics &SortednessStats();
+	void UpdateSortedness(Vector &v, idx_t count);
+
 	shared_ptr<ColumnStatistics> Copy() const;
 
 	void Serialize(Serializer &serializer) const;
@@ -41,6 +51,10 @@ private:
 	BaseStatistics stats;
 	//! The approximate count distinct stats of the column
 	unique_ptr<DistinctStatistics> distinct_stats;
+	//! The histogram stats of the column, only present after ANALYZE (in-memory only, not checkpointed)
+	unique_ptr<HistogramStatistics> histogram_stats;
+	//! The sortedness stats of the column (in-memory only, not checkpointed)
+	unique_ptr<SortednessStatistics> sortedness_stats;
 };
 
 } // namespace duckdb
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/histogram_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! HistogramStatistics holds an equi-depth histogram and a most-common-value list of a numeric column, built from a
+//! uniform sample of the column by the ANALYZE statement. The histogram refines the selectivity estimates of range
+//! and equality predicates beyond what the min/max in NumericStats can provide.
+class HistogramStatistics {
+public:
+	//! The number of equi-depth buckets of the histogram
+	static constexpr idx_t BUCKET_COUNT = 64;
+	//! The number of most-common values we keep
+	static constexpr idx_t MCV_COUNT = 8;
+	//! The number of values we sample to build the histogram from
+	static constexpr idx_t SAMPLE_SIZE = 65536;
+
+	struct CommonValue {
+		double value;
+		//! The fraction of all (non-NULL) values that equal this value
+		double fraction;
+	};
+
+public:
+	HistogramStatistics();
+
+	//! Whether histograms can be built for columns of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+	//! Sample the values of the vector into the histogram
+	void Update(Vector &input, idx_t count);
+	//! Merge the collected samples of another (unfinalized) histogram into this one
+	void Merge(const HistogramStatistics &other);
+	//! Build the buckets and the most-common-value list from the collected sample
+	void Finalize();
+
+	//! Estimate the selectivity of "column <comparison> constant"; the distinct count of the column (if known)
+	//! refines the estimate for equality predicates outside the most-common-value list.
+	//! Returns false if the comparison cannot be estimated from the histogram.
+	bool TryEstimateSelectivity(ExpressionType comparison, double constant, idx_t distinct_count,
+	                            double &selectivity) const;
+	//! The fraction of values that are NULL
+	double GetNullFraction() const;
+
+	unique_ptr<HistogramStatistics> Copy() const;
+
+private:
+	//! The fraction of (non-NULL) values that compare strictly less than the given value
+	double FractionBelow(double value) const;
+	//! The fraction of (non-NULL) values that equal the given value
+	double FractionEqual(double value, idx_t distinct_count) const;
+
+private:
+	//! The sampled values; cleared when the histogram is finalized
+	vector<double> sample;
+	//! The number of (non-NULL) values seen while sampling
+	idx_t total_count;
+	//! The number of NULL values seen while sampling
+	idx_t null_count;
+	//! The random engine driving the reservoir sampling
+	RandomEngine random;
+
+	//! The bucket boundaries (BUCKET_COUNT + 1 entries once finalized); each bucket holds an equal share of values
+	vector<double> bucket_boundaries;
+	//! The most-common values and their frequencies, most frequent first
+	vector<CommonValue> common_values;
+};
+
+} // namespace duckdb
@@ -19,8 +19,15 @@ public:
 	explicit SegmentStatistics(LogicalType type);
 	explicit SegmentStatistics(BaseStatistics statistics);
 
+	//! Whether sortedness is tracked for segments of the given type
+	static bool SortednessIsTracked(const LogicalType &type);
+
 	//! Type-specific statistics of the segment
 	BaseStatistics statistics;
+	//! Whether all values appended to the segment so far form a non-decreasing run without NULLs; maintained by the
+	//! append path for numeric segments, so that range filters can binary search instead of scanning. In-memory
+	//! only: segments loaded from disk start out as not known to be sorted.
+	bool is_sorted;
 };
 
 } // namespace duckdb
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/sortedness_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! SortednessStatistics tracks whether all values appended to a column so far form a single monotonic run without
+//! NULLs, as is the case for e.g. the timestamp column of append-only time-series tables. The optimizer uses this to
+//! elide sorts whose order is already established by the insertion order of the table. In-memory only, not
+//! checkpointed: columns loaded from disk start out as not known to be sorted.
+class SortednessStatistics {
+public:
+	SortednessStatistics();
+
+	//! Whether sortedness can be tracked for columns of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+	//! Verify that the appended values continue the monotonic run; directions that are violated are cleared
+	void Update(Vector &input, idx_t count);
+	//! Merge in the statistics of rows that are appended directly after the rows covered by these statistics
+	void Merge(const SortednessStatistics &other);
+	//! Mark the column as no longer known to be sorted (e.g., after an in-place update)
+	void SetUnsorted();
+
+	//! Whether all values of the column are known to be sorted in the given direction, without any NULLs
+	bool IsSorted(OrderType order_type) const;
+
+	unique_ptr<SortednessStatistics> Copy() const;
+
+private:
+	//! Whether the values appended so far are non-decreasing / non-increasing
+	bool is_ascending;
+	bool is_descending;
+	//! Whether any values have been appended yet
+	bool has_values;
+	//! The first and last appended value, for stitching runs together across appends and merges
+	Value first_value;
+	Value last_value;
+};
+
+} // namespace duckdb
@@ -22,6 +22,8 @@ class Vector;
 
 struct StringStatsData {
 	constexpr static uint32_t MAX_STRING_MINMAX_SIZE = 8;
+	constexpr static uint32_t NGRAM_FILTER_WORDS = 4;
+	constexpr static uint32_t NGRAM_FILTER_BITS = NGRAM_FILTER_WORDS * 64;
 
 	//! The minimum value of the segment, potentially truncated
 	data_t min[MAX_STRING_MINMAX_SIZE];
@@ -33,6 +35,10 @@ struct StringStatsData {
 	bool has_max_string_length;
 	//! The maximum string length in bytes
 	uint32_t max_string_length;
+	//! Whether or not the ngram filter is valid (false e.g. for statistics written by older versions)
+	bool has_ngram_filter;
+	//! Bloom-style presence filter over the 3-grams of all values, used to prune contains/LIKE '%...%' predicates
+	uint64_t ngram_filter[NGRAM_FILTER_WORDS];
 };
 
 struct StringStats {
@@ -63,6 +69,10 @@ struct StringStats {
 
 	DUCKDB_API static FilterPropagateResult CheckZonemap(const BaseStatistics &stats, ExpressionType comparison_type,
 	                                                     const string &value);
+	//! Whether or not the statistics have a valid ngram presence filter
+	DUCKDB_API static bool HasNGramFilter(const BaseStatistics &stats);
+	//! Checks if "value" can occur as a substring of any of the values covered by these statistics
+	DUCKDB_API static FilterPropagateResult CheckContains(const BaseStatistics &stats, const string &value);
 
 	DUCKDB_API static void Update(BaseStatistics &stats, const string_t &value);
 	DUCKDB_API static void Merge(BaseStatistics &stats, const BaseStatistics &other);
@@ -52,7 +52,7 @@ struct CheckpointOptions {
 //! database on disk
 class StorageManager {
 public:
-	StorageManager(AttachedDatabase &db, string path, bool read_only);
+	StorageManager(AttachedDatabase &db, string path, bool read_only, bool use_direct_io = false);
 	virtual ~StorageManager();
 
 public:
@@ -85,6 +85,8 @@ public:
 	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
+	//! The path to the working-set file used for warm restarts, derived from the database file path
+	string GetWorkingSetPath();
 	bool InMemory();
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
@@ -95,6 +97,13 @@ public:
 	virtual vector<MetadataBlockInfo> GetMetadataInfo() = 0;
 	virtual shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) = 0;
 
+	//! Write the ids of the blocks that are resident in the buffer pool to the working-set file (warm restart)
+	virtual void PersistWorkingSet() {
+	}
+	//! Pre-load the blocks listed in the working-set file into the buffer pool (warm restart)
+	virtual void RestoreWorkingSet() {
+	}
+
 protected:
 	virtual void LoadDatabase(const optional_idx block_alloc_size) = 0;
 
@@ -107,6 +116,8 @@ protected:
 	unique_ptr<WriteAheadLog> wal;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
+	//! Whether or not to bypass the operating system page cache for this database
+	bool use_direct_io;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
@@ -128,7 +139,7 @@ public:
 class SingleFileStorageManager : public StorageManager {
 public:
 	SingleFileStorageManager() = delete;
-	SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only);
+	SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only, bool use_direct_io = false);
 
 	//! The BlockManager to read/store meta information and data in blocks
 	unique_ptr<BlockManager> block_manager;
@@ -143,6 +154,8 @@ public:
 	DatabaseSize GetDatabaseSize() override;
 	vector<MetadataBlockInfo> GetMetadataInfo() override;
 	shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) override;
+	void PersistWorkingSet() override;
+	void RestoreWorkingSet() override;
 
 protected:
 	void LoadDatabase(const optional_idx block_alloc_size) override;
@@ -52,7 +52,7 @@ struct RowGroupAppendState {
 };
 
 struct IndexLock {
-	unique_lock<mutex> index_lock;
+	unique_ptr<StorageLockKey> index_lock;
 };
 
 struct TableAppendState {
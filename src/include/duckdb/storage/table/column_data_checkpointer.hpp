@@ -32,6 +32,8 @@ public:
 
 private:
 	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
+	CompressionType GetReusableCompressionType();
+	unique_ptr<AnalyzeState> TryReusePreviousCompression(idx_t &compression_idx);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
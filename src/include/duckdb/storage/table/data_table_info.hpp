@@ -29,6 +29,13 @@ public:
 
 	//! Whether or not the table is temporary
 	bool IsTemporary() const;
+	//! Whether or not the table is unlogged (changes to its data bypass the WAL)
+	bool IsUnlogged() const {
+		return unlogged;
+	}
+	void SetUnlogged() {
+		unlogged = true;
+	}
 
 	AttachedDatabase &GetDB() {
 		return db;
@@ -49,6 +56,13 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Get the current data version of the table
+	idx_t GetDataVersion() {
+		return data_version;
+	}
+	//! Increment the data version of the table, invalidating cached query results that read from it
+	void BumpDataVersion();
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +80,12 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! Monotonic version number, incremented on every change to the table data
+	atomic<idx_t> data_version;
+	//! The number of rows deleted or updated since the distinct statistics were last rebuilt
+	atomic<idx_t> rows_changed_since_stats_refresh;
+	//! Whether or not the table is unlogged
+	bool unlogged;
 };
 
 } // namespace duckdb
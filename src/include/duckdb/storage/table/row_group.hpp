@@ -134,6 +134,12 @@ public:
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
+	//! Whether a checkpoint can re-use the on-disk data of this row group as-is
+	//! This requires that the row group is unchanged since it was last checkpointed, and that we know which
+	//! metadata blocks its column pointers occupy
+	bool CanReuseCheckpointData();
+	//! Create a row group pointer that re-uses the on-disk data of an unchanged row group
+	RowGroupPointer CheckpointUnchanged(MetadataManager &manager);
 
 	void InitializeAppend(RowGroupAppendState &append_state);
 	void Append(RowGroupAppendState &append_state, DataChunk &chunk, idx_t append_count);
@@ -184,6 +190,10 @@ private:
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
+	//! The metadata blocks that hold the serialized column pointers (see column_pointers)
+	vector<MetaBlockPointer> column_metadata_pointers;
+	//! Whether the row group has been modified since it was last read from or written to disk
+	atomic<bool> has_changes;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
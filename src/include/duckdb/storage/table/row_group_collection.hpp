@@ -39,6 +39,9 @@ public:
 
 public:
 	idx_t GetTotalRows() const;
+	//! Returns the amount of rows visible to the given transaction, computed purely from the row version metadata
+	//! (i.e. without scanning any column data)
+	idx_t GetVisibleCount(TransactionData transaction);
 	Allocator &GetAllocator() const;
 
 	void Initialize(PersistentTableData &data);
@@ -57,7 +60,7 @@ public:
 	                              idx_t end_row);
 	static bool InitializeScanInRowGroup(CollectionScanState &state, RowGroupCollection &collection,
 	                                     RowGroup &row_group, idx_t vector_index, idx_t max_row);
-	void InitializeParallelScan(ParallelCollectionScanState &state);
+	void InitializeParallelScan(ParallelCollectionScanState &state, bool shared_scan = false);
 	bool NextParallelScan(ClientContext &context, ParallelCollectionScanState &state, CollectionScanState &scan_state);
 
 	bool Scan(DuckTransaction &transaction, const vector<column_t> &column_ids,
@@ -111,6 +114,9 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	void SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram_stats);
+	unique_ptr<HistogramStatistics> CopyHistogram(column_t column_id);
+	bool IsColumnSorted(column_t column_id, OrderType order_type);
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
@@ -127,6 +133,8 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Get the next row group to scan, wrapping around to the start of the collection for circular scans
+	RowGroup *GetNextScanSegment(ParallelCollectionScanState &state, RowGroup *row_group);
 
 private:
 	//! BlockManager
@@ -144,6 +152,9 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The start of the row group most recently handed out to a parallel scan - new scans can attach here so that
+	//! concurrent scans over the same collection share one physical pass through the buffer pool (circular scans)
+	atomic<idx_t> shared_scan_position;
 };
 
 } // namespace duckdb
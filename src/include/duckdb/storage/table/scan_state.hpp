@@ -8,12 +8,14 @@
 
 #pragma once
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/map.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/scan_options.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/table/segment_lock.hpp"
 
 namespace duckdb {
@@ -85,6 +87,9 @@ struct ColumnScanState {
 	bool initialized = false;
 	//! If this segment has already been checked for skipping purposes
 	bool segment_checked = false;
+	//! The row up to which the zonemap check of the compression method excluded any matches
+	//! (DConstants::INVALID_INDEX if no such check was performed)
+	idx_t zonemap_prune_target = DConstants::INVALID_INDEX;
 	//! We initialize one SegmentScanState per segment, however, if scanning a DataChunk requires us to scan over more
 	//! than one Segment, we need to keep the scan states of the previous segments around
 	vector<unique_ptr<SegmentScanState>> previous_states;
@@ -130,12 +135,17 @@ public:
 	idx_t batch_index;
 	//! The valid selection
 	SelectionVector valid_sel;
+	//! The wall-clock time at which the currently claimed parallel morsel was handed out
+	time_point<high_resolution_clock> morsel_start_time;
+	//! Whether morsel_start_time refers to a morsel that is currently being scanned
+	bool morsel_timing_valid;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
 	const vector<storage_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	ExpressionExecutor *GetFilterExecutor(idx_t filter_idx);
 	TableScanOptions &GetOptions();
 	bool Scan(DuckTransaction &transaction, DataChunk &result);
 	bool ScanCommitted(DataChunk &result, TableScanType type);
@@ -153,6 +163,7 @@ struct TableScanOptions {
 class TableScanState {
 public:
 	TableScanState() : table_state(*this), local_state(*this), table_filters(nullptr) {};
+	~TableScanState();
 
 	//! The underlying table scan state
 	CollectionScanState table_state;
@@ -165,10 +176,14 @@ public:
 
 public:
 	void Initialize(vector<storage_t> column_ids, TableFilterSet *table_filters = nullptr);
+	//! Initialize the scan state, additionally creating expression executors for any expression filters
+	void Initialize(vector<storage_t> column_ids, ClientContext &context, TableFilterSet *table_filters = nullptr);
 
 	const vector<storage_t> &GetColumnIds();
 	TableFilterSet *GetFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
+	//! Returns the expression executor of the expression filter on the given column (if any)
+	ExpressionExecutor *GetFilterExecutor(idx_t filter_idx);
 
 private:
 	//! The column identifiers of the scan
@@ -177,6 +192,8 @@ private:
 	TableFilterSet *table_filters;
 	//! Adaptive filter info (if any)
 	unique_ptr<AdaptiveFilter> adaptive_filter;
+	//! Expression executors for any expression filters, indexed by the filter column index
+	unordered_map<idx_t, unique_ptr<ExpressionExecutor>> filter_executors;
 };
 
 struct ParallelCollectionScanState {
@@ -185,9 +202,17 @@ struct ParallelCollectionScanState {
 	//! The row group collection we are scanning
 	RowGroupCollection *collection;
 	RowGroup *current_row_group;
+	//! The row group this scan started at - only set if the scan attached to a concurrently running scan over the
+	//! same collection and needs to wrap around at the end (circular scan)
+	RowGroup *start_row_group;
+	//! Whether or not a circular scan has wrapped around to the start of the collection
+	bool wrapped;
 	idx_t vector_index;
 	idx_t max_row;
 	idx_t batch_index;
+	//! The current morsel size handed out by NextParallelScan, in vectors - grown and shrunk adaptively based on
+	//! how long the previously handed out morsels took to scan
+	idx_t morsel_vectors;
 	atomic<idx_t> processed_rows;
 	mutex lock;
 };
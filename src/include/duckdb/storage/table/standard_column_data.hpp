@@ -63,6 +63,9 @@ public:
 	void DeserializeColumn(Deserializer &deserializer, BaseStatistics &target_stats) override;
 
 	void Verify(RowGroup &parent) override;
+
+private:
+	bool CheckCompressedZonemap(ColumnScanState &state, TableFilter &filter);
 };
 
 } // namespace duckdb
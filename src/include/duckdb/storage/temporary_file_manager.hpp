@@ -61,6 +61,9 @@ struct TemporaryFileIndex {
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The size of the block as written to disk, set to DConstants::INVALID_INDEX if it was written uncompressed.
+	//! Temporary files do not survive restarts, so this is only tracked here and not in the file itself.
+	idx_t compressed_size = DConstants::INVALID_INDEX;
 
 public:
 	bool IsValid() const;
@@ -89,7 +92,9 @@ public:
 public:
 	TemporaryFileIndex TryGetBlockIndex();
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	void WriteTemporaryFile(data_ptr_t compressed_data, idx_t compressed_size, TemporaryFileIndex index);
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, idx_t compressed_size,
+	                                           unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -9,8 +9,10 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
@@ -18,13 +20,44 @@ namespace duckdb {
 class ClientContext;
 class TemporaryMemoryManager;
 
+//! A record of a decision that forces an operator to process externally (i.e. to spill),
+//! or of an operator finishing (recording its peak reservation)
+struct SpillEvent {
+	//! The time at which the event was recorded
+	timestamp_t time;
+	//! The operator that owns the TemporaryMemoryState
+	string operator_name;
+	//! The size (in bytes) the operator needed at the time of the event
+	idx_t remaining_size;
+	//! The reservation (in bytes) the operator was granted at the time of the event
+	idx_t reservation;
+	//! The peak reservation (in bytes) of the operator up to the time of the event
+	idx_t peak_reservation;
+	//! Why the event was recorded
+	string reason;
+};
+
+//! A snapshot of a currently active TemporaryMemoryState
+struct TemporaryMemoryStateInfo {
+	//! The operator that owns the TemporaryMemoryState
+	string operator_name;
+	//! The remaining size (in bytes) the operator needs if it could fit fully in memory
+	idx_t remaining_size;
+	//! The minimum reservation (in bytes) guaranteed to the operator
+	idx_t minimum_reservation;
+	//! The reservation (in bytes) currently granted to the operator
+	idx_t reservation;
+	//! The highest reservation (in bytes) the operator has held
+	idx_t peak_reservation;
+};
+
 //! State of the temporary memory to be managed concurrently with other states
 //! As long as this is within scope, it is active
 class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, string owner, idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -38,10 +71,14 @@ public:
 	void SetMinimumReservation(idx_t new_minimum_reservation);
 	//! Get the reservation of this state
 	idx_t GetReservation() const;
+	//! Get the peak reservation of this state
+	idx_t GetPeakReservation() const;
 
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The name of the operator that owns this state (for spill event reporting)
+	string owner;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -49,6 +86,14 @@ private:
 	atomic<idx_t> minimum_reservation;
 	//! How much memory this operator has reserved
 	atomic<idx_t> reservation;
+	//! The highest reservation this operator has held
+	atomic<idx_t> peak_reservation;
+	//! Whether external processing was forced when this state was last updated,
+	//! in which case the state stays at its minimum reservation
+	atomic<bool> force_external;
+	//! Whether a spill event has been reported for the current unsatisfied reservation
+	//! (protected by the TemporaryMemoryManager's lock)
+	bool spill_reported = false;
 };
 
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
@@ -78,8 +123,12 @@ private:
 public:
 	//! Get the TemporaryMemoryManager
 	static TemporaryMemoryManager &Get(ClientContext &context);
-	//! Register a TemporaryMemoryState
-	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Register a TemporaryMemoryState - the owner identifies the operator in the spill event log
+	unique_ptr<TemporaryMemoryState> Register(ClientContext &context, string owner);
+	//! Returns a copy of the recorded spill events, ordered from oldest to newest
+	vector<SpillEvent> GetSpillEvents();
+	//! Returns a snapshot of the currently active states
+	vector<TemporaryMemoryStateInfo> GetStateInfo();
 
 private:
 	//! Locks the TemporaryMemoryManager
@@ -88,12 +137,19 @@ private:
 	void UpdateConfiguration(ClientContext &context);
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
 	void UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state);
+	//! Compute the reservation that we can currently grant to a TemporaryMemoryState (must hold the lock)
+	idx_t ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const;
+	//! Grow the reservations of states that were granted less than their remaining size,
+	//! using memory that was freed up by another state (must hold the lock)
+	void RedistributeMemory();
 	//! Set the remaining size of a TemporaryMemoryState (must hold the lock)
 	void SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size);
 	//! Set the reservation of a TemporaryMemoryState (must hold the lock)
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
+	//! Record a spill event for a TemporaryMemoryState (must hold the lock)
+	void AddSpillEvent(const TemporaryMemoryState &temporary_memory_state, string reason);
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
@@ -116,6 +172,11 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+
+	//! The maximum number of spill events that are kept - when full, the oldest events are dropped
+	static constexpr const idx_t MAX_SPILL_EVENTS = 4096;
+	//! The recorded spill events, ordered from oldest to newest
+	deque<SpillEvent> spill_events;
 };
 
 } // namespace duckdb
@@ -14,6 +14,7 @@
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -63,6 +64,15 @@ public:
 	//! Initializes the file of the WAL by creating the file writer.
 	BufferedFileWriter &Initialize();
 
+	//! The database this WAL belongs to
+	AttachedDatabase &GetDatabase() {
+		return database;
+	}
+
+	//! The version of the WAL file, which determines the entry layout.
+	//! For existing files the version is read from the version entry at the head of the file.
+	idx_t GetVersion();
+
 	void WriteVersion();
 
 	virtual void WriteCreateTable(const TableCatalogEntry &entry);
@@ -112,14 +122,41 @@ public:
 	void Delete();
 	void Flush();
 
+	//! Whether committing transactions defer the disk sync so that concurrent commits can share it (group commit)
+	bool GroupCommitEnabled() const;
+	//! Write a flush marker and flush the WAL to the OS, deferring the disk sync to SyncGroupCommit
+	void FlushGroupCommit();
+	//! Sync the WAL to disk up to the given write position, on behalf of all commits that flushed before it
+	void SyncGroupCommit(idx_t target_position);
+	//! The WAL write position that has been flushed to the OS (but possibly not yet synced to disk)
+	idx_t GetFlushedPosition() const {
+		return flushed_position;
+	}
+	//! Whether the WAL holds flushed entries that still require a disk sync
+	bool RequiresSync() const {
+		return flushed_position > synced_position;
+	}
+
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
+protected:
+	//! Read the version entry at the head of an existing WAL file
+	void ReadVersion();
+
 protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! The version of the WAL file, or zero, if it has not been determined yet
+	atomic<idx_t> wal_version;
+	//! Lock used to serialize the disk syncs of concurrently committing transactions (group commit)
+	mutex sync_lock;
+	//! The WAL write position that has been flushed to the OS, but possibly not yet synced to disk
+	atomic<idx_t> flushed_position;
+	//! The WAL write position up to which the file has been synced to disk
+	atomic<idx_t> synced_position;
 };
 
 } // namespace duckdb
@@ -74,6 +74,9 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Vacuum the database by triggering a full checkpoint after enough rows have been deleted,
+	//! if the database is otherwise idle
+	void AutomaticVacuum(idx_t deleted_rows);
 
 private:
 	//! The current start timestamp used by transactions
@@ -86,6 +89,8 @@ private:
 	atomic<transaction_t> lowest_active_start;
 	//! The last commit timestamp
 	atomic<transaction_t> last_commit;
+	//! The number of rows deleted since the last automatic vacuum
+	atomic<idx_t> vacuum_deleted_rows;
 	//! Set of currently running transactions
 	vector<unique_ptr<DuckTransaction>> active_transactions;
 	//! Set of recently committed transactions
@@ -50,6 +50,8 @@ public:
 	OptimisticDataWriter optimistic_writer;
 	//! The set of all optimistic data writers associated with this table
 	vector<unique_ptr<OptimisticDataWriter>> optimistic_writers;
+	//! Lock guarding the set of optimistic writers and merges into the main optimistic writer
+	mutex optimistic_writer_lock;
 	//! Whether or not storage was merged
 	bool merged_storage = false;
 	//! Whether or not the storage was dropped
@@ -18,6 +18,7 @@ class WriteAheadLog;
 
 struct UndoBufferProperties {
 	idx_t estimated_size = 0;
+	idx_t deleted_rows = 0;
 	bool has_updates = false;
 	bool has_deletes = false;
 	bool has_catalog_changes = false;
@@ -12,6 +12,13 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/optimistic_data_writer.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/planner/expression_binder/constant_binder.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -433,4 +440,151 @@ void BaseAppender::Close() {
 	}
 }
 
+ParallelAppenderThread::ParallelAppenderThread(ParallelAppender &parent_p)
+    : BaseAppender(Allocator::DefaultAllocator(), parent_p.types, AppenderType::LOGICAL), parent(parent_p),
+      append_state(make_uniq<TableAppendState>()) {
+	row_groups = make_uniq<RowGroupCollection>(parent.table_info, *parent.block_manager, parent.types,
+	                                           NumericCast<idx_t>(MAX_ROW_ID));
+	row_groups->InitializeEmpty();
+	row_groups->InitializeAppend(*append_state);
+}
+
+ParallelAppenderThread::~ParallelAppenderThread() {
+	Destructor();
+	row_groups->FinalizeAppend(TransactionData(0, 0), *append_state);
+	parent.ReturnCollection(std::move(row_groups));
+}
+
+void ParallelAppenderThread::FlushInternal(ColumnDataCollection &collection) {
+	for (auto &append_chunk : collection.Chunks()) {
+		row_groups->Append(append_chunk, *append_state);
+	}
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &schema_name, const string &table_name)
+    : context(con.context), open_appenders(0), closed(false) {
+	description = con.TableInfo(schema_name, table_name);
+	if (!description) {
+		// table could not be found
+		throw CatalogException(StringUtil::Format("Table \"%s.%s\" could not be found", schema_name, table_name));
+	}
+	for (auto &column : description->columns) {
+		types.push_back(column.Type());
+	}
+	// resolve the table info and block manager up-front so thread appenders can be created without holding any
+	// catalog locks
+	context->RunFunctionInTransaction([&]() {
+		auto &table_entry =
+		    Catalog::GetEntry<TableCatalogEntry>(*context, INVALID_CATALOG, description->schema, description->table);
+		auto &storage = table_entry.GetStorage();
+		table_info = storage.GetDataTableInfo();
+		block_manager = &TableIOManager::Get(storage).GetBlockManagerForRowData();
+	});
+}
+
+ParallelAppender::ParallelAppender(Connection &con, const string &table_name)
+    : ParallelAppender(con, DEFAULT_SCHEMA, table_name) {
+}
+
+ParallelAppender::~ParallelAppender() {
+	if (Exception::UncaughtException()) {
+		return;
+	}
+	// wrapped in a try/catch because Close() can throw if the table was dropped in the meantime
+	try {
+		Close();
+	} catch (...) { // NOLINT
+	}
+}
+
+unique_ptr<ParallelAppenderThread> ParallelAppender::CreateAppender() {
+	lock_guard<mutex> guard(collection_lock);
+	if (closed) {
+		throw InvalidInputException("Cannot create a thread appender: the parallel appender has been closed");
+	}
+	open_appenders++;
+	return unique_ptr<ParallelAppenderThread>(new ParallelAppenderThread(*this));
+}
+
+void ParallelAppender::ReturnCollection(unique_ptr<RowGroupCollection> row_groups) {
+	lock_guard<mutex> guard(collection_lock);
+	if (row_groups->GetTotalRows() > 0) {
+		collections.push_back(std::move(row_groups));
+	}
+	open_appenders--;
+}
+
+void ParallelAppender::Close() {
+	vector<unique_ptr<RowGroupCollection>> to_append;
+	{
+		lock_guard<mutex> guard(collection_lock);
+		if (closed) {
+			return;
+		}
+		if (open_appenders != 0) {
+			throw InvalidInputException("Cannot close the parallel appender: %llu thread appenders are still open",
+			                            open_appenders.load());
+		}
+		closed = true;
+		to_append = std::move(collections);
+	}
+	if (to_append.empty()) {
+		return;
+	}
+	idx_t total_rows = 0;
+	for (auto &collection : to_append) {
+		total_rows += collection->GetTotalRows();
+	}
+	context->RunFunctionInTransaction([&]() {
+		auto &table_entry =
+		    Catalog::GetEntry<TableCatalogEntry>(*context, INVALID_CATALOG, description->schema, description->table);
+		auto &storage = table_entry.GetStorage();
+		if (storage.GetDataTableInfo().get() != table_info.get()) {
+			throw InvalidInputException(
+			    "Failed to append: table \"%s\" was dropped or altered after the parallel appender was created",
+			    description->table);
+		}
+		auto binder = Binder::CreateBinder(*context);
+		auto bound_constraints = binder->BindConstraints(table_entry);
+		MetaTransaction::Get(*context).ModifyDatabase(table_entry.ParentCatalog().GetAttached());
+		auto &transaction = DuckTransaction::Get(*context, table_entry.catalog);
+		if (total_rows < LocalStorage::MERGE_THRESHOLD) {
+			// we gathered a small amount of data - append it through the regular transaction-local append path
+			LocalAppendState append_state;
+			storage.InitializeLocalAppend(append_state, table_entry, *context, bound_constraints);
+			for (auto &collection : to_append) {
+				collection->Scan(transaction, [&](DataChunk &insert_chunk) {
+					storage.LocalAppend(append_state, table_entry, *context, insert_chunk);
+					return true;
+				});
+			}
+			storage.FinalizeLocalAppend(append_state);
+		} else {
+			// we gathered a lot of data - repack the per-thread row groups into full row groups, write them to disk
+			// through the optimistic writer and merge them into the transaction-local storage in one go
+			auto constraint_state = storage.InitializeConstraintState(table_entry, bound_constraints);
+			auto &writer = storage.CreateOptimisticWriter(*context);
+			auto merged = make_uniq<RowGroupCollection>(storage.GetDataTableInfo(), *block_manager, types,
+			                                            NumericCast<idx_t>(MAX_ROW_ID));
+			merged->InitializeEmpty();
+			TableAppendState append_state;
+			merged->InitializeAppend(append_state);
+			for (auto &collection : to_append) {
+				collection->Scan(transaction, [&](DataChunk &append_chunk) {
+					storage.VerifyAppendConstraints(*constraint_state, *context, append_chunk);
+					if (merged->Append(append_chunk, append_state)) {
+						// a new row group was created by the append - write the previous row group to disk
+						writer.WriteNewRowGroup(*merged);
+					}
+					return true;
+				});
+			}
+			merged->FinalizeAppend(TransactionData(0, 0), append_state);
+			writer.WriteLastRowGroup(*merged);
+			storage.LocalMerge(*context, *merged);
+			storage.FinalizeOptimisticWriter(*context, writer);
+		}
+	});
+}
+
 } // namespace duckdb
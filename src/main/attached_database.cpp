@@ -18,7 +18,7 @@ namespace duckdb {
 //===--------------------------------------------------------------------===//
 
 AttachOptions::AttachOptions(const DBConfigOptions &options)
-    : access_mode(options.access_mode), db_type(options.database_type) {
+    : access_mode(options.access_mode), db_type(options.database_type), use_direct_io(options.use_direct_io) {
 }
 
 AttachOptions::AttachOptions(const unique_ptr<AttachInfo> &info, const AccessMode default_access_mode)
@@ -50,6 +50,12 @@ AttachOptions::AttachOptions(const unique_ptr<AttachInfo> &info, const AccessMod
 			continue;
 		}
 
+		if (entry.first == "direct_io") {
+			// Bypass the operating system page cache for this database file.
+			use_direct_io = BooleanValue::Get(entry.second.DefaultCastAs(LogicalType::BOOLEAN));
+			continue;
+		}
+
 		if (entry.first == "type") {
 			// Extract the database type.
 			db_type = StringValue::Get(entry.second.DefaultCastAs(LogicalType::VARCHAR));
@@ -97,7 +103,7 @@ AttachedDatabase::AttachedDatabase(DatabaseInstance &db, Catalog &catalog_p, str
 	// We create the storage after the catalog to guarantee we allow extensions to instantiate the DuckCatalog.
 	catalog = make_uniq<DuckCatalog>(*this);
 	auto read_only = options.access_mode == AccessMode::READ_ONLY;
-	storage = make_uniq<SingleFileStorageManager>(*this, std::move(file_path_p), read_only);
+	storage = make_uniq<SingleFileStorageManager>(*this, std::move(file_path_p), read_only, options.use_direct_io);
 	transaction_manager = make_uniq<DuckTransactionManager>(*this);
 	internal = true;
 }
@@ -122,7 +128,7 @@ AttachedDatabase::AttachedDatabase(DatabaseInstance &db, Catalog &catalog_p, Sto
 	if (catalog->IsDuckCatalog()) {
 		// The attached database uses the DuckCatalog.
 		auto read_only = options.access_mode == AccessMode::READ_ONLY;
-		storage = make_uniq<SingleFileStorageManager>(*this, info.path, read_only);
+		storage = make_uniq<SingleFileStorageManager>(*this, info.path, read_only, options.use_direct_io);
 	}
 	transaction_manager = storage_extension->create_transaction_manager(storage_info, *this, *catalog);
 	if (!transaction_manager) {
@@ -232,12 +238,14 @@ void AttachedDatabase::Close() {
 	try {
 		if (!storage->InMemory()) {
 			auto &config = DBConfig::GetConfig(db);
-			if (!config.options.checkpoint_on_shutdown) {
-				return;
+			if (config.options.checkpoint_on_shutdown) {
+				CheckpointOptions options;
+				options.wal_action = CheckpointWALAction::DELETE_WAL;
+				storage->CreateCheckpoint(options);
 			}
-			CheckpointOptions options;
-			options.wal_action = CheckpointWALAction::DELETE_WAL;
-			storage->CreateCheckpoint(options);
+			// persist the working set after the checkpoint, so that the dumped block ids
+			// reflect the final on-disk layout of the database file
+			storage->PersistWorkingSet();
 		}
 	} catch (...) { // NOLINT
 	}
@@ -553,6 +553,40 @@ duckdb_data_chunk duckdb_result_get_chunk(duckdb_result result, idx_t chunk_idx)
 	return reinterpret_cast<duckdb_data_chunk>(chunk.release());
 }
 
+idx_t duckdb_result_fetch_chunks(duckdb_result result, duckdb_data_chunk *out_chunks, idx_t chunk_count) {
+	if (!result.internal_data || !out_chunks) {
+		return 0;
+	}
+	auto &result_data = *(reinterpret_cast<duckdb::DuckDBResultData *>(result.internal_data));
+	if (result_data.result_set_type == duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_DEPRECATED) {
+		return 0;
+	}
+	if (result_data.result->type != duckdb::QueryResultType::MATERIALIZED_RESULT) {
+		// This API is only supported for materialized query results
+		return 0;
+	}
+	result_data.result_set_type = duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_MATERIALIZED;
+	auto &materialized = reinterpret_cast<duckdb::MaterializedQueryResult &>(*result_data.result);
+	auto &collection = materialized.Collection();
+	if (!result_data.fetched_chunks) {
+		result_data.fetched_chunks = duckdb::make_uniq<duckdb::DuckDBFetchedChunks>();
+	}
+	auto &fetched = *result_data.fetched_chunks;
+	// release the chunks and pins handed out by the previous call
+	fetched.chunks.clear();
+	fetched.chunk_state.handles.clear();
+	idx_t count = 0;
+	while (count < chunk_count && fetched.chunk_idx < collection.ChunkCount()) {
+		auto chunk = duckdb::make_uniq<duckdb::DataChunk>();
+		chunk->Initialize(duckdb::Allocator::DefaultAllocator(), collection.Types());
+		collection.FetchChunk(fetched.chunk_idx, *chunk, fetched.chunk_state);
+		out_chunks[count++] = reinterpret_cast<duckdb_data_chunk>(chunk.get());
+		fetched.chunks.push_back(std::move(chunk));
+		fetched.chunk_idx++;
+	}
+	return count;
+}
+
 bool duckdb_result_is_streaming(duckdb_result result) {
 	if (!result.internal_data) {
 		return false;
@@ -1,5 +1,6 @@
 #include "duckdb/main/capi/capi_internal.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/parallel/interrupt.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -23,6 +24,7 @@ struct CTableFunctionInfo : public TableFunctionInfo {
 	duckdb_table_function_init_t init = nullptr;
 	duckdb_table_function_init_t local_init = nullptr;
 	duckdb_table_function_t function = nullptr;
+	duckdb_table_function_async_t async_function = nullptr;
 	void *extra_info = nullptr;
 	duckdb_delete_callback_t delete_callback = nullptr;
 };
@@ -102,13 +104,16 @@ struct CTableInternalInitInfo {
 };
 
 struct CTableInternalFunctionInfo {
-	CTableInternalFunctionInfo(const CTableBindData &bind_data, CTableInitData &init_data, CTableInitData &local_data)
-	    : bind_data(bind_data), init_data(init_data), local_data(local_data), success(true) {
+	CTableInternalFunctionInfo(const CTableBindData &bind_data, CTableInitData &init_data, CTableInitData &local_data,
+	                           optional_ptr<InterruptState> interrupt_state = nullptr)
+	    : bind_data(bind_data), init_data(init_data), local_data(local_data), interrupt_state(interrupt_state),
+	      success(true) {
 	}
 
 	const CTableBindData &bind_data;
 	CTableInitData &init_data;
 	CTableInitData &local_data;
+	optional_ptr<InterruptState> interrupt_state;
 	bool success;
 	string error;
 };
@@ -153,7 +158,7 @@ duckdb_function_info ToCFunctionInfo(duckdb::CTableInternalFunctionInfo &info) {
 unique_ptr<FunctionData> CTableFunctionBind(ClientContext &context, TableFunctionBindInput &input,
                                             vector<LogicalType> &return_types, vector<string> &names) {
 	auto &info = input.info->Cast<CTableFunctionInfo>();
-	D_ASSERT(info.bind && info.function && info.init);
+	D_ASSERT(info.bind && (info.function || info.async_function) && info.init);
 	auto result = make_uniq<CTableBindData>(info);
 	CTableInternalBindInfo bind_info(context, input, return_types, names, *result, info);
 	info.bind(ToCBindInfo(bind_info));
@@ -211,6 +216,27 @@ void CTableFunction(ClientContext &context, TableFunctionInput &data_p, DataChun
 	}
 }
 
+SourceResultType CTableFunctionAsync(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<CTableBindData>();
+	auto &global_data = data_p.global_state->Cast<CTableGlobalInitData>();
+	auto &local_data = data_p.local_state->Cast<CTableLocalInitData>();
+	CTableInternalFunctionInfo function_info(bind_data, global_data.init_data, local_data.init_data,
+	                                         data_p.interrupt_state);
+	auto source_result =
+	    bind_data.info.async_function(ToCFunctionInfo(function_info), reinterpret_cast<duckdb_data_chunk>(&output));
+	if (!function_info.success) {
+		throw InvalidInputException(function_info.error);
+	}
+	switch (source_result) {
+	case DUCKDB_SOURCE_RESULT_FINISHED:
+		return SourceResultType::FINISHED;
+	case DUCKDB_SOURCE_RESULT_BLOCKED:
+		return SourceResultType::BLOCKED;
+	default:
+		return SourceResultType::HAVE_MORE_OUTPUT;
+	}
+}
+
 } // namespace duckdb
 
 //===--------------------------------------------------------------------===//
@@ -308,6 +334,17 @@ void duckdb_table_function_set_function(duckdb_table_function table_function, du
 	info.function = function;
 }
 
+void duckdb_table_function_set_function_async(duckdb_table_function table_function,
+                                              duckdb_table_function_async_t function) {
+	if (!table_function || !function) {
+		return;
+	}
+	auto &tf = GetCTableFunction(table_function);
+	auto &info = tf.function_info->Cast<duckdb::CTableFunctionInfo>();
+	info.async_function = function;
+	tf.async_function = duckdb::CTableFunctionAsync;
+}
+
 void duckdb_table_function_supports_projection_pushdown(duckdb_table_function table_function, bool pushdown) {
 	if (!table_function) {
 		return;
@@ -323,7 +360,7 @@ duckdb_state duckdb_register_table_function(duckdb_connection connection, duckdb
 	auto con = reinterpret_cast<duckdb::Connection *>(connection);
 	auto &tf = GetCTableFunction(function);
 	auto &info = tf.function_info->Cast<duckdb::CTableFunctionInfo>();
-	if (tf.name.empty() || !info.bind || !info.init || !info.function) {
+	if (tf.name.empty() || !info.bind || !info.init || (!info.function && !info.async_function)) {
 		return DuckDBError;
 	}
 	try {
@@ -531,3 +568,19 @@ void duckdb_function_set_error(duckdb_function_info info, const char *error) {
 	function_info.error = error;
 	function_info.success = false;
 }
+
+duckdb_interrupt_state duckdb_function_get_interrupt_state(duckdb_function_info info) {
+	if (!info) {
+		return nullptr;
+	}
+	auto &function_info = GetCFunctionInfo(info);
+	return reinterpret_cast<duckdb_interrupt_state>(function_info.interrupt_state.get());
+}
+
+void duckdb_interrupt_state_callback(duckdb_interrupt_state state) {
+	if (!state) {
+		return;
+	}
+	auto &interrupt_state = *reinterpret_cast<duckdb::InterruptState *>(state);
+	interrupt_state.Callback();
+}
@@ -18,6 +18,8 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
@@ -354,6 +356,11 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #endif
 	}
 
+	if (statement_type == StatementType::SELECT_STATEMENT && db->config.options.enable_result_cache) {
+		// gather the tables the plan reads for the query result cache
+		cache_plan_info = QueryResultCache::AnalyzePlan(*plan);
+	}
+
 	profiler.StartPhase("physical_planner");
 	// now convert logical query plan into a physical query plan
 	PhysicalPlanGenerator physical_planner(*this);
@@ -724,10 +731,32 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
-	// prepare the query for execution
-	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
-	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
 	idx_t parameter_count = !parameters.parameters ? 0 : parameters.parameters->size();
+	// check if a plan for this statement can be reused from the plan cache
+	auto &plan_cache = *ClientData::Get(*this).plan_cache;
+	shared_ptr<PreparedStatementData> prepared;
+	string cache_key;
+	idx_t cache_config_version = 0;
+	bool can_cache = parameter_count == 0 && PlanCache::CanCacheStatement(*this, *statement);
+	if (can_cache) {
+		cache_key = statement->ToString();
+		cache_config_version = DBConfig::GetConfig(*this).config_version;
+		prepared = plan_cache.Lookup(*this, cache_key);
+	}
+	if (!prepared) {
+		unique_ptr<SQLStatement> unbound_statement;
+		if (can_cache) {
+			unbound_statement = statement->Copy();
+		}
+		// prepare the query for execution
+		prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
+		                                   PreparedStatementMode::PREPARE_AND_EXECUTE);
+		if (can_cache && PlanCache::CanCachePlan(*prepared)) {
+			// keep the unbound statement around so the cached plan can be validated for reuse
+			prepared->unbound_statement = std::move(unbound_statement);
+			plan_cache.Store(*this, cache_key, cache_config_version, prepared);
+		}
+	}
 	if (prepared->properties.parameter_count > 0 && parameter_count == 0) {
 		string error_message = StringUtil::Format("Expected %lld parameters, but none were supplied",
 		                                          prepared->properties.parameter_count);
@@ -923,13 +952,37 @@ unique_ptr<QueryResult> ClientContext::Query(const string &query, bool allow_str
 		bool is_last_statement = i + 1 == statements.size();
 		PendingQueryParameters parameters;
 		parameters.allow_stream_result = allow_stream_result && is_last_statement;
-		auto pending_query = PendingQueryInternal(*lock, std::move(statement), parameters);
-		auto has_result = pending_query->properties.return_type == StatementReturnType::QUERY_RESULT;
+
+		// check if this statement can be served from the query result cache
+		string cache_key;
+		idx_t cache_catalog_version = 0;
+		idx_t cache_data_version = 0;
+		bool can_cache = QueryResultCache::CanCacheStatement(*this, *statement);
 		unique_ptr<QueryResult> current_result;
-		if (pending_query->HasError()) {
-			current_result = ErrorResult<MaterializedQueryResult>(pending_query->GetErrorObject());
-		} else {
-			current_result = ExecutePendingQueryInternal(*lock, *pending_query);
+		bool has_result = true;
+		if (can_cache) {
+			// capture the versions before the query transaction begins: if they are unchanged after execution,
+			// the result is known to reflect them and can be stored in the cache
+			auto &manager = DatabaseManager::Get(*this);
+			cache_catalog_version = manager.GetCatalogVersion();
+			cache_data_version = manager.GetDataVersion();
+			cache_key = QueryResultCache::MakeKey(*this, *statement);
+			current_result = db->GetResultCache().Lookup(*this, cache_key);
+		}
+		if (!current_result) {
+			cache_plan_info.reset();
+			auto pending_query = PendingQueryInternal(*lock, std::move(statement), parameters);
+			has_result = pending_query->properties.return_type == StatementReturnType::QUERY_RESULT;
+			if (pending_query->HasError()) {
+				current_result = ErrorResult<MaterializedQueryResult>(pending_query->GetErrorObject());
+			} else {
+				current_result = ExecutePendingQueryInternal(*lock, *pending_query);
+			}
+			if (can_cache && !current_result->HasError() &&
+			    current_result->type == QueryResultType::MATERIALIZED_RESULT) {
+				db->GetResultCache().Store(*this, cache_key, std::move(cache_plan_info), cache_catalog_version,
+				                           cache_data_version, current_result->Cast<MaterializedQueryResult>());
+			}
 		}
 		// now append the result to the list of results
 		if (!last_result || !last_had_result) {
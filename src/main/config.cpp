@@ -57,7 +57,10 @@ bool DBConfigOptions::debug_print_bindings = false;
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
+    DUCKDB_GLOBAL(CheckpointCompressionReuseSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(CompressedBufferTierSizeSetting),
+    DUCKDB_LOCAL(BulkUpdateThreshold),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
     DUCKDB_LOCAL(DebugForceExternal),
@@ -70,6 +73,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DefaultNullOrderSetting),
     DUCKDB_GLOBAL(DisabledFileSystemsSetting),
     DUCKDB_GLOBAL(DisabledOptimizersSetting),
+    DUCKDB_GLOBAL(EnableCardinalityFeedbackSetting),
     DUCKDB_GLOBAL(EnableExternalAccessSetting),
     DUCKDB_GLOBAL(EnableFSSTVectors),
     DUCKDB_GLOBAL(AllowUnsignedExtensionsSetting),
@@ -82,6 +86,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
+    DUCKDB_LOCAL(EnablePlanCacheSetting),
+    DUCKDB_GLOBAL(EnableResultCacheSetting),
+    DUCKDB_GLOBAL(EnableSelectivitySamplingSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
@@ -113,18 +120,23 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
     DUCKDB_LOCAL(PivotLimitSetting),
+    DUCKDB_GLOBAL(PrefetchAllMetadataSetting),
     DUCKDB_LOCAL(PreserveIdentifierCase),
     DUCKDB_GLOBAL(PreserveInsertionOrder),
+    DUCKDB_LOCAL(PrioritySetting),
     DUCKDB_LOCAL(ProfileOutputSetting),
     DUCKDB_LOCAL(ProfilingModeSetting),
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_GLOBAL(ScanPrefetchDepthSetting),
+    DUCKDB_GLOBAL(ScanResistantEvictionSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
@@ -135,6 +147,14 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
     DUCKDB_GLOBAL(FlushAllocatorSetting),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
+    DUCKDB_GLOBAL(AllocatorHugePagesSetting),
+    DUCKDB_GLOBAL(NumaTaskSchedulingSetting),
+    DUCKDB_GLOBAL(WalParallelReplaySetting),
+    DUCKDB_GLOBAL(WalGroupCommitSetting),
+    DUCKDB_GLOBAL(WalCompressionSetting),
+    DUCKDB_GLOBAL(AutomaticVacuumSetting),
+    DUCKDB_GLOBAL(AutomaticStatisticsRefreshSetting),
+    DUCKDB_GLOBAL(WarmRestartSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
@@ -226,6 +246,7 @@ void DBConfig::SetOption(DatabaseInstance *db, const ConfigurationOption &option
 	D_ASSERT(option.reset_global);
 	Value input = value.DefaultCastAs(option.parameter_type);
 	option.set_global(db, *this, input);
+	config_version++;
 }
 
 void DBConfig::ResetOption(DatabaseInstance *db, const ConfigurationOption &option) {
@@ -235,11 +256,13 @@ void DBConfig::ResetOption(DatabaseInstance *db, const ConfigurationOption &opti
 	}
 	D_ASSERT(option.set_global);
 	option.reset_global(db, *this);
+	config_version++;
 }
 
 void DBConfig::SetOption(const string &name, Value value) {
 	lock_guard<mutex> l(config_lock);
 	options.set_variables[name] = std::move(value);
+	config_version++;
 }
 
 void DBConfig::ResetOption(const string &name) {
@@ -254,6 +277,7 @@ void DBConfig::ResetOption(const string &name) {
 		// Otherwise just remove it from the 'set_variables' map
 		options.set_variables.erase(name);
 	}
+	config_version++;
 }
 
 void DBConfig::AddExtensionOption(const string &name, string description, LogicalType parameter,
@@ -12,6 +12,8 @@
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+#include "duckdb/main/sampling_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
@@ -61,6 +63,7 @@ DatabaseInstance::~DatabaseInstance() {
 	GetDatabaseManager().ResetDatabases(scheduler);
 	// destroy child elements
 	connection_manager.reset();
+	result_cache.reset();
 	object_cache.reset();
 	scheduler.reset();
 	db_manager.reset();
@@ -226,6 +229,8 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	result_cache = make_uniq<QueryResultCache>();
+	sampling_profiler = make_uniq<SamplingProfiler>();
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -307,6 +312,14 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryResultCache &DatabaseInstance::GetResultCache() {
+	return *result_cache;
+}
+
+SamplingProfiler &DatabaseInstance::GetSamplingProfiler() {
+	return *sampling_profiler;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -382,8 +395,10 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	if (new_config.buffer_pool) {
 		config.buffer_pool = std::move(new_config.buffer_pool);
 	} else {
-		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
-		                                                 config.options.buffer_manager_track_eviction_timestamps);
+		config.buffer_pool =
+		    make_shared_ptr<BufferPool>(config.options.maximum_memory,
+		                                config.options.buffer_manager_track_eviction_timestamps,
+		                                config.options.scan_resistant_eviction);
 	}
 }
 
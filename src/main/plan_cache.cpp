@@ -0,0 +1,73 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+
+namespace duckdb {
+
+bool PlanCache::CanCacheStatement(ClientContext &context, SQLStatement &statement) {
+	if (!ClientConfig::GetConfig(context).enable_plan_cache) {
+		return false;
+	}
+	// only select statements are cached: anything else either modifies state or is cheap to plan anyway
+	return statement.type == StatementType::SELECT_STATEMENT;
+}
+
+bool PlanCache::CanCachePlan(PreparedStatementData &plan) {
+	auto &properties = plan.properties;
+	if (!plan.plan || !properties.bound_all_parameters || properties.parameter_count > 0) {
+		return false;
+	}
+	if (properties.always_require_rebind) {
+		return false;
+	}
+	return true;
+}
+
+shared_ptr<PreparedStatementData> PlanCache::Lookup(ClientContext &context, const string &key) {
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return nullptr;
+	}
+	auto &entry = it->second;
+	bool valid = entry.config_version == DBConfig::GetConfig(context).config_version;
+	if (valid) {
+		try {
+			valid = !entry.plan->RequireRebind(context, nullptr);
+		} catch (std::exception &) {
+			// validating the plan itself failed (e.g. a referenced database was detached) - plan from scratch
+			valid = false;
+		}
+	}
+	if (!valid) {
+		entries.erase(it);
+		return nullptr;
+	}
+	return entry.plan;
+}
+
+void PlanCache::Store(ClientContext &context, const string &key, idx_t config_version,
+                      shared_ptr<PreparedStatementData> plan) {
+	D_ASSERT(plan->unbound_statement);
+	if (DBConfig::GetConfig(context).config_version != config_version) {
+		// the configuration changed while the statement was being planned
+		return;
+	}
+	if (entries.size() >= MAX_CACHED_PLANS && entries.find(key) == entries.end()) {
+		// the cache is full - evict everything rather than tracking recency
+		entries.clear();
+	}
+	CacheEntry entry;
+	entry.plan = std::move(plan);
+	entry.config_version = config_version;
+	entries[key] = std::move(entry);
+}
+
+void PlanCache::Clear() {
+	entries.clear();
+}
+
+} // namespace duckdb
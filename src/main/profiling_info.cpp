@@ -51,6 +51,16 @@ string ProfilingInfo::GetMetricAsString(MetricsType setting) const {
 		return to_string(metrics.operator_cardinality);
 	case MetricsType::OPERATOR_TIMING:
 		return to_string(metrics.operator_timing);
+	case MetricsType::OPERATOR_INSTRUCTIONS:
+		return to_string(metrics.operator_instructions);
+	case MetricsType::OPERATOR_LLC_MISSES:
+		return to_string(metrics.operator_llc_misses);
+	case MetricsType::OPERATOR_BRANCH_MISSES:
+		return to_string(metrics.operator_branch_misses);
+	case MetricsType::OPERATOR_IO_WAIT:
+		return to_string(metrics.operator_io_wait);
+	case MetricsType::OPERATOR_BUFFER_WAIT:
+		return to_string(metrics.operator_buffer_wait);
 	}
 	return "";
 }
@@ -15,6 +15,8 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 #include <algorithm>
@@ -151,7 +153,12 @@ void QueryProfiler::EndQuery() {
 	main_query.End();
 	if (root && root->GetProfilingInfo().Enabled(MetricsType::OPERATOR_CARDINALITY)) {
 		Finalize(root->GetChild(0)->Cast<OperatorProfilingNode>());
+		if (query_root && DBConfig::GetConfig(context).options.enable_cardinality_feedback) {
+			// feed the observed join cardinalities back to the join order optimizer
+			CardinalityFeedback::Get(context).RecordQuery(*query_root, tree_map);
+		}
 	}
+	query_root = nullptr;
 	this->running = false;
 	// print or output the query profiling after termination
 	// EXPLAIN ANALYSE should not be outputted by the profiler
@@ -246,9 +253,21 @@ void QueryProfiler::EndPhase() {
 OperatorProfiler::OperatorProfiler(ClientContext &context) {
 	enabled = QueryProfiler::Get(context).IsEnabled();
 	settings = ClientConfig::GetConfig(context).profiler_settings;
+	sample_slot = SamplingProfiler::Get(context).RegisterThread();
+	if (enabled && SettingSetFunctions::HardwareCountersEnabled(settings)) {
+		hardware_counters = make_uniq<HardwareCounterProfiler>();
+		if (!hardware_counters->IsSupported()) {
+			hardware_counters.reset();
+		}
+	}
+	wait_times_enabled = enabled && SettingSetFunctions::WaitTimesEnabled(settings);
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
+	// publish the current operator for the sampling profiler - this is always on
+	if (phys_op) {
+		sample_slot->SetActiveOperator(phys_op->type);
+	}
 	if (!enabled) {
 		return;
 	}
@@ -263,9 +282,16 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 	if (SettingEnabled(MetricsType::OPERATOR_TIMING)) {
 		op.Start();
 	}
+	if (hardware_counters) {
+		hardware_counters->Start();
+	}
+	if (wait_times_enabled) {
+		wait_times_baseline = ThreadWaitTimes::Get();
+	}
 }
 
 void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
+	sample_slot->SetActiveOperator(PhysicalOperatorType::INVALID);
 	if (!enabled) {
 		return;
 	}
@@ -289,6 +315,16 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 			curr_operator_info.AddElements(chunk->size());
 		}
 	}
+	if (hardware_counters) {
+		hardware_counters->End();
+		GetOperatorInfo(*active_operator).AddHardwareCounters(hardware_counters->Elapsed());
+	}
+	if (wait_times_enabled) {
+		auto &wait_times = ThreadWaitTimes::Get();
+		GetOperatorInfo(*active_operator)
+		    .AddWaitTimes(wait_times.io_wait - wait_times_baseline.io_wait,
+		                  wait_times.buffer_wait - wait_times_baseline.buffer_wait);
+	}
 	active_operator = nullptr;
 }
 
@@ -330,6 +366,21 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		if (profiler.SettingEnabled(MetricsType::OPERATOR_CARDINALITY)) {
 			tree_node.GetProfilingInfo().metrics.operator_cardinality += node.second.elements;
 		}
+		if (SettingSetFunctions::Enabled(profiler.settings, MetricsType::OPERATOR_INSTRUCTIONS)) {
+			tree_node.GetProfilingInfo().metrics.operator_instructions += node.second.hardware_counters.instructions;
+		}
+		if (SettingSetFunctions::Enabled(profiler.settings, MetricsType::OPERATOR_LLC_MISSES)) {
+			tree_node.GetProfilingInfo().metrics.operator_llc_misses += node.second.hardware_counters.llc_misses;
+		}
+		if (SettingSetFunctions::Enabled(profiler.settings, MetricsType::OPERATOR_BRANCH_MISSES)) {
+			tree_node.GetProfilingInfo().metrics.operator_branch_misses += node.second.hardware_counters.branch_misses;
+		}
+		if (SettingSetFunctions::Enabled(profiler.settings, MetricsType::OPERATOR_IO_WAIT)) {
+			tree_node.GetProfilingInfo().metrics.operator_io_wait += node.second.io_wait;
+		}
+		if (SettingSetFunctions::Enabled(profiler.settings, MetricsType::OPERATOR_BUFFER_WAIT)) {
+			tree_node.GetProfilingInfo().metrics.operator_buffer_wait += node.second.buffer_wait;
+		}
 	}
 	profiler.timings.clear();
 }
@@ -609,6 +660,7 @@ void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
 		return;
 	}
 	query_requires_profiling = false;
+	query_root = root_op;
 	ClientConfig &config = ClientConfig::GetConfig(context);
 	root = CreateTree(root_op, config.profiler_settings, 0);
 	if (!query_requires_profiling) {
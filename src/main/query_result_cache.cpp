@@ -0,0 +1,193 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+bool QueryResultCache::CanCacheStatement(ClientContext &context, SQLStatement &statement) {
+	if (!DBConfig::GetConfig(context).options.enable_result_cache) {
+		return false;
+	}
+	if (statement.type != StatementType::SELECT_STATEMENT) {
+		return false;
+	}
+	// within an explicit transaction the snapshot can be older than the table versions we validate against
+	return context.transaction.IsAutoCommit();
+}
+
+string QueryResultCache::MakeKey(ClientContext &context, SQLStatement &statement) {
+	// the cache is shared by all sessions, so the key must include the search path: the same unqualified table name
+	// can resolve to different tables in sessions with different search paths
+	auto &search_path = *ClientData::Get(context).catalog_search_path;
+	return CatalogSearchEntry::ListToString(search_path.Get()) + "\n" + statement.ToString();
+}
+
+//===--------------------------------------------------------------------===//
+// Plan Analysis
+//===--------------------------------------------------------------------===//
+static bool ExpressionIsCacheable(Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_FUNCTION:
+		if (expr.Cast<BoundFunctionExpression>().function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	case ExpressionClass::BOUND_AGGREGATE:
+		if (expr.Cast<BoundAggregateExpression>().function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	case ExpressionClass::BOUND_WINDOW: {
+		auto &window = expr.Cast<BoundWindowExpression>();
+		if (window.aggregate && window.aggregate->stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	bool cacheable = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		if (!ExpressionIsCacheable(child)) {
+			cacheable = false;
+		}
+	});
+	return cacheable;
+}
+
+static bool OperatorIsCacheable(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.function.name != string("seq_scan")) {
+			// we can only track the versions of base table scans - any other source may change undetected
+			return false;
+		}
+		auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+		auto &table_info = bind_data.table.GetStorage().GetDataTableInfo();
+		if (table_info->IsTemporary()) {
+			// temporary tables are session-local, while the cache is shared by all sessions
+			return false;
+		}
+		tables.push_back(table_info);
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		// sampling is non-deterministic
+		return false;
+	default:
+		break;
+	}
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *child) {
+		if (!ExpressionIsCacheable(**child)) {
+			cacheable = false;
+		}
+	});
+	if (!cacheable) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!OperatorIsCacheable(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<QueryCachePlanInfo> QueryResultCache::AnalyzePlan(LogicalOperator &plan) {
+	auto info = make_uniq<QueryCachePlanInfo>();
+	info->cacheable = OperatorIsCacheable(plan, info->tables);
+	return info;
+}
+
+//===--------------------------------------------------------------------===//
+// Lookup / Store
+//===--------------------------------------------------------------------===//
+static unique_ptr<ColumnDataCollection> CopyCollection(ColumnDataCollection &collection) {
+	auto copy = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), collection.Types());
+	for (auto &chunk : collection.Chunks()) {
+		copy->Append(chunk);
+	}
+	return copy;
+}
+
+unique_ptr<QueryResult> QueryResultCache::Lookup(ClientContext &context, const string &key) {
+	auto &manager = DatabaseManager::Get(context);
+	lock_guard<mutex> guard(lock);
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return nullptr;
+	}
+	auto &entry = it->second;
+	bool valid = entry.catalog_version == manager.GetCatalogVersion();
+	for (idx_t i = 0; valid && i < entry.table_versions.size(); i++) {
+		auto &table_version = entry.table_versions[i];
+		auto table_info = table_version.table_info.lock();
+		valid = table_info && table_info->GetDataVersion() == table_version.data_version;
+	}
+	if (!valid) {
+		entries.erase(it);
+		return nullptr;
+	}
+	auto names = entry.names;
+	return make_uniq<MaterializedQueryResult>(StatementType::SELECT_STATEMENT, entry.properties, std::move(names),
+	                                          CopyCollection(*entry.collection), context.GetClientProperties());
+}
+
+void QueryResultCache::Store(ClientContext &context, const string &key, unique_ptr<QueryCachePlanInfo> plan_info,
+                             idx_t catalog_version, idx_t data_version, MaterializedQueryResult &result) {
+	if (!plan_info || !plan_info->cacheable) {
+		return;
+	}
+	if (result.Collection().SizeInBytes() > MAX_CACHED_RESULT_SIZE) {
+		return;
+	}
+	auto &manager = DatabaseManager::Get(context);
+	if (manager.GetCatalogVersion() != catalog_version || manager.GetDataVersion() != data_version) {
+		// something changed while the query was executing - the result may not reflect the current versions
+		return;
+	}
+	CacheEntry entry;
+	entry.catalog_version = catalog_version;
+	for (auto &table : plan_info->tables) {
+		auto table_info = table.lock();
+		if (!table_info) {
+			return;
+		}
+		entry.table_versions.push_back(CacheTableVersion {table, table_info->GetDataVersion()});
+	}
+	entry.properties = result.properties;
+	entry.names = result.names;
+	entry.collection = CopyCollection(result.Collection());
+
+	lock_guard<mutex> guard(lock);
+	if (entries.size() >= MAX_CACHED_RESULTS && entries.find(key) == entries.end()) {
+		// the cache is full - evict everything rather than tracking recency
+		entries.clear();
+	}
+	entries[key] = std::move(entry);
+}
+
+void QueryResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+}
+
+} // namespace duckdb
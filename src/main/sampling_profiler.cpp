@@ -0,0 +1,98 @@
+#include "duckdb/main/sampling_profiler.hpp"
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+SamplingProfiler::SamplingProfiler() {
+	samples.reserve(SAMPLE_BUFFER_CAPACITY);
+}
+
+SamplingProfiler::~SamplingProfiler() {
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+	}
+	sampling_cv.notify_all();
+	if (sampling_thread) {
+		sampling_thread->join();
+	}
+}
+
+SamplingProfiler &SamplingProfiler::Get(ClientContext &context) {
+	return SamplingProfiler::Get(DatabaseInstance::GetDatabase(context));
+}
+
+SamplingProfiler &SamplingProfiler::Get(DatabaseInstance &db) {
+	return db.GetSamplingProfiler();
+}
+
+shared_ptr<SamplingProfilerSlot> SamplingProfiler::RegisterThread() {
+	lock_guard<mutex> guard(lock);
+	auto slot = make_shared_ptr<SamplingProfilerSlot>(next_thread_id++);
+	slots.push_back(slot);
+	if (!sampling_thread) {
+		// start the sampling thread on the first registration so that idle databases do not pay for it
+		sampling_thread = make_uniq<thread>([this]() { SamplingLoop(); });
+	}
+	return slot;
+}
+
+vector<ProfilingSample> SamplingProfiler::GetSamples() {
+	lock_guard<mutex> guard(lock);
+	vector<ProfilingSample> result;
+	result.reserve(samples.size());
+	if (samples.size() == SAMPLE_BUFFER_CAPACITY) {
+		// the ring buffer has wrapped around - the oldest sample sits at the write position
+		result.insert(result.end(), samples.begin() + NumericCast<int64_t>(sample_offset), samples.end());
+		result.insert(result.end(), samples.begin(), samples.begin() + NumericCast<int64_t>(sample_offset));
+	} else {
+		result.insert(result.end(), samples.begin(), samples.end());
+	}
+	return result;
+}
+
+void SamplingProfiler::CollectSample() {
+	auto time = Timestamp::GetCurrentTimestamp();
+	for (idx_t slot_idx = 0; slot_idx < slots.size(); slot_idx++) {
+		auto slot = slots[slot_idx].lock();
+		if (!slot) {
+			// the owning thread is gone - drop the slot
+			slots.erase_at(slot_idx);
+			slot_idx--;
+			continue;
+		}
+		auto operator_type = slot->active_operator_type.load(std::memory_order_relaxed);
+		if (operator_type == PhysicalOperatorType::INVALID) {
+			// the thread is idle - don't emit a sample
+			continue;
+		}
+		ProfilingSample sample {time, slot->thread_id, operator_type};
+		if (samples.size() < SAMPLE_BUFFER_CAPACITY) {
+			samples.push_back(sample);
+		} else {
+			// the ring buffer is full - overwrite the oldest sample
+			samples[sample_offset] = sample;
+			sample_offset++;
+			if (sample_offset >= SAMPLE_BUFFER_CAPACITY) {
+				sample_offset = 0;
+			}
+		}
+	}
+}
+
+void SamplingProfiler::SamplingLoop() {
+	unique_lock<mutex> guard(lock);
+	while (!shutdown) {
+		sampling_cv.wait_for(guard, std::chrono::milliseconds(SAMPLE_INTERVAL_MS), [&]() { return shutdown; });
+		if (shutdown) {
+			break;
+		}
+		CollectSample();
+	}
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/main/settings.hpp"
 
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -8,11 +9,14 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -95,6 +99,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Checkpoint Compression Reuse
+//===--------------------------------------------------------------------===//
+void CheckpointCompressionReuseSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.checkpoint_compression_reuse = input.GetValue<bool>();
+}
+
+void CheckpointCompressionReuseSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_compression_reuse = DBConfig().options.checkpoint_compression_reuse;
+}
+
+Value CheckpointCompressionReuseSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.checkpoint_compression_reuse);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -414,6 +434,22 @@ Value DisabledOptimizersSetting::GetSetting(const ClientContext &context) {
 	return Value(result);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Cardinality Feedback
+//===--------------------------------------------------------------------===//
+void EnableCardinalityFeedbackSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_cardinality_feedback = input.GetValue<bool>();
+}
+
+void EnableCardinalityFeedbackSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_cardinality_feedback = DBConfig().options.enable_cardinality_feedback;
+}
+
+Value EnableCardinalityFeedbackSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_cardinality_feedback);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable External Access
 //===--------------------------------------------------------------------===//
@@ -614,6 +650,64 @@ Value StorageCompatibilityVersion::GetSetting(const ClientContext &context) {
 	return Value(version_name);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Plan Cache
+//===--------------------------------------------------------------------===//
+void EnablePlanCacheSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.enable_plan_cache = input.GetValue<bool>();
+	if (!config.enable_plan_cache) {
+		ClientData::Get(context).plan_cache->Clear();
+	}
+}
+
+void EnablePlanCacheSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_plan_cache = ClientConfig().enable_plan_cache;
+	ClientData::Get(context).plan_cache->Clear();
+}
+
+Value EnablePlanCacheSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_plan_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Result Cache
+//===--------------------------------------------------------------------===//
+void EnableResultCacheSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_result_cache = input.GetValue<bool>();
+	if (db && !config.options.enable_result_cache) {
+		db->GetResultCache().Clear();
+	}
+}
+
+void EnableResultCacheSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_result_cache = DBConfig().options.enable_result_cache;
+	if (db) {
+		db->GetResultCache().Clear();
+	}
+}
+
+Value EnableResultCacheSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_result_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Selectivity Sampling
+//===--------------------------------------------------------------------===//
+void EnableSelectivitySamplingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_selectivity_sampling = input.GetValue<bool>();
+}
+
+void EnableSelectivitySamplingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_selectivity_sampling = DBConfig().options.enable_selectivity_sampling;
+}
+
+Value EnableSelectivitySamplingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_selectivity_sampling);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable HTTP Metadata Cache
 //===--------------------------------------------------------------------===//
@@ -1107,6 +1201,22 @@ Value ImmediateTransactionModeSetting::GetSetting(const ClientContext &context)
 	return Value::BOOLEAN(config.options.immediate_transaction_mode);
 }
 
+//===--------------------------------------------------------------------===//
+// Compressed Buffer Tier Size
+//===--------------------------------------------------------------------===//
+void CompressedBufferTierSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.compressed_buffer_tier_size = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void CompressedBufferTierSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.compressed_buffer_tier_size = DBConfig().options.compressed_buffer_tier_size;
+}
+
+Value CompressedBufferTierSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.compressed_buffer_tier_size));
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Expression Depth
 //===--------------------------------------------------------------------===//
@@ -1204,6 +1314,23 @@ Value MaximumTempDirectorySize::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Bulk Update Threshold
+//===--------------------------------------------------------------------===//
+void BulkUpdateThreshold::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.bulk_update_threshold = input.GetValue<idx_t>();
+}
+
+void BulkUpdateThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).bulk_update_threshold = ClientConfig().bulk_update_threshold;
+}
+
+Value BulkUpdateThreshold::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.bulk_update_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Merge Join Threshold
 //===--------------------------------------------------------------------===//
@@ -1435,6 +1562,22 @@ Value PreserveInsertionOrder::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.preserve_insertion_order);
 }
 
+//===--------------------------------------------------------------------===//
+// PrefetchAllMetadata
+//===--------------------------------------------------------------------===//
+void PrefetchAllMetadataSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.prefetch_all_metadata = input.GetValue<bool>();
+}
+
+void PrefetchAllMetadataSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.prefetch_all_metadata = DBConfig().options.prefetch_all_metadata;
+}
+
+Value PrefetchAllMetadataSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.prefetch_all_metadata);
+}
+
 //===--------------------------------------------------------------------===//
 // ExportLargeBufferArrow
 //===--------------------------------------------------------------------===//
@@ -1487,6 +1630,39 @@ Value ProduceArrowStringView::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(DBConfig::GetConfig(context).options.produce_arrow_string_views);
 }
 
+//===--------------------------------------------------------------------===//
+// Priority
+//===--------------------------------------------------------------------===//
+void PrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).priority = ClientConfig().priority;
+}
+
+void PrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "low") {
+		ClientConfig::GetConfig(context).priority = QueryPriority::LOW;
+	} else if (parameter == "normal") {
+		ClientConfig::GetConfig(context).priority = QueryPriority::NORMAL;
+	} else if (parameter == "high") {
+		ClientConfig::GetConfig(context).priority = QueryPriority::HIGH;
+	} else {
+		throw ParserException("Unrecognized priority \"%s\", expected either LOW, NORMAL or HIGH", parameter);
+	}
+}
+
+Value PrioritySetting::GetSetting(const ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).priority) {
+	case QueryPriority::LOW:
+		return "low";
+	case QueryPriority::NORMAL:
+		return "normal";
+	case QueryPriority::HIGH:
+		return "high";
+	default:
+		throw InternalException("Unrecognized priority");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Profile Output
 //===--------------------------------------------------------------------===//
@@ -1559,6 +1735,44 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Scan Prefetch Depth
+//===--------------------------------------------------------------------===//
+void ScanPrefetchDepthSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scan_prefetch_depth = input.GetValue<uint64_t>();
+}
+
+void ScanPrefetchDepthSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scan_prefetch_depth = DBConfig().options.scan_prefetch_depth;
+}
+
+Value ScanPrefetchDepthSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.scan_prefetch_depth);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan Resistant Eviction
+//===--------------------------------------------------------------------===//
+void ScanResistantEvictionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scan_resistant_eviction = input.GetValue<bool>();
+	if (db) {
+		db->GetBufferPool().SetScanResistantEviction(config.options.scan_resistant_eviction);
+	}
+}
+
+void ScanResistantEvictionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scan_resistant_eviction = DBConfig().options.scan_resistant_eviction;
+	if (db) {
+		db->GetBufferPool().SetScanResistantEviction(config.options.scan_resistant_eviction);
+	}
+}
+
+Value ScanResistantEvictionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.scan_resistant_eviction);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1643,6 +1857,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1730,6 +1960,142 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Allocator Huge Pages
+//===--------------------------------------------------------------------===//
+void AllocatorHugePagesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.allocator_huge_pages = input.GetValue<bool>();
+	Allocator::SetHugePages(config.options.allocator_huge_pages);
+}
+
+void AllocatorHugePagesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.allocator_huge_pages = DBConfig().options.allocator_huge_pages;
+	Allocator::SetHugePages(config.options.allocator_huge_pages);
+}
+
+Value AllocatorHugePagesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.allocator_huge_pages);
+}
+
+//===--------------------------------------------------------------------===//
+// Wal Parallel Replay
+//===--------------------------------------------------------------------===//
+void WalParallelReplaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_parallel_replay = input.GetValue<bool>();
+}
+
+void WalParallelReplaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_parallel_replay = DBConfig().options.wal_parallel_replay;
+}
+
+Value WalParallelReplaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.wal_parallel_replay);
+}
+
+//===--------------------------------------------------------------------===//
+// Wal Group Commit
+//===--------------------------------------------------------------------===//
+void WalGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = input.GetValue<bool>();
+}
+
+void WalGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WalGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// Wal Compression
+//===--------------------------------------------------------------------===//
+void WalCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_compression = input.GetValue<bool>();
+}
+
+void WalCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_compression = DBConfig().options.wal_compression;
+}
+
+Value WalCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.wal_compression);
+}
+
+//===--------------------------------------------------------------------===//
+// Automatic Vacuum
+//===--------------------------------------------------------------------===//
+void AutomaticVacuumSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.automatic_vacuum = input.GetValue<bool>();
+}
+
+void AutomaticVacuumSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.automatic_vacuum = DBConfig().options.automatic_vacuum;
+}
+
+Value AutomaticVacuumSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.automatic_vacuum);
+}
+
+//===--------------------------------------------------------------------===//
+// Automatic Statistics Refresh
+//===--------------------------------------------------------------------===//
+void AutomaticStatisticsRefreshSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.automatic_statistics_refresh = input.GetValue<bool>();
+}
+
+void AutomaticStatisticsRefreshSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.automatic_statistics_refresh = DBConfig().options.automatic_statistics_refresh;
+}
+
+Value AutomaticStatisticsRefreshSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.automatic_statistics_refresh);
+}
+
+//===--------------------------------------------------------------------===//
+// Warm Restart
+//===--------------------------------------------------------------------===//
+void WarmRestartSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.warm_restart = input.GetValue<bool>();
+}
+
+void WarmRestartSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.warm_restart = DBConfig().options.warm_restart;
+}
+
+Value WarmRestartSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.warm_restart);
+}
+
+//===--------------------------------------------------------------------===//
+// Numa Task Scheduling
+//===--------------------------------------------------------------------===//
+void NumaTaskSchedulingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.numa_task_scheduling = input.GetValue<bool>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetNumaAware(config.options.numa_task_scheduling);
+	}
+}
+
+void NumaTaskSchedulingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.numa_task_scheduling = DBConfig().options.numa_task_scheduling;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetNumaAware(config.options.numa_task_scheduling);
+	}
+}
+
+Value NumaTaskSchedulingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.numa_task_scheduling);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,81 @@
+#include "duckdb/optimizer/count_star_optimizer.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_dummy_scan.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+CountStarOptimizer::CountStarOptimizer(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+bool CountStarOptimizer::CanOptimize(LogicalOperator &op) {
+	if (op.type != LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		return false;
+	}
+	auto &aggr = op.Cast<LogicalAggregate>();
+	if (!aggr.groups.empty() || aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		return false;
+	}
+	if (aggr.expressions.size() != 1) {
+		return false;
+	}
+	auto &expr = *aggr.expressions[0];
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+		return false;
+	}
+	auto &aggregate = expr.Cast<BoundAggregateExpression>();
+	if (aggregate.function.name != "count_star" || aggregate.IsDistinct() || aggregate.filter) {
+		return false;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = aggr.children[0]->Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.table_filters.filters.empty()) {
+		return false;
+	}
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return false;
+	}
+	// the count can only be answered from metadata if there are no transaction-local changes to the table
+	auto &local_storage = LocalStorage::Get(optimizer.context, table->catalog);
+	if (local_storage.Find(table->GetStorage())) {
+		return false;
+	}
+	return true;
+}
+
+unique_ptr<LogicalOperator> CountStarOptimizer::Optimize(unique_ptr<LogicalOperator> op) {
+	if (CanOptimize(*op)) {
+		auto &aggr = op->Cast<LogicalAggregate>();
+		auto &get = aggr.children[0]->Cast<LogicalGet>();
+		auto &storage = get.GetTable()->GetStorage();
+		// count the rows that are visible to our transaction from the row version metadata
+		auto count = storage.GetVisibleRowCount(optimizer.context);
+		// the count is only valid within this transaction: the plan cannot be cached or re-used
+		optimizer.binder.SetAlwaysRequireRebind();
+		// replace the aggregate with a projection of the count over a dummy scan
+		// the projection takes over the table index of the aggregate, so that the bindings of parents remain valid
+		vector<unique_ptr<Expression>> select_list;
+		select_list.push_back(make_uniq<BoundConstantExpression>(Value::BIGINT(NumericCast<int64_t>(count))));
+		auto projection = make_uniq<LogicalProjection>(aggr.aggregate_index, std::move(select_list));
+		projection->children.push_back(make_uniq<LogicalDummyScan>(optimizer.binder.GenerateTableIndex()));
+		return std::move(projection);
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+} // namespace duckdb
@@ -0,0 +1,303 @@
+#include "duckdb/optimizer/eager_aggregation.hpp"
+
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+unique_ptr<LogicalOperator> EagerAggregation::Optimize(unique_ptr<LogicalOperator> op) {
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		op = TryPushAggregate(std::move(op));
+	}
+	// record the column references of this operator only after the (possible) rewrite, so that the map never holds
+	// references into replaced expressions
+	LogicalOperatorVisitor::VisitOperatorExpressions(*op);
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+//! Returns whether the aggregate function can be split into a partial aggregation and a merge aggregation,
+//! and if so, the name of the merge function
+static bool CanSplitAggregate(const BoundAggregateExpression &aggregate, string &merge_name) {
+	if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys) {
+		return false;
+	}
+	auto &name = aggregate.function.name;
+	if (name == "min" || name == "max") {
+		// duplication-insensitive: merging uses the same function
+		merge_name = name;
+		return true;
+	}
+	if (name == "sum" || name == "sum_no_overflow" || name == "count" || name == "count_star") {
+		// partial sums and counts are combined by summing them up
+		merge_name = "sum";
+		return true;
+	}
+	return false;
+}
+
+//! Binds "merge_name" over the given partial aggregate result column
+static unique_ptr<BoundAggregateExpression> BindMergeAggregate(ClientContext &context, const string &merge_name,
+                                                               unique_ptr<Expression> partial_ref) {
+	QueryErrorContext error_context;
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA, merge_name,
+	                                                              error_context);
+	D_ASSERT(func.type == CatalogType::AGGREGATE_FUNCTION_ENTRY);
+
+	vector<LogicalType> types {partial_ref->return_type};
+	ErrorData error;
+	FunctionBinder function_binder(context);
+	auto best_function = function_binder.BindFunction(func.name, func.functions, types, error);
+	if (!best_function.IsValid()) {
+		return nullptr;
+	}
+	auto bound_function = func.functions.GetFunctionByOffset(best_function.GetIndex());
+
+	vector<unique_ptr<Expression>> children;
+	children.push_back(std::move(partial_ref));
+	return function_binder.BindAggregateFunction(bound_function, std::move(children));
+}
+
+unique_ptr<LogicalOperator> EagerAggregation::TryPushAggregate(unique_ptr<LogicalOperator> op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	if (!aggr.grouping_functions.empty() || aggr.grouping_sets.size() > 1) {
+		return op;
+	}
+	if (aggr.grouping_sets.size() == 1 && aggr.grouping_sets[0].size() != aggr.groups.size()) {
+		return op;
+	}
+	if (aggr.groups.empty() || aggr.expressions.empty()) {
+		return op;
+	}
+	// this optimizer should run before statistics propagation, so this should be empty
+	D_ASSERT(aggr.group_stats.empty());
+	if (op->children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return op;
+	}
+	auto &join = op->children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER) {
+		// for non-inner joins the join multiplicity of a row is not determined by the join conditions alone
+		return op;
+	}
+	if (!join.left_projection_map.empty() || !join.right_projection_map.empty()) {
+		return op;
+	}
+
+	unordered_set<idx_t> side_tables[2];
+	LogicalJoin::GetTableReferences(*join.children[0], side_tables[0]);
+	LogicalJoin::GetTableReferences(*join.children[1], side_tables[1]);
+	auto side_of_table = [&](idx_t table_index) {
+		if (side_tables[0].find(table_index) != side_tables[0].end()) {
+			return idx_t(0);
+		}
+		if (side_tables[1].find(table_index) != side_tables[1].end()) {
+			return idx_t(1);
+		}
+		return DConstants::INVALID_INDEX;
+	};
+
+	// all aggregate inputs must be column references of a single join side, and every aggregate function must be
+	// splittable into a partial and a merge aggregation
+	optional_idx aggregate_side;
+	vector<string> merge_names;
+	for (auto &expr : aggr.expressions) {
+		if (expr->type != ExpressionType::BOUND_AGGREGATE) {
+			return op;
+		}
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		string merge_name;
+		if (!CanSplitAggregate(aggregate, merge_name)) {
+			return op;
+		}
+		merge_names.push_back(std::move(merge_name));
+		for (auto &child : aggregate.children) {
+			if (child->type != ExpressionType::BOUND_COLUMN_REF) {
+				return op;
+			}
+			auto side = side_of_table(child->Cast<BoundColumnRefExpression>().binding.table_index);
+			if (side == DConstants::INVALID_INDEX) {
+				return op;
+			}
+			if (aggregate_side.IsValid() && aggregate_side.GetIndex() != side) {
+				return op;
+			}
+			aggregate_side = side;
+		}
+	}
+	if (!aggregate_side.IsValid()) {
+		// only COUNT(*) aggregates: no side to push towards
+		return op;
+	}
+	auto pushdown_side = aggregate_side.GetIndex();
+	if (join.children[pushdown_side]->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		// a (partial) aggregation was already pushed below this join
+		return op;
+	}
+
+	// the groups of the pushdown side must be column references; groups of the other side may be arbitrary expressions
+	vector<idx_t> pushed_groups;
+	column_binding_map_t<idx_t> pushed_group_map;
+	for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+		auto &group = aggr.groups[group_idx];
+		if (group->type == ExpressionType::BOUND_COLUMN_REF) {
+			auto &colref = group->Cast<BoundColumnRefExpression>();
+			auto side = side_of_table(colref.binding.table_index);
+			if (side == DConstants::INVALID_INDEX) {
+				return op;
+			}
+			if (side == pushdown_side) {
+				pushed_group_map[colref.binding] = pushed_groups.size();
+				pushed_groups.push_back(group_idx);
+			}
+			continue;
+		}
+		unordered_set<idx_t> group_tables;
+		LogicalJoin::GetExpressionBindings(*group, group_tables);
+		for (auto &table_index : group_tables) {
+			if (side_of_table(table_index) != 1 - pushdown_side) {
+				return op;
+			}
+		}
+	}
+	if (pushed_groups.empty()) {
+		return op;
+	}
+
+	// the join keys of the pushdown side must be covered by its grouping keys: then all rows within a partial group
+	// have identical join behavior, so they are all duplicated by the same join multiplicity
+	for (auto &cond : join.conditions) {
+		auto &side_expr = pushdown_side == 0 ? *cond.left : *cond.right;
+		if (side_expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return op;
+		}
+		auto &colref = side_expr.Cast<BoundColumnRefExpression>();
+		if (pushed_group_map.find(colref.binding) == pushed_group_map.end()) {
+			return op;
+		}
+	}
+
+	// bind the merge aggregates before modifying the plan, so that a failed binding leaves the plan untouched
+	auto &context = optimizer.GetContext();
+	auto bottom_group_index = optimizer.binder.GenerateTableIndex();
+	auto bottom_aggregate_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<BoundAggregateExpression>> merge_aggregates;
+	bool needs_cast = false;
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		auto &original = aggr.expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		// the partial aggregate is a copy of the original, so its result type equals the original result type
+		auto partial_ref = make_uniq<BoundColumnRefExpression>(original.return_type,
+		                                                       ColumnBinding(bottom_aggregate_index, aggr_idx));
+		auto merge_aggregate = BindMergeAggregate(context, merge_names[aggr_idx], std::move(partial_ref));
+		if (!merge_aggregate) {
+			return op;
+		}
+		merge_aggregate->alias = original.alias;
+		if (merge_aggregate->return_type != original.return_type) {
+			// e.g. COUNT becomes SUM(partial counts), which returns HUGEINT instead of BIGINT:
+			// a projection on top of the merge aggregation casts back to the original type
+			needs_cast = true;
+		}
+		merge_aggregates.push_back(std::move(merge_aggregate));
+	}
+
+	// construct the partial aggregation below the join
+	vector<unique_ptr<Expression>> partial_aggregates;
+	for (auto &expr : aggr.expressions) {
+		partial_aggregates.push_back(expr->Copy());
+	}
+	auto bottom =
+	    make_uniq<LogicalAggregate>(bottom_group_index, bottom_aggregate_index, std::move(partial_aggregates));
+	GroupingSet bottom_grouping_set;
+	for (idx_t pushed_idx = 0; pushed_idx < pushed_groups.size(); pushed_idx++) {
+		bottom->groups.push_back(aggr.groups[pushed_groups[pushed_idx]]->Copy());
+		bottom_grouping_set.insert(pushed_idx);
+	}
+	bottom->grouping_sets.push_back(std::move(bottom_grouping_set));
+	bottom->AddChild(std::move(join.children[pushdown_side]));
+	join.children[pushdown_side] = std::move(bottom);
+
+	// point the join conditions and the grouping keys of the pushdown side at the partial groups
+	for (auto &cond : join.conditions) {
+		auto &side_expr = pushdown_side == 0 ? *cond.left : *cond.right;
+		auto &colref = side_expr.Cast<BoundColumnRefExpression>();
+		colref.binding = ColumnBinding(bottom_group_index, pushed_group_map[colref.binding]);
+	}
+	for (idx_t pushed_idx = 0; pushed_idx < pushed_groups.size(); pushed_idx++) {
+		auto &colref = aggr.groups[pushed_groups[pushed_idx]]->Cast<BoundColumnRefExpression>();
+		colref.binding = ColumnBinding(bottom_group_index, pushed_idx);
+	}
+
+	// replace the aggregates by the merge aggregates over the partial results
+	vector<LogicalType> original_types;
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		original_types.push_back(aggr.expressions[aggr_idx]->return_type);
+		aggr.expressions[aggr_idx] = std::move(merge_aggregates[aggr_idx]);
+	}
+
+	if (!needs_cast) {
+		return op;
+	}
+
+	// the merge aggregation changed some result types: project all aggregate outputs, casting back where needed,
+	// and replace all references to the aggregate with references to the projection
+	auto projection_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> projections;
+	for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+		auto group_ref = make_uniq<BoundColumnRefExpression>(aggr.groups[group_idx]->return_type,
+		                                                     ColumnBinding(aggr.group_index, group_idx));
+		group_ref->alias = aggr.groups[group_idx]->alias;
+		projections.push_back(std::move(group_ref));
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		auto &merge_aggregate = aggr.expressions[aggr_idx];
+		unique_ptr<Expression> aggr_ref = make_uniq<BoundColumnRefExpression>(
+		    merge_aggregate->return_type, ColumnBinding(aggr.aggregate_index, aggr_idx));
+		if (merge_aggregate->return_type != original_types[aggr_idx]) {
+			aggr_ref = BoundCastExpression::AddCastToType(context, std::move(aggr_ref), original_types[aggr_idx]);
+		}
+		aggr_ref->alias = merge_aggregate->alias;
+		projections.push_back(std::move(aggr_ref));
+	}
+
+	// remap the references of all operators above the aggregate
+	for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+		auto it = column_references.find(ColumnBinding(aggr.group_index, group_idx));
+		if (it == column_references.end()) {
+			continue;
+		}
+		for (auto expr : it->second) {
+			expr.get().binding = ColumnBinding(projection_index, group_idx);
+		}
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		auto it = column_references.find(ColumnBinding(aggr.aggregate_index, aggr_idx));
+		if (it == column_references.end()) {
+			continue;
+		}
+		for (auto expr : it->second) {
+			expr.get().binding = ColumnBinding(projection_index, aggr.groups.size() + aggr_idx);
+		}
+	}
+
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(projections));
+	projection->AddChild(std::move(op));
+	return std::move(projection);
+}
+
+unique_ptr<Expression> EagerAggregation::VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) {
+	// add a column reference
+	column_references[expr.binding].push_back(expr);
+	return nullptr;
+}
+
+} // namespace duckdb
@@ -1,4 +1,6 @@
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
@@ -99,6 +101,11 @@ void CardinalityEstimator::InitEquivalentRelations(const vector<unique_ptr<Filte
 	// For each filter, we fill keep track of the index of the equivalent relation set
 	// the left and right relation needs to be added to.
 	for (auto &filter : filter_infos) {
+		if (filter->set.count == 1) {
+			// the filter restricts a single relation beyond its base cardinality, so cardinalities observed for
+			// joins over the unfiltered relation are no longer comparable
+			filtered_relations.insert(filter->set.relations[0]);
+		}
 		if (SingleColumnFilter(*filter)) {
 			// Filter on one relation, (i.e. string or range filter on a column).
 			// Grab the first relation and add it to  the equivalence_relations
@@ -327,6 +334,26 @@ DenomInfo CardinalityEstimator::GetDenominator(JoinRelationSet &set) {
 	return DenomInfo(*subgraphs.at(0).numerator_relations, 1, subgraphs.at(0).denom);
 }
 
+optional_idx CardinalityEstimator::GetFeedbackCardinality(JoinRelationSet &new_set) {
+	if (new_set.count < 2 || !DBConfig::GetConfig(context).options.enable_cardinality_feedback) {
+		return optional_idx();
+	}
+	vector<string> table_names;
+	for (idx_t i = 0; i < new_set.count; i++) {
+		auto entry = relation_table_names.find(new_set.relations[i]);
+		if (entry == relation_table_names.end() || entry->second.empty()) {
+			// not an unfiltered base table relation - no feedback can have been recorded for this set
+			return optional_idx();
+		}
+		if (filtered_relations.find(new_set.relations[i]) != filtered_relations.end()) {
+			// the relation carries a filter: the recorded cardinality does not account for it
+			return optional_idx();
+		}
+		table_names.push_back(entry->second);
+	}
+	return CardinalityFeedback::Get(context).GetObservedCardinality(table_names);
+}
+
 template <>
 double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set) {
 
@@ -334,6 +361,14 @@ double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set
 		return relation_set_2_cardinality[new_set.ToString()].cardinality_before_filters;
 	}
 
+	// prefer the cardinality observed during previous executions of the same join, if there is one
+	auto observed = GetFeedbackCardinality(new_set);
+	if (observed.IsValid()) {
+		double observed_result = (double)observed.GetIndex();
+		relation_set_2_cardinality[new_set.ToString()] = CardinalityHelper(observed_result);
+		return observed_result;
+	}
+
 	// can happen if a table has cardinality 0, or a tdom is set to 0
 	auto denom = GetDenominator(new_set);
 	auto numerator = GetNumerator(denom.numerator_relations);
@@ -374,6 +409,7 @@ void CardinalityEstimator::InitCardinalityEstimatorProps(optional_ptr<JoinRelati
 
 	auto card_helper = CardinalityHelper((double)relation_cardinality);
 	relation_set_2_cardinality[set->ToString()] = card_helper;
+	relation_table_names[set->relations[0]] = stats.qualified_table_name;
 
 	UpdateTotalDomains(set, stats);
 
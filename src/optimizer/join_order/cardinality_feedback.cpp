@@ -0,0 +1,128 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+CardinalityFeedback &CardinalityFeedback::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<CardinalityFeedback>(ObjectType());
+}
+
+string CardinalityFeedback::MakeKey(vector<string> table_names) {
+	// self-joins keep their duplicate entries, so the key is the sorted multiset of table names
+	std::sort(table_names.begin(), table_names.end());
+	return StringUtil::Join(table_names, ",");
+}
+
+bool CardinalityFeedback::PlanTerminatesEarly(const PhysicalOperator &op) {
+	switch (op.type) {
+	case PhysicalOperatorType::LIMIT:
+	case PhysicalOperatorType::STREAMING_LIMIT:
+	case PhysicalOperatorType::LIMIT_PERCENT:
+	case PhysicalOperatorType::TOP_N:
+		return true;
+	default:
+		break;
+	}
+	for (auto &child : op.GetChildren()) {
+		if (PlanTerminatesEarly(child.get())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool CardinalityFeedback::CollectBaseTables(const PhysicalOperator &op, vector<string> &table_names) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!scan.function.get_bind_info) {
+			return false;
+		}
+		if (scan.table_filters && !scan.table_filters->filters.empty()) {
+			// the scan is filtered: the observed cardinality would not be comparable to joins over the
+			// unfiltered table
+			return false;
+		}
+		auto table = scan.function.get_bind_info(scan.bind_data.get()).table;
+		if (!table) {
+			return false;
+		}
+		// qualify the name so that same-named tables in different schemas or catalogs do not collide
+		table_names.push_back(table->ParentCatalog().GetName() + "." + table->ParentSchema().name + "." + table->name);
+		return true;
+	}
+	case PhysicalOperatorType::PROJECTION:
+	case PhysicalOperatorType::HASH_JOIN:
+	case PhysicalOperatorType::NESTED_LOOP_JOIN:
+	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
+	case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
+	case PhysicalOperatorType::CROSS_PRODUCT: {
+		for (auto &child : op.GetChildren()) {
+			if (!CollectBaseTables(child.get(), table_names)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		// filters, aggregates, set operations etc. make the observed cardinality incomparable to a plain join
+		return false;
+	}
+}
+
+void CardinalityFeedback::RecordJoins(const PhysicalOperator &op, const QueryProfiler::TreeMap &tree_map) {
+	switch (op.type) {
+	case PhysicalOperatorType::HASH_JOIN:
+	case PhysicalOperatorType::NESTED_LOOP_JOIN:
+	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
+	case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
+	case PhysicalOperatorType::CROSS_PRODUCT: {
+		vector<string> table_names;
+		if (CollectBaseTables(op, table_names) && table_names.size() >= 2) {
+			auto entry = tree_map.find(op);
+			if (entry != tree_map.end()) {
+				auto observed = entry->second.get().GetProfilingInfo().metrics.operator_cardinality;
+				auto key = MakeKey(std::move(table_names));
+				lock_guard<mutex> guard(lock);
+				if (observed_cardinalities.size() < MAXIMUM_FEEDBACK_ENTRIES ||
+				    observed_cardinalities.find(key) != observed_cardinalities.end()) {
+					observed_cardinalities[key] = observed;
+				}
+			}
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	for (auto &child : op.GetChildren()) {
+		RecordJoins(child.get(), tree_map);
+	}
+}
+
+void CardinalityFeedback::RecordQuery(const PhysicalOperator &root, const QueryProfiler::TreeMap &tree_map) {
+	if (PlanTerminatesEarly(root)) {
+		// part of the plan can cut off execution early - the observed cardinalities would be undercounts
+		return;
+	}
+	RecordJoins(root, tree_map);
+}
+
+optional_idx CardinalityFeedback::GetObservedCardinality(const vector<string> &table_names) {
+	auto key = MakeKey(table_names);
+	lock_guard<mutex> guard(lock);
+	auto entry = observed_cardinalities.find(key);
+	if (entry == observed_cardinalities.end()) {
+		return optional_idx();
+	}
+	return entry->second;
+}
+
+} // namespace duckdb
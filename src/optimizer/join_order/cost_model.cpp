@@ -5,7 +5,7 @@
 namespace duckdb {
 
 CostModel::CostModel(QueryGraphManager &query_graph_manager)
-    : query_graph_manager(query_graph_manager), cardinality_estimator() {
+    : query_graph_manager(query_graph_manager), cardinality_estimator(query_graph_manager.context) {
 }
 
 double CostModel::ComputeCost(DPJoinNode &left, DPJoinNode &right) {
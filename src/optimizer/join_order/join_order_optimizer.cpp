@@ -25,11 +25,10 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOpera
 
 	if (reorderable) {
 		// query graph now has filters and relations
-		auto cost_model = CostModel(query_graph_manager);
+		CostModel cost_model(query_graph_manager);
 
 		// Initialize a plan enumerator.
-		auto plan_enumerator =
-		    PlanEnumerator(query_graph_manager, cost_model, query_graph_manager.GetQueryGraphEdges());
+		PlanEnumerator plan_enumerator(query_graph_manager, cost_model, query_graph_manager.GetQueryGraphEdges());
 
 		// Initialize the leaf/single node plans
 		plan_enumerator.InitLeafPlans();
@@ -36,7 +36,7 @@ bool JoinRelationSet::IsSubset(JoinRelationSet &super, JoinRelationSet &sub) {
 	return false;
 }
 
-JoinRelationSet &JoinRelationSetManager::GetJoinRelation(unsafe_unique_array<idx_t> relations, idx_t count) {
+JoinRelationSet &JoinRelationSetManager::GetJoinRelation(const idx_t *relations, idx_t count) {
 	// now look it up in the tree
 	reference<JoinRelationTreeNode> info(root);
 	for (idx_t i = 0; i < count; i++) {
@@ -51,34 +51,36 @@ JoinRelationSet &JoinRelationSetManager::GetJoinRelation(unsafe_unique_array<idx
 	}
 	// now check if the JoinRelationSet has already been created
 	if (!info.get().relation) {
-		// if it hasn't we need to create it
-		info.get().relation = make_uniq<JoinRelationSet>(std::move(relations), count);
+		// if it hasn't we need to create it - copy the relations into the arena so the set outlives the caller
+		idx_t *arena_relations = nullptr;
+		if (count > 0) {
+			arena_relations = reinterpret_cast<idx_t *>(arena.AllocateAligned(count * sizeof(idx_t)));
+			memcpy(arena_relations, relations, count * sizeof(idx_t));
+		}
+		info.get().relation = &arena.Make<JoinRelationSet>(arena_relations, count);
 	}
 	return *info.get().relation;
 }
 
 //! Create or get a JoinRelationSet from a single node with the given index
 JoinRelationSet &JoinRelationSetManager::GetJoinRelation(idx_t index) {
-	// create a sorted vector of the relations
-	auto relations = make_unsafe_uniq_array<idx_t>(1);
-	relations[0] = index;
-	idx_t count = 1;
-	return GetJoinRelation(std::move(relations), count);
+	return GetJoinRelation(&index, 1);
 }
 
 JoinRelationSet &JoinRelationSetManager::GetJoinRelation(const unordered_set<idx_t> &bindings) {
 	// create a sorted vector of the relations
-	unsafe_unique_array<idx_t> relations = bindings.empty() ? nullptr : make_unsafe_uniq_array<idx_t>(bindings.size());
+	scratch.resize(bindings.size());
 	idx_t count = 0;
 	for (auto &entry : bindings) {
-		relations[count++] = entry;
+		scratch[count++] = entry;
 	}
-	std::sort(relations.get(), relations.get() + count);
-	return GetJoinRelation(std::move(relations), count);
+	std::sort(scratch.begin(), scratch.end());
+	return GetJoinRelation(scratch.data(), count);
 }
 
 JoinRelationSet &JoinRelationSetManager::Union(JoinRelationSet &left, JoinRelationSet &right) {
-	auto relations = make_unsafe_uniq_array<idx_t>(left.count + right.count);
+	scratch.resize(left.count + right.count);
+	auto relations = scratch.data();
 	idx_t count = 0;
 	// move through the left and right relations, eliminating duplicates
 	idx_t i = 0, j = 0;
@@ -110,7 +112,7 @@ JoinRelationSet &JoinRelationSetManager::Union(JoinRelationSet &left, JoinRelati
 			j++;
 		}
 	}
-	return GetJoinRelation(std::move(relations), count);
+	return GetJoinRelation(relations, count);
 }
 
 // JoinRelationSet *JoinRelationSetManager::Difference(JoinRelationSet *left, JoinRelationSet *right) {
@@ -246,6 +246,8 @@ bool RelationManager::ExtractJoinRelations(LogicalOperator &input_op,
 		if (!datasource_filters.empty()) {
 			stats.cardinality =
 			    (idx_t)MaxValue(stats.cardinality * RelationStatisticsHelper::DEFAULT_SELECTIVITY, (double)1);
+			// the relation is filtered, so it cannot be matched against cardinality feedback
+			stats.qualified_table_name.clear();
 		}
 		AddRelation(input_op, parent, stats);
 		return true;
@@ -8,6 +8,9 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/join_order/table_sample_cache.hpp"
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
 
 namespace duckdb {
 
@@ -52,6 +55,54 @@ static ExpressionBinding GetChildColumnBinding(Expression &expr) {
 	return ret;
 }
 
+static bool TryEstimateFilterSelectivity(const TableFilter &filter, const HistogramStatistics &histogram,
+                                         idx_t distinct_count, double &selectivity) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (!constant_filter.constant.type().IsNumeric() || constant_filter.constant.IsNull()) {
+			return false;
+		}
+		auto constant = constant_filter.constant.GetValue<double>();
+		return histogram.TryEstimateSelectivity(constant_filter.comparison_type, constant, distinct_count,
+		                                        selectivity);
+	}
+	case TableFilterType::IS_NULL:
+		selectivity = histogram.GetNullFraction();
+		return true;
+	case TableFilterType::IS_NOT_NULL:
+		selectivity = 1.0 - histogram.GetNullFraction();
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		selectivity = 1;
+		for (auto &child_filter : conjunction.child_filters) {
+			double child_selectivity;
+			if (!TryEstimateFilterSelectivity(*child_filter, histogram, distinct_count, child_selectivity)) {
+				return false;
+			}
+			selectivity *= child_selectivity;
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		selectivity = 0;
+		for (auto &child_filter : conjunction.child_filters) {
+			double child_selectivity;
+			if (!TryEstimateFilterSelectivity(*child_filter, histogram, distinct_count, child_selectivity)) {
+				return false;
+			}
+			selectivity += child_selectivity;
+		}
+		selectivity = MinValue<double>(selectivity, 1);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
 RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientContext &context) {
 	auto return_stats = RelationStats();
 
@@ -64,6 +115,10 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 	if (catalog_table) {
 		name = catalog_table->name;
 		return_stats.table_name = name;
+		if (get.table_filters.filters.empty()) {
+			return_stats.qualified_table_name = catalog_table->ParentCatalog().GetName() + "." +
+			                                    catalog_table->ParentSchema().name + "." + catalog_table->name;
+		}
 	}
 
 	// if we can get the catalog table, then our column statistics will be accurate
@@ -124,6 +179,50 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 			cardinality_after_filters = MaxValue<idx_t>(
 			    NumericCast<idx_t>(base_table_cardinality * RelationStatisticsHelper::DEFAULT_SELECTIVITY), 1U);
 		}
+		if (catalog_table && catalog_table->IsDuckTable()) {
+			// refine the estimate with the histograms gathered by ANALYZE, if the table has been analyzed
+			auto &storage = catalog_table->GetStorage();
+			double histogram_selectivity = 1;
+			bool has_histogram_estimate = false;
+			for (auto &it : get.table_filters.filters) {
+				if (it.first >= get.column_ids.size()) {
+					continue;
+				}
+				auto column_id = get.column_ids[it.first];
+				if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+					continue;
+				}
+				auto histogram = storage.GetHistogram(column_id);
+				if (!histogram) {
+					continue;
+				}
+				idx_t distinct_count = 0;
+				if (get.bind_data && get.function.statistics) {
+					auto filter_stats = get.function.statistics(context, get.bind_data.get(), it.first);
+					if (filter_stats) {
+						distinct_count = filter_stats->GetDistinctCount();
+					}
+				}
+				double filter_selectivity;
+				if (TryEstimateFilterSelectivity(*it.second, *histogram, distinct_count, filter_selectivity)) {
+					histogram_selectivity *= filter_selectivity;
+					has_histogram_estimate = true;
+				}
+			}
+			if (has_histogram_estimate) {
+				cardinality_after_filters = MaxValue<idx_t>(
+				    NumericCast<idx_t>(double(base_table_cardinality) * histogram_selectivity), 1U);
+			}
+		}
+		if (DBConfig::GetConfig(context).options.enable_selectivity_sampling) {
+			// measure the actual selectivity of the pushed-down filters against a sample of the table, which
+			// also captures correlations between the filtered columns that statistics cannot express
+			auto sampled_cardinality =
+			    TableSampleCache::Get(context).EstimateFilteredCardinality(context, get, base_table_cardinality);
+			if (sampled_cardinality.IsValid()) {
+				cardinality_after_filters = sampled_cardinality.GetIndex();
+			}
+		}
 		if (base_table_cardinality == 0) {
 			cardinality_after_filters = 0;
 		}
@@ -199,6 +298,7 @@ void RelationStatisticsHelper::CopyRelationStats(RelationStats &to, const Relati
 	to.column_names = from.column_names;
 	to.cardinality = from.cardinality;
 	to.table_name = from.table_name;
+	to.qualified_table_name = from.qualified_table_name;
 	to.stats_initialized = from.stats_initialized;
 }
 
@@ -0,0 +1,166 @@
+#include "duckdb/optimizer/join_order/table_sample_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/reservoir_sample.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+TableSampleCache &TableSampleCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<TableSampleCache>(ObjectType());
+}
+
+//! Whether the filter can be evaluated against raw sample vectors through ColumnSegment::FilterSelection
+static bool FilterCanBeSampled(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterCanBeSampled(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterCanBeSampled(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+shared_ptr<ColumnDataCollection> TableSampleCache::GetTableSample(ClientContext &context, DuckTableEntry &table) {
+	auto &storage = table.GetStorage();
+	auto data_version = storage.GetDataTableInfo()->GetDataVersion();
+	auto key = table.catalog.GetName() + "." + table.schema.name + "." + table.name;
+	// the cache-wide lock only guards the map itself - the sample is drawn under the per-table lock below, so a
+	// cold large table does not block sampling-based planning of queries over other tables
+	TableSample *table_sample;
+	{
+		lock_guard<mutex> guard(lock);
+		auto &entry = samples[key];
+		if (!entry) {
+			entry = make_uniq<TableSample>();
+		}
+		table_sample = entry.get();
+	}
+	lock_guard<mutex> sample_guard(table_sample->sample_lock);
+	if (table_sample->rows && table_sample->data_version == data_version) {
+		return table_sample->rows;
+	}
+
+	// no sample for the current version of the table - draw a fresh one
+	// this scans the full table once, but the sample is reused until the table is written to again
+	auto types = storage.GetTypes();
+	vector<column_t> column_ids;
+	for (column_t i = 0; i < types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	auto &transaction = DuckTransaction::Get(context, table.catalog);
+	TableScanState scan_state;
+	storage.InitializeScan(transaction, scan_state, column_ids, nullptr);
+
+	ReservoirSample reservoir(SAMPLE_SIZE);
+	DataChunk chunk;
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
+	while (true) {
+		chunk.Reset();
+		storage.Scan(transaction, chunk, scan_state);
+		if (chunk.size() == 0) {
+			break;
+		}
+		reservoir.AddToReservoir(chunk);
+	}
+	reservoir.Finalize();
+
+	auto rows = make_shared_ptr<ColumnDataCollection>(Allocator::DefaultAllocator(), types);
+	while (auto sample_chunk = reservoir.GetChunk()) {
+		if (sample_chunk->size() == 0) {
+			break;
+		}
+		rows->Append(*sample_chunk);
+	}
+	table_sample->data_version = data_version;
+	table_sample->rows = std::move(rows);
+	return table_sample->rows;
+}
+
+optional_idx TableSampleCache::EstimateFilteredCardinality(ClientContext &context, LogicalGet &get,
+                                                           idx_t base_cardinality) {
+	auto catalog_table = get.GetTable();
+	if (!catalog_table || !catalog_table->IsDuckTable()) {
+		return optional_idx();
+	}
+	// resolve the storage column of every filter and make sure we can evaluate all of them on the sample
+	vector<pair<idx_t, reference<TableFilter>>> filters;
+	for (auto &entry : get.table_filters.filters) {
+		if (entry.first >= get.column_ids.size()) {
+			return optional_idx();
+		}
+		auto column_id = get.column_ids[entry.first];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID || !FilterCanBeSampled(*entry.second)) {
+			return optional_idx();
+		}
+		filters.emplace_back(column_id, *entry.second);
+	}
+	if (filters.empty()) {
+		return optional_idx();
+	}
+
+	auto &table = catalog_table->Cast<DuckTableEntry>();
+	// the returned collection is a shared snapshot: a concurrent rebuild of the sample swaps in a new collection
+	// instead of mutating this one
+	auto sample_rows = GetTableSample(context, table);
+	if (!sample_rows || sample_rows->Count() == 0) {
+		return optional_idx();
+	}
+	// evaluate the filter conjunction over the sample, narrowing the selection per filter
+	idx_t sampled_rows = 0;
+	idx_t matching_rows = 0;
+	for (auto &chunk : sample_rows->Chunks()) {
+		auto count = chunk.size();
+		SelectionVector sel(nullptr);
+		idx_t approved_tuple_count = count;
+		for (auto &filter_entry : filters) {
+			if (filter_entry.first >= chunk.ColumnCount()) {
+				return optional_idx();
+			}
+			if (approved_tuple_count == 0) {
+				break;
+			}
+			auto &vector = chunk.data[filter_entry.first];
+			UnifiedVectorFormat vdata;
+			vector.ToUnifiedFormat(count, vdata);
+			ColumnSegment::FilterSelection(sel, vector, vdata, filter_entry.second.get(), count,
+			                               approved_tuple_count);
+		}
+		sampled_rows += count;
+		matching_rows += approved_tuple_count;
+	}
+	if (sampled_rows == 0) {
+		return optional_idx();
+	}
+	auto selectivity = double(matching_rows) / double(sampled_rows);
+	auto estimate = MaxValue<idx_t>(NumericCast<idx_t>(double(base_cardinality) * selectivity), 1U);
+	return MinValue<idx_t>(estimate, base_cardinality);
+}
+
+} // namespace duckdb
@@ -9,12 +9,14 @@
 #include "duckdb/optimizer/common_aggregate_optimizer.hpp"
 #include "duckdb/optimizer/cse_optimizer.hpp"
 #include "duckdb/optimizer/deliminator.hpp"
+#include "duckdb/optimizer/eager_aggregation.hpp"
 #include "duckdb/optimizer/expression_heuristics.hpp"
 #include "duckdb/optimizer/filter_pullup.hpp"
 #include "duckdb/optimizer/filter_pushdown.hpp"
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/regex_range_filter.hpp"
+#include "duckdb/optimizer/count_star_optimizer.hpp"
 #include "duckdb/optimizer/remove_duplicate_groups.hpp"
 #include "duckdb/optimizer/remove_unused_columns.hpp"
 #include "duckdb/optimizer/rule/equal_or_null_simplification.hpp"
@@ -154,6 +156,18 @@ void Optimizer::RunBuiltInOptimizers() {
 		remove.VisitOperator(*plan);
 	});
 
+	// answer COUNT(*) over a bare table scan from table metadata instead of scanning
+	RunOptimizer(OptimizerType::COUNT_STAR, [&]() {
+		CountStarOptimizer count_star(*this);
+		plan = count_star.Optimize(std::move(plan));
+	});
+
+	// Push partial aggregations below joins whose join keys are covered by the grouping keys
+	RunOptimizer(OptimizerType::EAGER_AGGREGATION, [&]() {
+		EagerAggregation eager_aggregation(*this);
+		plan = eager_aggregation.Optimize(std::move(plan));
+	});
+
 	// then we extract common subexpressions inside the different operators
 	RunOptimizer(OptimizerType::COMMON_SUBEXPRESSIONS, [&]() {
 		CommonSubExpressionOptimizer cse_optimizer(binder);
@@ -175,7 +189,7 @@ void Optimizer::RunBuiltInOptimizers() {
 
 	// transform ORDER BY + LIMIT to TopN
 	RunOptimizer(OptimizerType::TOP_N, [&]() {
-		TopN topn;
+		TopN topn(*this);
 		plan = topn.Optimize(std::move(plan));
 	});
 
@@ -2,11 +2,46 @@
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_parameter_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 
 namespace duckdb {
 
+//! Check if the expression references exactly one scanned column of this LogicalGet, and return that column
+static bool FindScanColumnIndex(LogicalGet &get, Expression &expr, optional_idx &column_index) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != get.table_index) {
+			return false;
+		}
+		if (column_index.IsValid() && column_index.GetIndex() != colref.binding.column_index) {
+			// the expression references more than one column
+			return false;
+		}
+		column_index = colref.binding.column_index;
+		return true;
+	}
+	bool can_push = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		if (!FindScanColumnIndex(get, child, column_index)) {
+			can_push = false;
+		}
+	});
+	return can_push;
+}
+
+//! Replace the column references in the expression by references to the filtered column itself
+static void ReplaceScanColumnRefs(unique_ptr<Expression> &expr) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		expr = make_uniq<BoundReferenceExpression>(expr->return_type, 0U);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [](unique_ptr<Expression> &child) { ReplaceScanColumnRefs(child); });
+}
+
 unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperator> op) {
 	D_ASSERT(op->type == LogicalOperatorType::LOGICAL_GET);
 	auto &get = op->Cast<LogicalGet>();
@@ -73,6 +108,35 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperat
 
 	GenerateFilters();
 
+	if (get.function.name == "seq_scan") {
+		//! Push remaining filters that reference a single scanned column into the scan as expression filters:
+		//! they are evaluated while scanning the filtered column, so the other columns only need to fetch the
+		//! rows that survive them
+		for (idx_t i = 0; i < filters.size(); i++) {
+			auto &expr = filters[i]->filter;
+			if (expr->IsVolatile() || expr->HasParameter() || expr->HasSubquery()) {
+				continue;
+			}
+			optional_idx column_index;
+			if (!FindScanColumnIndex(get, *expr, column_index) || !column_index.IsValid()) {
+				continue;
+			}
+			auto column_id = get.column_ids[column_index.GetIndex()];
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				continue;
+			}
+			if (get.table_filters.filters.find(column_id) != get.table_filters.filters.end()) {
+				// the scan can only evaluate an expression filter stand-alone, not nested inside a conjunction
+				// with other filters on the same column - keep the expression in the filter above the scan
+				continue;
+			}
+			auto filter_expr = std::move(expr);
+			ReplaceScanColumnRefs(filter_expr);
+			get.table_filters.PushFilter(column_id, make_uniq<ExpressionFilter>(std::move(filter_expr)));
+			filters.erase_at(i--);
+		}
+	}
+
 	//! Now we try to pushdown the remaining filters to perform zonemap checking
 	return FinishPushdown(std::move(op));
 }
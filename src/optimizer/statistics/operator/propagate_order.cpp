@@ -1,9 +1,90 @@
 
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 namespace duckdb {
 
+//! Returns true if the requested order is already established by the insertion order of the table scanned below.
+//! This requires that order preservation is enabled (so that the scan emits the rows in insertion order), that the
+//! order key resolves to a base table column through order-preserving operators only, and that the column is known
+//! to be sorted in the requested direction (which also implies that it contains no NULLs).
+static bool OrderIsRedundant(ClientContext &context, LogicalOrder &order) {
+	if (!DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		// without order preservation the scan is free to emit row groups in any order
+		return false;
+	}
+	if (!order.projections.empty() || order.orders.size() != 1) {
+		// for multiple order keys the leading key would additionally have to be proven duplicate-free
+		return false;
+	}
+	auto &bound_order = order.orders[0];
+	if (bound_order.type != OrderType::ASCENDING && bound_order.type != OrderType::DESCENDING) {
+		return false;
+	}
+	if (bound_order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto binding = bound_order.expression->Cast<BoundColumnRefExpression>().binding;
+
+	// walk down to the scan, resolving the binding along the way
+	reference<LogicalOperator> child = *order.children[0];
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		switch (child.get().type) {
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			auto &filter = child.get().Cast<LogicalFilter>();
+			if (!filter.projection_map.empty()) {
+				return false;
+			}
+			// filters preserve the scan order and do not change bindings
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child.get().Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index || binding.column_index >= proj.expressions.size()) {
+				return false;
+			}
+			auto &proj_expr = proj.expressions[binding.column_index];
+			if (proj_expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				return false;
+			}
+			binding = proj_expr->Cast<BoundColumnRefExpression>().binding;
+			break;
+		}
+		default:
+			// any other operator may reorder the rows
+			return false;
+		}
+		child = *child.get().children[0];
+	}
+
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || binding.column_index >= get.column_ids.size()) {
+		return false;
+	}
+	auto column_id = get.column_ids[binding.column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return false;
+	}
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return false;
+	}
+	auto &storage = table->GetStorage();
+	if (LocalStorage::Get(context, table->catalog).Find(storage)) {
+		// rows appended by this transaction are not covered by the global table statistics
+		return false;
+	}
+	return storage.IsColumnSorted(column_id, bound_order.type);
+}
+
 unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalOrder &order,
                                                                      unique_ptr<LogicalOperator> &node_ptr) {
 	// first propagate to the child
@@ -13,6 +94,11 @@ unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalOrde
 	for (auto &bound_order : order.orders) {
 		bound_order.stats = PropagateExpression(bound_order.expression);
 	}
+
+	if (OrderIsRedundant(context, order)) {
+		// the child already produces the rows in the requested order - the sort can be elided
+		node_ptr = std::move(order.children[0]);
+	}
 	return std::move(node_stats);
 }
 
@@ -1,12 +1,26 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+//! Late materialization is only worthwhile when few rows survive the Top-N and there are enough payload columns
+//! that dragging them through the sort is more expensive than the join-back
+static constexpr idx_t MAX_LATE_MATERIALIZATION_ROWS = 2048;
+static constexpr idx_t MIN_LATE_MATERIALIZATION_PAYLOAD_COLUMNS = 3;
+
+TopN::TopN(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
 bool TopN::CanOptimize(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
 		auto &limit = op.Cast<LogicalLimit>();
@@ -32,6 +46,125 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+unique_ptr<LogicalOperator> TopN::TryLateMaterialization(unique_ptr<LogicalTopN> topn) {
+	if (topn->limit + topn->offset > MAX_LATE_MATERIALIZATION_ROWS) {
+		return std::move(topn);
+	}
+	// the binder plans the select-list projection(s) between the order modifier and the scan, so walk through the
+	// projection chain to find the base table scan
+	vector<reference<LogicalProjection>> projections;
+	reference<LogicalOperator> current = *topn->children[0];
+	while (current.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projections.push_back(current.get().Cast<LogicalProjection>());
+		current = *current.get().children[0];
+	}
+	if (current.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return std::move(topn);
+	}
+	auto &get = current.get().Cast<LogicalGet>();
+	if (!get.GetTable() || !get.table_filters.filters.empty() || !get.projection_ids.empty()) {
+		// only plain scans of base tables are supported - the key-side scan must see the exact same rows
+		return std::move(topn);
+	}
+	if (projections.empty()) {
+		// the topmost projection is kept above the join-back so that the row id and the key-side columns do not
+		// leak into the operator's output
+		return std::move(topn);
+	}
+	// the sort keys must resolve to plain column references of the scan through every projection level, so we can
+	// re-bind them to the key-side scan
+	vector<idx_t> key_positions;
+	for (auto &order : topn->orders) {
+		reference<Expression> key_expr = *order.expression;
+		bool plain_colref = true;
+		for (auto &projection_ref : projections) {
+			auto &projection = projection_ref.get();
+			if (key_expr.get().type != ExpressionType::BOUND_COLUMN_REF) {
+				plain_colref = false;
+				break;
+			}
+			auto &level_colref = key_expr.get().Cast<BoundColumnRefExpression>();
+			if (level_colref.binding.table_index != projection.table_index) {
+				plain_colref = false;
+				break;
+			}
+			key_expr = *projection.expressions[level_colref.binding.column_index];
+		}
+		if (!plain_colref || key_expr.get().type != ExpressionType::BOUND_COLUMN_REF) {
+			return std::move(topn);
+		}
+		auto &colref = key_expr.get().Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != get.table_index ||
+		    get.column_ids[colref.binding.column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+			return std::move(topn);
+		}
+		key_positions.push_back(colref.binding.column_index);
+	}
+	if (get.column_ids.size() < key_positions.size() + MIN_LATE_MATERIALIZATION_PAYLOAD_COLUMNS) {
+		// not enough payload columns for the rewrite to pay off
+		return std::move(topn);
+	}
+
+	// the Top-N output order must be restored after the join-back: the re-sort runs directly below the topmost
+	// projection, so it orders by the sort keys as bound one level further down - these are exactly the (verified)
+	// column references inside the topmost projection
+	auto &top_projection_op = projections[0].get();
+	vector<BoundOrderByNode> final_orders;
+	for (auto &order : topn->orders) {
+		auto &top_colref = order.expression->Cast<BoundColumnRefExpression>();
+		auto &key_source = *top_projection_op.expressions[top_colref.binding.column_index];
+		final_orders.emplace_back(order.type, order.null_order, key_source.Copy());
+	}
+
+	// build the key-side scan: only the sort key columns plus the row id
+	auto key_index = optimizer.binder.GenerateTableIndex();
+	auto key_get =
+	    make_uniq<LogicalGet>(key_index, get.function, get.bind_data->Copy(), get.returned_types, get.names);
+	for (idx_t key_idx = 0; key_idx < key_positions.size(); key_idx++) {
+		key_get->column_ids.push_back(get.column_ids[key_positions[key_idx]]);
+		// re-bind the order expression to the key-side scan
+		auto &order = topn->orders[key_idx];
+		auto &colref = order.expression->Cast<BoundColumnRefExpression>();
+		order.expression = make_uniq<BoundColumnRefExpression>(colref.return_type, ColumnBinding(key_index, key_idx));
+	}
+	const auto key_row_id_idx = key_get->column_ids.size();
+	key_get->column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+
+	// the payload side keeps the original operators below the topmost projection so that bindings remain valid,
+	// it only additionally emits the row id to join on, forwarded through any intermediate projection levels
+	get.column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	ColumnBinding payload_row_id(get.table_index, get.column_ids.size() - 1);
+	for (idx_t i = projections.size(); i > 1; i--) {
+		auto &projection = projections[i - 1].get();
+		projection.expressions.push_back(make_uniq<BoundColumnRefExpression>(LogicalType::ROW_TYPE, payload_row_id));
+		payload_row_id = ColumnBinding(projection.table_index, projection.expressions.size() - 1);
+	}
+	auto top_projection = std::move(topn->children[0]);
+	auto payload_plan = std::move(top_projection->children[0]);
+
+	// sort only the keys and the row id
+	topn->children[0] = std::move(key_get);
+
+	// join the surviving row ids back into the payload side
+	// the Top-N is the right child so it becomes the (tiny) build side of the hash join
+	auto join = make_uniq<LogicalComparisonJoin>(JoinType::INNER);
+	JoinCondition condition;
+	condition.left = make_uniq<BoundColumnRefExpression>(LogicalType::ROW_TYPE, payload_row_id);
+	condition.right = make_uniq<BoundColumnRefExpression>(LogicalType::ROW_TYPE,
+	                                                      ColumnBinding(key_index, key_row_id_idx));
+	condition.comparison = ExpressionType::COMPARE_EQUAL;
+	join->conditions.push_back(std::move(condition));
+	join->children.push_back(std::move(payload_plan));
+	join->children.push_back(std::move(topn));
+
+	// the join does not preserve the sort order, so re-sort the (at most limit + offset) surviving rows and
+	// restore the topmost projection on top
+	auto order_by = make_uniq<LogicalOrder>(std::move(final_orders));
+	order_by->AddChild(std::move(join));
+	top_projection->children[0] = std::move(order_by);
+	return top_projection;
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -62,7 +195,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
-		op = std::move(topn);
+		op = TryLateMaterialization(std::move(topn));
 
 		// reconstruct all projection nodes above limit operator
 		while (!projections.empty()) {
@@ -175,6 +175,8 @@ void Executor::SchedulePipeline(const shared_ptr<MetaPipeline> &meta_pipeline, S
 void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	auto &events = event_data.events;
 	D_ASSERT(events.empty());
+	// every meta pipeline creates at least four events
+	events.reserve(event_data.meta_pipelines.size() * 4);
 
 	// create all the required pipeline events
 	for (auto &meta_pipeline : event_data.meta_pipelines) {
@@ -357,7 +359,12 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		auto priority = ClientConfig::GetConfig(context).priority;
+		if (!producer || producer->priority != priority) {
+			// creating a producer token allocates queue blocks in the scheduler - recycle it across queries,
+			// only creating a new token when the priority setting of the connection changed
+			this->producer = scheduler.CreateProducer(priority);
+		}
 
 		// build and ready the pipelines
 		PipelineBuildState state;
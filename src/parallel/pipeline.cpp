@@ -87,7 +87,7 @@ bool Pipeline::GetProgress(double &current_percentage, idx_t &source_cardinality
 
 void Pipeline::ScheduleSequentialTask(shared_ptr<Event> &event) {
 	vector<shared_ptr<Task>> tasks;
-	tasks.push_back(make_uniq<PipelineTask>(*this, event));
+	tasks.push_back(make_shared_ptr<PipelineTask>(*this, event));
 	event->SetTasks(std::move(tasks));
 }
 
@@ -174,8 +174,10 @@ bool Pipeline::LaunchScanTasks(shared_ptr<Event> &event, idx_t max_threads) {
 
 	// launch a task for every thread
 	vector<shared_ptr<Task>> tasks;
+	tasks.reserve(max_threads);
 	for (idx_t i = 0; i < max_threads; i++) {
-		tasks.push_back(make_uniq<PipelineTask>(*this, event));
+		// allocate the task and its shared_ptr control block together
+		tasks.push_back(make_shared_ptr<PipelineTask>(*this, event));
 	}
 	event->SetTasks(std::move(tasks));
 	return true;
@@ -1,6 +1,10 @@
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 
 #ifdef DUCKDB_DEBUG_ASYNC_SINK_SOURCE
 #include <thread>
@@ -25,6 +29,7 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 	}
 	local_source_state = pipeline.source->GetLocalSourceState(context, *pipeline.source_state);
 
+	chunk_capacity = ComputeChunkCapacity();
 	intermediate_chunks.reserve(pipeline.operators.size());
 	intermediate_states.reserve(pipeline.operators.size());
 	for (idx_t i = 0; i < pipeline.operators.size(); i++) {
@@ -32,7 +37,7 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 		auto &current_operator = pipeline.operators[i].get();
 
 		auto chunk = make_uniq<DataChunk>();
-		chunk->Initialize(Allocator::Get(context.client), prev_operator.GetTypes());
+		chunk->Initialize(Allocator::Get(context.client), prev_operator.GetTypes(), chunk_capacity);
 		intermediate_chunks.push_back(std::move(chunk));
 
 		auto op_state = current_operator.GetOperatorState(context);
@@ -47,6 +52,35 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 	InitializeChunk(final_chunk);
 }
 
+idx_t PipelineExecutor::ComputeChunkCapacity() {
+	if (pipeline.source->type != PhysicalOperatorType::TABLE_SCAN) {
+		return STANDARD_VECTOR_SIZE;
+	}
+	auto &table_scan = pipeline.source->Cast<PhysicalTableScan>();
+	if (!table_scan.bind_data ||
+	    (table_scan.function.name != "seq_scan" && table_scan.function.name != "index_scan")) {
+		return STANDARD_VECTOR_SIZE;
+	}
+	auto &bind_data = table_scan.bind_data->Cast<TableScanBindData>();
+	if (!bind_data.is_index_scan || bind_data.row_ids.size() >= STANDARD_VECTOR_SIZE) {
+		return STANDARD_VECTOR_SIZE;
+	}
+	auto &local_storage = LocalStorage::Get(context.client, bind_data.table.catalog);
+	if (local_storage.Find(bind_data.table.GetStorage())) {
+		// transaction-local rows are scanned a full vector at a time - keep the default capacity
+		return STANDARD_VECTOR_SIZE;
+	}
+	// the index scan fetches an exact (and small) set of row identifiers: we can narrow the chunks that flow
+	// through the pipeline accordingly, but only if every operator emits at most as many rows as it reads
+	for (auto &op_ref : pipeline.operators) {
+		auto &op = op_ref.get();
+		if (op.type != PhysicalOperatorType::PROJECTION && op.type != PhysicalOperatorType::FILTER) {
+			return STANDARD_VECTOR_SIZE;
+		}
+	}
+	return MaxValue<idx_t>(bind_data.row_ids.size(), 1);
+}
+
 bool PipelineExecutor::TryFlushCachingOperators() {
 	if (!started_flushing) {
 		// Remainder of this method assumes any in process operators are from flushing
@@ -195,6 +229,11 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 			} else {
 				return PipelineExecuteResult::INTERRUPTED;
 			}
+		} else if (!exhausted_source && !next_batch_blocked && AnyOperatorFinished()) {
+			// an operator (e.g. a streaming limit) signalled that it will never need more input
+			// stop pulling from the source - this also stops sibling tasks that poll the same global state
+			FinishProcessing();
+			break;
 		} else if (!exhausted_source || next_batch_blocked) {
 			SourceResultType source_result;
 			if (!next_batch_blocked) {
@@ -257,6 +296,16 @@ OperatorResultType PipelineExecutor::ExecutePush(DataChunk &input) { // LCOV_EXC
 	return ExecutePushInternal(input);
 } // LCOV_EXCL_STOP
 
+bool PipelineExecutor::AnyOperatorFinished() {
+	for (auto &op_ref : pipeline.GetOperators()) {
+		auto &op = op_ref.get();
+		if (op.op_state && op.OperatorFinished(*op.op_state)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void PipelineExecutor::FinishProcessing(int32_t operator_idx) {
 	finished_processing_idx = operator_idx < 0 ? NumericLimits<int32_t>::Maximum() : operator_idx;
 	in_process_operators = stack<idx_t>();
@@ -501,7 +550,7 @@ SourceResultType PipelineExecutor::FetchFromSource(DataChunk &result) {
 
 void PipelineExecutor::InitializeChunk(DataChunk &chunk) {
 	auto &last_op = pipeline.operators.empty() ? *pipeline.source : pipeline.operators.back().get();
-	chunk.Initialize(Allocator::DefaultAllocator(), last_op.GetTypes());
+	chunk.Initialize(Allocator::DefaultAllocator(), last_op.GetTypes(), chunk_capacity);
 }
 
 void PipelineExecutor::StartOperator(PhysicalOperator &op) {
@@ -27,7 +27,7 @@ public:
 void PipelineInitializeEvent::Schedule() {
 	// needs to spawn a task to get the chain of tasks for the query plan going
 	vector<shared_ptr<Task>> tasks;
-	tasks.push_back(make_uniq<PipelineInitializeTask>(*pipeline, shared_from_this()));
+	tasks.push_back(make_shared_ptr<PipelineInitializeTask>(*pipeline, shared_from_this()));
 	SetTasks(std::move(tasks));
 }
 
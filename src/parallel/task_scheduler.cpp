@@ -3,6 +3,10 @@
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -23,6 +27,11 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <fstream>
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -38,24 +47,214 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The NUMA topology of the machine: which CPUs belong to which NUMA node.
+//! When the topology cannot be discovered (or the machine has a single node) there is one node holding all CPUs.
+struct NumaTopology {
+	//! The CPUs that belong to each NUMA node
+	vector<vector<idx_t>> node_cpus;
+	//! Mapping of CPU id to NUMA node
+	vector<idx_t> cpu_to_node;
+
+	idx_t NodeCount() const {
+		return node_cpus.empty() ? 1 : node_cpus.size();
+	}
+
+	idx_t NodeOfCPU(idx_t cpu) const {
+		if (cpu >= cpu_to_node.size()) {
+			return 0;
+		}
+		return cpu_to_node[cpu];
+	}
+
+	static NumaTopology Discover() {
+		NumaTopology result;
+#if defined(__linux__)
+		// parse the NUMA topology from sysfs - each node exposes its CPUs as a list of ranges (e.g. "0-31,64-95")
+		for (idx_t node = 0;; node++) {
+			std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+			if (!cpulist.is_open()) {
+				break;
+			}
+			string line;
+			if (!std::getline(cpulist, line)) {
+				break;
+			}
+			vector<idx_t> cpus;
+			for (auto &range : StringUtil::Split(line, ',')) {
+				auto dash = range.find('-');
+				auto start = std::stoull(range.substr(0, dash));
+				auto end = dash == string::npos ? start : std::stoull(range.substr(dash + 1));
+				for (auto cpu = start; cpu <= end; cpu++) {
+					cpus.push_back(idx_t(cpu));
+				}
+			}
+			result.node_cpus.push_back(std::move(cpus));
+		}
+		if (result.node_cpus.size() < 2) {
+			// single node (or discovery failed) - fall back to a single queue
+			result.node_cpus.clear();
+			return result;
+		}
+		for (idx_t node = 0; node < result.node_cpus.size(); node++) {
+			for (auto cpu : result.node_cpus[node]) {
+				if (cpu >= result.cpu_to_node.size()) {
+					result.cpu_to_node.resize(cpu + 1, 0);
+				}
+				result.cpu_to_node[cpu] = node;
+			}
+		}
+#endif
+		return result;
+	}
+
+	void PinThreadToNode(idx_t node) const {
+#if defined(__linux__)
+		if (node >= node_cpus.size()) {
+			return;
+		}
+		cpu_set_t cpuset;
+		CPU_ZERO(&cpuset);
+		for (auto cpu : node_cpus[node]) {
+			CPU_SET(cpu, &cpuset);
+		}
+		pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#else
+		(void)node;
+#endif
+	}
+};
+
+//! A per-worker-thread task deque: the owning thread pushes and pops at the back (LIFO, cache-friendly),
+//! other threads steal from the front (FIFO, oldest task first)
+struct WorkStealingDeque {
+	mutex lock;
+	deque<shared_ptr<Task>> tasks;
+
+	void PushBack(shared_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(std::move(task));
+	}
+
+	bool PopBack(shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back());
+		tasks.pop_back();
+		return true;
+	}
+
+	bool StealFront(shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front());
+		tasks.pop_front();
+		return true;
+	}
+};
+
+//! The deque of the current thread, if it is a scheduler worker thread
+static thread_local WorkStealingDeque *local_worker_deque = nullptr;
+
+//! The number of priority classes (QueryPriority::LOW/NORMAL/HIGH)
+static constexpr idx_t PRIORITY_CLASS_COUNT = 3;
+//! The share of worker dequeues each priority class gets when all classes have queued tasks, indexed by QueryPriority
+static constexpr idx_t PRIORITY_WEIGHTS[PRIORITY_CLASS_COUNT] = {1, 4, 16};
+//! The sum of the priority weights
+static constexpr idx_t PRIORITY_TICKETS = 21;
+
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	ConcurrentQueue()
+	    : topology(NumaTopology::Discover()), queues(topology.NodeCount() * PRIORITY_CLASS_COUNT), priority_ticket(0) {
+	}
+
+	//! The NUMA topology the queues are laid out over
+	NumaTopology topology;
+	//! One task queue per priority class per NUMA node, indexed via QueueIndex
+	vector<concurrent_queue_t> queues;
+	//! Ticket counter implementing the weighted fair selection of the priority class to serve first
+	atomic<idx_t> priority_ticket;
+	//! The work-stealing deques of the active worker threads
+	vector<WorkStealingDeque *> worker_deques;
+	//! Lock protecting the set of registered worker deques
+	mutex worker_deque_lock;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	void RegisterWorker(WorkStealingDeque &deque_p) {
+		lock_guard<mutex> guard(worker_deque_lock);
+		worker_deques.push_back(&deque_p);
+		local_worker_deque = &deque_p;
+	}
+
+	void UnregisterWorker(WorkStealingDeque &deque_p) {
+		local_worker_deque = nullptr;
+		lock_guard<mutex> guard(worker_deque_lock);
+		worker_deques.erase(std::find(worker_deques.begin(), worker_deques.end(), &deque_p));
+	}
+
+	//! Try to steal a task from another worker's deque (FIFO)
+	bool TrySteal(shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(worker_deque_lock);
+		for (auto &worker : worker_deques) {
+			if (worker == local_worker_deque) {
+				continue;
+			}
+			if (worker->StealFront(task)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, bool numa_aware);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeue a task, preferring the queue of `preferred_node` before scanning the remaining nodes
+	bool TryDequeue(idx_t preferred_node, shared_ptr<Task> &task);
+	//! The NUMA node the calling thread is currently executing on
+	idx_t LocalNode() const;
+	//! The index of the queue of the given priority class on the given NUMA node
+	idx_t QueueIndex(idx_t priority_class, idx_t node) const {
+		return priority_class * topology.NodeCount() + node;
+	}
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, QueryPriority priority) : priority_class(idx_t(priority)) {
+		for (idx_t node = 0; node < queue.topology.NodeCount(); node++) {
+			queue_tokens.push_back(
+			    make_uniq<duckdb_moodycamel::ProducerToken>(queue.queues[queue.QueueIndex(priority_class, node)]));
+		}
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	//! The priority class the producer enqueues into
+	idx_t priority_class;
+	//! One producer token per NUMA node queue of the priority class
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+idx_t ConcurrentQueue::LocalNode() const {
+	if (topology.NodeCount() < 2) {
+		return 0;
+	}
+	return topology.NodeOfCPU(TaskScheduler::GetCurrentCPU());
+}
+
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, bool numa_aware) {
+	if (local_worker_deque) {
+		// scheduled from a worker thread: push onto the worker's own deque (LIFO),
+		// other workers can steal from the front if this worker falls behind
+		local_worker_deque->PushBack(std::move(task));
+		semaphore.signal();
+		return;
+	}
+	// enqueue on the producer's local node so the task is preferentially consumed on the socket that produced it
+	idx_t node = numa_aware ? LocalNode() : 0;
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	auto queue_index = QueueIndex(token.token->priority_class, node);
+	if (queues[queue_index].enqueue(*token.token->queue_tokens[node], std::move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -64,7 +263,55 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	auto local_node = LocalNode();
+	auto node_count = topology.NodeCount();
+	for (idx_t i = 0; i < node_count; i++) {
+		auto node = (local_node + i) % node_count;
+		auto queue_index = QueueIndex(token.token->priority_class, node);
+		if (queues[queue_index].try_dequeue_from_producer(*token.token->queue_tokens[node], task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::TryDequeue(idx_t preferred_node, shared_ptr<Task> &task) {
+	// the worker's own deque first (most recently pushed task, hot in cache)
+	if (local_worker_deque && local_worker_deque->PopBack(task)) {
+		return true;
+	}
+	// weighted fair selection of the priority class to serve first: out of every PRIORITY_TICKETS dequeues,
+	// each class is served first PRIORITY_WEIGHTS[class] times - the other classes are still drained when the
+	// selected class has no queued tasks, so no worker ever idles while tasks are available
+	auto ticket = priority_ticket++ % PRIORITY_TICKETS;
+	idx_t first_class = idx_t(QueryPriority::LOW);
+	for (idx_t priority_class = PRIORITY_CLASS_COUNT; priority_class > 0; priority_class--) {
+		if (ticket < PRIORITY_WEIGHTS[priority_class - 1]) {
+			first_class = priority_class - 1;
+			break;
+		}
+		ticket -= PRIORITY_WEIGHTS[priority_class - 1];
+	}
+	idx_t class_order[PRIORITY_CLASS_COUNT];
+	idx_t class_count = 0;
+	class_order[class_count++] = first_class;
+	for (idx_t priority_class = PRIORITY_CLASS_COUNT; priority_class > 0; priority_class--) {
+		if (priority_class - 1 != first_class) {
+			class_order[class_count++] = priority_class - 1;
+		}
+	}
+	auto node_count = topology.NodeCount();
+	for (idx_t class_idx = 0; class_idx < PRIORITY_CLASS_COUNT; class_idx++) {
+		for (idx_t i = 0; i < node_count; i++) {
+			// scan the local node's queue first, then the other nodes
+			auto node = (preferred_node + i) % node_count;
+			if (queues[QueueIndex(class_order[class_idx], node)].try_dequeue(task)) {
+				return true;
+			}
+		}
+	}
+	// finally, steal from another worker's deque
+	return TrySteal(task);
 }
 
 #else
@@ -72,11 +319,11 @@ struct ConcurrentQueue {
 	std::queue<shared_ptr<Task>> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, bool numa_aware);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, bool numa_aware) {
 	lock_guard<mutex> lock(qlock);
 	q.push(std::move(task));
 }
@@ -92,13 +339,13 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, QueryPriority priority) {
 	}
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, QueryPriority priority)
+    : scheduler(scheduler), token(std::move(token)), priority(priority) {
 }
 
 ProducerToken::~ProducerToken() {
@@ -107,7 +354,8 @@ ProducerToken::~ProducerToken() {
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
-      allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
+      allocator_background_threads(db.config.options.allocator_background_threads),
+      numa_aware(db.config.options.numa_task_scheduling), numa_thread_counter(0), requested_thread_count(0),
       current_thread_count(1) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
@@ -130,14 +378,14 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(QueryPriority priority) {
+	auto token = make_uniq<QueueProducerToken>(*queue, priority);
+	return make_uniq<ProducerToken>(*this, std::move(token), priority);
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queue->Enqueue(token, std::move(task), numa_aware);
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
@@ -149,6 +397,17 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	WorkStealingDeque worker_deque;
+	queue->RegisterWorker(worker_deque);
+	idx_t local_node = 0;
+	if (numa_aware && queue->topology.NodeCount() > 1) {
+		// assign this worker to a NUMA node round-robin and pin it to that node's CPUs,
+		// so that tasks scheduled on a socket are preferentially consumed there
+		local_node = numa_thread_counter++ % queue->topology.NodeCount();
+		queue->topology.PinThreadToNode(local_node);
+	} else {
+		local_node = queue->LocalNode();
+	}
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush() || allocator_background_threads) {
@@ -164,7 +423,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->TryDequeue(local_node, task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -181,7 +440,15 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			}
 		}
 	}
-	// this thread will exit, flush all of its outstanding allocations
+	// this thread will exit: push any tasks left in its deque back onto the global queue so they are not lost
+	queue->UnregisterWorker(worker_deque);
+	while (worker_deque.PopBack(task)) {
+		if (queue->queues[queue->QueueIndex(idx_t(QueryPriority::NORMAL), local_node)].enqueue(std::move(task))) {
+			queue->semaphore.signal();
+		}
+		task.reset();
+	}
+	// flush all of this thread's outstanding allocations
 	if (Allocator::SupportsFlush()) {
 		Allocator::ThreadFlush(0);
 		Allocator::ThreadIdle();
@@ -194,10 +461,11 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	auto local_node = queue->LocalNode();
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->TryDequeue(local_node, task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -225,9 +493,10 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	auto local_node = queue->LocalNode();
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->TryDequeue(local_node, task)) {
 			return;
 		}
 		try {
@@ -292,6 +561,21 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 	Allocator::SetBackgroundThreads(enable);
 }
 
+void TaskScheduler::SetNumaAware(bool enable) {
+	if (numa_aware == enable) {
+		return;
+	}
+	numa_aware = enable;
+#ifndef DUCKDB_NO_THREADS
+	// relaunch the worker threads so they pick up (or drop) their NUMA node assignment and pinning
+	lock_guard<mutex> t(thread_lock);
+	numa_thread_counter = 0;
+	auto n = requested_thread_count.load();
+	RelaunchThreadsInternal(0);
+	RelaunchThreadsInternal(n);
+#endif
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
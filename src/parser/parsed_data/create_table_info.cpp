@@ -26,6 +26,7 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->unlogged = unlogged;
 	return std::move(result);
 }
 
@@ -39,6 +40,9 @@ string CreateTableInfo::ToString() const {
 	if (temporary) {
 		ret += " TEMP";
 	}
+	if (unlogged) {
+		ret += " UNLOGGED";
+	}
 	ret += " TABLE ";
 
 	if (on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT) {
@@ -1,10 +1,13 @@
 #include "duckdb/parser/transformer.hpp"
 
 #include "duckdb/parser/expression/list.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
 #include "duckdb/parser/statement/list.hpp"
-#include "duckdb/parser/tableref/emptytableref.hpp"
+#include "duckdb/parser/tableref/list.hpp"
 #include "duckdb/parser/query_node/select_node.hpp"
 #include "duckdb/parser/query_node/cte_node.hpp"
+#include "duckdb/parser/query_node/recursive_cte_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
 #include "duckdb/parser/parser_options.hpp"
 
 namespace duckdb {
@@ -224,12 +227,129 @@ unique_ptr<SQLStatement> Transformer::TransformStatementInternal(duckdb_libpgque
 	}
 }
 
+static idx_t CountCTEReferences(QueryNode &node, const string &ctename);
+
+static idx_t CountCTEReferences(ParsedExpression &expr, const string &ctename) {
+	idx_t count = 0;
+	if (expr.expression_class == ExpressionClass::SUBQUERY) {
+		count += CountCTEReferences(*expr.Cast<SubqueryExpression>().subquery->node, ctename);
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { count += CountCTEReferences(child, ctename); });
+	return count;
+}
+
+static idx_t CountCTEReferences(TableRef &ref, const string &ctename) {
+	switch (ref.type) {
+	case TableReferenceType::BASE_TABLE: {
+		auto &base_table = ref.Cast<BaseTableRef>();
+		// CTE references are never qualified with a schema
+		return base_table.schema_name.empty() && base_table.table_name == ctename ? 1 : 0;
+	}
+	case TableReferenceType::JOIN: {
+		auto &join = ref.Cast<JoinRef>();
+		idx_t count = CountCTEReferences(*join.left, ctename) + CountCTEReferences(*join.right, ctename);
+		if (join.condition) {
+			count += CountCTEReferences(*join.condition, ctename);
+		}
+		return count;
+	}
+	case TableReferenceType::PIVOT: {
+		auto &pivot = ref.Cast<PivotRef>();
+		idx_t count = CountCTEReferences(*pivot.source, ctename);
+		for (auto &aggregate : pivot.aggregates) {
+			count += CountCTEReferences(*aggregate, ctename);
+		}
+		return count;
+	}
+	case TableReferenceType::SUBQUERY:
+		return CountCTEReferences(*ref.Cast<SubqueryRef>().subquery->node, ctename);
+	case TableReferenceType::TABLE_FUNCTION:
+		return CountCTEReferences(*ref.Cast<TableFunctionRef>().function, ctename);
+	default:
+		return 0;
+	}
+}
+
+//! Count the references to a CTE within the scope of a query node, without checking the node's own CTE map
+static idx_t CountCTEReferencesInScope(QueryNode &node, const string &ctename) {
+	idx_t count = 0;
+	switch (node.type) {
+	case QueryNodeType::RECURSIVE_CTE_NODE: {
+		auto &rcte_node = node.Cast<RecursiveCTENode>();
+		if (rcte_node.ctename == ctename) {
+			// the recursive CTE shadows the name within its own scope
+			return 0;
+		}
+		count += CountCTEReferences(*rcte_node.left, ctename);
+		count += CountCTEReferences(*rcte_node.right, ctename);
+		break;
+	}
+	case QueryNodeType::CTE_NODE: {
+		auto &cte_node = node.Cast<CTENode>();
+		count += CountCTEReferences(*cte_node.query, ctename);
+		if (cte_node.child && cte_node.ctename != ctename) {
+			count += CountCTEReferences(*cte_node.child, ctename);
+		}
+		break;
+	}
+	case QueryNodeType::SELECT_NODE: {
+		auto &select_node = node.Cast<SelectNode>();
+		for (auto &entry : select_node.select_list) {
+			count += CountCTEReferences(*entry, ctename);
+		}
+		for (auto &group : select_node.groups.group_expressions) {
+			count += CountCTEReferences(*group, ctename);
+		}
+		if (select_node.where_clause) {
+			count += CountCTEReferences(*select_node.where_clause, ctename);
+		}
+		if (select_node.having) {
+			count += CountCTEReferences(*select_node.having, ctename);
+		}
+		if (select_node.qualify) {
+			count += CountCTEReferences(*select_node.qualify, ctename);
+		}
+		count += CountCTEReferences(*select_node.from_table, ctename);
+		break;
+	}
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &setop_node = node.Cast<SetOperationNode>();
+		count += CountCTEReferences(*setop_node.left, ctename);
+		count += CountCTEReferences(*setop_node.right, ctename);
+		break;
+	}
+	default:
+		break;
+	}
+	ParsedExpressionIterator::EnumerateQueryNodeModifiers(
+	    node, [&](unique_ptr<ParsedExpression> &child) { count += CountCTEReferences(*child, ctename); });
+	for (auto &kv : node.cte_map.map) {
+		count += CountCTEReferences(*kv.second->query->node, ctename);
+	}
+	return count;
+}
+
+static idx_t CountCTEReferences(QueryNode &node, const string &ctename) {
+	if (node.cte_map.map.contains(ctename)) {
+		// a CTE with the same name in a nested scope shadows the CTE we are counting
+		return 0;
+	}
+	return CountCTEReferencesInScope(node, ctename);
+}
+
 unique_ptr<QueryNode> Transformer::TransformMaterializedCTE(unique_ptr<QueryNode> root) {
 	// Extract materialized CTEs from cte_map
 	vector<unique_ptr<CTENode>> materialized_ctes;
 
 	for (auto &cte : root->cte_map.map) {
 		auto &cte_entry = cte.second;
+		if (cte_entry->materialized == CTEMaterialize::CTE_MATERIALIZE_DEFAULT &&
+		    CountCTEReferencesInScope(*root, cte.first) > 1) {
+			// a CTE that is referenced more than once is materialized once and shared between the consumers,
+			// instead of duplicating its subtree into every reference (opt out with NOT MATERIALIZED)
+			cte_entry->materialized = CTEMaterialize::CTE_MATERIALIZE_ALWAYS;
+		}
 		if (cte_entry->materialized == CTEMaterialize::CTE_MATERIALIZE_ALWAYS) {
 			auto mat_cte = make_uniq<CTENode>();
 			mat_cte->ctename = cte.first;
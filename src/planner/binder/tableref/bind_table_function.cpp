@@ -53,7 +53,7 @@ static TableFunctionBindType GetTableFunctionBindType(TableFunctionCatalogEntry
 		}
 		if (function.in_out_function) {
 			has_in_out_function = true;
-		} else if (function.function || function.bind_replace) {
+		} else if (function.function || function.async_function || function.bind_replace) {
 			has_standard_table_function = true;
 		} else {
 			throw InternalException("Function \"%s\" has neither in_out_function nor function defined",
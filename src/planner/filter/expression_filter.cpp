@@ -0,0 +1,68 @@
+#include "duckdb/planner/filter/expression_filter.hpp"
+
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+
+namespace duckdb {
+
+ExpressionFilter::ExpressionFilter(unique_ptr<Expression> expr_p)
+    : TableFilter(TableFilterType::EXPRESSION_FILTER), expr(std::move(expr_p)) {
+	D_ASSERT(expr);
+	D_ASSERT(expr->return_type == LogicalType::BOOLEAN);
+}
+
+FilterPropagateResult ExpressionFilter::CheckStatistics(BaseStatistics &stats) {
+	// the expression is opaque to the zonemaps - we can never prune based on it
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+static void SetColumnName(Expression &expr, const string &column_name) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		expr.alias = column_name;
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { SetColumnName(child, column_name); });
+}
+
+string ExpressionFilter::ToString(const string &column_name) {
+	// print the expression with the column references rendered as the column name
+	auto expr_copy = expr->Copy();
+	SetColumnName(*expr_copy, column_name);
+	return expr_copy->ToString();
+}
+
+bool ExpressionFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<ExpressionFilter>();
+	return other.expr->Equals(*expr);
+}
+
+idx_t ExpressionFilter::Select(Vector &vector, ExpressionExecutor &executor, SelectionVector &sel,
+                               idx_t &approved_tuple_count) {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	// slice the rows that are still selected into a one-column chunk and evaluate the expression over them
+	DataChunk input;
+	input.InitializeEmpty({vector.GetType()});
+	input.data[0].Reference(vector);
+	input.data[0].Slice(sel, approved_tuple_count);
+	input.SetCardinality(approved_tuple_count);
+
+	SelectionVector true_sel(approved_tuple_count);
+	idx_t true_count = executor.SelectExpression(input, true_sel);
+
+	// "true_sel" indexes into the sliced chunk - map it back onto the original selection vector
+	SelectionVector new_sel(true_count);
+	for (idx_t i = 0; i < true_count; i++) {
+		new_sel.set_index(i, sel.get_index(true_sel.get_index(i)));
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = true_count;
+	return approved_tuple_count;
+}
+
+} // namespace duckdb
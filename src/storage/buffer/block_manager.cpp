@@ -81,6 +81,18 @@ void BlockManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
 	}
 }
 
+vector<block_id_t> BlockManager::GetResidentBlockIds() {
+	lock_guard<mutex> lock(blocks_lock);
+	vector<block_id_t> result;
+	for (auto &entry : blocks) {
+		auto handle = entry.second.lock();
+		if (handle && !handle->IsUnloaded()) {
+			result.push_back(entry.first);
+		}
+	}
+	return result;
+}
+
 MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
@@ -39,6 +39,11 @@ void BufferHandle::Destroy() {
 	node = nullptr;
 }
 
+void BufferHandle::SetRetentionHint(BlockRetentionHint hint) {
+	D_ASSERT(IsValid());
+	handle->SetRetentionHint(hint);
+}
+
 FileBuffer &BufferHandle::GetFileBuffer() {
 	D_ASSERT(node);
 	return *node;
@@ -37,15 +37,38 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
+//! One shard of an eviction queue. The queue and its counters are colocated,
+//! so threads pinned to different CPUs do not ping-pong cache lines.
+struct EvictionShard {
+	EvictionShard() : evict_queue_insertions(0), total_dead_nodes(0) {
+	}
+
+	//! The concurrent queue of this shard
+	eviction_queue_t q;
+	//! Number of insertions into this shard. This guides the schedule for calling PurgeQueue.
+	atomic<idx_t> evict_queue_insertions;
+	//! Dead nodes in this shard. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into the eviction queue.
+	atomic<idx_t> total_dead_nodes;
+};
+
 struct EvictionQueue {
 public:
-	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0) {
+	//! The queue is sharded by CPU so that pins and unpins stay mostly core-local
+	constexpr static idx_t SHARD_COUNT = 8;
+
+public:
+	EvictionQueue() : dequeue_shard(0) {
 	}
 
 public:
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(BufferEvictionNode &&node);
+	//! Re-add a node to the eviction queue without counting it as an insertion
+	void Requeue(BufferEvictionNode &&node);
+	//! Tries to dequeue an element, rotating through the shards.
+	bool TryDequeue(BufferEvictionNode &node);
 	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
 	bool TryDequeueWithLock(BufferEvictionNode &node);
 	//! Garbage collect dead nodes in the eviction queue.
@@ -53,25 +76,30 @@ public:
 	template <typename FN>
 	void IterateUnloadableBlocks(FN fn);
 
-	//! Increment the dead node counter in the purge queue.
+	//! Increment the dead node counter of the current shard.
 	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
+		GetCurrentShard().total_dead_nodes++;
 	}
-	//! Decrement the dead node counter in the purge queue.
+	//! Decrement the dead node counter of the current shard.
 	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
+		GetCurrentShard().total_dead_nodes--;
 	}
 
 private:
-	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
+	//! Returns the shard of the current CPU
+	inline EvictionShard &GetCurrentShard() {
+		return shards[TaskScheduler::GetCurrentCPU() % SHARD_COUNT];
+	}
+	//! Returns the approximate total queue size over all shards
+	idx_t ApproxSize();
+	//! Returns the approximate total number of dead nodes over all shards
+	idx_t ApproxDeadNodes();
+	//! Bulk purge dead nodes from each shard. Then, enqueue those that are still alive.
 	void PurgeIteration(const idx_t purge_size);
 
-public:
-	//! The concurrent queue
-	eviction_queue_t q;
-
 private:
-	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
+	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions.
+	//! The trigger is per shard, so each shard counts INSERT_INTERVAL / SHARD_COUNT insertions.
 	constexpr static idx_t INSERT_INTERVAL = 4096;
 	//! We multiply the base purge size by this value.
 	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
@@ -83,11 +111,10 @@ private:
 	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
 
 private:
-	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
-	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
+	//! The queue shards
+	array<EvictionShard, SHARD_COUNT> shards;
+	//! The next shard to dequeue from during eviction
+	atomic<idx_t> dequeue_shard;
 
 	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
 	//! Only lets a single thread enter the purge phase.
@@ -97,13 +124,44 @@ private:
 };
 
 bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
-	q.enqueue(std::move(node));
-	return ++evict_queue_insertions % INSERT_INTERVAL == 0;
+	auto &shard = GetCurrentShard();
+	shard.q.enqueue(std::move(node));
+	return ++shard.evict_queue_insertions % (INSERT_INTERVAL / SHARD_COUNT) == 0;
+}
+
+void EvictionQueue::Requeue(BufferEvictionNode &&node) {
+	GetCurrentShard().q.enqueue(std::move(node));
+}
+
+bool EvictionQueue::TryDequeue(BufferEvictionNode &node) {
+	const auto start = dequeue_shard++;
+	for (idx_t i = 0; i < SHARD_COUNT; i++) {
+		if (shards[(start + i) % SHARD_COUNT].q.try_dequeue(node)) {
+			return true;
+		}
+	}
+	return false;
 }
 
 bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
 	lock_guard<mutex> lock(purge_lock);
-	return q.try_dequeue(node);
+	return TryDequeue(node);
+}
+
+idx_t EvictionQueue::ApproxSize() {
+	idx_t approx_q_size = 0;
+	for (auto &shard : shards) {
+		approx_q_size += shard.q.size_approx();
+	}
+	return approx_q_size;
+}
+
+idx_t EvictionQueue::ApproxDeadNodes() {
+	idx_t approx_dead_nodes = 0;
+	for (auto &shard : shards) {
+		approx_dead_nodes += shard.total_dead_nodes;
+	}
+	return approx_dead_nodes;
 }
 
 void EvictionQueue::Purge() {
@@ -117,7 +175,7 @@ void EvictionQueue::Purge() {
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = q.size_approx();
+	idx_t approx_q_size = ApproxSize();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -146,14 +204,14 @@ void EvictionQueue::Purge() {
 		PurgeIteration(purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = q.size_approx();
+		approx_q_size = ApproxSize();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
 			break;
 		}
 
-		idx_t approx_dead_nodes = total_dead_nodes;
+		idx_t approx_dead_nodes = ApproxDeadNodes();
 		approx_dead_nodes = approx_dead_nodes > approx_q_size ? approx_q_size : approx_dead_nodes;
 		idx_t approx_alive_nodes = approx_q_size - approx_dead_nodes;
 
@@ -170,31 +228,34 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
+	const idx_t purge_size_per_shard = purge_size / SHARD_COUNT;
 	idx_t previous_purge_size = purge_nodes.size();
-	if (purge_size < previous_purge_size / 2 || purge_size > previous_purge_size) {
-		purge_nodes.resize(purge_size);
+	if (purge_size_per_shard < previous_purge_size / 2 || purge_size_per_shard > previous_purge_size) {
+		purge_nodes.resize(purge_size_per_shard);
 	}
 
-	// bulk purge
-	idx_t actually_dequeued = q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
-
-	// retrieve all alive nodes that have been wrongly dequeued
-	idx_t alive_nodes = 0;
-	for (idx_t i = 0; i < actually_dequeued; i++) {
-		auto &node = purge_nodes[i];
-		auto handle = node.TryGetBlockHandle();
-		if (handle) {
-			q.enqueue(std::move(node));
-			alive_nodes++;
+	for (auto &shard : shards) {
+		// bulk purge
+		idx_t actually_dequeued = shard.q.try_dequeue_bulk(purge_nodes.begin(), purge_size_per_shard);
+
+		// retrieve all alive nodes that have been wrongly dequeued
+		idx_t alive_nodes = 0;
+		for (idx_t i = 0; i < actually_dequeued; i++) {
+			auto &node = purge_nodes[i];
+			auto handle = node.TryGetBlockHandle();
+			if (handle) {
+				shard.q.enqueue(std::move(node));
+				alive_nodes++;
+			}
 		}
-	}
 
-	total_dead_nodes -= actually_dequeued - alive_nodes;
+		shard.total_dead_nodes -= actually_dequeued - alive_nodes;
+	}
 }
 
-BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
+BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, bool scan_resistant_eviction_p)
     : maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
+      scan_resistant_eviction(scan_resistant_eviction_p), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
 	queues.reserve(FILE_BUFFER_TYPE_COUNT);
 	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
@@ -209,6 +270,8 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
+	// the block was just used, so it deserves a fresh second chance in the eviction queue
+	handle->eviction_second_chance = false;
 	auto ts = ++handle->eviction_seq_num;
 	if (track_eviction_timestamps) {
 		handle->lru_timestamp_msec =
@@ -285,6 +348,19 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 	}
 
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+		// grant frequently used blocks a second trip through the queue before unloading them,
+		// so that a single large scan cannot flush the hot set
+		// blocks that an operator has hinted it will access again get the same treatment regardless of
+		// how often they have been used - the executor knows the plan will read them again
+		const bool frequently_used =
+		    scan_resistant_eviction && handle->eviction_seq_num >= SECOND_CHANCE_MIN_UNPINS;
+		const bool will_reaccess = handle->retention_hint == BlockRetentionHint::WILL_REACCESS;
+		if ((frequently_used || will_reaccess) && !handle->eviction_second_chance) {
+			handle->eviction_second_chance = true;
+			queue.Requeue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_seq_num));
+			return true;
+		}
+
 		// hooray, we can unload the block
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
@@ -342,7 +418,7 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 	for (;;) {
 		// get a block to unpin from the queue
 		BufferEvictionNode node;
-		if (!q.try_dequeue(node)) {
+		if (!TryDequeue(node)) {
 			// we could not dequeue any eviction node, so we try one more time,
 			// but more aggressively
 			if (!TryDequeueWithLock(node)) {
@@ -375,6 +451,10 @@ void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
 }
 
+void BufferPool::SetScanResistantEviction(bool enable) {
+	scan_resistant_eviction = enable;
+}
+
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 	lock_guard<mutex> l_lock(limit_lock);
 	// try to evict until the limit is reached
@@ -16,6 +16,10 @@ shared_ptr<BlockHandle> BufferManager::RegisterSmallMemory(const idx_t size) {
 	throw NotImplementedException("This type of BufferManager can not create 'small-memory' blocks");
 }
 
+void BufferManager::PrefetchAsync(vector<shared_ptr<BlockHandle>> handles) {
+	Prefetch(handles);
+}
+
 Allocator &BufferManager::GetBufferAllocator() {
 	throw NotImplementedException("This type of BufferManager does not have an Allocator");
 }
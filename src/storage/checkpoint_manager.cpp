@@ -26,6 +26,8 @@
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
+#include "duckdb/execution/task_error_manager.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
@@ -35,6 +37,12 @@ namespace duckdb {
 
 void ReorderTableEntries(catalog_entry_vector_t &tables);
 
+PreparedTableData::PreparedTableData() {
+}
+
+PreparedTableData::~PreparedTableData() {
+}
+
 SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager,
                                                        CheckpointType checkpoint_type)
     : CheckpointWriter(db), partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT),
@@ -140,7 +148,9 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 
 	//! Set up the writers for the checkpoints
 	metadata_writer = make_uniq<MetadataWriter>(metadata_manager);
-	table_metadata_writer = make_uniq<MetadataWriter>(metadata_manager);
+	// track the blocks the table data writer writes to, so that row groups can remember where their
+	// column pointers were serialized and re-use them if they are unchanged at the next checkpoint
+	table_metadata_writer = make_uniq<MetadataWriter>(metadata_manager, &table_metadata_pointers);
 
 	// get the id of the first meta block
 	auto meta_block = metadata_writer->GetMetaBlockPointer();
@@ -170,6 +180,11 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	    }
 	 */
 	auto catalog_entries = GetCatalogEntries(schemas);
+
+	// write the data of all tables ahead of the catalog serialization, so tables are compressed and written in
+	// parallel instead of one at a time - the metadata pointers are written when the catalog entry is serialized
+	WriteTableDataInParallel(catalog_entries);
+
 	SerializationOptions serialization_options;
 
 	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
@@ -182,6 +197,12 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	});
 	serializer.End();
 
+	// flush the metadata writers of tables that were checkpointed in parallel, and release their table locks
+	for (auto &entry : prepared_tables) {
+		entry.second->table_data_writer->Flush();
+	}
+	prepared_tables.clear();
+
 	metadata_writer->Flush();
 	table_metadata_writer->Flush();
 
@@ -243,10 +264,18 @@ void SingleFileCheckpointReader::LoadFromStorage() {
 		return;
 	}
 
+	auto &config = DBConfig::GetConfig(storage.GetDatabase());
 	if (block_manager.IsRemote()) {
+		// remote file: load all metadata blocks up-front with coalesced reads instead of reading them one-by-one
 		auto metadata_blocks = metadata_manager.GetBlocks();
 		auto &buffer_manager = BufferManager::GetBufferManager(storage.GetDatabase());
 		buffer_manager.Prefetch(metadata_blocks);
+	} else if (config.options.prefetch_all_metadata) {
+		// local file: warm the metadata blocks in the background while the catalog is deserialized, so that both
+		// the catalog load and the lazily deserialized table data (e.g. row group pointers) hit loaded blocks
+		auto metadata_blocks = metadata_manager.GetBlocks();
+		auto &buffer_manager = BufferManager::GetBufferManager(storage.GetDatabase());
+		buffer_manager.PrefetchAsync(std::move(metadata_blocks));
 	}
 
 	// create the MetadataReader to read from the storage
@@ -488,6 +517,157 @@ void CheckpointReader::ReadTableMacro(CatalogTransaction transaction, Deserializ
 	catalog.CreateFunction(transaction, macro_info);
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Table Data Write
+//===--------------------------------------------------------------------===//
+struct TableCheckpointState {
+	TableCheckpointState(SingleFileCheckpointWriter &writer, TaskScheduler &scheduler,
+	                     vector<reference<TableCatalogEntry>> &tables)
+	    : writer(writer), scheduler(scheduler), tables(tables), token(scheduler.CreateProducer()), completed_tasks(0),
+	      total_tasks(0) {
+		prepared.resize(tables.size());
+	}
+
+	SingleFileCheckpointWriter &writer;
+	TaskScheduler &scheduler;
+	vector<reference<TableCatalogEntry>> &tables;
+	//! The prepared table data, one entry per table
+	vector<unique_ptr<PreparedTableData>> prepared;
+
+public:
+	void PushError(ErrorData error) {
+		error_manager.PushError(std::move(error));
+	}
+	bool HasError() {
+		return error_manager.HasError();
+	}
+	void ThrowError() {
+		error_manager.ThrowException();
+	}
+
+	void ScheduleTask(shared_ptr<Task> task) {
+		++total_tasks;
+		scheduler.ScheduleTask(*token, std::move(task));
+	}
+	void FinishTask() {
+		++completed_tasks;
+	}
+	bool TasksFinished() {
+		if (completed_tasks == total_tasks) {
+			return true;
+		}
+		if (HasError()) {
+			return true;
+		}
+		return false;
+	}
+	void CancelTasks() {
+		D_ASSERT(error_manager.HasError());
+		// give every pending task the chance to cancel
+		shared_ptr<Task> task;
+		while (GetTask(task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		}
+		// wait for all active tasks to realize the checkpoint has been canceled
+		while (completed_tasks != total_tasks) {
+		}
+	}
+
+	bool GetTask(shared_ptr<Task> &task) {
+		return scheduler.GetTaskFromProducer(*token, task);
+	}
+
+private:
+	TaskErrorManager error_manager;
+	unique_ptr<ProducerToken> token;
+	atomic<idx_t> completed_tasks;
+	atomic<idx_t> total_tasks;
+};
+
+class TableDataCheckpointTask : public Task {
+public:
+	TableDataCheckpointTask(TableCheckpointState &state, idx_t index) : state(state), index(index) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		(void)mode;
+		D_ASSERT(mode == TaskExecutionMode::PROCESS_ALL);
+		if (state.HasError()) {
+			state.FinishTask();
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		try {
+			ExecuteTask();
+			state.FinishTask();
+			return TaskExecutionResult::TASK_FINISHED;
+		} catch (std::exception &ex) {
+			state.PushError(ErrorData(ex));
+		} catch (...) { // LCOV_EXCL_START
+			state.PushError(ErrorData("Unknown exception while checkpointing table data!"));
+		} // LCOV_EXCL_STOP
+		state.FinishTask();
+		return TaskExecutionResult::TASK_ERROR;
+	}
+
+private:
+	void ExecuteTask() {
+		auto &table = state.tables[index].get();
+		auto &storage = table.GetStorage();
+		auto result = make_uniq<PreparedTableData>();
+		// lock the table against concurrent modification until the checkpoint completes
+		result->table_lock = storage.GetCheckpointLock();
+		// each table writes its row group pointers through its own metadata writer, so the data writes of
+		// different tables can proceed independently
+		result->table_data_writer =
+		    make_uniq<MetadataWriter>(state.writer.GetMetadataManager(), &result->table_metadata_pointers);
+		result->writer = make_uniq<SingleFileTableDataWriter>(state.writer, table, *result->table_data_writer);
+		storage.CheckpointData(*result->writer, result->global_stats);
+		state.prepared[index] = std::move(result);
+	}
+
+private:
+	TableCheckpointState &state;
+	idx_t index;
+};
+
+void SingleFileCheckpointWriter::WriteTableDataInParallel(catalog_entry_vector_t &catalog_entries) {
+	vector<reference<TableCatalogEntry>> tables;
+	for (auto &entry : catalog_entries) {
+		if (entry.get().type == CatalogType::TABLE_ENTRY) {
+			tables.push_back(entry.get().Cast<TableCatalogEntry>());
+		}
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	if (tables.size() < 2 || scheduler.NumberOfThreads() < 2) {
+		// nothing to parallelize - tables are checkpointed while the catalog is serialized
+		return;
+	}
+	TableCheckpointState state(*this, scheduler, tables);
+	for (idx_t table_idx = 0; table_idx < tables.size(); table_idx++) {
+		state.ScheduleTask(make_shared_ptr<TableDataCheckpointTask>(state, table_idx));
+	}
+	// all tasks have been scheduled - execute tasks until we are done
+	do {
+		shared_ptr<Task> task;
+		while (state.GetTask(task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		}
+	} while (!state.TasksFinished());
+	if (state.HasError()) {
+		state.CancelTasks();
+		state.ThrowError();
+	}
+	// flush the partial blocks that the data writes produced - this is single-threaded and must happen
+	// while the table locks are still held
+	partial_block_manager.FlushPartialBlocks();
+	// store the prepared data - WriteTable picks it up when the catalog entries are serialized
+	for (idx_t table_idx = 0; table_idx < tables.size(); table_idx++) {
+		prepared_tables[tables[table_idx].get()] = std::move(state.prepared[table_idx]);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Table Metadata
 //===--------------------------------------------------------------------===//
@@ -495,6 +675,14 @@ void SingleFileCheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer
 	// Write the table metadata
 	serializer.WriteProperty(100, "table", &table);
 
+	auto prepared_entry = prepared_tables.find(table);
+	if (prepared_entry != prepared_tables.end()) {
+		// the table data was already written in parallel - only the finalization info needs to be serialized
+		auto &prepared = *prepared_entry->second;
+		table.GetStorage().FinalizeCheckpoint(*prepared.writer, prepared.global_stats, serializer);
+		return;
+	}
+
 	// Write the table data
 	auto table_lock = table.GetStorage().GetCheckpointLock();
 	if (auto writer = GetTableDataWriter(table)) {
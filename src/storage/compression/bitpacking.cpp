@@ -9,6 +9,7 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -587,11 +588,13 @@ static void ApplyFrameOfReference(T *dst, T frame_of_reference, idx_t size) {
 }
 
 // Based on https://github.com/lemire/FastPFor (Apache License 2.0)
+// The frame of reference is re-applied to every delta in the same pass as the running sum,
+// so DELTA_FOR groups are only traversed once during decompression
 template <class T>
-static T DeltaDecode(T *data, T previous_value, const size_t size) {
+static T DeltaDecode(T *data, T previous_value, const size_t size, const T frame_of_reference) {
 	D_ASSERT(size >= 1);
 
-	data[0] += previous_value;
+	data[0] += previous_value + frame_of_reference;
 
 	const size_t UnrollQty = 4;
 	const size_t sz0 = (size / UnrollQty) * UnrollQty; // equal to 0, if size < UnrollQty
@@ -599,14 +602,14 @@ static T DeltaDecode(T *data, T previous_value, const size_t size) {
 	if (sz0 >= UnrollQty) {
 		T a = data[0];
 		for (; i < sz0 - UnrollQty; i += UnrollQty) {
-			a = data[i] += a;
-			a = data[i + 1] += a;
-			a = data[i + 2] += a;
-			a = data[i + 3] += a;
+			a = data[i] += a + frame_of_reference;
+			a = data[i + 1] += a + frame_of_reference;
+			a = data[i + 2] += a + frame_of_reference;
+			a = data[i + 3] += a + frame_of_reference;
 		}
 	}
 	for (; i != size; ++i) {
-		data[i] += data[i - 1];
+		data[i] += data[i - 1] + frame_of_reference;
 	}
 
 	return data[size - 1];
@@ -747,10 +750,8 @@ public:
 				                                     skip_sign_extend);
 
 				T *decompression_ptr = decompression_buffer + offset_in_compression_group;
-				ApplyFrameOfReference<T_S>(reinterpret_cast<T_S *>(decompression_ptr),
-				                           static_cast<T_S>(current_frame_of_reference), skipping_this_algorithm_group);
 				DeltaDecode<T_S>(reinterpret_cast<T_S *>(decompression_ptr), static_cast<T_S>(current_delta_offset),
-				                 skipping_this_algorithm_group);
+				                 skipping_this_algorithm_group, static_cast<T_S>(current_frame_of_reference));
 				current_delta_offset = decompression_ptr[skipping_this_algorithm_group - 1];
 
 				skipped += skipping_this_algorithm_group;
@@ -853,10 +854,9 @@ void BitpackingScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t
 		}
 
 		if (scan_state.current_group.mode == BitpackingMode::DELTA_FOR) {
-			ApplyFrameOfReference<T_S>(reinterpret_cast<T_S *>(current_result_ptr),
-			                           static_cast<T_S>(scan_state.current_frame_of_reference), to_scan);
 			DeltaDecode<T_S>(reinterpret_cast<T_S *>(current_result_ptr),
-			                 static_cast<T_S>(scan_state.current_delta_offset), to_scan);
+			                 static_cast<T_S>(scan_state.current_delta_offset), to_scan,
+			                 static_cast<T_S>(scan_state.current_frame_of_reference));
 			scan_state.current_delta_offset = current_result_ptr[to_scan - 1];
 		} else {
 			ApplyFrameOfReference<T>(current_result_ptr, scan_state.current_frame_of_reference, to_scan);
@@ -938,16 +938,141 @@ void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_c
 	scan_state.Skip(segment, skip_count);
 }
 
+//===--------------------------------------------------------------------===//
+// Zonemap Pruning
+//===--------------------------------------------------------------------===//
+template <class T>
+static bool GroupCanMatch(const ExpressionType comparison_type, const T group_min, const T group_max,
+                          const T constant) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return constant >= group_min && constant <= group_max;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return !(group_min == group_max && group_min == constant);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return group_max > constant;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return group_max >= constant;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return group_min < constant;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return group_min <= constant;
+	default:
+		return true;
+	}
+}
+
+//! Computes conservative bounds for a metadata group from the group metadata alone, without unpacking any values
+//! Returns false if the bounds cannot be computed cheaply (i.e. for DELTA_FOR groups)
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+static bool GroupBounds(bitpacking_metadata_t group, data_ptr_t group_ptr, idx_t group_rows, T &group_min,
+                        T &group_max) {
+	switch (group.mode) {
+	case BitpackingMode::CONSTANT:
+		group_min = Load<T>(group_ptr);
+		group_max = group_min;
+		return true;
+	case BitpackingMode::CONSTANT_DELTA: {
+		auto frame_of_reference = Load<T>(group_ptr);
+		auto constant = Load<T>(group_ptr + sizeof(T));
+		// the values are monotonic in the constant delta: the bounds are the two endpoints
+		// intended static casts to unsigned and back for defined wrapping of integers
+		idx_t multiplier = group_rows - 1;
+		T last = static_cast<T>((static_cast<T_U>(constant) * multiplier) + static_cast<T_U>(frame_of_reference));
+		group_min = MinValue(frame_of_reference, last);
+		group_max = MaxValue(frame_of_reference, last);
+		return true;
+	}
+	case BitpackingMode::FOR: {
+		auto frame_of_reference = Load<T>(group_ptr);
+		auto width = static_cast<bitpacking_width_t>(Load<T>(group_ptr + sizeof(T)));
+		if (width >= sizeof(T) * 8) {
+			return false;
+		}
+		// the packed values lie in [0, 2^width), bounding the group by [FOR, FOR + 2^width - 1]
+		T_U range = (static_cast<T_U>(1) << width) - 1;
+		T upper_bound = static_cast<T>(static_cast<T_U>(frame_of_reference) + range);
+		if (upper_bound < frame_of_reference) {
+			// the conservative upper bound overflowed
+			return false;
+		}
+		group_min = frame_of_reference;
+		group_max = upper_bound;
+		return true;
+	}
+	default:
+		// DELTA_FOR: computing bounds would require decoding the deltas
+		return false;
+	}
+}
+
+template <class T>
+idx_t BitpackingZonemapPrune(ColumnSegment &segment, ColumnScanState &state, TableFilter &filter) {
+	if (filter.filter_type != TableFilterType::CONSTANT_COMPARISON) {
+		return 0;
+	}
+	auto &constant_filter = filter.Cast<ConstantFilter>();
+	if (constant_filter.constant.IsNull()) {
+		return 0;
+	}
+	T constant = constant_filter.constant.GetValueUnsafe<T>();
+
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	data_ptr_t base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto bitpacking_metadata_offset = Load<idx_t>(base_ptr);
+
+	// walk the metadata groups from the current scan position, pruning as long as the group bounds
+	// exclude any matches for the filter - the values of excluded groups are never unpacked
+	idx_t position = segment.GetRelativeIndex(state.row_index);
+	idx_t pruned = 0;
+	while (position + pruned < segment.count) {
+		idx_t group_idx = (position + pruned) / BITPACKING_METADATA_GROUP_SIZE;
+		idx_t group_end = MinValue<idx_t>((group_idx + 1) * BITPACKING_METADATA_GROUP_SIZE, segment.count);
+		auto group = DecodeMeta(reinterpret_cast<bitpacking_metadata_encoded_t *>(
+		    base_ptr + bitpacking_metadata_offset - (group_idx + 1) * sizeof(bitpacking_metadata_encoded_t)));
+
+		T group_min, group_max;
+		idx_t group_rows = group_end - group_idx * BITPACKING_METADATA_GROUP_SIZE;
+		if (!GroupBounds<T>(group, base_ptr + group.offset, group_rows, group_min, group_max)) {
+			break;
+		}
+		if (GroupCanMatch<T>(constant_filter.comparison_type, group_min, group_max, constant)) {
+			break;
+		}
+		pruned = group_end - position;
+	}
+	return pruned;
+}
+
+template <class T>
+static typename std::enable_if<std::is_integral<T>::value, compression_zonemap_prune_t>::type
+GetBitpackingZonemapPrune(PhysicalType data_type) {
+	if (data_type == PhysicalType::BOOL || data_type == PhysicalType::LIST) {
+		// the filter constant cannot be interpreted as the native integer type
+		return nullptr;
+	}
+	return BitpackingZonemapPrune<T>;
+}
+
+template <class T>
+static typename std::enable_if<!std::is_integral<T>::value, compression_zonemap_prune_t>::type
+GetBitpackingZonemapPrune(PhysicalType data_type) {
+	// hugeint arithmetic is not supported by the pruning hook
+	return nullptr;
+}
+
 //===--------------------------------------------------------------------===//
 // Get Function
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
-	                           BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
-	                           BitpackingInitCompression<T, WRITE_STATISTICS>, BitpackingCompress<T, WRITE_STATISTICS>,
-	                           BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
-	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	CompressionFunction function(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
+	                             BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
+	                             BitpackingInitCompression<T, WRITE_STATISTICS>, BitpackingCompress<T, WRITE_STATISTICS>,
+	                             BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
+	                             BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	function.zonemap_prune = GetBitpackingZonemapPrune<T>(data_type);
+	return function;
 }
 
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
@@ -440,7 +440,9 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 //===--------------------------------------------------------------------===//
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
+	//! The dictionary vector, materialized on the first dictionary vector emission of the scan
 	buffer_ptr<Vector> dictionary;
+	uint32_t index_buffer_count;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
@@ -454,25 +456,31 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto baseptr = state->handle.Ptr() + segment.GetBlockOffset();
 
 	// Load header values
-	auto dict = DictionaryCompressionStorage::GetDictionary(segment, state->handle);
 	auto header_ptr = reinterpret_cast<dictionary_compression_header_t *>(baseptr);
-	auto index_buffer_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->index_buffer_offset));
-	auto index_buffer_count = Load<uint32_t>(data_ptr_cast(&header_ptr->index_buffer_count));
+	state->index_buffer_count = Load<uint32_t>(data_ptr_cast(&header_ptr->index_buffer_count));
 	state->current_width = (bitpacking_width_t)(Load<uint32_t>(data_ptr_cast(&header_ptr->bitpacking_width)));
 
-	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
+	// The dictionary vector is only materialized when the scan emits dictionary vectors: scans that
+	// go through the flat path (filtered scans, fetches, non-aligned reads) fetch strings directly
+	return std::move(state);
+}
 
-	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
-	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
+static Vector &MaterializeDictionaryVector(ColumnSegment &segment, CompressedStringScanState &scan_state,
+                                           data_ptr_t baseptr, StringDictionaryContainer dict,
+                                           uint32_t *index_buffer_ptr) {
+	if (scan_state.dictionary) {
+		return *scan_state.dictionary;
+	}
+	scan_state.dictionary = make_buffer<Vector>(segment.type, scan_state.index_buffer_count);
+	auto dict_child_data = FlatVector::GetData<string_t>(*(scan_state.dictionary));
 
-	for (uint32_t i = 0; i < index_buffer_count; i++) {
+	for (uint32_t i = 0; i < scan_state.index_buffer_count; i++) {
 		// NOTE: the passing of dict_child_vector, will not be used, its for big strings
-		uint16_t str_len = GetStringLength(index_buffer_ptr, i);
-		dict_child_data[i] =
-		    FetchStringFromDict(segment, dict, baseptr, UnsafeNumericCast<int32_t>(index_buffer_ptr[i]), str_len);
+		uint16_t str_len = DictionaryCompressionStorage::GetStringLength(index_buffer_ptr, i);
+		dict_child_data[i] = DictionaryCompressionStorage::FetchStringFromDict(
+		    segment, dict, baseptr, UnsafeNumericCast<int32_t>(index_buffer_ptr[i]), str_len);
 	}
-
-	return std::move(state);
+	return *scan_state.dictionary;
 }
 
 //===--------------------------------------------------------------------===//
@@ -545,7 +553,8 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 
 		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		auto &dictionary = MaterializeDictionaryVector(segment, scan_state, baseptr, dict, index_buffer_ptr);
+		result.Slice(dictionary, *scan_state.sel_vec, scan_count);
 	}
 }
 
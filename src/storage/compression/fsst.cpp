@@ -623,19 +623,55 @@ void FSSTStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &sta
 			FSSTVector::SetCount(result, scan_count);
 		}
 	} else {
-		// Just decompress
+		// batch decompression: decompress all scanned strings back-to-back into the scratch buffer
+		// and materialize them with a single string heap allocation,
+		// instead of going through a separate buffer-and-copy round trip per string
+		idx_t total_compressed_size = 0;
+		for (idx_t i = 0; i < scan_count; i++) {
+			total_compressed_size += bitunpack_buffer[i + offsets.scan_offset];
+		}
+		// a single FSST symbol expands to at most 8 bytes
+		idx_t required_size = total_compressed_size * 8 + 1;
+		if (scan_state.decompress_buffer.size() < required_size) {
+			scan_state.decompress_buffer.resize(required_size);
+		}
+		auto decompress_ptr = scan_state.decompress_buffer.data();
+		auto decoder = reinterpret_cast<duckdb_fsst_decoder_t *>(scan_state.duckdb_fsst_decoder.get());
+
+		uint32_t decompressed_sizes[STANDARD_VECTOR_SIZE];
+		idx_t total_decompressed_size = 0;
 		for (idx_t i = 0; i < scan_count; i++) {
 			uint32_t str_len = bitunpack_buffer[i + offsets.scan_offset];
+			if (str_len == 0) {
+				decompressed_sizes[i] = 0;
+				continue;
+			}
 			auto str_ptr = FSSTStorage::FetchStringPointer(
 			    dict, baseptr,
 			    UnsafeNumericCast<int32_t>(delta_decode_buffer[i + offsets.unused_delta_decoded_values]));
+			auto decompressed_size = duckdb_fsst_decompress(
+			    decoder, str_len, reinterpret_cast<unsigned char *>(str_ptr),
+			    scan_state.decompress_buffer.size() - total_decompressed_size, decompress_ptr + total_decompressed_size);
+			decompressed_sizes[i] = UnsafeNumericCast<uint32_t>(decompressed_size);
+			total_decompressed_size += decompressed_size;
+		}
 
-			if (str_len > 0) {
-				result_data[i + result_offset] = FSSTPrimitives::DecompressValue(
-				    scan_state.duckdb_fsst_decoder.get(), result, str_ptr, str_len, scan_state.decompress_buffer);
-			} else {
-				result_data[i + result_offset] = string_t(nullptr, 0);
-			}
+		const char *decompressed_base;
+		if (total_decompressed_size > string_t::INLINE_LENGTH) {
+			// allocate the full decompressed range in the string heap at once
+			// the individual strings then point into this single allocation
+			auto target = StringVector::EmptyString(result, total_decompressed_size);
+			memcpy(target.GetDataWriteable(), decompress_ptr, total_decompressed_size);
+			target.Finalize();
+			decompressed_base = target.GetData();
+		} else {
+			// every string fits inline in its string_t: no heap allocation required
+			decompressed_base = const_char_ptr_cast(decompress_ptr);
+		}
+		idx_t decompressed_offset = 0;
+		for (idx_t i = 0; i < scan_count; i++) {
+			result_data[i + result_offset] = string_t(decompressed_base + decompressed_offset, decompressed_sizes[i]);
+			decompressed_offset += decompressed_sizes[i];
 		}
 	}
 
@@ -1,3 +1,4 @@
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
@@ -260,15 +261,17 @@ struct RLEScanState : public SegmentScanState {
 		auto data = handle.Ptr() + segment.GetBlockOffset();
 		auto index_pointer = reinterpret_cast<rle_count_t *>(data + rle_count_offset);
 
-		for (idx_t i = 0; i < skip_count; i++) {
-			// assign the current value
-			position_in_entry++;
-			if (position_in_entry >= index_pointer[entry_pos]) {
-				// handled all entries in this RLE value
-				// move to the next entry
-				entry_pos++;
-				position_in_entry = 0;
+		// skip over whole runs at a time instead of iterating per row
+		while (skip_count > 0) {
+			idx_t remaining_in_run = index_pointer[entry_pos] - position_in_entry;
+			if (skip_count < remaining_in_run) {
+				position_in_entry += skip_count;
+				break;
 			}
+			// the skip exhausts this run: move to the next entry
+			skip_count -= remaining_in_run;
+			entry_pos++;
+			position_in_entry = 0;
 		}
 	}
 
@@ -353,10 +356,17 @@ void RLEScanPartialInternal(ColumnSegment &segment, ColumnScanState &state, idx_
 
 	auto result_data = FlatVector::GetData<T>(result);
 	result.SetVectorType(VectorType::FLAT_VECTOR);
-	for (idx_t i = 0; i < scan_count; i++) {
-		// assign the current value
-		result_data[result_offset + i] = data_pointer[scan_state.entry_pos];
-		scan_state.position_in_entry++;
+	// process the scan run-at-a-time: fill the result with the run value for however much
+	// of the run falls within the scanned range, rather than re-checking the run per row
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto run_value = data_pointer[scan_state.entry_pos];
+		idx_t remaining_in_run = index_pointer[scan_state.entry_pos] - scan_state.position_in_entry;
+		idx_t fill_count = MinValue<idx_t>(remaining_in_run, scan_count - scanned);
+		std::fill(result_data + result_offset + scanned, result_data + result_offset + scanned + fill_count,
+		          run_value);
+		scanned += fill_count;
+		scan_state.position_in_entry += fill_count;
 		if (ExhaustedRun(scan_state, index_pointer)) {
 			ForwardToNextRun(scan_state);
 		}
@@ -0,0 +1,410 @@
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Roaring validity compression
+//===--------------------------------------------------------------------===//
+// Validity masks are compressed in containers of 2048 rows each
+// depending on how many of its rows are valid, a container is stored in one of several ways:
+// * ALL_VALID/ALL_INVALID: no payload at all
+// * ARRAY_VALID/ARRAY_INVALID: the positions of the valid (resp. invalid) rows, as a sorted uint16_t array
+// * BITSET: the verbatim bitmask
+// mostly-valid and mostly-NULL columns thus require only a handful of bytes per container
+// on top of that, scanning an ALL_VALID container leaves the result mask untouched entirely,
+// so scans over dense data never have to consult the mask per value
+
+namespace roaring {
+
+enum class ContainerType : uint8_t { ALL_VALID = 0, ALL_INVALID = 1, ARRAY_VALID = 2, ARRAY_INVALID = 3, BITSET = 4 };
+
+struct RoaringConstants {
+	//! The number of rows covered by a single container
+	static constexpr const idx_t CONTAINER_SIZE = 2048;
+	//! The size of the verbatim bitmask of a single container
+	static constexpr const idx_t CONTAINER_BYTES = CONTAINER_SIZE / 8;
+	//! The maximum number of positions stored in an array container
+	//! above this count the verbatim bitmask is smaller than the position array
+	static constexpr const idx_t MAX_ARRAY_COUNT = 126;
+	//! The header holds the offset of the payload area within the segment
+	static constexpr const idx_t HEADER_SIZE = sizeof(uint64_t);
+	//! The per-container metadata: a uint32_t payload offset and a uint8_t container type
+	static constexpr const idx_t METADATA_SIZE = sizeof(uint32_t) + sizeof(uint8_t);
+};
+
+//! Returns the payload size of a container with the given number of rows and invalid rows
+static idx_t ContainerPayloadSize(idx_t fill, idx_t invalid_count) {
+	if (invalid_count == 0 || invalid_count == fill) {
+		// all-valid or all-invalid: the container type suffices
+		return 0;
+	}
+	auto min_count = MinValue<idx_t>(invalid_count, fill - invalid_count);
+	if (min_count <= RoaringConstants::MAX_ARRAY_COUNT) {
+		// store the positions of whichever of the two is rarer
+		return sizeof(uint16_t) * (1 + min_count);
+	}
+	return RoaringConstants::CONTAINER_BYTES;
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct RoaringAnalyzeState : public AnalyzeState {
+	explicit RoaringAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	//! The number of rows in the current (unfinished) container
+	idx_t container_fill = 0;
+	//! The number of invalid rows in the current container
+	idx_t container_invalid = 0;
+	//! The number of finished containers
+	idx_t container_count = 0;
+	//! The total payload size of the finished containers
+	idx_t payload_size = 0;
+
+	void FinishContainer() {
+		payload_size += ContainerPayloadSize(container_fill, container_invalid);
+		container_count++;
+		container_fill = 0;
+		container_invalid = 0;
+	}
+};
+
+unique_ptr<AnalyzeState> RoaringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize(), type);
+	return make_uniq<RoaringAnalyzeState>(info);
+}
+
+bool RoaringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<RoaringAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			state.container_invalid++;
+		}
+		state.container_fill++;
+		if (state.container_fill == RoaringConstants::CONTAINER_SIZE) {
+			state.FinishContainer();
+		}
+	}
+	return true;
+}
+
+idx_t RoaringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<RoaringAnalyzeState>();
+	if (state.container_fill > 0) {
+		state.FinishContainer();
+	}
+	return RoaringConstants::HEADER_SIZE + state.container_count * RoaringConstants::METADATA_SIZE +
+	       state.payload_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+struct RoaringCompressState : public CompressionState {
+	RoaringCompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer_p),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ROARING)) {
+		// while writing, the container metadata is kept at a fixed reserved position at the start of the block
+		// and the payload is written directly behind the reservation
+		// when the segment is flushed the payload is compacted down to directly follow the actual metadata
+		max_container_count = info.GetBlockSize() / RoaringConstants::CONTAINER_BYTES;
+		payload_capacity =
+		    info.GetBlockSize() - RoaringConstants::HEADER_SIZE - max_container_count * RoaringConstants::METADATA_SIZE;
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		ResetContainer();
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! The maximum number of containers that fit in a segment, based on the reserved metadata area
+	idx_t max_container_count;
+	//! The number of payload bytes available in a segment
+	idx_t payload_capacity;
+
+	//! The verbatim bitmask of the current (unfinished) container
+	uint8_t container_bits[RoaringConstants::CONTAINER_BYTES];
+	//! The number of rows in the current container
+	idx_t container_fill = 0;
+	//! The number of invalid rows in the current container
+	idx_t container_invalid = 0;
+
+	//! The number of containers written to the current segment
+	idx_t container_count = 0;
+	//! The payload bytes written to the current segment
+	idx_t payload_offset = 0;
+
+	void ResetContainer() {
+		memset(container_bits, 0xFF, RoaringConstants::CONTAINER_BYTES);
+		container_fill = 0;
+		container_invalid = 0;
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto column_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		column_segment->function = function;
+		current_segment = std::move(column_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+		container_count = 0;
+		payload_offset = 0;
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto &validity_stats = current_segment->stats.statistics;
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			if (!vdata.validity.RowIsValid(idx)) {
+				container_bits[container_fill / 8] &= ~(1 << (container_fill % 8));
+				container_invalid++;
+				validity_stats.SetHasNullFast();
+			} else {
+				validity_stats.SetHasNoNullFast();
+			}
+			container_fill++;
+			if (container_fill == RoaringConstants::CONTAINER_SIZE) {
+				FlushContainer();
+			}
+		}
+	}
+
+	void FlushContainer() {
+		if (container_fill == 0) {
+			return;
+		}
+		idx_t payload_size = ContainerPayloadSize(container_fill, container_invalid);
+		if (container_count == max_container_count || payload_offset + payload_size > payload_capacity) {
+			// the current segment is full: flush it and create a new segment
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		auto data_ptr = handle.Ptr();
+		auto metadata_offset = RoaringConstants::HEADER_SIZE + container_count * sizeof(uint32_t);
+		auto type_offset =
+		    RoaringConstants::HEADER_SIZE + max_container_count * sizeof(uint32_t) + container_count * sizeof(uint8_t);
+		auto payload_base =
+		    RoaringConstants::HEADER_SIZE + max_container_count * RoaringConstants::METADATA_SIZE + payload_offset;
+		auto payload_ptr = data_ptr + payload_base;
+
+		ContainerType container_type;
+		auto array_count = MinValue<idx_t>(container_invalid, container_fill - container_invalid);
+		if (container_invalid == 0) {
+			container_type = ContainerType::ALL_VALID;
+		} else if (container_invalid == container_fill) {
+			container_type = ContainerType::ALL_INVALID;
+		} else if (array_count > RoaringConstants::MAX_ARRAY_COUNT) {
+			container_type = ContainerType::BITSET;
+			memcpy(payload_ptr, container_bits, RoaringConstants::CONTAINER_BYTES);
+		} else {
+			// array container: store the positions of whichever of valid/invalid rows is rarer
+			bool store_invalid = container_invalid <= container_fill - container_invalid;
+			container_type = store_invalid ? ContainerType::ARRAY_INVALID : ContainerType::ARRAY_VALID;
+			Store<uint16_t>(UnsafeNumericCast<uint16_t>(array_count), payload_ptr);
+			idx_t position_idx = 0;
+			for (idx_t i = 0; i < container_fill; i++) {
+				bool is_valid = (container_bits[i / 8] >> (i % 8)) & 1;
+				if (is_valid != store_invalid) {
+					Store<uint16_t>(UnsafeNumericCast<uint16_t>(i),
+					                payload_ptr + sizeof(uint16_t) * (1 + position_idx));
+					position_idx++;
+				}
+			}
+			D_ASSERT(position_idx == array_count);
+		}
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(payload_offset), data_ptr + metadata_offset);
+		Store<uint8_t>(static_cast<uint8_t>(container_type), data_ptr + type_offset);
+
+		payload_offset += payload_size;
+		container_count++;
+		current_segment->count += container_fill;
+		ResetContainer();
+	}
+
+	void FlushSegment() {
+		// compact the segment: move the container types and the payload down
+		// so they directly follow the actual (rather than the reserved) metadata
+		auto data_ptr = handle.Ptr();
+		idx_t type_dest = RoaringConstants::HEADER_SIZE + container_count * sizeof(uint32_t);
+		memmove(data_ptr + type_dest, data_ptr + RoaringConstants::HEADER_SIZE + max_container_count * sizeof(uint32_t),
+		        container_count);
+		idx_t payload_base = AlignValue<idx_t, sizeof(uint16_t)>(type_dest + container_count);
+		memmove(data_ptr + payload_base,
+		        data_ptr + RoaringConstants::HEADER_SIZE + max_container_count * RoaringConstants::METADATA_SIZE,
+		        payload_offset);
+		Store<uint64_t>(payload_base, data_ptr);
+		handle.Destroy();
+
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), payload_base + payload_offset);
+	}
+
+	void Finalize() {
+		FlushContainer();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+unique_ptr<CompressionState> RoaringInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                    unique_ptr<AnalyzeState> state) {
+	return make_uniq<RoaringCompressState>(checkpointer, state->info);
+}
+
+void RoaringCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<RoaringCompressState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+
+	state.Append(vdata, count);
+}
+
+void RoaringFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<RoaringCompressState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct RoaringScanState : public SegmentScanState {
+	BufferHandle handle;
+};
+
+unique_ptr<SegmentScanState> RoaringInitScan(ColumnSegment &segment) {
+	auto result = make_uniq<RoaringScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	result->handle = buffer_manager.Pin(segment.block);
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+static void RoaringScanInternal(ColumnSegment &segment, data_ptr_t data_ptr, idx_t start, idx_t scan_count,
+                                ValidityMask &result_mask, idx_t result_offset) {
+	auto payload_base = Load<uint64_t>(data_ptr);
+	idx_t total_container_count =
+	    (segment.count + RoaringConstants::CONTAINER_SIZE - 1) / RoaringConstants::CONTAINER_SIZE;
+	auto types_ptr = data_ptr + RoaringConstants::HEADER_SIZE + total_container_count * sizeof(uint32_t);
+
+	idx_t pos = 0;
+	while (pos < scan_count) {
+		idx_t container_idx = (start + pos) / RoaringConstants::CONTAINER_SIZE;
+		idx_t offset_in_container = (start + pos) % RoaringConstants::CONTAINER_SIZE;
+		idx_t count_in_container =
+		    MinValue<idx_t>(scan_count - pos, RoaringConstants::CONTAINER_SIZE - offset_in_container);
+		D_ASSERT(container_idx < total_container_count);
+
+		auto container_type = static_cast<ContainerType>(Load<uint8_t>(types_ptr + container_idx));
+		switch (container_type) {
+		case ContainerType::ALL_VALID:
+			// nothing to do: the result mask starts out all-valid
+			break;
+		case ContainerType::ALL_INVALID:
+			for (idx_t i = 0; i < count_in_container; i++) {
+				result_mask.SetInvalid(result_offset + pos + i);
+			}
+			break;
+		default: {
+			auto container_offset = Load<uint32_t>(data_ptr + RoaringConstants::HEADER_SIZE +
+			                                       container_idx * sizeof(uint32_t));
+			auto payload_ptr = data_ptr + payload_base + container_offset;
+			if (container_type == ContainerType::BITSET) {
+				for (idx_t i = 0; i < count_in_container; i++) {
+					idx_t bit_idx = offset_in_container + i;
+					if (!((payload_ptr[bit_idx / 8] >> (bit_idx % 8)) & 1)) {
+						result_mask.SetInvalid(result_offset + pos + i);
+					}
+				}
+				break;
+			}
+			// array container: walk the scanned range and the sorted position array in lock-step
+			bool stores_invalid = container_type == ContainerType::ARRAY_INVALID;
+			idx_t array_count = Load<uint16_t>(payload_ptr);
+			idx_t position_idx = 0;
+			for (idx_t i = 0; i < count_in_container; i++) {
+				idx_t bit_idx = offset_in_container + i;
+				while (position_idx < array_count &&
+				       Load<uint16_t>(payload_ptr + sizeof(uint16_t) * (1 + position_idx)) < bit_idx) {
+					position_idx++;
+				}
+				bool in_array = position_idx < array_count &&
+				                Load<uint16_t>(payload_ptr + sizeof(uint16_t) * (1 + position_idx)) == bit_idx;
+				// ARRAY_INVALID lists the invalid rows, ARRAY_VALID lists the valid rows
+				if (in_array == stores_invalid) {
+					result_mask.SetInvalid(result_offset + pos + i);
+				}
+			}
+			break;
+		}
+		}
+		pos += count_in_container;
+	}
+}
+
+void RoaringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                        idx_t result_offset) {
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto &scan_state = state.scan_state->Cast<RoaringScanState>();
+
+	auto &result_mask = FlatVector::Validity(result);
+	auto data_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	RoaringScanInternal(segment, data_ptr, start, scan_count, result_mask, result_offset);
+}
+
+void RoaringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	result.Flatten(scan_count);
+	RoaringScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void RoaringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	D_ASSERT(row_id >= 0 && row_id < row_t(segment.count));
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+	auto data_ptr = handle.Ptr() + segment.GetBlockOffset();
+	auto &result_mask = FlatVector::Validity(result);
+	RoaringScanInternal(segment, data_ptr, NumericCast<idx_t>(row_id), 1, result_mask, result_idx);
+}
+
+} // namespace roaring
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction RoaringCompressionFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::BIT);
+	return CompressionFunction(CompressionType::COMPRESSION_ROARING, data_type, roaring::RoaringInitAnalyze,
+	                           roaring::RoaringAnalyze, roaring::RoaringFinalAnalyze, roaring::RoaringInitCompression,
+	                           roaring::RoaringCompress, roaring::RoaringFinalizeCompress, roaring::RoaringInitScan,
+	                           roaring::RoaringScan, roaring::RoaringScanPartial, roaring::RoaringFetchRow,
+	                           UncompressedFunctions::EmptySkip);
+}
+
+bool RoaringCompressionFun::TypeIsSupported(const CompressionInfo &info) {
+	return info.GetPhysicalType() == PhysicalType::BIT;
+}
+
+} // namespace duckdb
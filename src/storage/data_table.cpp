@@ -6,7 +6,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/database_manager.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/planner/constraints/list.hpp"
 #include "duckdb/planner/expression_binder/check_binder.hpp"
@@ -32,13 +36,19 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      data_version(0), rows_changed_since_stats_refresh(0), unlogged(false) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
 	indexes.InitializeIndexes(context, *this, index_type);
 }
 
+void DataTableInfo::BumpDataVersion() {
+	++data_version;
+	db.GetDatabase().GetDatabaseManager().ModifyData();
+}
+
 bool DataTableInfo::IsTemporary() const {
 	return db.IsTemporary();
 }
@@ -203,6 +213,10 @@ bool DataTable::IsTemporary() const {
 	return info->IsTemporary();
 }
 
+bool DataTable::IsUnlogged() const {
+	return info->IsUnlogged();
+}
+
 AttachedDatabase &DataTable::GetAttached() {
 	D_ASSERT(RefersToSameObject(db, info->db));
 	return db;
@@ -250,13 +264,20 @@ idx_t DataTable::MaxThreads(ClientContext &context) {
 		parallel_scan_vector_count = 1;
 	}
 	idx_t parallel_scan_tuple_count = STANDARD_VECTOR_SIZE * parallel_scan_vector_count;
-	return GetTotalRows() / parallel_scan_tuple_count + 1;
+	// count the transaction-local rows as well - uncommitted data is scanned through the same parallel scan state
+	auto &local_storage = LocalStorage::Get(context, db);
+	idx_t total_rows = GetTotalRows() + local_storage.AddedRows(*this);
+	return total_rows / parallel_scan_tuple_count + 1;
 }
 
 void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScanState &state) {
 	auto &local_storage = LocalStorage::Get(context, db);
 	state.checkpoint_lock = info->checkpoint_lock.GetSharedLock();
-	row_groups->InitializeParallelScan(state.scan_state);
+	// when insertion order does not need to be preserved, concurrent scans over the same table can attach to each
+	// other and share one physical pass over the row groups (circular scan)
+	auto &config = DBConfig::GetConfig(context);
+	bool shared_scan = !config.options.preserve_insertion_order;
+	row_groups->InitializeParallelScan(state.scan_state, shared_scan);
 
 	local_storage.InitializeParallelScan(*this, state.local_state);
 }
@@ -814,6 +835,7 @@ void DataTable::LocalAppend(LocalAppendState &state, TableCatalogEntry &table, C
 
 	// append to the transaction local data
 	LocalStorage::Append(state, chunk);
+	info->BumpDataVersion();
 }
 
 void DataTable::FinalizeLocalAppend(LocalAppendState &state) {
@@ -833,6 +855,7 @@ void DataTable::FinalizeOptimisticWriter(ClientContext &context, OptimisticDataW
 void DataTable::LocalMerge(ClientContext &context, RowGroupCollection &collection) {
 	auto &local_storage = LocalStorage::Get(context, db);
 	local_storage.LocalMerge(*this, collection);
+	info->BumpDataVersion();
 }
 
 void DataTable::LocalAppend(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk,
@@ -938,6 +961,7 @@ void DataTable::ScanTableSegment(idx_t row_start, idx_t count, const std::functi
 void DataTable::MergeStorage(RowGroupCollection &data, TableIndexList &indexes) {
 	row_groups->MergeStorage(data);
 	row_groups->Verify();
+	info->BumpDataVersion();
 }
 
 void DataTable::WriteToLog(WriteAheadLog &log, idx_t row_start, idx_t count) {
@@ -948,6 +972,7 @@ void DataTable::WriteToLog(WriteAheadLog &log, idx_t row_start, idx_t count) {
 void DataTable::CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count) {
 	lock_guard<mutex> lock(append_lock);
 	row_groups->CommitAppend(commit_id, row_start, count);
+	info->BumpDataVersion();
 }
 
 void DataTable::RevertAppendInternal(idx_t start_row) {
@@ -958,6 +983,7 @@ void DataTable::RevertAppendInternal(idx_t start_row) {
 
 void DataTable::RevertAppend(idx_t start_row, idx_t count) {
 	lock_guard<mutex> lock(append_lock);
+	info->BumpDataVersion();
 
 	// revert any appends to indexes
 	if (!info->indexes.Empty()) {
@@ -997,7 +1023,17 @@ void DataTable::RevertAppend(idx_t start_row, idx_t count) {
 //===--------------------------------------------------------------------===//
 // Indexes
 //===--------------------------------------------------------------------===//
-ErrorData DataTable::AppendToIndexes(TableIndexList &indexes, DataChunk &chunk, row_t row_start) {
+bool DataTable::IndexAppendsInBulk(Index &index) {
+	if (!index.IsBound() || index.GetIndexType() != ART::TYPE_NAME) {
+		return false;
+	}
+	// only indexes without constraints qualify: for these, the bulk merge cannot run into a constraint
+	// violation, so we do not need the row-at-a-time path to pinpoint a violating row
+	return index.GetConstraintType() == IndexConstraintType::NONE;
+}
+
+ErrorData DataTable::AppendToIndexes(TableIndexList &indexes, DataChunk &chunk, row_t row_start,
+                                     bool skip_bulk_indexes) {
 	ErrorData error;
 	if (indexes.Empty()) {
 		return error;
@@ -1010,6 +1046,10 @@ ErrorData DataTable::AppendToIndexes(TableIndexList &indexes, DataChunk &chunk,
 	bool append_failed = false;
 	// now append the entries to the indices
 	indexes.Scan([&](Index &index_to_append) {
+		if (skip_bulk_indexes && IndexAppendsInBulk(index_to_append)) {
+			// the caller appends to this index in bulk after the scan
+			return false;
+		}
 		if (!index_to_append.IsBound()) {
 			error = ErrorData("Unbound index found in DataTable::AppendToIndexes");
 			append_failed = true;
@@ -1148,6 +1188,7 @@ idx_t DataTable::Delete(TableDeleteState &state, ClientContext &context, Vector
 
 	auto &transaction = DuckTransaction::Get(context, db);
 	auto &local_storage = LocalStorage::Get(transaction);
+	info->BumpDataVersion();
 
 	row_identifiers.Flatten(count);
 	auto ids = FlatVector::GetData<row_t>(row_identifiers);
@@ -1307,6 +1348,7 @@ void DataTable::Update(TableUpdateState &state, ClientContext &context, Vector &
 
 	// first verify that no constraints are violated
 	VerifyUpdateConstraints(*state.constraint_state, context, updates, column_ids);
+	info->BumpDataVersion();
 
 	// now perform the actual update
 	Vector max_row_id_vec(Value::BIGINT(MAX_ROW_ID));
@@ -1360,6 +1402,7 @@ void DataTable::UpdateColumn(TableCatalogEntry &table, ClientContext &context, V
 	updates.Flatten();
 	row_ids.Flatten(updates.size());
 	row_groups->UpdateColumn(transaction, row_ids, column_path, updates);
+	info->BumpDataVersion();
 }
 
 //===--------------------------------------------------------------------===//
@@ -1377,6 +1420,70 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+void DataTable::SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram_stats) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	row_groups->SetHistogram(column_id, std::move(histogram_stats));
+}
+
+void DataTable::RegisterChangedRows(ClientContext &context, idx_t changed_rows) {
+	auto total_changed = info->rows_changed_since_stats_refresh += changed_rows;
+	auto &config = DBConfig::GetConfig(context);
+	if (!config.options.automatic_statistics_refresh) {
+		return;
+	}
+	// the distinct statistics cannot un-count deleted or overwritten values, so we rebuild them
+	// once a significant fraction of the table has changed since they were last rebuilt
+	idx_t threshold = MaxValue<idx_t>(Storage::ROW_GROUP_SIZE, GetTotalRows() / 5);
+	if (total_changed < threshold) {
+		return;
+	}
+	// reset the counter first so that concurrent writers do not trigger a redundant refresh
+	info->rows_changed_since_stats_refresh = 0;
+	RefreshDistinctStatistics(context);
+}
+
+void DataTable::RefreshDistinctStatistics(ClientContext &context) {
+	auto &transaction = DuckTransaction::Get(context, db);
+	// collect the columns whose types support distinct statistics
+	vector<column_t> column_ids;
+	for (idx_t i = 0; i < column_definitions.size(); i++) {
+		if (DistinctStatistics::TypeIsSupported(column_definitions[i].GetType())) {
+			column_ids.push_back(i);
+		}
+	}
+	if (column_ids.empty()) {
+		return;
+	}
+	vector<unique_ptr<DistinctStatistics>> new_stats;
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		new_stats.push_back(make_uniq<DistinctStatistics>());
+	}
+	// rebuild the sketches from the rows visible to this transaction, with the same sampling as appends
+	row_groups->Scan(transaction, column_ids, [&](DataChunk &chunk) {
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			new_stats[i]->Update(chunk.data[i], chunk.size());
+		}
+		return true;
+	});
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		row_groups->SetDistinct(column_ids[i], std::move(new_stats[i]));
+	}
+}
+
+unique_ptr<HistogramStatistics> DataTable::GetHistogram(column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	return row_groups->CopyHistogram(column_id);
+}
+
+bool DataTable::IsColumnSorted(column_t column_id, OrderType order_type) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return false;
+	}
+	return row_groups->IsColumnSorted(column_id, order_type);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -1391,9 +1498,16 @@ unique_ptr<StorageLockKey> DataTable::GetCheckpointLock() {
 void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
 	// checkpoint each individual row group
 	TableStatistics global_stats;
+	CheckpointData(writer, global_stats);
+	FinalizeCheckpoint(writer, global_stats, serializer);
+}
+
+void DataTable::CheckpointData(TableDataWriter &writer, TableStatistics &global_stats) {
 	row_groups->CopyStats(global_stats);
 	row_groups->Checkpoint(writer, global_stats);
+}
 
+void DataTable::FinalizeCheckpoint(TableDataWriter &writer, TableStatistics &global_stats, Serializer &serializer) {
 	// The row group payload data has been written. Now write:
 	//   column stats
 	//   row-group pointers
@@ -1414,6 +1528,11 @@ idx_t DataTable::GetTotalRows() const {
 	return row_groups->GetTotalRows();
 }
 
+idx_t DataTable::GetVisibleRowCount(ClientContext &context) {
+	auto &transaction = DuckTransaction::Get(context, db);
+	return row_groups->GetVisibleCount(transaction);
+}
+
 void DataTable::CommitDropTable() {
 	// commit a drop of this table: mark all blocks as modified, so they can be reclaimed later on
 	row_groups->CommitDropTable();
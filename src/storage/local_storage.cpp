@@ -125,6 +125,18 @@ ErrorData LocalTableStorage::AppendToIndexes(DuckTransaction &transaction, RowGr
 	// create an empty mock chunk that contains all the correct types for the table
 	DataChunk mock_chunk;
 	mock_chunk.InitializeEmpty(table_types);
+
+	// indexes without constraints are not appended to row-at-a-time: we accumulate the keys of the
+	// entire batch during the scan, and merge them into the index as a bulk-constructed subtree afterwards
+	vector<pair<reference<ART>, unique_ptr<ARTBulkAppendState>>> bulk_appends;
+	index_list.Scan([&](Index &index) {
+		if (DataTable::IndexAppendsInBulk(index)) {
+			auto &art = index.Cast<ART>();
+			bulk_appends.emplace_back(art, art.InitializeBulkAppend());
+		}
+		return false;
+	});
+
 	ErrorData error;
 	source.Scan(transaction, columns, [&](DataChunk &chunk) -> bool {
 		// construct the mock chunk by referencing the required columns
@@ -132,14 +144,31 @@ ErrorData LocalTableStorage::AppendToIndexes(DuckTransaction &transaction, RowGr
 			mock_chunk.data[columns[i]].Reference(chunk.data[i]);
 		}
 		mock_chunk.SetCardinality(chunk);
-		// append this chunk to the indexes of the table
-		error = DataTable::AppendToIndexes(index_list, mock_chunk, start_row);
+		// collect the keys of this chunk for the bulk-appended indexes
+		for (auto &bulk_append : bulk_appends) {
+			bulk_append.first.get().CollectBulkAppend(*bulk_append.second, mock_chunk, start_row);
+		}
+		// append this chunk to the remaining indexes of the table
+		error = DataTable::AppendToIndexes(index_list, mock_chunk, start_row, true);
 		if (error.HasError()) {
 			return false;
 		}
 		start_row += chunk.size();
 		return true;
 	});
+	if (error.HasError()) {
+		// constraint violation: the bulk appends never touched their indexes, so the caller can revert
+		return error;
+	}
+	// now apply the bulk appends
+	for (auto &bulk_append : bulk_appends) {
+		try {
+			bulk_append.first.get().FinishBulkAppend(*bulk_append.second);
+		} catch (std::exception &ex) { // LCOV_EXCL_START
+			error = ErrorData(ex);
+			return error;
+		} // LCOV_EXCL_STOP
+	}
 	return error;
 }
 
@@ -203,11 +232,13 @@ void LocalTableStorage::AppendToIndexes(DuckTransaction &transaction, TableAppen
 
 OptimisticDataWriter &LocalTableStorage::CreateOptimisticWriter() {
 	auto writer = make_uniq<OptimisticDataWriter>(table_ref.get());
+	lock_guard<mutex> l(optimistic_writer_lock);
 	optimistic_writers.push_back(std::move(writer));
 	return *optimistic_writers.back();
 }
 
 void LocalTableStorage::FinalizeOptimisticWriter(OptimisticDataWriter &writer) {
+	lock_guard<mutex> l(optimistic_writer_lock);
 	// remove the writer from the set of optimistic writers
 	unique_ptr<OptimisticDataWriter> owned_writer;
 	for (idx_t i = 0; i < optimistic_writers.size(); i++) {
@@ -224,6 +255,7 @@ void LocalTableStorage::FinalizeOptimisticWriter(OptimisticDataWriter &writer) {
 }
 
 void LocalTableStorage::Rollback() {
+	lock_guard<mutex> l(optimistic_writer_lock);
 	for (auto &writer : optimistic_writers) {
 		writer->Rollback();
 	}
@@ -15,6 +15,7 @@ MetadataManager::~MetadataManager() {
 }
 
 MetadataHandle MetadataManager::AllocateHandle() {
+	lock_guard<mutex> guard(block_lock);
 	// check if there is any free space left in an existing block
 	// if not allocate a new block
 	block_id_t free_block = INVALID_BLOCK;
@@ -46,11 +47,16 @@ MetadataHandle MetadataManager::AllocateHandle() {
 	// mark the block as used
 	block.free_blocks.pop_back();
 	D_ASSERT(pointer.index < METADATA_BLOCK_COUNT);
-	// pin the block
-	return Pin(pointer);
+	// pin the block (we already hold the lock)
+	return PinInternal(pointer);
 }
 
 MetadataHandle MetadataManager::Pin(MetadataPointer pointer) {
+	lock_guard<mutex> guard(block_lock);
+	return PinInternal(pointer);
+}
+
+MetadataHandle MetadataManager::PinInternal(MetadataPointer pointer) {
 	D_ASSERT(pointer.index < METADATA_BLOCK_COUNT);
 	auto &block = blocks[pointer.block_index];
 
@@ -257,6 +263,7 @@ void MetadataBlock::FreeBlocksFromInteger(idx_t free_list) {
 }
 
 void MetadataManager::MarkBlocksAsModified() {
+	lock_guard<mutex> guard(block_lock);
 	// for any blocks that were modified in the last checkpoint - set them to free blocks currently
 	for (auto &kv : modified_blocks) {
 		auto block_id = kv.first;
@@ -287,6 +294,8 @@ void MetadataManager::MarkBlocksAsModified() {
 }
 
 void MetadataManager::ClearModifiedBlocks(const vector<MetaBlockPointer> &pointers) {
+	// checkpoint tasks of different tables can clear sub-blocks of the same shared metadata block concurrently
+	lock_guard<mutex> guard(block_lock);
 	for (auto &pointer : pointers) {
 		auto block_id = pointer.GetBlockId();
 		auto block_index = pointer.GetBlockIndex();
@@ -3,15 +3,21 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/set.hpp"
+#include "duckdb/common/thread_wait_times.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "miniz.hpp"
+
 namespace duckdb {
 
 #ifdef DUCKDB_DEBUG_DESTROY_BLOCKS
@@ -298,6 +304,41 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
 }
 
+//! Task that loads a set of blocks on a background thread ahead of the thread that needs them
+class BlockPrefetchTask : public Task {
+public:
+	BlockPrefetchTask(StandardBufferManager &buffer_manager_p, vector<shared_ptr<BlockHandle>> handles_p)
+	    : buffer_manager(buffer_manager_p), handles(std::move(handles_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			buffer_manager.Prefetch(handles);
+		} catch (...) { // NOLINT
+			// prefetching is a performance suggestion: any error here will surface when the block is actually pinned
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	StandardBufferManager &buffer_manager;
+	vector<shared_ptr<BlockHandle>> handles;
+};
+
+void StandardBufferManager::PrefetchAsync(vector<shared_ptr<BlockHandle>> handles) {
+	auto &scheduler = TaskScheduler::GetScheduler(db);
+	if (scheduler.NumberOfThreads() <= 1) {
+		// no background threads available: prefetch synchronously
+		Prefetch(handles);
+		return;
+	}
+	lock_guard<mutex> guard(prefetch_lock);
+	if (!prefetch_producer) {
+		prefetch_producer = scheduler.CreateProducer();
+	}
+	scheduler.ScheduleTask(*prefetch_producer, make_shared_ptr<BlockPrefetchTask>(*this, std::move(handles)));
+}
+
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// we need to be careful not to return the BufferHandle to this block while holding the BlockHandle's lock
 	// as exiting this function's scope may cause the destructor of the BufferHandle to be called while holding the lock
@@ -320,6 +361,12 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	if (buf.IsValid()) {
 		return buf; // the block was already loaded, return it without holding the BlockHandle's lock
 	} else {
+		// time the eviction and the load so that the wait can be attributed to the active operator
+		auto &wait_times = ThreadWaitTimes::Get();
+		auto io_wait_start = wait_times.io_wait;
+		Profiler wait_timer;
+		wait_timer.Start();
+
 		// evict blocks until we have space for the current block
 		unique_ptr<FileBuffer> reusable_buffer;
 		auto reservation =
@@ -350,6 +397,10 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			}
 			D_ASSERT(handle->memory_usage == handle->buffer->AllocSize());
 		}
+
+		// the file system reads issued while loading are already counted as io_wait
+		wait_timer.End();
+		wait_times.buffer_wait += wait_timer.Elapsed() - (wait_times.io_wait - io_wait_start);
 	}
 
 	// we should have a valid BufferHandle by now, either because the block was already loaded, or because we loaded it
@@ -434,6 +485,50 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBufferInternal(Buffer
 	return buffer;
 }
 
+AllocatedData StandardBufferManager::CompressTemporaryBuffer(Allocator &allocator, FileBuffer &buffer,
+                                                             idx_t &compressed_size) {
+	// compress the entire buffer (including the buffer header) so it can be reconstructed verbatim
+	auto source = buffer.InternalBuffer();
+	auto source_size = buffer.AllocSize();
+	auto bound = duckdb_miniz::mz_compressBound(source_size);
+	auto compress_buffer = allocator.Allocate(bound);
+	// compress a small prefix first so that clearly incompressible blocks skip the full compression pass
+	static constexpr idx_t COMPRESSION_SAMPLE_SIZE = 4096;
+	const auto sample_size = MinValue<idx_t>(source_size, COMPRESSION_SAMPLE_SIZE);
+	duckdb_miniz::mz_ulong mz_size = bound;
+	auto mz_ret = duckdb_miniz::mz_compress2(compress_buffer.get(), &mz_size, source, sample_size,
+	                                         duckdb_miniz::MZ_BEST_SPEED);
+	if (mz_ret != duckdb_miniz::MZ_OK || mz_size >= sample_size - sample_size / 8) {
+		// the sample does not compress well enough: write the block uncompressed
+		return AllocatedData();
+	}
+	mz_size = bound;
+	mz_ret = duckdb_miniz::mz_compress2(compress_buffer.get(), &mz_size, source, source_size,
+	                                    duckdb_miniz::MZ_BEST_SPEED);
+	if (mz_ret != duckdb_miniz::MZ_OK || mz_size >= source_size) {
+		return AllocatedData();
+	}
+	compressed_size = mz_size;
+	return compress_buffer;
+}
+
+unique_ptr<FileBuffer> StandardBufferManager::ReadCompressedTemporaryBufferInternal(
+    BufferManager &buffer_manager, FileHandle &handle, idx_t position, idx_t compressed_size, idx_t size,
+    unique_ptr<FileBuffer> reusable_buffer) {
+	auto compressed_data = Allocator::Get(buffer_manager.GetDatabase()).Allocate(compressed_size);
+	handle.Read(compressed_data.get(), compressed_size, position);
+	// decompress back into a managed buffer of the original size
+	auto buffer = buffer_manager.ConstructManagedBuffer(size, std::move(reusable_buffer));
+	duckdb_miniz::mz_ulong decompressed_size = buffer->AllocSize();
+	auto mz_ret =
+	    duckdb_miniz::mz_uncompress(buffer->InternalBuffer(), &decompressed_size, compressed_data.get(),
+	                                NumericCast<duckdb_miniz::mz_ulong>(compressed_size));
+	if (mz_ret != duckdb_miniz::MZ_OK || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress temporary block at position %llu", position);
+	}
+	return buffer;
+}
+
 string StandardBufferManager::GetTemporaryPath(block_id_t id) {
 	auto &fs = FileSystem::GetFileSystem(db);
 	return fs.JoinPath(temporary_directory.path, "duckdb_temp_block-" + to_string(id) + ".block");
@@ -453,11 +548,90 @@ void StandardBufferManager::RequireTemporaryDirectory() {
 	}
 }
 
+bool StandardBufferManager::TryWriteCompressedBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
+	auto tier_size = DBConfig::GetConfig(db).options.compressed_buffer_tier_size;
+	if (tier_size == 0) {
+		// the compressed tier is disabled
+		return false;
+	}
+	// compress the entire buffer (including the buffer header) so it can be reconstructed verbatim
+	auto source = buffer.InternalBuffer();
+	auto source_size = buffer.AllocSize();
+	auto bound = duckdb_miniz::mz_compressBound(source_size);
+	auto &allocator = Allocator::Get(db);
+	auto compress_buffer = allocator.Allocate(bound);
+	duckdb_miniz::mz_ulong compressed_size = bound;
+	auto mz_ret = duckdb_miniz::mz_compress2(compress_buffer.get(), &compressed_size, source, source_size,
+	                                         duckdb_miniz::MZ_BEST_SPEED);
+	if (mz_ret != duckdb_miniz::MZ_OK || compressed_size >= source_size) {
+		// compression failed or the data does not compress: evict to disk instead
+		return false;
+	}
+	// copy the compressed data into an exactly-sized allocation so the tier only accounts for what it holds
+	auto compressed_data = allocator.Allocate(compressed_size);
+	memcpy(compressed_data.get(), compress_buffer.get(), compressed_size);
+
+	lock_guard<mutex> guard(compressed_tier.lock);
+	if (compressed_tier.size + compressed_size > tier_size) {
+		// the tier is full: evict to disk instead
+		return false;
+	}
+	compressed_tier.size += compressed_size;
+	auto &entry = compressed_tier.buffers[block_id];
+	entry.compressed_data = std::move(compressed_data);
+	entry.compressed_size = compressed_size;
+	entry.uncompressed_size = buffer.size;
+	evicted_data_per_tag[uint8_t(tag)] += buffer.size;
+	return true;
+}
+
+unique_ptr<FileBuffer> StandardBufferManager::TryReadCompressedBuffer(MemoryTag tag, block_id_t id,
+                                                                      unique_ptr<FileBuffer> &reusable_buffer) {
+	CompressedBufferEntry entry;
+	{
+		lock_guard<mutex> guard(compressed_tier.lock);
+		auto it = compressed_tier.buffers.find(id);
+		if (it == compressed_tier.buffers.end()) {
+			return nullptr;
+		}
+		entry = std::move(it->second);
+		compressed_tier.size -= entry.compressed_size;
+		compressed_tier.buffers.erase(it);
+	}
+	evicted_data_per_tag[uint8_t(tag)] -= entry.uncompressed_size;
+
+	// decompress back into a managed buffer of the original size
+	auto buffer = ConstructManagedBuffer(entry.uncompressed_size, std::move(reusable_buffer));
+	duckdb_miniz::mz_ulong decompressed_size = buffer->AllocSize();
+	auto mz_ret = duckdb_miniz::mz_uncompress(buffer->InternalBuffer(), &decompressed_size,
+	                                          entry.compressed_data.get(), entry.compressed_size);
+	if (mz_ret != duckdb_miniz::MZ_OK || decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress block %lld from the compressed buffer tier", id);
+	}
+	return buffer;
+}
+
+bool StandardBufferManager::DeleteCompressedBuffer(block_id_t id) {
+	lock_guard<mutex> guard(compressed_tier.lock);
+	auto it = compressed_tier.buffers.find(id);
+	if (it == compressed_tier.buffers.end()) {
+		return false;
+	}
+	compressed_tier.size -= it->second.compressed_size;
+	compressed_tier.buffers.erase(it);
+	return true;
+}
+
 void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 
 	// WriteTemporaryBuffer assumes that we never write a buffer below DEFAULT_BLOCK_ALLOC_SIZE.
 	RequireTemporaryDirectory();
 
+	// Try to keep the buffer in memory in compressed form before falling back to the temporary files.
+	if (TryWriteCompressedBuffer(tag, block_id, buffer)) {
+		return;
+	}
+
 	// Append to a few grouped files.
 	if (buffer.size == GetBlockSize()) {
 		evicted_data_per_tag[uint8_t(tag)] += GetBlockSize();
@@ -480,6 +654,11 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
                                                                   unique_ptr<FileBuffer> reusable_buffer) {
 	D_ASSERT(!temporary_directory.path.empty());
 	D_ASSERT(temporary_directory.handle.get());
+	// check the compressed in-memory tier first
+	auto compressed_buffer = TryReadCompressedBuffer(tag, id, reusable_buffer);
+	if (compressed_buffer) {
+		return compressed_buffer;
+	}
 	if (temporary_directory.handle->GetTempFile().HasTemporaryBuffer(id)) {
 		evicted_data_per_tag[uint8_t(tag)] -= GetBlockSize();
 		return temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
@@ -503,6 +682,10 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 }
 
 void StandardBufferManager::DeleteTemporaryFile(block_id_t id) {
+	if (DeleteCompressedBuffer(id)) {
+		// the buffer was held in the compressed in-memory tier: nothing on disk to delete
+		return;
+	}
 	if (temporary_directory.path.empty()) {
 		// no temporary directory specified: nothing to delete
 		return;
@@ -8,6 +8,10 @@ ColumnStatistics::ColumnStatistics(BaseStatistics stats_p) : stats(std::move(sta
 	if (DistinctStatistics::TypeIsSupported(stats.GetType())) {
 		distinct_stats = make_uniq<DistinctStatistics>();
 	}
+	if (SortednessStatistics::TypeIsSupported(stats.GetType())) {
+		// only freshly created (empty) columns are tracked - deserialized columns have unknown sortedness
+		sortedness_stats = make_uniq<SortednessStatistics>();
+	}
 }
 ColumnStatistics::ColumnStatistics(BaseStatistics stats_p, unique_ptr<DistinctStatistics> distinct_stats_p)
     : stats(std::move(stats_p)), distinct_stats(std::move(distinct_stats_p)) {
@@ -23,6 +27,14 @@ void ColumnStatistics::Merge(ColumnStatistics &other) {
 		D_ASSERT(other.distinct_stats);
 		distinct_stats->Merge(*other.distinct_stats);
 	}
+	if (sortedness_stats) {
+		if (other.sortedness_stats) {
+			sortedness_stats->Merge(*other.sortedness_stats);
+		} else {
+			// the sortedness of the merged rows is unknown
+			sortedness_stats->SetUnsorted();
+		}
+	}
 }
 
 BaseStatistics &ColumnStatistics::Statistics() {
@@ -44,6 +56,39 @@ void ColumnStatistics::SetDistinct(unique_ptr<DistinctStatistics> distinct) {
 	this->distinct_stats = std::move(distinct);
 }
 
+bool ColumnStatistics::HasHistogramStats() {
+	return histogram_stats.get();
+}
+
+HistogramStatistics &ColumnStatistics::HistogramStats() {
+	if (!histogram_stats) {
+		throw InternalException("HistogramStats called without histogram_stats");
+	}
+	return *histogram_stats;
+}
+
+void ColumnStatistics::SetHistogram(unique_ptr<HistogramStatistics> histogram) {
+	this->histogram_stats = std::move(histogram);
+}
+
+bool ColumnStatistics::HasSortednessStats() {
+	return sortedness_stats.get();
+}
+
+SortednessStatistics &ColumnStatistics::SortednessStats() {
+	if (!sortedness_stats) {
+		throw InternalException("SortednessStats called without sortedness_stats");
+	}
+	return *sortedness_stats;
+}
+
+void ColumnStatistics::UpdateSortedness(Vector &v, idx_t count) {
+	if (!sortedness_stats) {
+		return;
+	}
+	sortedness_stats->Update(v, count);
+}
+
 void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 	if (!distinct_stats) {
 		return;
@@ -53,7 +98,14 @@ void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Copy() const {
-	return make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	auto result = make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	if (histogram_stats) {
+		result->histogram_stats = histogram_stats->Copy();
+	}
+	if (sortedness_stats) {
+		result->sortedness_stats = sortedness_stats->Copy();
+	}
+	return result;
 }
 
 void ColumnStatistics::Serialize(Serializer &serializer) const {
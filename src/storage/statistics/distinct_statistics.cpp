@@ -18,7 +18,7 @@ unique_ptr<DistinctStatistics> DistinctStatistics::Copy() const {
 }
 
 void DistinctStatistics::Merge(const DistinctStatistics &other) {
-	log = log->Merge(*other.log);
+	log->MergeInPlace(*other.log);
 	sample_count += other.sample_count;
 	total_count += other.total_count;
 }
@@ -0,0 +1,186 @@
+#include "duckdb/storage/statistics/histogram_statistics.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+HistogramStatistics::HistogramStatistics() : total_count(0), null_count(0), random(1) {
+}
+
+bool HistogramStatistics::TypeIsSupported(const LogicalType &type) {
+	return type.IsNumeric();
+}
+
+void HistogramStatistics::Update(Vector &input, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	// histograms are only built over numeric columns, so casting the values to double is lossless enough
+	// for selectivity estimation
+	Vector cast_vector(LogicalType::DOUBLE);
+	VectorOperations::DefaultCast(input, cast_vector, count);
+	UnifiedVectorFormat vdata;
+	cast_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<double>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			null_count++;
+			continue;
+		}
+		auto value = data[idx];
+		if (Value::IsNan(value)) {
+			// NaN values have no place in an ordered histogram
+			continue;
+		}
+		total_count++;
+		if (sample.size() < SAMPLE_SIZE) {
+			sample.push_back(value);
+		} else {
+			// reservoir sampling: keep the value with probability SAMPLE_SIZE / total_count
+			auto replace_idx = idx_t(random.NextRandom() * double(total_count));
+			if (replace_idx < SAMPLE_SIZE) {
+				sample[replace_idx] = value;
+			}
+		}
+	}
+}
+
+void HistogramStatistics::Merge(const HistogramStatistics &other) {
+	D_ASSERT(bucket_boundaries.empty() && other.bucket_boundaries.empty());
+	total_count += other.total_count;
+	null_count += other.null_count;
+	sample.insert(sample.end(), other.sample.begin(), other.sample.end());
+	if (sample.size() > SAMPLE_SIZE) {
+		// the merged sample exceeds the cap - keep a uniformly drawn subset
+		for (idx_t i = 0; i < SAMPLE_SIZE; i++) {
+			auto j = i + idx_t(random.NextRandom() * double(sample.size() - i));
+			std::swap(sample[i], sample[MinValue<idx_t>(j, sample.size() - 1)]);
+		}
+		sample.resize(SAMPLE_SIZE);
+	}
+}
+
+void HistogramStatistics::Finalize() {
+	bucket_boundaries.clear();
+	common_values.clear();
+	if (sample.empty()) {
+		return;
+	}
+	std::sort(sample.begin(), sample.end());
+	auto size = sample.size();
+	for (idx_t bucket = 0; bucket <= BUCKET_COUNT; bucket++) {
+		auto offset = MinValue<idx_t>(bucket * size / BUCKET_COUNT, size - 1);
+		bucket_boundaries.push_back(sample[offset]);
+	}
+	// the most-common values are the longest runs in the sorted sample
+	vector<CommonValue> runs;
+	idx_t run_start = 0;
+	for (idx_t i = 1; i <= size; i++) {
+		if (i == size || sample[i] != sample[run_start]) {
+			if (i - run_start > 1) {
+				runs.push_back(CommonValue {sample[run_start], double(i - run_start) / double(size)});
+			}
+			run_start = i;
+		}
+	}
+	std::sort(runs.begin(), runs.end(),
+	          [](const CommonValue &a, const CommonValue &b) { return a.fraction > b.fraction; });
+	if (runs.size() > MCV_COUNT) {
+		runs.resize(MCV_COUNT);
+	}
+	common_values = std::move(runs);
+	sample.clear();
+}
+
+double HistogramStatistics::GetNullFraction() const {
+	auto seen = total_count + null_count;
+	return seen == 0 ? 0 : double(null_count) / double(seen);
+}
+
+double HistogramStatistics::FractionBelow(double value) const {
+	if (value <= bucket_boundaries.front()) {
+		return 0;
+	}
+	if (value > bucket_boundaries.back()) {
+		return 1;
+	}
+	auto it = std::lower_bound(bucket_boundaries.begin(), bucket_boundaries.end(), value);
+	auto boundary_idx = idx_t(it - bucket_boundaries.begin());
+	if (boundary_idx == 0) {
+		return 0;
+	}
+	// interpolate within the bucket; every bucket holds an equal share of the values
+	auto bucket = boundary_idx - 1;
+	auto lower = bucket_boundaries[bucket];
+	auto upper = bucket_boundaries[boundary_idx];
+	auto fraction_in_bucket = upper > lower ? (value - lower) / (upper - lower) : 1.0;
+	return (double(bucket) + fraction_in_bucket) / double(BUCKET_COUNT);
+}
+
+double HistogramStatistics::FractionEqual(double value, idx_t distinct_count) const {
+	if (value < bucket_boundaries.front() || value > bucket_boundaries.back()) {
+		return 0;
+	}
+	double common_value_total = 0;
+	for (auto &common_value : common_values) {
+		if (common_value.value == value) {
+			return common_value.fraction;
+		}
+		common_value_total += common_value.fraction;
+	}
+	// the value is not in the most-common-value list: spread the remaining probability mass evenly over the
+	// remaining distinct values
+	auto remaining = MaxValue<double>(0, 1.0 - common_value_total);
+	if (distinct_count > common_values.size()) {
+		return remaining / double(distinct_count - common_values.size());
+	}
+	return remaining / double(BUCKET_COUNT);
+}
+
+bool HistogramStatistics::TryEstimateSelectivity(ExpressionType comparison, double constant, idx_t distinct_count,
+                                                 double &selectivity) const {
+	if (bucket_boundaries.empty()) {
+		return false;
+	}
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		selectivity = FractionEqual(constant, distinct_count);
+		break;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		selectivity = 1.0 - FractionEqual(constant, distinct_count);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		selectivity = FractionBelow(constant);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		selectivity = FractionBelow(constant) + FractionEqual(constant, distinct_count);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		selectivity = 1.0 - FractionBelow(constant) - FractionEqual(constant, distinct_count);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		selectivity = 1.0 - FractionBelow(constant);
+		break;
+	default:
+		return false;
+	}
+	// comparisons never match NULL values
+	selectivity = MinValue<double>(MaxValue<double>(selectivity, 0), 1) * (1.0 - GetNullFraction());
+	return true;
+}
+
+unique_ptr<HistogramStatistics> HistogramStatistics::Copy() const {
+	auto result = make_uniq<HistogramStatistics>();
+	result->sample = sample;
+	result->total_count = total_count;
+	result->null_count = null_count;
+	result->bucket_boundaries = bucket_boundaries;
+	result->common_values = common_values;
+	return result;
+}
+
+} // namespace duckdb
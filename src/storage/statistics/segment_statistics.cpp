@@ -4,10 +4,30 @@
 
 namespace duckdb {
 
-SegmentStatistics::SegmentStatistics(LogicalType type) : statistics(BaseStatistics::CreateEmpty(std::move(type))) {
+SegmentStatistics::SegmentStatistics(LogicalType type)
+    : statistics(BaseStatistics::CreateEmpty(std::move(type))),
+      is_sorted(SortednessIsTracked(statistics.GetType())) {
 }
 
-SegmentStatistics::SegmentStatistics(BaseStatistics stats) : statistics(std::move(stats)) {
+SegmentStatistics::SegmentStatistics(BaseStatistics stats) : statistics(std::move(stats)), is_sorted(false) {
+}
+
+bool SegmentStatistics::SortednessIsTracked(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
 }
 
 } // namespace duckdb
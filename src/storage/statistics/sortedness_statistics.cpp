@@ -0,0 +1,117 @@
+#include "duckdb/storage/statistics/sortedness_statistics.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/value_operations/value_operations.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+SortednessStatistics::SortednessStatistics() : is_ascending(true), is_descending(true), has_values(false) {
+}
+
+bool SortednessStatistics::TypeIsSupported(const LogicalType &type) {
+	auto physical_type = type.InternalType();
+	return physical_type != PhysicalType::LIST && physical_type != PhysicalType::STRUCT &&
+	       physical_type != PhysicalType::ARRAY;
+}
+
+void SortednessStatistics::Update(Vector &input, idx_t count) {
+	if (!is_ascending && !is_descending) {
+		// already known to be unsorted - nothing to track
+		return;
+	}
+	if (count == 0) {
+		return;
+	}
+
+	UnifiedVectorFormat data;
+	input.ToUnifiedFormat(count, data);
+	if (!data.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			if (!data.validity.RowIsValid(data.sel->get_index(i))) {
+				// a NULL breaks the run - we cannot prove where NULLs end up in a sorted result
+				SetUnsorted();
+				return;
+			}
+		}
+	}
+
+	// verify that the values within the chunk are monotonic by comparing each value to its successor
+	if (count > 1) {
+		SelectionVector head_sel(count - 1);
+		SelectionVector tail_sel(count - 1);
+		for (idx_t i = 0; i < count - 1; i++) {
+			head_sel.set_index(i, i);
+			tail_sel.set_index(i, i + 1);
+		}
+		Vector head(input);
+		Vector tail(input);
+		head.Slice(head_sel, count - 1);
+		tail.Slice(tail_sel, count - 1);
+		if (is_ascending &&
+		    VectorOperations::DistinctLessThanEquals(head, tail, nullptr, count - 1, nullptr, nullptr) != count - 1) {
+			is_ascending = false;
+		}
+		if (is_descending && VectorOperations::DistinctGreaterThanEquals(head, tail, nullptr, count - 1, nullptr,
+		                                                                 nullptr) != count - 1) {
+			is_descending = false;
+		}
+	}
+
+	// verify that the chunk continues the run of the previously appended values
+	auto chunk_first = input.GetValue(0);
+	if (has_values) {
+		if (is_ascending && ValueOperations::DistinctGreaterThan(last_value, chunk_first)) {
+			is_ascending = false;
+		}
+		if (is_descending && ValueOperations::DistinctLessThan(last_value, chunk_first)) {
+			is_descending = false;
+		}
+	} else {
+		first_value = std::move(chunk_first);
+		has_values = true;
+	}
+	last_value = input.GetValue(count - 1);
+}
+
+void SortednessStatistics::Merge(const SortednessStatistics &other) {
+	if (!other.has_values) {
+		return;
+	}
+	if (!has_values) {
+		*this = other;
+		return;
+	}
+	// the rows of "other" are appended after the rows covered by these statistics
+	if (is_ascending &&
+	    !(other.is_ascending && ValueOperations::DistinctLessThanEquals(last_value, other.first_value))) {
+		is_ascending = false;
+	}
+	if (is_descending &&
+	    !(other.is_descending && ValueOperations::DistinctGreaterThanEquals(last_value, other.first_value))) {
+		is_descending = false;
+	}
+	last_value = other.last_value;
+}
+
+void SortednessStatistics::SetUnsorted() {
+	is_ascending = false;
+	is_descending = false;
+}
+
+bool SortednessStatistics::IsSorted(OrderType order_type) const {
+	switch (order_type) {
+	case OrderType::ASCENDING:
+		return is_ascending;
+	case OrderType::DESCENDING:
+		return is_descending;
+	default:
+		return false;
+	}
+}
+
+unique_ptr<SortednessStatistics> SortednessStatistics::Copy() const {
+	return make_uniq<SortednessStatistics>(*this);
+}
+
+} // namespace duckdb
@@ -22,6 +22,10 @@ BaseStatistics StringStats::CreateUnknown(LogicalType type) {
 	string_data.max_string_length = 0;
 	string_data.has_max_string_length = false;
 	string_data.has_unicode = true;
+	string_data.has_ngram_filter = false;
+	for (idx_t i = 0; i < StringStatsData::NGRAM_FILTER_WORDS; i++) {
+		string_data.ngram_filter[i] = NumericLimits<uint64_t>::Maximum();
+	}
 	return result;
 }
 
@@ -36,6 +40,10 @@ BaseStatistics StringStats::CreateEmpty(LogicalType type) {
 	string_data.max_string_length = 0;
 	string_data.has_max_string_length = true;
 	string_data.has_unicode = false;
+	string_data.has_ngram_filter = true;
+	for (idx_t i = 0; i < StringStatsData::NGRAM_FILTER_WORDS; i++) {
+		string_data.ngram_filter[i] = 0;
+	}
 	return result;
 }
 
@@ -63,6 +71,13 @@ uint32_t StringStats::MaxStringLength(const BaseStatistics &stats) {
 	return StringStats::GetDataUnsafe(stats).max_string_length;
 }
 
+bool StringStats::HasNGramFilter(const BaseStatistics &stats) {
+	if (stats.GetType().id() == LogicalTypeId::SQLNULL) {
+		return false;
+	}
+	return StringStats::GetDataUnsafe(stats).has_ngram_filter;
+}
+
 bool StringStats::CanContainUnicode(const BaseStatistics &stats) {
 	if (stats.GetType().id() == LogicalTypeId::SQLNULL) {
 		return true;
@@ -103,6 +118,12 @@ void StringStats::Serialize(const BaseStatistics &stats, Serializer &serializer)
 	serializer.WriteProperty(202, "has_unicode", string_data.has_unicode);
 	serializer.WriteProperty(203, "has_max_string_length", string_data.has_max_string_length);
 	serializer.WriteProperty(204, "max_string_length", string_data.max_string_length);
+	vector<uint64_t> ngram_filter;
+	if (string_data.has_ngram_filter) {
+		ngram_filter.insert(ngram_filter.end(), string_data.ngram_filter,
+		                    string_data.ngram_filter + StringStatsData::NGRAM_FILTER_WORDS);
+	}
+	serializer.WritePropertyWithDefault(205, "ngram_filter", ngram_filter, vector<uint64_t>());
 }
 
 void StringStats::Deserialize(Deserializer &deserializer, BaseStatistics &base) {
@@ -112,6 +133,12 @@ void StringStats::Deserialize(Deserializer &deserializer, BaseStatistics &base)
 	deserializer.ReadProperty(202, "has_unicode", string_data.has_unicode);
 	deserializer.ReadProperty(203, "has_max_string_length", string_data.has_max_string_length);
 	deserializer.ReadProperty(204, "max_string_length", string_data.max_string_length);
+	// the ngram filter is absent in statistics written by older versions
+	auto ngram_filter = deserializer.ReadPropertyWithDefault<vector<uint64_t>>(205, "ngram_filter");
+	string_data.has_ngram_filter = ngram_filter.size() == StringStatsData::NGRAM_FILTER_WORDS;
+	for (idx_t i = 0; i < StringStatsData::NGRAM_FILTER_WORDS; i++) {
+		string_data.ngram_filter[i] = string_data.has_ngram_filter ? ngram_filter[i] : 0;
+	}
 }
 
 static int StringValueComparison(const_data_ptr_t data, idx_t len, const_data_ptr_t comparison) {
@@ -126,6 +153,20 @@ static int StringValueComparison(const_data_ptr_t data, idx_t len, const_data_pt
 	return 0;
 }
 
+//! Maps a 3-byte window onto a bit position in the ngram filter using a multiplicative hash
+static inline void SetNGramBit(uint64_t ngram_filter[], const_data_ptr_t data) {
+	uint64_t ngram = (uint64_t(data[0]) << 16) | (uint64_t(data[1]) << 8) | uint64_t(data[2]);
+	uint64_t bit = (ngram * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - 8);
+	D_ASSERT(bit < StringStatsData::NGRAM_FILTER_BITS);
+	ngram_filter[bit >> 6] |= uint64_t(1) << (bit & 63);
+}
+
+static inline bool NGramBitIsSet(const uint64_t ngram_filter[], const_data_ptr_t data) {
+	uint64_t ngram = (uint64_t(data[0]) << 16) | (uint64_t(data[1]) << 8) | uint64_t(data[2]);
+	uint64_t bit = (ngram * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - 8);
+	return (ngram_filter[bit >> 6] >> (bit & 63)) & 1;
+}
+
 static void ConstructValue(const_data_ptr_t data, idx_t size, data_t target[]) {
 	idx_t value_size = size > StringStatsData::MAX_STRING_MINMAX_SIZE ? StringStatsData::MAX_STRING_MINMAX_SIZE : size;
 	memcpy(target, data, value_size);
@@ -154,6 +195,11 @@ void StringStats::Update(BaseStatistics &stats, const string_t &value) {
 	if (size > string_data.max_string_length) {
 		string_data.max_string_length = UnsafeNumericCast<uint32_t>(size);
 	}
+	if (string_data.has_ngram_filter) {
+		for (idx_t i = 0; i + 2 < size; i++) {
+			SetNGramBit(string_data.ngram_filter, data + i);
+		}
+	}
 	if (stats.GetType().id() == LogicalTypeId::VARCHAR && !string_data.has_unicode) {
 		auto unicode = Utf8Proc::Analyze(const_char_ptr_cast(data), size);
 		if (unicode == UnicodeType::UNICODE) {
@@ -183,6 +229,10 @@ void StringStats::Merge(BaseStatistics &stats, const BaseStatistics &other) {
 	string_data.has_unicode = string_data.has_unicode || other_data.has_unicode;
 	string_data.has_max_string_length = string_data.has_max_string_length && other_data.has_max_string_length;
 	string_data.max_string_length = MaxValue<uint32_t>(string_data.max_string_length, other_data.max_string_length);
+	string_data.has_ngram_filter = string_data.has_ngram_filter && other_data.has_ngram_filter;
+	for (idx_t i = 0; i < StringStatsData::NGRAM_FILTER_WORDS; i++) {
+		string_data.ngram_filter[i] |= other_data.ngram_filter[i];
+	}
 }
 
 FilterPropagateResult StringStats::CheckZonemap(const BaseStatistics &stats, ExpressionType comparison_type,
@@ -225,6 +275,25 @@ FilterPropagateResult StringStats::CheckZonemap(const BaseStatistics &stats, Exp
 	}
 }
 
+FilterPropagateResult StringStats::CheckContains(const BaseStatistics &stats, const string &value) {
+	auto &string_data = StringStats::GetDataUnsafe(stats);
+	if (string_data.has_max_string_length && value.size() > string_data.max_string_length) {
+		// the value is longer than the longest string - it cannot be contained in any value
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	if (!string_data.has_ngram_filter || value.size() < 3) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto data = const_data_ptr_cast(value.c_str());
+	for (idx_t i = 0; i + 2 < value.size(); i++) {
+		if (!NGramBitIsSet(string_data.ngram_filter, data + i)) {
+			// one of the 3-grams of the value does not occur in any of the strings
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
 static idx_t GetValidMinMaxSubstring(const_data_ptr_t data) {
 	for (idx_t i = 0; i < StringStatsData::MAX_STRING_MINMAX_SIZE; i++) {
 		if (data[i] == '\0') {
@@ -264,6 +333,16 @@ void StringStats::Verify(const BaseStatistics &stats, Vector &vector, const Sele
 		auto data = value.GetData();
 		auto len = value.GetSize();
 		// LCOV_EXCL_START
+		if (string_data.has_ngram_filter) {
+			for (idx_t val_idx = 0; val_idx + 2 < len; val_idx++) {
+				if (!NGramBitIsSet(string_data.ngram_filter, const_data_ptr_cast(data) + val_idx)) {
+					throw InternalException(
+					    "Statistics mismatch: 3-gram of string value not present in ngram filter.\nStatistics: "
+					    "%s\nVector: %s",
+					    stats.ToString(), vector.ToString(count));
+				}
+			}
+		}
 		if (string_data.has_max_string_length && len > string_data.max_string_length) {
 			throw InternalException(
 			    "Statistics mismatch: string value exceeds maximum string length.\nStatistics: %s\nVector: %s",
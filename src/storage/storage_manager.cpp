@@ -18,8 +18,8 @@
 
 namespace duckdb {
 
-StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only)
-    : db(db), path(std::move(path_p)), read_only(read_only) {
+StorageManager::StorageManager(AttachedDatabase &db, string path_p, bool read_only, bool use_direct_io)
+    : db(db), path(std::move(path_p)), read_only(read_only), use_direct_io(use_direct_io) {
 
 	if (path.empty()) {
 		path = IN_MEMORY_PATH;
@@ -99,6 +99,18 @@ string StorageManager::GetWALPath() {
 	return wal_path;
 }
 
+string StorageManager::GetWorkingSetPath() {
+
+	std::size_t question_mark_pos = path.find('?');
+	auto working_set_path = path;
+	if (question_mark_pos != std::string::npos) {
+		working_set_path.insert(question_mark_pos, ".workingset");
+	} else {
+		working_set_path += ".workingset";
+	}
+	return working_set_path;
+}
+
 bool StorageManager::InMemory() {
 	D_ASSERT(!path.empty());
 	return path == IN_MEMORY_PATH;
@@ -134,8 +146,9 @@ public:
 	}
 };
 
-SingleFileStorageManager::SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only)
-    : StorageManager(db, std::move(path), read_only) {
+SingleFileStorageManager::SingleFileStorageManager(AttachedDatabase &db, string path, bool read_only,
+                                                   bool use_direct_io)
+    : StorageManager(db, std::move(path), read_only, use_direct_io) {
 }
 
 void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size) {
@@ -155,7 +168,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 
 	StorageManagerOptions options;
 	options.read_only = read_only;
-	options.use_direct_io = config.options.use_direct_io;
+	options.use_direct_io = config.options.use_direct_io || use_direct_io;
 	options.debug_initialize = config.options.debug_initialize;
 
 	// Check if the database file already exists.
@@ -221,6 +234,9 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 	}
 
 	load_complete = true;
+
+	// optionally pre-load the working set of the previous session into the buffer pool
+	RestoreWorkingSet();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -277,7 +293,12 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	if (wal.GroupCommitEnabled()) {
+		// defer the disk sync - the transaction manager syncs after releasing its locks (group commit)
+		wal.FlushGroupCommit();
+	} else {
+		wal.Flush();
+	}
 	state = WALCommitState::FLUSHED;
 }
 
@@ -347,4 +368,79 @@ shared_ptr<TableIOManager> SingleFileStorageManager::GetTableIOManager(BoundCrea
 	return shared_ptr<TableIOManager>(shared_ptr<char>(nullptr), table_io_manager.get());
 }
 
+//! Magic number and version of the working-set sidecar file used for warm restarts
+static constexpr uint64_t WORKING_SET_MAGIC = 0x4455434B57534554ULL; // "DUCKWSET"
+static constexpr uint64_t WORKING_SET_VERSION = 1;
+
+void SingleFileStorageManager::PersistWorkingSet() {
+	if (InMemory() || read_only || !load_complete) {
+		return;
+	}
+	auto &config = DBConfig::Get(db);
+	if (!config.options.warm_restart) {
+		return;
+	}
+	auto &fs = FileSystem::Get(db);
+	try {
+		auto block_ids = block_manager->GetResidentBlockIds();
+		// sort the ids so that restoring reads the database file mostly sequentially
+		std::sort(block_ids.begin(), block_ids.end());
+		BufferedFileWriter writer(fs, GetWorkingSetPath(),
+		                          FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		writer.Write<uint64_t>(WORKING_SET_MAGIC);
+		writer.Write<uint64_t>(WORKING_SET_VERSION);
+		writer.Write<uint64_t>(block_manager->GetBlockAllocSize());
+		writer.Write<uint64_t>(block_ids.size());
+		for (auto &block_id : block_ids) {
+			writer.Write<block_id_t>(block_id);
+		}
+		writer.Sync();
+	} catch (...) { // NOLINT
+		// the working set is only a hint - failing to persist it must not fail the shutdown
+	}
+}
+
+void SingleFileStorageManager::RestoreWorkingSet() {
+	if (InMemory() || !load_complete) {
+		return;
+	}
+	auto &config = DBConfig::Get(db);
+	if (!config.options.warm_restart) {
+		return;
+	}
+	auto &fs = FileSystem::Get(db);
+	auto working_set_path = GetWorkingSetPath();
+	if (!fs.FileExists(working_set_path)) {
+		return;
+	}
+	try {
+		BufferedFileReader reader(fs, working_set_path.c_str());
+		if (reader.Read<uint64_t>() != WORKING_SET_MAGIC || reader.Read<uint64_t>() != WORKING_SET_VERSION ||
+		    reader.Read<uint64_t>() != block_manager->GetBlockAllocSize()) {
+			// the file was written by a different version or refers to a different block size: ignore it
+			return;
+		}
+		auto count = reader.Read<uint64_t>();
+		auto total_blocks = NumericCast<block_id_t>(block_manager->TotalBlocks());
+		auto block_alloc_size = block_manager->GetBlockAllocSize();
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		for (idx_t i = 0; i < count; i++) {
+			auto block_id = reader.Read<block_id_t>();
+			if (block_id < 0 || block_id >= total_blocks) {
+				// the database file shrank since the working set was written
+				continue;
+			}
+			if (buffer_manager.GetUsedMemory() + block_alloc_size > buffer_manager.GetMaxMemory()) {
+				// pre-loading any further would evict the blocks we just loaded
+				break;
+			}
+			// pinning reads the block from disk; dropping the handle leaves it resident but evictable
+			auto handle = block_manager->RegisterBlock(block_id);
+			buffer_manager.Pin(handle);
+		}
+	} catch (...) { // NOLINT
+		// the working set is only a hint - failing to restore it must not fail the load
+	}
+}
+
 } // namespace duckdb
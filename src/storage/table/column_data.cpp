@@ -1,8 +1,11 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
@@ -293,12 +296,132 @@ idx_t ColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t scan_c
 	return ScanVector(state, result, scan_count, ScanVectorType::SCAN_FLAT_VECTOR);
 }
 
+template <class T, class OP>
+static idx_t SortedBoundarySearch(UnifiedVectorFormat &vdata, idx_t scan_count, T predicate) {
+	// find the first index for which OP(value, predicate) holds; the values are sorted, so OP is monotonic
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	idx_t lo = 0;
+	idx_t hi = scan_count;
+	while (lo < hi) {
+		idx_t mid = lo + (hi - lo) / 2;
+		if (OP::Operation(data[vdata.sel->get_index(mid)], predicate)) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return lo;
+}
+
+template <class T>
+static bool TemplatedSortedRangeSpan(UnifiedVectorFormat &vdata, const ConstantFilter &filter, idx_t scan_count,
+                                     idx_t &span_start, idx_t &span_end) {
+	auto predicate = filter.constant.GetValueUnsafe<T>();
+	span_start = 0;
+	span_end = scan_count;
+	switch (filter.comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		span_start = SortedBoundarySearch<T, GreaterThanEquals>(vdata, scan_count, predicate);
+		span_end = SortedBoundarySearch<T, GreaterThan>(vdata, scan_count, predicate);
+		return true;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		span_start = SortedBoundarySearch<T, GreaterThan>(vdata, scan_count, predicate);
+		return true;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		span_start = SortedBoundarySearch<T, GreaterThanEquals>(vdata, scan_count, predicate);
+		return true;
+	case ExpressionType::COMPARE_LESSTHAN:
+		span_end = SortedBoundarySearch<T, GreaterThanEquals>(vdata, scan_count, predicate);
+		return true;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		span_end = SortedBoundarySearch<T, GreaterThan>(vdata, scan_count, predicate);
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Converts a constant comparison filter over a sorted NULL-free vector into a row span by binary searching the
+//! boundaries, instead of comparing every value
+static bool TrySortedFilterSelection(const LogicalType &type, UnifiedVectorFormat &vdata, const TableFilter &filter,
+                                     SelectionVector &sel, idx_t &approved_tuple_count, idx_t scan_count) {
+	if (filter.filter_type != TableFilterType::CONSTANT_COMPARISON) {
+		return false;
+	}
+	auto &constant_filter = filter.Cast<ConstantFilter>();
+	if (constant_filter.constant.type().InternalType() != type.InternalType()) {
+		return false;
+	}
+	idx_t span_start;
+	idx_t span_end;
+	bool success;
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		success = TemplatedSortedRangeSpan<int8_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::INT16:
+		success = TemplatedSortedRangeSpan<int16_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::INT32:
+		success = TemplatedSortedRangeSpan<int32_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::INT64:
+		success = TemplatedSortedRangeSpan<int64_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::UINT8:
+		success = TemplatedSortedRangeSpan<uint8_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::UINT16:
+		success = TemplatedSortedRangeSpan<uint16_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::UINT32:
+		success = TemplatedSortedRangeSpan<uint32_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::UINT64:
+		success = TemplatedSortedRangeSpan<uint64_t>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::FLOAT:
+		success = TemplatedSortedRangeSpan<float>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	case PhysicalType::DOUBLE:
+		success = TemplatedSortedRangeSpan<double>(vdata, constant_filter, scan_count, span_start, span_end);
+		break;
+	default:
+		success = false;
+		break;
+	}
+	if (!success) {
+		return false;
+	}
+	// restrict the current selection to the span; the selection indices are in increasing order
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (idx >= span_start && idx < span_end) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return true;
+}
+
 void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                         SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
+	auto segment = state.current;
+	const auto start_row = state.row_index;
 	idx_t scan_count = Scan(transaction, vector_index, state, result);
 
 	UnifiedVectorFormat vdata;
 	result.ToUnifiedFormat(scan_count, vdata);
+	// if the entire vector comes from a segment that is known to be sorted, range filters can binary search the
+	// boundaries instead of comparing every value
+	if (segment && segment->stats.is_sorted && !HasUpdates() &&
+	    start_row + scan_count <= segment->start + segment->count &&
+	    TrySortedFilterSelection(type, vdata, filter, sel, s_count, scan_count)) {
+		return;
+	}
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, s_count);
 }
 
@@ -390,13 +513,75 @@ void ColumnData::InitializeAppend(ColumnAppendState &state) {
 	D_ASSERT(state.current->function.get().append);
 }
 
+template <class T>
+static bool TemplatedAppendIsSorted(UnifiedVectorFormat &vdata, idx_t offset, idx_t count, const Value &previous_max,
+                                    bool has_previous_values) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto &mask = vdata.validity;
+	bool started = has_previous_values;
+	T prev = started ? previous_max.GetValueUnsafe<T>() : T();
+	for (idx_t i = offset; i < offset + count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!mask.RowIsValid(idx)) {
+			// NULLs break the run - we cannot prove where they end up in a sorted result
+			return false;
+		}
+		auto value = data[idx];
+		if (started && LessThan::Operation(value, prev)) {
+			return false;
+		}
+		prev = value;
+		started = true;
+	}
+	return true;
+}
+
+static bool AppendIsSorted(const LogicalType &type, UnifiedVectorFormat &vdata, idx_t offset, idx_t count,
+                           const Value &previous_max, bool has_previous_values) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedAppendIsSorted<int8_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::INT16:
+		return TemplatedAppendIsSorted<int16_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::INT32:
+		return TemplatedAppendIsSorted<int32_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::INT64:
+		return TemplatedAppendIsSorted<int64_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::UINT8:
+		return TemplatedAppendIsSorted<uint8_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::UINT16:
+		return TemplatedAppendIsSorted<uint16_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::UINT32:
+		return TemplatedAppendIsSorted<uint32_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::UINT64:
+		return TemplatedAppendIsSorted<uint64_t>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::FLOAT:
+		return TemplatedAppendIsSorted<float>(vdata, offset, count, previous_max, has_previous_values);
+	case PhysicalType::DOUBLE:
+		return TemplatedAppendIsSorted<double>(vdata, offset, count, previous_max, has_previous_values);
+	default:
+		return false;
+	}
+}
+
 void ColumnData::AppendData(BaseStatistics &append_stats, ColumnAppendState &state, UnifiedVectorFormat &vdata,
                             idx_t append_count) {
 	idx_t offset = 0;
 	this->count += append_count;
 	while (true) {
+		auto &segment = *state.current;
+		Value previous_max;
+		const idx_t preceding_count = segment.count;
+		if (segment.stats.is_sorted && preceding_count > 0) {
+			// the max of a non-decreasing segment is its last value
+			previous_max = NumericStats::Max(segment.stats.statistics);
+		}
 		// append the data from the vector
 		idx_t copied_elements = state.current->Append(state, vdata, offset, append_count);
+		if (segment.stats.is_sorted &&
+		    !AppendIsSorted(type, vdata, offset, copied_elements, previous_max, preceding_count > 0)) {
+			segment.stats.is_sorted = false;
+		}
 		append_stats.Merge(state.current->stats.statistics);
 		if (copied_elements == append_count) {
 			// finished copying everything
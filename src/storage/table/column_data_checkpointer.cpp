@@ -97,6 +97,66 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 	return found ? compression_type : CompressionType::COMPRESSION_AUTO;
 }
 
+CompressionType ColumnDataCheckpointer::GetReusableCompressionType() {
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	if (!config.options.checkpoint_compression_reuse) {
+		return CompressionType::COMPRESSION_AUTO;
+	}
+	// reuse is only considered when no compression method is forced
+	if (checkpoint_info.GetCompressionType() != CompressionType::COMPRESSION_AUTO ||
+	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
+		return CompressionType::COMPRESSION_AUTO;
+	}
+	// only reuse when all segments were previously written by the same compression method
+	// a transient segment holds newly appended data whose distribution has not been analyzed yet
+	CompressionType reuse_type = CompressionType::COMPRESSION_AUTO;
+	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+		auto segment = nodes[segment_idx].node.get();
+		if (segment->segment_type != ColumnSegmentType::PERSISTENT) {
+			return CompressionType::COMPRESSION_AUTO;
+		}
+		auto segment_compression = segment->function.get().type;
+		if (reuse_type == CompressionType::COMPRESSION_AUTO) {
+			reuse_type = segment_compression;
+		} else if (reuse_type != segment_compression) {
+			return CompressionType::COMPRESSION_AUTO;
+		}
+	}
+	return reuse_type;
+}
+
+unique_ptr<AnalyzeState> ColumnDataCheckpointer::TryReusePreviousCompression(idx_t &compression_idx) {
+	auto reuse_type = GetReusableCompressionType();
+	if (reuse_type == CompressionType::COMPRESSION_AUTO) {
+		return nullptr;
+	}
+	idx_t function_idx = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < compression_functions.size(); i++) {
+		if (compression_functions[i] && compression_functions[i]->type == reuse_type) {
+			function_idx = i;
+			break;
+		}
+	}
+	if (function_idx == DConstants::INVALID_INDEX) {
+		return nullptr;
+	}
+	// run the analyze step for only this function
+	// if it can no longer handle the (updated) data we fall back to the full analyze pass
+	auto &function = *compression_functions[function_idx];
+	auto analyze_state = function.init_analyze(col_data, col_data.type.InternalType());
+	bool success = analyze_state != nullptr;
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (success) {
+			success = function.analyze(*analyze_state, scan_vector, count);
+		}
+	});
+	if (!success || function.final_analyze(*analyze_state) == DConstants::INVALID_INDEX) {
+		return nullptr;
+	}
+	compression_idx = function_idx;
+	return analyze_state;
+}
+
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
 	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
@@ -187,9 +247,14 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	}
 
 	// now we need to write our segment
-	// we will first run an analyze step that determines which compression function to use
+	// if the column only saw updates since the last checkpoint we try to reuse the compression
+	// method that wrote the previous segments, otherwise we run the full analyze step over all
+	// compression functions to determine which one to use
 	idx_t compression_idx;
-	auto analyze_state = DetectBestCompressionMethod(compression_idx);
+	auto analyze_state = TryReusePreviousCompression(compression_idx);
+	if (!analyze_state) {
+		analyze_state = DetectBestCompressionMethod(compression_idx);
+	}
 
 	if (!analyze_state) {
 		throw FatalException("No suitable compression/storage method found to store column");
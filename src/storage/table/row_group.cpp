@@ -21,17 +21,19 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), has_changes(true), allocation_size(0) {
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
-    : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), allocation_size(0) {
+    : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), has_changes(false),
+      allocation_size(0) {
 	// deserialize the columns
 	if (pointer.data_pointers.size() != collection_p.GetTypes().size()) {
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
@@ -50,6 +52,10 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
 	this->collection = collection_p;
+	if (new_start == this->start) {
+		// the row start is unchanged - we do not need to touch any of the data
+		return;
+	}
 	this->start = new_start;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
@@ -60,6 +66,8 @@ void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_star
 			vinfo->SetStart(new_start);
 		}
 	}
+	// the row start is serialized both in the row group pointer and in the column segments
+	has_changes = true;
 }
 
 RowGroup::~RowGroup() {
@@ -99,9 +107,13 @@ ColumnData &RowGroup::GetColumn(storage_t c) {
 	auto &metadata_manager = GetCollection().GetMetadataManager();
 	auto &types = GetCollection().GetTypes();
 	auto &block_pointer = column_pointers[c];
-	MetadataReader column_data_reader(metadata_manager, block_pointer);
+	// record the metadata blocks the column pointers occupy - once all columns are loaded, an unchanged
+	// row group can re-use them as-is at the next checkpoint
+	vector<MetaBlockPointer> read_pointers;
+	MetadataReader column_data_reader(metadata_manager, block_pointer, &read_pointers);
 	this->columns[c] =
 	    ColumnData::Deserialize(GetBlockManager(), GetTableInfo(), c, start, column_data_reader, types[c]);
+	column_metadata_pointers.insert(column_metadata_pointers.end(), read_pointers.begin(), read_pointers.end());
 	is_loaded[c] = true;
 	if (this->columns[c]->count != this->count) {
 		throw InternalException("Corrupted database - loaded column with index %llu at row start %llu, count %llu did "
@@ -394,9 +406,17 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 		}
 		return max_count;
 	}
+	case TableFilterType::CONSTANT_COMPARISON:
+		if (state.zonemap_prune_target != DConstants::INVALID_INDEX) {
+			// the compression method excluded matches up to this row only, not for the entire segment
+			auto target_row = state.zonemap_prune_target;
+			state.zonemap_prune_target = DConstants::INVALID_INDEX;
+			return target_row;
+		}
+		return state.current->start + state.current->count;
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
-	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::EXPRESSION_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -485,6 +505,8 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 			count = max_count;
 		}
 		auto &block_manager = GetBlockManager();
+		auto &buffer_manager = block_manager.buffer_manager;
+		auto prefetch_depth = DBConfig::GetConfig(buffer_manager.GetDatabase()).options.scan_prefetch_depth;
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
 		// // in regular operation we only prefetch from remote file systems
 		// // when alternative verify is set, we always prefetch for testing purposes
@@ -500,8 +522,19 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], max_count);
 				}
 			}
-			auto &buffer_manager = block_manager.buffer_manager;
 			buffer_manager.Prefetch(prefetch_state.blocks);
+		} else if (prefetch_depth > 0 && !block_manager.InMemory()) {
+			// read-ahead is enabled: schedule a background read of the segments covering the next vectors,
+			// so the disk reads overlap with scanning the current vector
+			PrefetchState prefetch_state;
+			idx_t prefetch_rows = max_count + prefetch_depth * STANDARD_VECTOR_SIZE;
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				const auto &column = column_ids[i];
+				if (column != COLUMN_IDENTIFIER_ROW_ID) {
+					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], prefetch_rows);
+				}
+			}
+			buffer_manager.PrefetchAsync(std::move(prefetch_state.blocks));
 		}
 
 		if (count == max_count && !table_filters) {
@@ -532,8 +565,8 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 				sel.Initialize(nullptr);
 			}
 			//! first, we scan the columns with filters, fetch their data and generate a selection vector.
-			//! get runtime statistics
-			auto start_time = high_resolution_clock::now();
+			//! the filters run in the order of the adaptive permutation, and we record the observed selectivity
+			//! and cost of each filter so the permutation keeps cheap and selective filters in front
 			if (table_filters) {
 				D_ASSERT(adaptive_filter);
 				D_ASSERT(ALLOW_UPDATES);
@@ -541,9 +574,33 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					auto tf_idx = adaptive_filter->permutation[i];
 					auto col_idx = column_ids[tf_idx];
 					auto &col_data = GetColumn(col_idx);
-					col_data.Select(transaction, state.vector_index, state.column_scans[tf_idx], result.data[tf_idx],
-					                sel, approved_tuple_count, *table_filters->filters[tf_idx]);
+					auto &filter = *table_filters->filters[tf_idx];
+					auto filter_input_count = approved_tuple_count;
+					auto filter_start_time = high_resolution_clock::now();
+					if (filter.filter_type == TableFilterType::EXPRESSION_FILTER) {
+						// expression filter: scan the column and evaluate the expression over the remaining rows
+						auto &result_vector = result.data[tf_idx];
+						if (TYPE == TableScanType::TABLE_SCAN_REGULAR) {
+							col_data.Scan(transaction, state.vector_index, state.column_scans[tf_idx], result_vector);
+						} else {
+							col_data.ScanCommitted(state.vector_index, state.column_scans[tf_idx], result_vector,
+							                       ALLOW_UPDATES);
+						}
+						auto executor = state.GetFilterExecutor(tf_idx);
+						if (!executor) {
+							throw InternalException("Expression filter in a table scan without an expression executor");
+						}
+						filter.Cast<ExpressionFilter>().Select(result_vector, *executor, sel, approved_tuple_count);
+					} else {
+						col_data.Select(transaction, state.vector_index, state.column_scans[tf_idx],
+						                result.data[tf_idx], sel, approved_tuple_count, filter);
+					}
+					auto filter_end_time = high_resolution_clock::now();
+					adaptive_filter->ObserveFilter(
+					    tf_idx, filter_input_count, approved_tuple_count,
+					    duration_cast<duration<double>>(filter_end_time - filter_start_time).count());
 				}
+				adaptive_filter->AdaptTableFilterOrder();
 				for (auto &table_filter : table_filters->filters) {
 					result.data[table_filter.first].Slice(sel, approved_tuple_count);
 				}
@@ -590,10 +647,6 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 				}
 			}
-			auto end_time = high_resolution_clock::now();
-			if (adaptive_filter && table_filters->filters.size() > 1) {
-				adaptive_filter->AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - start_time).count());
-			}
 			D_ASSERT(approved_tuple_count > 0);
 			count = approved_tuple_count;
 		}
@@ -725,6 +778,7 @@ void RowGroup::AppendVersionInfo(TransactionData transaction, idx_t count) {
 	auto &vinfo = GetOrCreateVersionInfo();
 	vinfo.AppendVersionInfo(transaction, count, row_group_start, row_group_end);
 	this->count = row_group_end;
+	has_changes = true;
 }
 
 void RowGroup::CommitAppend(transaction_t commit_id, idx_t row_group_start, idx_t count) {
@@ -739,6 +793,7 @@ void RowGroup::RevertAppend(idx_t row_group_start) {
 		column->RevertAppend(UnsafeNumericCast<row_t>(row_group_start));
 	}
 	this->count = MinValue<idx_t>(row_group_start - this->start, this->count);
+	has_changes = true;
 	Verify();
 }
 
@@ -763,6 +818,7 @@ void RowGroup::Append(RowGroupAppendState &state, DataChunk &chunk, idx_t append
 		allocation_size += col_data.GetAllocationSize() - prev_allocation_size;
 	}
 	state.offset_in_row_group += append_count;
+	has_changes = true;
 }
 
 void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_t *ids, idx_t offset, idx_t count,
@@ -809,6 +865,8 @@ unique_ptr<BaseStatistics> RowGroup::GetStatistics(idx_t column_idx) {
 void RowGroup::MergeStatistics(idx_t column_idx, const BaseStatistics &other) {
 	auto &col_data = GetColumn(column_idx);
 	col_data.MergeStatistics(other);
+	// the statistics are serialized together with the column pointers
+	has_changes = true;
 }
 
 void RowGroup::MergeIntoStatistics(idx_t column_idx, BaseStatistics &other) {
@@ -894,11 +952,13 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 
 	// construct the row group pointer and write the column meta data to disk
 	D_ASSERT(write_data.states.size() == columns.size());
+	auto &data_writer = writer.GetPayloadWriter();
+	auto written_pointers = data_writer.GetWrittenPointers();
+	idx_t written_pointer_start = written_pointers ? written_pointers->size() : 0;
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
-		auto &data_writer = writer.GetPayloadWriter();
 		auto pointer = data_writer.GetMetaBlockPointer();
 
 		// store the stats and the data pointers in the row group pointers
@@ -914,6 +974,51 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		serializer.End();
 	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+	if (written_pointers) {
+		// remember which metadata blocks hold the serialized column pointers
+		// as long as the row group is not modified, subsequent checkpoints can re-use them as-is
+		column_pointers = row_group_pointer.data_pointers;
+		column_metadata_pointers = column_pointers;
+		column_metadata_pointers.insert(column_metadata_pointers.end(),
+		                                written_pointers->begin() + UnsafeNumericCast<int64_t>(written_pointer_start),
+		                                written_pointers->end());
+		has_changes = false;
+	}
+	Verify();
+	return row_group_pointer;
+}
+
+bool RowGroup::CanReuseCheckpointData() {
+	if (has_changes) {
+		return false;
+	}
+	if (column_metadata_pointers.empty()) {
+		// we do not know which metadata blocks the column pointers occupy
+		return false;
+	}
+	if (is_loaded) {
+		// the metadata blocks are recorded as the columns are lazily loaded
+		// they only cover the entire row group once every column has been loaded
+		for (idx_t c = 0; c < columns.size(); c++) {
+			if (!is_loaded[c]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+RowGroupPointer RowGroup::CheckpointUnchanged(MetadataManager &manager) {
+	// the row group is unchanged since it was last read from or written to disk
+	// we can re-use the existing column data and pointers as-is
+	D_ASSERT(CanReuseCheckpointData());
+	// ensure the metadata blocks we are pointing to are not marked as free
+	manager.ClearModifiedBlocks(column_metadata_pointers);
+	RowGroupPointer row_group_pointer;
+	row_group_pointer.row_start = start;
+	row_group_pointer.tuple_count = count;
+	row_group_pointer.data_pointers = column_pointers;
+	row_group_pointer.deletes_pointers = CheckpointDeletes(manager);
 	Verify();
 	return row_group_pointer;
 }
@@ -55,7 +55,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), shared_scan_position(DConstants::INVALID_INDEX) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -63,6 +63,19 @@ idx_t RowGroupCollection::GetTotalRows() const {
 	return total_rows.load();
 }
 
+idx_t RowGroupCollection::GetVisibleCount(TransactionData transaction) {
+	idx_t visible_count = 0;
+	SelectionVector dummy_sel(STANDARD_VECTOR_SIZE);
+	for (auto &row_group : row_groups->Segments()) {
+		idx_t row_group_count = row_group.count;
+		for (idx_t r = 0, vector_idx = 0; r < row_group_count; r += STANDARD_VECTOR_SIZE, vector_idx++) {
+			idx_t max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, row_group_count - r);
+			visible_count += row_group.GetSelVector(transaction, vector_idx, dummy_sel, max_count);
+		}
+	}
+	return visible_count;
+}
+
 const vector<LogicalType> &RowGroupCollection::GetTypes() const {
 	return types;
 }
@@ -162,17 +175,71 @@ bool RowGroupCollection::InitializeScanInRowGroup(CollectionScanState &state, Ro
 	return row_group.InitializeScanWithOffset(state, vector_index);
 }
 
-void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state) {
+void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state, bool shared_scan) {
 	state.collection = this;
 	state.current_row_group = row_groups->GetRootSegment();
+	state.start_row_group = nullptr;
+	state.wrapped = false;
 	state.vector_index = 0;
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
+	state.morsel_vectors = Storage::ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE;
 	state.processed_rows = 0;
+	if (shared_scan) {
+		// attach this scan to the position of any concurrently running scan over the same collection, wrapping around
+		// at the end (circular scan) - concurrent scans then move through the collection together and share the buffer
+		// pool residency of a single physical pass instead of each pinning the row groups independently
+		auto shared_row = shared_scan_position.load();
+		if (shared_row != DConstants::INVALID_INDEX && shared_row >= row_start && shared_row < state.max_row) {
+			auto row_group = row_groups->GetSegment(shared_row);
+			if (row_group && row_group->count > 0 && row_group != state.current_row_group) {
+				state.current_row_group = row_group;
+				state.start_row_group = row_group;
+			}
+		}
+	}
 }
 
+RowGroup *RowGroupCollection::GetNextScanSegment(ParallelCollectionScanState &state, RowGroup *row_group) {
+	auto next = row_groups->GetNextSegment(row_group);
+	if (next && next->count == 0) {
+		// empty row groups can only occur at the end of the collection
+		next = nullptr;
+	}
+	if (!next && state.start_row_group && !state.wrapped) {
+		// this scan attached to another scan midway through the collection
+		// wrap around to scan the row groups we skipped at the start
+		state.wrapped = true;
+		next = row_groups->GetRootSegment();
+	}
+	if (state.wrapped && next == state.start_row_group) {
+		// the circular scan arrived back at its starting point - the full collection has been scanned
+		return nullptr;
+	}
+	return next;
+}
+
+//! The morsel size is halved when a morsel takes longer than this to scan (straggler morsels)
+static constexpr double MORSEL_TIME_MAX = 0.1;
+//! The morsel size is doubled when a morsel completes faster than this (scheduling overhead dominates)
+static constexpr double MORSEL_TIME_MIN = 0.001;
+//! The largest morsel size we hand out, in vectors
+static constexpr idx_t MAXIMUM_MORSEL_VECTORS = 16 * (Storage::ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE);
+
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
+	auto claim_time = high_resolution_clock::now();
+	if (scan_state.morsel_timing_valid) {
+		// adapt the morsel size based on how long this thread took to scan its previously claimed morsel
+		auto morsel_seconds = duration<double>(claim_time - scan_state.morsel_start_time).count();
+		lock_guard<mutex> l(state.lock);
+		if (morsel_seconds > MORSEL_TIME_MAX && state.morsel_vectors > 1) {
+			state.morsel_vectors /= 2;
+		} else if (morsel_seconds < MORSEL_TIME_MIN && state.morsel_vectors < MAXIMUM_MORSEL_VECTORS) {
+			state.morsel_vectors *= 2;
+		}
+		scan_state.morsel_timing_valid = false;
+	}
 	while (true) {
 		idx_t vector_index;
 		idx_t max_row;
@@ -187,6 +254,8 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			collection = state.collection;
 			row_group = state.current_row_group;
+			// publish the scan position so that new scans over this collection can attach to it
+			shared_scan_position = row_group->start;
 			if (ClientConfig::GetConfig(context).verify_parallelism) {
 				vector_index = state.vector_index;
 				max_row = state.current_row_group->start +
@@ -195,14 +264,32 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
 				state.vector_index++;
 				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
-					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+					state.current_row_group = GetNextScanSegment(state, state.current_row_group);
 					state.vector_index = 0;
 				}
 			} else {
-				state.processed_rows += state.current_row_group->count;
-				vector_index = 0;
+				vector_index = state.vector_index;
 				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				idx_t claimed_rows = state.current_row_group->count - vector_index * STANDARD_VECTOR_SIZE;
+				idx_t morsel_rows = state.morsel_vectors * STANDARD_VECTOR_SIZE;
+				if (morsel_rows < claimed_rows) {
+					// the morsel covers only a part of the current row group
+					state.vector_index += state.morsel_vectors;
+					max_row = state.current_row_group->start + state.vector_index * STANDARD_VECTOR_SIZE;
+					claimed_rows = morsel_rows;
+				} else {
+					// claim the remainder of the current row group, plus any whole subsequent row groups that still
+					// fit in the morsel - but only while they are contiguous (a circular scan can wrap around)
+					state.vector_index = 0;
+					state.current_row_group = GetNextScanSegment(state, state.current_row_group);
+					while (state.current_row_group && state.current_row_group->start == max_row &&
+					       claimed_rows + state.current_row_group->count <= morsel_rows) {
+						claimed_rows += state.current_row_group->count;
+						max_row = state.current_row_group->start + state.current_row_group->count;
+						state.current_row_group = GetNextScanSegment(state, state.current_row_group);
+					}
+				}
+				state.processed_rows += claimed_rows;
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -216,6 +303,8 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			// skip this row group
 			continue;
 		}
+		scan_state.morsel_start_time = claim_time;
+		scan_state.morsel_timing_valid = true;
 		return true;
 	}
 	lock_guard<mutex> l(state.lock);
@@ -266,14 +355,17 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
 	// figure out which row_group to fetch from
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 	idx_t count = 0;
+	RowGroup *row_group = nullptr;
 	for (idx_t i = 0; i < fetch_count; i++) {
 		auto row_id = row_ids[i];
-		RowGroup *row_group;
-		{
+		//	index scans emit sorted row ids, so consecutive fetches usually hit the same row group
+		if (!row_group || UnsafeNumericCast<idx_t>(row_id) < row_group->start ||
+		    UnsafeNumericCast<idx_t>(row_id) >= row_group->start + row_group->count) {
 			idx_t segment_index;
 			auto l = row_groups->Lock();
 			if (!row_groups->TryGetSegmentIndex(l, UnsafeNumericCast<idx_t>(row_id), segment_index)) {
 				// in parallel append scenarios it is possible for the row_id
+				row_group = nullptr;
 				continue;
 			}
 			row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
@@ -336,6 +428,13 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 	idx_t total_append_count = chunk.size();
 	idx_t remaining = chunk.size();
 	state.total_append_count += total_append_count;
+	{
+		// update the sortedness before the chunk is possibly sliced by the append loop below
+		auto stats_lock = stats.GetLock();
+		for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+			stats.GetStats(*stats_lock, col_idx).UpdateSortedness(chunk.data[col_idx], chunk.size());
+		}
+	}
 	while (true) {
 		auto current_row_group = state.row_group_append_state.row_group;
 		// check how much we can fit into the current row_group
@@ -519,6 +618,11 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto column_id = column_ids[i];
 			stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
+			auto &column_stats = stats.GetStats(*l, column_id.index);
+			if (column_stats.HasSortednessStats()) {
+				// in-place updates can reorder the values of the column
+				column_stats.SortednessStats().SetUnsorted();
+			}
 		}
 	} while (pos < updates.size());
 }
@@ -600,7 +704,12 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 	row_group->UpdateColumn(transaction, updates, row_ids, column_path);
 
 	auto lock = stats.GetLock();
-	row_group->MergeIntoStatistics(primary_column_idx, stats.GetStats(*lock, primary_column_idx).Statistics());
+	auto &primary_column_stats = stats.GetStats(*lock, primary_column_idx);
+	row_group->MergeIntoStatistics(primary_column_idx, primary_column_stats.Statistics());
+	if (primary_column_stats.HasSortednessStats()) {
+		// in-place updates can reorder the values of the column
+		primary_column_stats.SortednessStats().SetUnsorted();
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -970,7 +1079,11 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		}
 		// schedule a checkpoint task for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
-		ScheduleCheckpointTask(checkpoint_state, segment_idx);
+		if (!entry.node->CanReuseCheckpointData()) {
+			// the row group has changed since the last checkpoint - it has to be rewritten
+			// unchanged row groups are skipped here and re-use their on-disk data when they are finalized
+			ScheduleCheckpointTask(checkpoint_state, segment_idx);
+		}
 		vacuum_state.row_start += entry.node->count;
 	}
 	// all tasks have been scheduled - execute tasks until we are done
@@ -997,12 +1110,19 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			continue;
 		}
 		auto &row_group = *entry.node;
+		RowGroupPointer pointer;
 		auto row_group_writer = std::move(checkpoint_state.writers[segment_idx]);
-		if (!row_group_writer) {
+		if (row_group_writer) {
+			pointer = row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer,
+			                               global_stats);
+		} else if (row_group.CanReuseCheckpointData()) {
+			// no checkpoint task was scheduled for this row group - it is unchanged since the last checkpoint
+			// re-use the on-disk data as-is; the global statistics already cover the row group,
+			// as they were copied from the table statistics
+			pointer = row_group.CheckpointUnchanged(GetMetadataManager());
+		} else {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
-		auto pointer =
-		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
@@ -1176,4 +1296,29 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
+void RowGroupCollection::SetHistogram(column_t column_id, unique_ptr<HistogramStatistics> histogram_stats) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	stats.GetStats(*stats_lock, column_id).SetHistogram(std::move(histogram_stats));
+}
+
+unique_ptr<HistogramStatistics> RowGroupCollection::CopyHistogram(column_t column_id) {
+	auto stats_lock = stats.GetLock();
+	auto &column_stats = stats.GetStats(*stats_lock, column_id);
+	if (!column_stats.HasHistogramStats()) {
+		return nullptr;
+	}
+	return column_stats.HistogramStats().Copy();
+}
+
+bool RowGroupCollection::IsColumnSorted(column_t column_id, OrderType order_type) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	auto &column_stats = stats.GetStats(*stats_lock, column_id);
+	if (!column_stats.HasSortednessStats()) {
+		return false;
+	}
+	return column_stats.SortednessStats().IsSorted(order_type);
+}
+
 } // namespace duckdb
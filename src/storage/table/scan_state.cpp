@@ -1,4 +1,6 @@
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/expression_filter.hpp"
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
@@ -8,6 +10,9 @@
 
 namespace duckdb {
 
+TableScanState::~TableScanState() {
+}
+
 void TableScanState::Initialize(vector<column_t> column_ids, TableFilterSet *table_filters) {
 	this->column_ids = std::move(column_ids);
 	this->table_filters = table_filters;
@@ -17,6 +22,20 @@ void TableScanState::Initialize(vector<column_t> column_ids, TableFilterSet *tab
 	}
 }
 
+void TableScanState::Initialize(vector<column_t> column_ids, ClientContext &context, TableFilterSet *table_filters) {
+	Initialize(std::move(column_ids), table_filters);
+	if (!table_filters) {
+		return;
+	}
+	for (auto &entry : table_filters->filters) {
+		if (entry.second->filter_type != TableFilterType::EXPRESSION_FILTER) {
+			continue;
+		}
+		auto &expr_filter = entry.second->Cast<ExpressionFilter>();
+		filter_executors[entry.first] = make_uniq<ExpressionExecutor>(context, *expr_filter.expr);
+	}
+}
+
 const vector<column_t> &TableScanState::GetColumnIds() {
 	D_ASSERT(!column_ids.empty());
 	return column_ids;
@@ -31,6 +50,11 @@ AdaptiveFilter *TableScanState::GetAdaptiveFilter() {
 	return adaptive_filter.get();
 }
 
+ExpressionExecutor *TableScanState::GetFilterExecutor(idx_t filter_idx) {
+	auto entry = filter_executors.find(filter_idx);
+	return entry == filter_executors.end() ? nullptr : entry->second.get();
+}
+
 void ColumnScanState::NextInternal(idx_t count) {
 	if (!current) {
 		//! There is no column segment
@@ -67,17 +91,22 @@ AdaptiveFilter *CollectionScanState::GetAdaptiveFilter() {
 	return parent.GetAdaptiveFilter();
 }
 
+ExpressionExecutor *CollectionScanState::GetFilterExecutor(idx_t filter_idx) {
+	return parent.GetFilterExecutor(filter_idx);
+}
+
 TableScanOptions &CollectionScanState::GetOptions() {
 	return parent.options;
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), start_row_group(nullptr), wrapped(false), morsel_vectors(0),
+      processed_rows(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
     : row_group(nullptr), vector_index(0), max_row_group_row(0), row_groups(nullptr), max_row(0), batch_index(0),
-      valid_sel(STANDARD_VECTOR_SIZE), parent(parent_p) {
+      valid_sel(STANDARD_VECTOR_SIZE), morsel_timing_valid(false), parent(parent_p) {
 }
 
 bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result) {
@@ -34,30 +34,50 @@ ScanVectorType StandardColumnData::GetVectorScanType(ColumnScanState &state, idx
 }
 
 bool StandardColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
+	if (!state.current) {
+		return true;
+	}
 	if (!state.segment_checked) {
-		if (!state.current) {
-			return true;
-		}
 		state.segment_checked = true;
 		FilterPropagateResult prune_result;
 		{
 			lock_guard<mutex> l(stats_lock);
 			prune_result = filter.CheckStatistics(state.current->stats.statistics);
-			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				return true;
-			}
 		}
-		lock_guard<mutex> l(update_lock);
-		if (updates) {
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			lock_guard<mutex> l(update_lock);
+			if (!updates) {
+				return false;
+			}
 			auto update_stats = updates->GetStatistics();
 			prune_result = filter.CheckStatistics(*update_stats);
 			return prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE;
-		} else {
-			return false;
 		}
-	} else {
+	}
+	return CheckCompressedZonemap(state, filter);
+}
+
+bool StandardColumnData::CheckCompressedZonemap(ColumnScanState &state, TableFilter &filter) {
+	// the segment as a whole may contain matches: consult the per-group metadata of the compression
+	// method (if it exposes any) to see whether the upcoming rows can be skipped without scanning them
+	auto &function = state.current->function.get();
+	if (!function.zonemap_prune || !state.initialized) {
+		return true;
+	}
+	{
+		lock_guard<mutex> l(update_lock);
+		if (updates) {
+			// updated values are not covered by the compressed group metadata
+			return true;
+		}
+	}
+	idx_t prune_count = function.zonemap_prune(*state.current, state, filter);
+	if (prune_count < STANDARD_VECTOR_SIZE) {
+		// the scan can only skip in whole vectors
 		return true;
 	}
+	state.zonemap_prune_target = state.row_index + prune_count;
+	return false;
 }
 
 void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
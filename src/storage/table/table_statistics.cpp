@@ -34,7 +34,12 @@ void TableStatistics::InitializeAddColumn(TableStatistics &parent, const Logical
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		column_stats.push_back(parent.column_stats[i]);
 	}
-	column_stats.push_back(ColumnStatistics::CreateEmptyStats(new_column_type));
+	auto new_column_stats = ColumnStatistics::CreateEmptyStats(new_column_type);
+	if (new_column_stats->HasSortednessStats()) {
+		// the values of the new column are filled in without going through the append path
+		new_column_stats->SortednessStats().SetUnsorted();
+	}
+	column_stats.push_back(std::move(new_column_stats));
 }
 
 void TableStatistics::InitializeRemoveColumn(TableStatistics &parent, idx_t removed_column) {
@@ -58,7 +63,12 @@ void TableStatistics::InitializeAlterType(TableStatistics &parent, idx_t changed
 	lock_guard<mutex> lock(*stats_lock);
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		if (i == changed_idx) {
-			column_stats.push_back(ColumnStatistics::CreateEmptyStats(new_type));
+			auto changed_stats = ColumnStatistics::CreateEmptyStats(new_type);
+			if (changed_stats->HasSortednessStats()) {
+				// casting to the new type does not necessarily preserve the order of the values
+				changed_stats->SortednessStats().SetUnsorted();
+			}
+			column_stats.push_back(std::move(changed_stats));
 		} else {
 			column_stats.push_back(parent.column_stats[i]);
 		}
@@ -1,4 +1,5 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
@@ -123,11 +124,24 @@ void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIn
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
-unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
+void TemporaryFileHandle::WriteTemporaryFile(data_ptr_t compressed_data, idx_t compressed_size,
+                                             TemporaryFileIndex index) {
+	// The compressed block still occupies a full slot in the file, but fewer bytes hit the disk.
+	D_ASSERT(compressed_size < BufferManager::GetBufferManager(db).GetBlockAllocSize());
+	handle->Write(compressed_data, NumericCast<int64_t>(compressed_size), GetPositionInFile(index.block_index));
+}
+
+unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index, idx_t compressed_size,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (compressed_size != DConstants::INVALID_INDEX) {
+		return StandardBufferManager::ReadCompressedTemporaryBufferInternal(
+		    buffer_manager, *handle, GetPositionInFile(block_index), compressed_size, buffer_manager.GetBlockSize(),
+		    std::move(reusable_buffer));
+	}
+	return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, GetPositionInFile(block_index),
+	                                                          buffer_manager.GetBlockSize(),
+	                                                          std::move(reusable_buffer));
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -280,6 +294,14 @@ TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) :
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+
+	// try to compress the block before grabbing the lock; incompressible blocks are written as-is
+	AllocatedData compressed_data;
+	idx_t compressed_size = DConstants::INVALID_INDEX;
+	if (DBConfig::GetConfig(db).options.temp_file_compression) {
+		compressed_data = StandardBufferManager::CompressTemporaryBuffer(Allocator::Get(db), buffer, compressed_size);
+	}
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
@@ -304,11 +326,16 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 			index = handle->TryGetBlockIndex();
 		}
 		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
+		index.compressed_size = compressed_size;
 		used_blocks[block_id] = index;
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (compressed_size != DConstants::INVALID_INDEX) {
+		handle->WriteTemporaryFile(compressed_data.get(), compressed_size, index);
+	} else {
+		handle->WriteTemporaryFile(buffer, index);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -374,7 +401,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
-	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
+	auto buffer = handle->ReadTemporaryBuffer(index.block_index, index.compressed_size, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
 		TemporaryManagerLock lock(manager_lock);
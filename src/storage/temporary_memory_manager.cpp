@@ -6,10 +6,10 @@
 
 namespace duckdb {
 
-TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
+TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p, string owner_p,
                                            idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
-      minimum_reservation(minimum_reservation_p), reservation(0) {
+    : temporary_memory_manager(temporary_memory_manager_p), owner(std::move(owner_p)), remaining_size(0),
+      minimum_reservation(minimum_reservation_p), reservation(0), peak_reservation(0), force_external(false) {
 }
 
 TemporaryMemoryState::~TemporaryMemoryState() {
@@ -18,8 +18,13 @@ TemporaryMemoryState::~TemporaryMemoryState() {
 
 void TemporaryMemoryState::SetRemainingSize(ClientContext &context, idx_t new_remaining_size) {
 	auto guard = temporary_memory_manager.Lock();
+	const bool shrinks = new_remaining_size < remaining_size;
 	temporary_memory_manager.SetRemainingSize(*this, new_remaining_size);
 	temporary_memory_manager.UpdateState(context, *this);
+	if (shrinks) {
+		// This state now needs less memory, other states may be able to use what was freed up
+		temporary_memory_manager.RedistributeMemory();
+	}
 }
 
 idx_t TemporaryMemoryState::GetRemainingSize() const {
@@ -34,6 +39,10 @@ idx_t TemporaryMemoryState::GetReservation() const {
 	return reservation;
 }
 
+idx_t TemporaryMemoryState::GetPeakReservation() const {
+	return peak_reservation;
+}
+
 TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0) {
 }
 
@@ -55,13 +64,14 @@ TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 	return BufferManager::GetBufferManager(context).GetTemporaryMemoryManager();
 }
 
-unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context) {
+unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context, string owner) {
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	auto result =
+	    unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, std::move(owner), minimum_reservation));
 	SetRemainingSize(*result, result->minimum_reservation);
 	SetReservation(*result, result->minimum_reservation);
 	active_states.insert(*result);
@@ -72,6 +82,7 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
+	temporary_memory_state.force_external = context.config.force_external;
 
 	if (context.config.force_external) {
 		// We're forcing external processing. Give it the minimum
@@ -83,26 +94,70 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// We overshot. Set reservation equal to the minimum
 		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
 	} else {
-		// The lower bound for the reservation of this state is its minimum reservation
-		auto &lower_bound = temporary_memory_state.minimum_reservation;
-
-		// The upper bound for the reservation of this state is the minimum of:
-		// 1. Remaining size of the state
-		// 2. The max memory per query
-		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
-		auto upper_bound = MinValue<idx_t>(temporary_memory_state.remaining_size, query_max_memory);
-		auto free_memory = memory_limit - (reservation - temporary_memory_state.reservation);
-		upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * free_memory));
-
-		if (remaining_size > memory_limit) {
-			// We're processing more data than fits in memory, so we must further limit memory usage.
-			// The upper bound for the reservation of this state is now also the minimum of:
-			// 3. The ratio of the remaining size of this state and the total remaining size * memory limit
-			auto ratio_of_remaining = double(temporary_memory_state.remaining_size) / double(remaining_size);
-			upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(ratio_of_remaining * memory_limit));
+		SetReservation(temporary_memory_state, ComputeReservation(temporary_memory_state));
+	}
+
+	if (temporary_memory_state.force_external ||
+	    temporary_memory_state.reservation < temporary_memory_state.remaining_size) {
+		// this state cannot fit its data in its reservation - it has to process externally
+		// report the decision once per unsatisfied reservation so that frequent size updates do not flood the log
+		if (!temporary_memory_state.spill_reported) {
+			temporary_memory_state.spill_reported = true;
+			AddSpillEvent(temporary_memory_state, temporary_memory_state.force_external
+			                                          ? "external processing forced"
+			                                          : "reservation below remaining size");
 		}
+	} else {
+		temporary_memory_state.spill_reported = false;
+	}
+
+	Verify();
+}
+
+idx_t TemporaryMemoryManager::ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const {
+	// The lower bound for the reservation of this state is its minimum reservation
+	auto &lower_bound = temporary_memory_state.minimum_reservation;
+
+	// The upper bound for the reservation of this state is the minimum of:
+	// 1. Remaining size of the state
+	// 2. The max memory per query
+	// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+	auto upper_bound = MinValue<idx_t>(temporary_memory_state.remaining_size, query_max_memory);
+	auto free_memory = memory_limit - (reservation - temporary_memory_state.reservation);
+	upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * free_memory));
+
+	if (remaining_size > memory_limit) {
+		// We're processing more data than fits in memory, so we must further limit memory usage.
+		// The upper bound for the reservation of this state is now also the minimum of:
+		// 3. The ratio of the remaining size of this state and the total remaining size * memory limit
+		auto ratio_of_remaining = double(temporary_memory_state.remaining_size) / double(remaining_size);
+		upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(ratio_of_remaining * memory_limit));
+	}
 
-		SetReservation(temporary_memory_state, MaxValue<idx_t>(lower_bound, upper_bound));
+	return MaxValue<idx_t>(lower_bound, upper_bound);
+}
+
+void TemporaryMemoryManager::RedistributeMemory() {
+	for (auto &active_state : active_states) {
+		auto &temporary_memory_state = active_state.get();
+		if (temporary_memory_state.force_external) {
+			// This state is forced to process externally, it stays at its minimum reservation
+			continue;
+		}
+		if (temporary_memory_state.remaining_size <= temporary_memory_state.reservation) {
+			// This state already has all the memory it asked for
+			continue;
+		}
+		if (reservation - temporary_memory_state.reservation >= memory_limit) {
+			// Still overshooting, nothing to hand out
+			continue;
+		}
+		auto new_reservation = ComputeReservation(temporary_memory_state);
+		if (new_reservation > temporary_memory_state.reservation) {
+			// Only ever grow reservations here: the state may already be using what it was granted.
+			// Operators poll their reservation, so they will pick this up without being called into
+			SetReservation(temporary_memory_state, new_reservation);
+		}
 	}
 
 	Verify();
@@ -120,15 +175,60 @@ void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memo
 	this->reservation -= temporary_memory_state.reservation;
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.reservation;
+	if (new_reservation > temporary_memory_state.peak_reservation) {
+		temporary_memory_state.peak_reservation = new_reservation;
+	}
+}
+
+void TemporaryMemoryManager::AddSpillEvent(const TemporaryMemoryState &temporary_memory_state, string reason) {
+	if (spill_events.size() >= MAX_SPILL_EVENTS) {
+		spill_events.pop_front();
+	}
+	SpillEvent event;
+	event.time = Timestamp::GetCurrentTimestamp();
+	event.operator_name = temporary_memory_state.owner;
+	event.remaining_size = temporary_memory_state.remaining_size;
+	event.reservation = temporary_memory_state.reservation;
+	event.peak_reservation = temporary_memory_state.peak_reservation;
+	event.reason = std::move(reason);
+	spill_events.push_back(std::move(event));
+}
+
+vector<SpillEvent> TemporaryMemoryManager::GetSpillEvents() {
+	auto guard = Lock();
+	return vector<SpillEvent>(spill_events.begin(), spill_events.end());
+}
+
+vector<TemporaryMemoryStateInfo> TemporaryMemoryManager::GetStateInfo() {
+	auto guard = Lock();
+	vector<TemporaryMemoryStateInfo> result;
+	result.reserve(active_states.size());
+	for (auto &active_state : active_states) {
+		auto &state = active_state.get();
+		TemporaryMemoryStateInfo info;
+		info.operator_name = state.owner;
+		info.remaining_size = state.remaining_size;
+		info.minimum_reservation = state.minimum_reservation;
+		info.reservation = state.reservation;
+		info.peak_reservation = state.peak_reservation;
+		result.push_back(std::move(info));
+	}
+	return result;
 }
 
 void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_state) {
 	auto guard = Lock();
 
+	// record the peak reservation of the finished state so that peak memory can be analyzed after the query
+	AddSpillEvent(temporary_memory_state, "state finished");
+
 	SetReservation(temporary_memory_state, 0);
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
 
+	// The memory of this state is now free, hand it out to states that asked for more than they got
+	RedistributeMemory();
+
 	Verify();
 }
 
@@ -17,6 +17,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -28,6 +30,7 @@
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "miniz.hpp"
 
 namespace duckdb {
 
@@ -44,6 +47,13 @@ public:
 	idx_t wal_version = 1;
 };
 
+//! The type of a buffered WAL entry and, for USE_TABLE entries, the table it targets
+struct WALEntryInfo {
+	WALType type;
+	string schema;
+	string table;
+};
+
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
@@ -62,13 +72,26 @@ public:
 			// old WAL versions do not have checksums
 			return WriteAheadLogDeserializer(state_p, stream, deserialize_only);
 		}
-		if (state_p.wal_version != 2) {
-			throw IOException("Failed to read WAL of version %llu - can only read version 1 and 2",
+		if (state_p.wal_version != 2 && state_p.wal_version != 3) {
+			throw IOException("Failed to read WAL of version %llu - can only read versions 1, 2 and 3",
 			                  state_p.wal_version);
 		}
+		idx_t size;
+		auto buffer = ReadEntryBuffer(stream, state_p.wal_version, size);
+		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+	}
+
+	//! Read a single checksummed (version 2 or 3) WAL entry into a buffer, verifying the checksum
+	//! and decompressing version 3 entries that hold a compressed payload
+	static unique_ptr<data_t[]> ReadEntryBuffer(BufferedFileReader &stream, idx_t wal_version, idx_t &size_p) {
 		// read the checksum and size
 		auto size = stream.Read<uint64_t>();
 		auto stored_checksum = stream.Read<uint64_t>();
+		// version 3 entries carry the uncompressed size (zero if the entry is stored uncompressed)
+		idx_t uncompressed_size = 0;
+		if (wal_version >= 3) {
+			uncompressed_size = stream.Read<uint64_t>();
+		}
 		auto offset = stream.CurrentOffset();
 		auto file_size = stream.FileSize();
 
@@ -83,7 +106,7 @@ public:
 		auto buffer = unique_ptr<data_t[]>(new data_t[size]);
 		stream.ReadData(buffer.get(), size);
 
-		// compute and verify the checksum
+		// compute and verify the checksum (over the payload as it is stored in the file)
 		auto computed_checksum = Checksum(buffer.get(), size);
 		if (stored_checksum != computed_checksum) {
 			throw SerializationException(
@@ -91,7 +114,35 @@ public:
 			    "stored checksum %llu",
 			    offset, computed_checksum, stored_checksum);
 		}
-		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+		if (uncompressed_size != 0) {
+			// the payload is compressed - decompress it
+			auto decompressed = unique_ptr<data_t[]>(new data_t[uncompressed_size]);
+			duckdb_miniz::mz_ulong mz_size = uncompressed_size;
+			auto mz_ret = duckdb_miniz::mz_uncompress(decompressed.get(), &mz_size, buffer.get(),
+			                                          NumericCast<duckdb_miniz::mz_ulong>(size));
+			if (mz_ret != duckdb_miniz::MZ_OK || mz_size != uncompressed_size) {
+				throw SerializationException("Corrupt WAL file: failed to decompress entry at byte position %llu",
+				                             offset);
+			}
+			buffer = std::move(decompressed);
+			size = uncompressed_size;
+		}
+		size_p = size;
+		return buffer;
+	}
+
+	//! Peek the entry type (and, for USE_TABLE entries, the targeted table) of a buffered WAL entry
+	static WALEntryInfo PeekEntry(data_ptr_t data_p, idx_t size) {
+		MemoryStream stream(data_p, size);
+		BinaryDeserializer deserializer(stream);
+		WALEntryInfo result;
+		deserializer.Begin();
+		result.type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (result.type == WALType::USE_TABLE) {
+			result.schema = deserializer.ReadProperty<string>(101, "schema");
+			result.table = deserializer.ReadProperty<string>(102, "table");
+		}
+		return result;
 	}
 
 	bool ReplayEntry() {
@@ -158,6 +209,157 @@ private:
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Parallel Replay
+//===--------------------------------------------------------------------===//
+//! A buffered, checksum-verified WAL entry
+struct BufferedWALEntry {
+	unique_ptr<data_t[]> data;
+	idx_t size;
+};
+
+//! The buffered data-level entries (USE_TABLE/INSERT/DELETE/UPDATE) targeting a single table
+struct WALTableReplayGroup {
+	vector<BufferedWALEntry> entries;
+};
+
+//! Task that replays the buffered data-level entries of a single table in its own transaction
+class WALTableReplayTask : public Task {
+public:
+	WALTableReplayTask(TaskCounter &counter, AttachedDatabase &db, unique_ptr<WALTableReplayGroup> group_p,
+	                   mutex &error_lock, ErrorData &error)
+	    : counter(counter), db(db), group(std::move(group_p)), error_lock(error_lock), error(error) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			Connection con(db.GetDatabase());
+			con.BeginTransaction();
+			MetaTransaction::Get(*con.context).ModifyDatabase(db);
+			ReplayState replay_state(db, *con.context);
+			replay_state.wal_version = 2;
+			for (auto &entry : group->entries) {
+				WriteAheadLogDeserializer deserializer(replay_state, std::move(entry.data), entry.size);
+				deserializer.ReplayEntry();
+			}
+			con.Commit();
+		} catch (std::exception &ex) { // LCOV_EXCL_START
+			lock_guard<mutex> guard(error_lock);
+			if (!error.HasError()) {
+				error = ErrorData(ex);
+			}
+		} // LCOV_EXCL_STOP
+		counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TaskCounter &counter;
+	AttachedDatabase &db;
+	unique_ptr<WALTableReplayGroup> group;
+	mutex &error_lock;
+	ErrorData &error;
+};
+
+//! Partitions buffered WAL entries by table and replays independent tables on the task scheduler,
+//! serializing only catalog-level entries
+class ParallelWALReplayer {
+public:
+	ParallelWALReplayer(AttachedDatabase &db, Connection &con)
+	    : db(db), con(con), scheduler(TaskScheduler::GetScheduler(db.GetDatabase())) {
+	}
+
+	//! Add a buffered entry; returns true if the entry was a WAL_FLUSH marker
+	bool AddEntry(unique_ptr<data_t[]> data, idx_t size, ReplayState &state) {
+		auto info = WriteAheadLogDeserializer::PeekEntry(data.get(), size);
+		switch (info.type) {
+		case WALType::WAL_FLUSH:
+			// transaction boundary: finish all pending table groups
+			FlushGroups();
+			return true;
+		case WALType::USE_TABLE: {
+			// remember the USE_TABLE entry so the group can be re-opened after a barrier
+			last_use_table = CopyEntry(data.get(), size);
+			current_group = &GetGroup(info.schema + "." + info.table);
+			current_group->entries.push_back(BufferedWALEntry {std::move(data), size});
+			break;
+		}
+		case WALType::INSERT_TUPLE:
+		case WALType::DELETE_TUPLE:
+		case WALType::UPDATE_TUPLE:
+			if (!current_group) {
+				// the group was flushed at a barrier without a new USE_TABLE entry - re-open it
+				if (!last_use_table.data) {
+					throw SerializationException("Corrupt WAL: data entry without a preceding USE_TABLE entry");
+				}
+				current_group = &GetGroup(last_table_key);
+				current_group->entries.push_back(CopyEntry(last_use_table.data.get(), last_use_table.size));
+			}
+			current_group->entries.push_back(BufferedWALEntry {std::move(data), size});
+			break;
+		default: {
+			// catalog-level entry: finish all pending table groups first, then replay it serially in order
+			FlushGroups();
+			WriteAheadLogDeserializer deserializer(state, std::move(data), size);
+			deserializer.ReplayEntry();
+			break;
+		}
+		}
+		return false;
+	}
+
+	//! Replay all pending table groups on the worker threads and wait for them to finish
+	void FlushGroups() {
+		current_group = nullptr;
+		if (groups.empty()) {
+			return;
+		}
+		// commit the catalog-level changes first so that the worker transactions can see them
+		con.Commit();
+		ErrorData error;
+		mutex error_lock;
+		TaskCounter counter(scheduler);
+		for (auto &entry : groups) {
+			counter.AddTask(make_shared_ptr<WALTableReplayTask>(counter, db, std::move(entry.second), error_lock, error));
+		}
+		groups.clear();
+		counter.Finish();
+		con.BeginTransaction();
+		MetaTransaction::Get(*con.context).ModifyDatabase(db);
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+
+private:
+	WALTableReplayGroup &GetGroup(const string &key) {
+		last_table_key = key;
+		auto entry = groups.find(key);
+		if (entry == groups.end()) {
+			entry = groups.insert(make_pair(key, make_uniq<WALTableReplayGroup>())).first;
+		}
+		return *entry->second;
+	}
+
+	static BufferedWALEntry CopyEntry(data_ptr_t data, idx_t size) {
+		auto copy = unique_ptr<data_t[]>(new data_t[size]);
+		memcpy(copy.get(), data, size);
+		return BufferedWALEntry {std::move(copy), size};
+	}
+
+private:
+	AttachedDatabase &db;
+	Connection &con;
+	TaskScheduler &scheduler;
+	//! The pending table groups, keyed by "schema.table"
+	unordered_map<string, unique_ptr<WALTableReplayGroup>> groups;
+	//! The group the current USE_TABLE entry points to
+	optional_ptr<WALTableReplayGroup> current_group;
+	//! A copy of the last USE_TABLE entry, and the group key it refers to
+	BufferedWALEntry last_use_table;
+	string last_table_key;
+};
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -177,11 +379,14 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	// first deserialize the WAL to look for a checkpoint flag
 	// if there is a checkpoint flag, we might have already flushed the contents of the WAL to disk
 	ReplayState checkpoint_state(database, *con.context);
+	// the offset just past the last fully validated WAL_FLUSH entry - entries before this point can safely be replayed
+	idx_t successful_flush_offset = 0;
 	try {
 		while (true) {
 			// read the current entry (deserialize only)
 			auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
 			if (deserializer.ReplayEntry()) {
+				successful_flush_offset = reader.CurrentOffset();
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -216,18 +421,44 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	// note that everything is wrapped inside a try/catch block here
 	// there can be errors in WAL replay because of a corrupt WAL file
 	try {
-		while (true) {
-			// read the current entry
-			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
-			if (deserializer.ReplayEntry()) {
-				con.Commit();
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					break;
+		if (config.options.wal_parallel_replay && !config.options.abort_on_wal_failure &&
+		    checkpoint_state.wal_version >= 2 && successful_flush_offset > 0) {
+			// parallel replay: buffer the entries up to the last validated flush,
+			// partition the data-level entries by table and replay independent tables on the worker threads
+			ParallelWALReplayer replayer(database, con);
+			while (reader.CurrentOffset() < successful_flush_offset) {
+				if (state.wal_version == 1) {
+					// the version entry precedes the checksummed format: replay it directly from the stream
+					auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
+					deserializer.ReplayEntry();
+					continue;
+				}
+				idx_t size;
+				auto buffer = WriteAheadLogDeserializer::ReadEntryBuffer(reader, state.wal_version, size);
+				if (replayer.AddEntry(std::move(buffer), size, state)) {
+					// flush entry: commit the replayed entries
+					con.Commit();
+					if (reader.Finished() || reader.CurrentOffset() >= successful_flush_offset) {
+						break;
+					}
+					con.BeginTransaction();
+					MetaTransaction::Get(*con.context).ModifyDatabase(database);
+				}
+			}
+		} else {
+			while (true) {
+				// read the current entry
+				auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
+				if (deserializer.ReplayEntry()) {
+					con.Commit();
+					// check if the file is exhausted
+					if (reader.Finished()) {
+						// we finished reading the file: break
+						break;
+					}
+					con.BeginTransaction();
+					MetaTransaction::Get(*con.context).ModifyDatabase(database);
 				}
-				con.BeginTransaction();
-				MetaTransaction::Get(*con.context).ModifyDatabase(database);
 			}
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
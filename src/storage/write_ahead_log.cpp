@@ -6,6 +6,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
@@ -14,14 +15,20 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/serializer/async_buffered_file_writer.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "miniz.hpp"
 
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
+//! WAL version in which entries carry their uncompressed size and may hold a compressed payload
+const uint64_t COMPRESSED_WAL_VERSION_NUMBER = 3;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), wal_version(0), flushed_position(0),
+      synced_position(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -32,9 +39,10 @@ BufferedFileWriter &WriteAheadLog::Initialize() {
 		return *writer;
 	}
 	if (!writer) {
-		writer = make_uniq<BufferedFileWriter>(FileSystem::Get(database), wal_path,
-		                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
-		                                           FileFlags::FILE_FLAGS_APPEND);
+		// use the double-buffered writer so that large commits can serialize while the previous buffer drains
+		writer = make_uniq<AsyncBufferedFileWriter>(FileSystem::Get(database), wal_path,
+		                                            FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
+		                                                FileFlags::FILE_FLAGS_APPEND);
 		wal_size = writer->GetFileSize();
 		initialized = true;
 	}
@@ -66,6 +74,14 @@ void WriteAheadLog::Truncate(idx_t size) {
 	}
 	writer->Truncate(size);
 	wal_size = writer->GetFileSize();
+	// the truncated tail no longer exists - move the group commit positions back accordingly
+	auto write_position = writer->GetTotalWritten();
+	if (flushed_position > write_position) {
+		flushed_position = write_position;
+	}
+	if (synced_position > write_position) {
+		synced_position = write_position;
+	}
 }
 
 void WriteAheadLog::Delete() {
@@ -76,6 +92,9 @@ void WriteAheadLog::Delete() {
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
 	wal_size = 0;
+	// a new writer starts counting written bytes from zero again
+	flushed_position = 0;
+	synced_position = 0;
 }
 
 //===--------------------------------------------------------------------===//
@@ -97,18 +116,54 @@ public:
 		}
 		auto data = memory_stream.GetData();
 		auto size = memory_stream.GetPosition();
-		// compute the checksum over the entry
-		auto checksum = Checksum(data, size);
-		// write the checksum and the length of the entry
-		stream->Write<uint64_t>(size);
-		stream->Write<uint64_t>(checksum);
-		// write data to the underlying stream
-		stream->WriteData(memory_stream.GetData(), memory_stream.GetPosition());
+		if (wal.GetVersion() >= COMPRESSED_WAL_VERSION_NUMBER) {
+			FlushCompressed(data, size);
+		} else {
+			// compute the checksum over the entry
+			auto checksum = Checksum(data, size);
+			// write the checksum and the length of the entry
+			stream->Write<uint64_t>(size);
+			stream->Write<uint64_t>(checksum);
+			// write data to the underlying stream
+			stream->WriteData(data, size);
+		}
 		// rewind the buffer
 		memory_stream.Rewind();
 	}
 
 private:
+	//! Write an entry in the version 3 layout, compressing the payload if that pays off
+	void FlushCompressed(data_ptr_t data, idx_t size) {
+		auto stored_data = data;
+		auto stored_size = size;
+		// an uncompressed size of zero marks an entry that is stored uncompressed
+		idx_t uncompressed_size = 0;
+		AllocatedData compressed;
+		if (size >= COMPRESSION_THRESHOLD) {
+			auto bound = duckdb_miniz::mz_compressBound(size);
+			compressed = Allocator::Get(wal.GetDatabase()).Allocate(bound);
+			duckdb_miniz::mz_ulong mz_size = bound;
+			auto mz_ret = duckdb_miniz::mz_compress2(compressed.get(), &mz_size, data,
+			                                         NumericCast<duckdb_miniz::mz_ulong>(size),
+			                                         duckdb_miniz::MZ_BEST_SPEED);
+			if (mz_ret == duckdb_miniz::MZ_OK && mz_size < size) {
+				stored_data = compressed.get();
+				stored_size = mz_size;
+				uncompressed_size = size;
+			}
+		}
+		// the checksum covers the payload as it is stored in the file
+		auto checksum = Checksum(stored_data, stored_size);
+		stream->Write<uint64_t>(stored_size);
+		stream->Write<uint64_t>(checksum);
+		stream->Write<uint64_t>(uncompressed_size);
+		stream->WriteData(stored_data, stored_size);
+	}
+
+private:
+	//! Entries smaller than this are never compressed - the compression overhead would not pay off
+	static constexpr idx_t COMPRESSION_THRESHOLD = 256;
+
 	WriteAheadLog &wal;
 	optional_ptr<WriteStream> stream;
 	MemoryStream memory_stream;
@@ -155,13 +210,42 @@ void WriteAheadLog::WriteVersion() {
 		// already written - no need to write a version marker
 		return;
 	}
+	// if WAL compression is enabled, new WAL files use the compressed entry layout
+	auto version = DBConfig::GetConfig(database.GetDatabase()).options.wal_compression ? COMPRESSED_WAL_VERSION_NUMBER
+	                                                                                   : WAL_VERSION_NUMBER;
 	// write the version marker
 	// note that we explicitly do not checksum the version entry
 	BinarySerializer serializer(*writer);
 	serializer.Begin();
 	serializer.WriteProperty(100, "wal_type", WALType::WAL_VERSION);
-	serializer.WriteProperty(101, "version", idx_t(WAL_VERSION_NUMBER));
+	serializer.WriteProperty(101, "version", idx_t(version));
 	serializer.End();
+	wal_version = version;
+}
+
+idx_t WriteAheadLog::GetVersion() {
+	if (wal_version == 0) {
+		// appending to an existing WAL file - the entry layout must match the version entry at its head
+		ReadVersion();
+	}
+	return wal_version;
+}
+
+void WriteAheadLog::ReadVersion() {
+	// fall back to the default version if the file holds no readable version entry
+	idx_t version = WAL_VERSION_NUMBER;
+	try {
+		BufferedFileReader reader(FileSystem::Get(database), wal_path.c_str());
+		BinaryDeserializer deserializer(reader);
+		deserializer.Begin();
+		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (wal_type == WALType::WAL_VERSION) {
+			version = deserializer.ReadProperty<idx_t>(101, "version");
+		}
+		deserializer.End();
+	} catch (std::exception &) { // NOLINT
+	}
+	wal_version = version;
 }
 
 void WriteAheadLog::WriteCheckpoint(MetaBlockPointer meta_block) {
@@ -404,6 +488,49 @@ void WriteAheadLog::Flush() {
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+	flushed_position = writer->GetTotalWritten();
+	synced_position = flushed_position.load();
+}
+
+bool WriteAheadLog::GroupCommitEnabled() const {
+	return DBConfig::GetConfig(database.GetDatabase()).options.wal_group_commit;
+}
+
+void WriteAheadLog::FlushGroupCommit() {
+	if (!writer) {
+		return;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// flush the changes to the OS - the disk sync is deferred to SyncGroupCommit,
+	// so that concurrently committing transactions can share a single sync
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	flushed_position = writer->GetTotalWritten();
+}
+
+void WriteAheadLog::SyncGroupCommit(idx_t target_position) {
+	if (synced_position >= target_position) {
+		// another commit has already synced past this position
+		return;
+	}
+	lock_guard<mutex> guard(sync_lock);
+	if (synced_position >= target_position) {
+		return;
+	}
+	// sync everything that has been flushed to the OS so far, on behalf of all commits that flushed before us
+	auto sync_to = flushed_position.load();
+	try {
+		writer->handle->Sync();
+	} catch (std::exception &ex) {
+		// the commits covered by this sync are already visible in memory and can no longer be rolled back
+		throw FatalException("Failed to sync WAL to disk during group commit: %s", ex.what());
+	}
+	// this store may interleave with a full Flush, but any stored value refers to data that has been synced
+	synced_position = sync_to;
 }
 
 } // namespace duckdb
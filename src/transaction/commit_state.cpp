@@ -143,7 +143,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		// Grab a write lock on the catalog
 		auto &duck_catalog = catalog.Cast<DuckCatalog>();
 		lock_guard<mutex> write_lock(duck_catalog.GetWriteLock());
-		lock_guard<mutex> read_lock(catalog_entry->set->GetCatalogLock());
+		auto read_lock = catalog_entry->set->GetCatalogLock().GetExclusiveLock();
 		catalog_entry->set->UpdateTimestamp(catalog_entry->Parent(), commit_id);
 		if (!StringUtil::CIEquals(catalog_entry->name, catalog_entry->Parent().name)) {
 			catalog_entry->set->UpdateTimestamp(*catalog_entry, commit_id);
@@ -167,12 +167,14 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		auto info = reinterpret_cast<DeleteInfo *>(data);
 		// mark the tuples as committed
 		info->version_info->CommitDelete(info->vector_idx, commit_id, *info);
+		info->table->GetDataTableInfo()->BumpDataVersion();
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
 		// update:
 		auto info = reinterpret_cast<UpdateInfo *>(data);
 		info->version_number = commit_id;
+		info->segment->column_data.GetTableInfo().BumpDataVersion();
 		break;
 	}
 	case UndoFlags::SEQUENCE_VALUE: {
@@ -7,7 +7,10 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/storage_info.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
@@ -27,6 +30,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 	current_transaction_id = TRANSACTION_ID_START;
 	lowest_active_id = TRANSACTION_ID_START;
 	lowest_active_start = MAX_TRANSACTION_ID;
+	vacuum_deleted_rows = 0;
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
@@ -255,6 +259,19 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		checkpoint_decision = CheckpointDecision(error.Message());
 		transaction.commit_id = 0;
 		transaction.Rollback();
+	} else if (held_wal_lock) {
+		// group commit: if the WAL flush deferred its disk sync, perform the sync before finalizing the commit
+		auto log = db.GetStorageManager().GetWAL();
+		if (log && log->RequiresSync()) {
+			// grab the position that must be durable for this commit while we still hold the WAL lock
+			auto sync_target = log->GetFlushedPosition();
+			// release the locks while syncing, so that other transactions can write to the WAL in the
+			// meantime and have their commits covered by a single sync
+			held_wal_lock.reset();
+			tlock.unlock();
+			log->SyncGroupCommit(sync_target);
+			tlock.lock();
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -279,10 +296,47 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		options.type = checkpoint_decision.type;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(options);
+	} else if (!error.HasError() && undo_properties.deleted_rows > 0) {
+		// the transaction deleted rows but we did not checkpoint - check if we should vacuum the database
+		tlock.unlock();
+		AutomaticVacuum(undo_properties.deleted_rows);
 	}
 	return error;
 }
 
+void DuckTransactionManager::AutomaticVacuum(idx_t deleted_rows) {
+	// only vacuum once enough rows have been deleted to (at least) free up an entire row group
+	static constexpr const idx_t AUTOMATIC_VACUUM_THRESHOLD = Storage::ROW_GROUP_SIZE;
+
+	if (!DBConfig::GetConfig(db.GetDatabase()).options.automatic_vacuum) {
+		return;
+	}
+	if (db.IsReadOnly() || db.GetStorageManager().InMemory()) {
+		return;
+	}
+	if (vacuum_deleted_rows.fetch_add(deleted_rows) + deleted_rows < AUTOMATIC_VACUUM_THRESHOLD) {
+		return;
+	}
+	// only vacuum when the database is otherwise idle
+	// if another thread is writing or checkpointing we skip - the deleted row count is kept,
+	// so the next qualifying commit will try again
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		return;
+	}
+	if (GetLastCommit() > LowestActiveStart()) {
+		// a transaction needs to read old data - we cannot perform the full checkpoint required for vacuuming
+		return;
+	}
+	vacuum_deleted_rows = 0;
+	// trigger a full checkpoint - this merges undersized row groups and purges deleted rows where possible
+	// the WAL may still be small at this point, so we have to force the checkpoint
+	CheckpointOptions options;
+	options.action = CheckpointAction::FORCE_CHECKPOINT;
+	options.type = CheckpointType::FULL_CHECKPOINT;
+	db.GetStorageManager().CreateCheckpoint(options);
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
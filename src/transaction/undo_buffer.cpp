@@ -130,6 +130,7 @@ UndoBufferProperties UndoBuffer::GetProperties() {
 				properties.estimated_size += sizeof(row_t) * info->count;
 			}
 			properties.has_deletes = true;
+			properties.deleted_rows += info->count;
 			break;
 		}
 		case UndoFlags::CATALOG_ENTRY: {
@@ -257,7 +257,7 @@ void WALWriteState::CommitEntry(UndoFlags type, data_ptr_t data) {
 	case UndoFlags::INSERT_TUPLE: {
 		// append:
 		auto info = reinterpret_cast<AppendInfo *>(data);
-		if (!info->table->IsTemporary()) {
+		if (!info->table->IsTemporary() && !info->table->IsUnlogged()) {
 			info->table->WriteToLog(log, info->start_row, info->count);
 		}
 		break;
@@ -265,7 +265,7 @@ void WALWriteState::CommitEntry(UndoFlags type, data_ptr_t data) {
 	case UndoFlags::DELETE_TUPLE: {
 		// deletion:
 		auto info = reinterpret_cast<DeleteInfo *>(data);
-		if (!info->table->IsTemporary()) {
+		if (!info->table->IsTemporary() && !info->table->IsUnlogged()) {
 			WriteDelete(*info);
 		}
 		break;
@@ -273,7 +273,8 @@ void WALWriteState::CommitEntry(UndoFlags type, data_ptr_t data) {
 	case UndoFlags::UPDATE_TUPLE: {
 		// update:
 		auto info = reinterpret_cast<UpdateInfo *>(data);
-		if (!info->segment->column_data.GetTableInfo().IsTemporary()) {
+		auto &table_info = info->segment->column_data.GetTableInfo();
+		if (!table_info.IsTemporary() && !table_info.IsUnlogged()) {
 			WriteUpdate(*info);
 		}
 		break;
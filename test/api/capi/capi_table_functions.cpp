@@ -1,5 +1,7 @@
 #include "capi_tester.hpp"
 
+#include <thread>
+
 using namespace duckdb;
 using namespace std;
 
@@ -121,6 +123,81 @@ TEST_CASE("Test Table Functions C API", "[capi]") {
 	REQUIRE(result->Fetch<int64_t>(1, 1) == 5000);
 }
 
+struct my_async_init_data_struct {
+	int64_t pos;
+	bool blocked;
+};
+
+void my_async_init(duckdb_init_info info) {
+	auto my_init_data = (my_async_init_data_struct *)malloc(sizeof(my_async_init_data_struct));
+	my_init_data->pos = 0;
+	my_init_data->blocked = false;
+	duckdb_init_set_init_data(info, my_init_data, free);
+}
+
+static duckdb::unique_ptr<std::thread> async_signal_thread;
+
+duckdb_source_result_type my_async_function(duckdb_function_info info, duckdb_data_chunk output) {
+	auto bind_data = (my_bind_data_struct *)duckdb_function_get_bind_data(info);
+	auto init_data = (my_async_init_data_struct *)duckdb_function_get_init_data(info);
+	if (!init_data->blocked) {
+		// block exactly once before producing any data - the scan is resumed from a separate thread
+		init_data->blocked = true;
+		auto interrupt_state = duckdb_function_get_interrupt_state(info);
+		REQUIRE(interrupt_state != nullptr);
+		REQUIRE(duckdb_function_get_interrupt_state(nullptr) == nullptr);
+		duckdb_interrupt_state_callback(nullptr);
+		async_signal_thread =
+		    duckdb::make_uniq<std::thread>([interrupt_state]() { duckdb_interrupt_state_callback(interrupt_state); });
+		duckdb_data_chunk_set_size(output, 0);
+		return DUCKDB_SOURCE_RESULT_BLOCKED;
+	}
+	auto ptr = (int64_t *)duckdb_vector_get_data(duckdb_data_chunk_get_vector(output, 0));
+	idx_t i;
+	for (i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (init_data->pos >= bind_data->size) {
+			break;
+		}
+		ptr[i] = init_data->pos % 2 == 0 ? 42 : 84;
+		init_data->pos++;
+	}
+	duckdb_data_chunk_set_size(output, i);
+	return i == 0 ? DUCKDB_SOURCE_RESULT_FINISHED : DUCKDB_SOURCE_RESULT_HAVE_MORE_OUTPUT;
+}
+
+TEST_CASE("Test asynchronous Table Functions C API", "[capi]") {
+	CAPITester tester;
+	duckdb::unique_ptr<CAPIResult> result;
+
+	REQUIRE(tester.OpenDatabase(nullptr));
+
+	// create and register an asynchronous table function
+	auto function = duckdb_create_table_function();
+	duckdb_table_function_set_name(function, "my_async_function");
+	duckdb_logical_type type = duckdb_create_logical_type(DUCKDB_TYPE_BIGINT);
+	duckdb_table_function_add_parameter(function, type);
+	duckdb_destroy_logical_type(&type);
+	duckdb_table_function_set_bind(function, my_bind);
+	duckdb_table_function_set_init(function, my_async_init);
+
+	// a function without a (asynchronous) main function cannot be registered
+	REQUIRE(duckdb_register_table_function(tester.connection, function) == DuckDBError);
+	duckdb_table_function_set_function_async(function, my_async_function);
+	REQUIRE(duckdb_register_table_function(tester.connection, function) == DuckDBSuccess);
+	duckdb_destroy_table_function(&function);
+
+	// the scan blocks once, gets resumed through the interrupt state and then produces its rows
+	result = tester.Query("SELECT * FROM my_async_function(3)");
+	REQUIRE_NO_FAIL(*result);
+	REQUIRE(result->Fetch<int64_t>(0, 0) == 42);
+	REQUIRE(result->Fetch<int64_t>(0, 1) == 84);
+	REQUIRE(result->Fetch<int64_t>(0, 2) == 42);
+
+	REQUIRE(async_signal_thread);
+	async_signal_thread->join();
+	async_signal_thread.reset();
+}
+
 void my_error_bind(duckdb_bind_info info) {
 	duckdb_bind_set_error(nullptr, nullptr);
 	duckdb_bind_set_error(info, "My error message");
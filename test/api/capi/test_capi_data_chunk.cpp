@@ -377,6 +377,83 @@ TEST_CASE("Test DataChunk result fetch in C API", "[capi]") {
 	REQUIRE(!chunk);
 }
 
+TEST_CASE("Test batched zero-copy result fetch in C API", "[capi]") {
+	if (duckdb_vector_size() < 64) {
+		return;
+	}
+
+	duckdb_database database;
+	duckdb_connection connection;
+	duckdb_state state;
+
+	state = duckdb_open(nullptr, &database);
+	REQUIRE(state == DuckDBSuccess);
+	state = duckdb_connect(database, &connection);
+	REQUIRE(state == DuckDBSuccess);
+
+	constexpr idx_t ROW_COUNT = 5000;
+
+	duckdb_result result;
+	state = duckdb_query(connection,
+	                     "SELECT CASE WHEN i % 97 = 0 THEN NULL ELSE i::INTEGER END i, concat('val', i) s "
+	                     "FROM range(5000) tbl(i)",
+	                     &result);
+	REQUIRE(state == DuckDBSuccess);
+
+	idx_t expected_chunk_count = (ROW_COUNT / STANDARD_VECTOR_SIZE) + (ROW_COUNT % STANDARD_VECTOR_SIZE != 0);
+	REQUIRE(duckdb_result_chunk_count(result) == expected_chunk_count);
+
+	constexpr idx_t BATCH_SIZE = 3;
+	duckdb_data_chunk chunks[BATCH_SIZE];
+
+	idx_t tuple_index = 0;
+	idx_t total_chunk_count = 0;
+	while (true) {
+		auto fetched = duckdb_result_fetch_chunks(result, chunks, BATCH_SIZE);
+		if (fetched == 0) {
+			break;
+		}
+		REQUIRE(fetched <= BATCH_SIZE);
+		total_chunk_count += fetched;
+		// all chunks of the batch remain valid together - verify them after fetching the full batch
+		for (idx_t chunk_index = 0; chunk_index < fetched; chunk_index++) {
+			auto chunk = chunks[chunk_index];
+			REQUIRE(duckdb_data_chunk_get_column_count(chunk) == 2);
+			auto int_vector = duckdb_data_chunk_get_vector(chunk, 0);
+			auto int_data = (int32_t *)duckdb_vector_get_data(int_vector);
+			auto validity = duckdb_vector_get_validity(int_vector);
+			auto string_vector = duckdb_data_chunk_get_vector(chunk, 1);
+			auto string_data = (duckdb_string_t *)duckdb_vector_get_data(string_vector);
+
+			auto tuples_in_chunk = duckdb_data_chunk_get_size(chunk);
+			for (idx_t i = 0; i < tuples_in_chunk; i++, tuple_index++) {
+				if (tuple_index % 97 == 0) {
+					REQUIRE(!duckdb_validity_row_is_valid(validity, i));
+				} else {
+					REQUIRE(duckdb_validity_row_is_valid(validity, i));
+					REQUIRE(int_data[i] == (int32_t)tuple_index);
+				}
+				auto expected_string = "val" + std::to_string(tuple_index);
+				auto tuple = string_data[i];
+				REQUIRE(tuple.value.inlined.length == expected_string.size());
+				auto string_ptr =
+				    duckdb_string_is_inlined(tuple) ? tuple.value.inlined.inlined : tuple.value.pointer.ptr;
+				REQUIRE(memcmp(string_ptr, expected_string.c_str(), expected_string.size()) == 0);
+			}
+		}
+		// the chunks are owned by the result - they must not be destroyed
+	}
+	REQUIRE(tuple_index == ROW_COUNT);
+	REQUIRE(total_chunk_count == expected_chunk_count);
+
+	// the result is exhausted - subsequent calls return no chunks
+	REQUIRE(duckdb_result_fetch_chunks(result, chunks, BATCH_SIZE) == 0);
+
+	duckdb_destroy_result(&result);
+	duckdb_disconnect(&connection);
+	duckdb_close(&database);
+}
+
 TEST_CASE("Test duckdb_result_return_type", "[capi]") {
 	CAPITester tester;
 	duckdb::unique_ptr<CAPIResult> result;
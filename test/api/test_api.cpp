@@ -202,6 +202,44 @@ TEST_CASE("Test making and dropping connections in parallel to a single database
 	REQUIRE(CHECK_COLUMN(result, 0, {1, 2, 3, Value()}));
 }
 
+static void parallel_ddl(DuckDB *db, bool *correct, size_t threadnr) {
+	correct[threadnr] = true;
+	auto conn = make_uniq<Connection>(*db);
+	for (size_t i = 0; i < 100; i++) {
+		auto table_name = "ddl_table_" + to_string(threadnr);
+		if (conn->Query("CREATE TABLE " + table_name + "(i INTEGER)")->HasError()) {
+			correct[threadnr] = false;
+		}
+		if (conn->Query("DROP TABLE " + table_name)->HasError()) {
+			correct[threadnr] = false;
+		}
+	}
+}
+
+TEST_CASE("Test parallel catalog lookups with concurrent DDL", "[api][.]") {
+	auto db = make_uniq<DuckDB>(nullptr);
+	auto conn = make_uniq<Connection>(*db);
+
+	REQUIRE_NO_FAIL(conn->Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(conn->Query("INSERT INTO integers VALUES (1), (2), (3), (NULL)"));
+
+	// readers repeatedly bind and run queries while writers create and drop unrelated tables
+	bool correct[12];
+	thread threads[12];
+	for (size_t i = 0; i < 8; i++) {
+		threads[i] = thread(parallel_query_with_new_connection, db.get(), correct, i);
+	}
+	for (size_t i = 8; i < 12; i++) {
+		threads[i] = thread(parallel_ddl, db.get(), correct, i);
+	}
+	for (size_t i = 0; i < 12; i++) {
+		threads[i].join();
+		REQUIRE(correct[i]);
+	}
+	auto result = conn->Query("SELECT * FROM integers ORDER BY i");
+	REQUIRE(CHECK_COLUMN(result, 0, {1, 2, 3, Value()}));
+}
+
 TEST_CASE("Test multiple result sets", "[api]") {
 	duckdb::unique_ptr<QueryResult> result;
 	DuckDB db(nullptr);
@@ -0,0 +1,116 @@
+#include "catch.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/storage/storage_info.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+#define PARALLEL_THREAD_COUNT 4
+
+static void parallel_append_to_integers(ParallelAppender *parallel_appender, size_t threadnr, size_t element_count) {
+	auto appender = parallel_appender->CreateAppender();
+	for (size_t i = 0; i < element_count; i++) {
+		appender->BeginRow();
+		appender->Append<int32_t>((int32_t)(threadnr * element_count + i));
+		appender->EndRow();
+	}
+}
+
+static void test_parallel_append(size_t element_count) {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+
+	ParallelAppender parallel_appender(con, "integers");
+
+	thread threads[PARALLEL_THREAD_COUNT];
+	for (size_t i = 0; i < PARALLEL_THREAD_COUNT; i++) {
+		threads[i] = thread(parallel_append_to_integers, &parallel_appender, i, element_count);
+	}
+	for (size_t i = 0; i < PARALLEL_THREAD_COUNT; i++) {
+		threads[i].join();
+	}
+	parallel_appender.Close();
+
+	// every thread appended a distinct range of values: verify the count, sum and bounds
+	int64_t total_count = (int64_t)(PARALLEL_THREAD_COUNT * element_count);
+	result = con.Query("SELECT COUNT(*), SUM(i), MIN(i), MAX(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(total_count)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(total_count * (total_count - 1) / 2)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {0}));
+	REQUIRE(CHECK_COLUMN(result, 3, {Value::INTEGER((int32_t)(total_count - 1))}));
+	result = con.Query("SELECT COUNT(DISTINCT i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(total_count)}));
+}
+
+TEST_CASE("Test parallel appender with a small append", "[appender]") {
+	// small appends go through the regular transaction-local append path
+	test_parallel_append(2000);
+}
+
+TEST_CASE("Test parallel appender with a large append", "[appender][.]") {
+	// large appends are repacked into full row groups and merged into the transaction-local storage
+	test_parallel_append(Storage::ROW_GROUP_SIZE);
+}
+
+TEST_CASE("Test parallel appender with constraints", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER PRIMARY KEY)"));
+
+	ParallelAppender parallel_appender(con, "integers");
+	{
+		auto appender = parallel_appender.CreateAppender();
+		for (size_t i = 0; i < 1000; i++) {
+			appender->AppendRow((int32_t)i);
+		}
+	}
+	parallel_appender.Close();
+
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+
+	// appending a duplicate key must fail
+	ParallelAppender duplicate_appender(con, "integers");
+	{
+		auto appender = duplicate_appender.CreateAppender();
+		appender->AppendRow(42);
+	}
+	REQUIRE_THROWS(duplicate_appender.Close());
+
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+}
+
+TEST_CASE("Test parallel appender errors", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+
+	// appending to a non-existing table fails
+	REQUIRE_THROWS(ParallelAppender(con, "unknown_table"));
+
+	// closing while a thread appender is still open fails
+	ParallelAppender parallel_appender(con, "integers");
+	auto appender = parallel_appender.CreateAppender();
+	appender->AppendRow(1);
+	REQUIRE_THROWS(parallel_appender.Close());
+	appender.reset();
+	REQUIRE_NOTHROW(parallel_appender.Close());
+
+	// no thread appenders can be created after the parallel appender has been closed
+	REQUIRE_THROWS(parallel_appender.CreateAppender());
+
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1}));
+}
@@ -29,6 +29,8 @@ int ArrowTestFactory::ArrowArrayStreamGetSchema(struct ArrowArrayStream *stream,
 static int NextFromMaterialized(MaterializedQueryResult &res, bool big, ClientProperties properties,
                                 struct ArrowArray *out) {
 	auto &types = res.types;
+	// the fetched chunks are not modified afterwards - exercise the zero-copy export path
+	properties.arrow_allow_zero_copy = true;
 	if (big) {
 		// Combine all chunks into a single ArrowArray
 		ArrowAppender appender(types, STANDARD_VECTOR_SIZE, properties);
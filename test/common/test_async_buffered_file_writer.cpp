@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/async_buffered_file_writer.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test async buffered file writer", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	auto fname = TestCreatePath("async_writer_test");
+
+	// write enough values to rotate the buffers many times
+	const idx_t value_count = 100000;
+	{
+		AsyncBufferedFileWriter writer(*fs, fname);
+		for (idx_t i = 0; i < value_count; i++) {
+			writer.Write<uint64_t>(i);
+		}
+		// a large write that bypasses the buffers
+		duckdb::vector<uint64_t> large_values;
+		for (idx_t i = 0; i < value_count; i++) {
+			large_values.push_back(value_count + i);
+		}
+		writer.WriteData(const_data_ptr_cast(large_values.data()), large_values.size() * sizeof(uint64_t));
+		REQUIRE(writer.GetTotalWritten() == 2 * value_count * sizeof(uint64_t));
+		writer.Sync();
+		REQUIRE(writer.GetFileSize() == 2 * value_count * sizeof(uint64_t));
+		writer.Close();
+	}
+
+	// read the values back
+	{
+		BufferedFileReader reader(*fs, fname.c_str());
+		for (idx_t i = 0; i < 2 * value_count; i++) {
+			REQUIRE(reader.Read<uint64_t>() == i);
+		}
+		REQUIRE(reader.Finished());
+	}
+
+	// truncate to a previous size and append again
+	{
+		AsyncBufferedFileWriter writer(*fs, fname);
+		writer.Truncate(value_count * sizeof(uint64_t));
+		REQUIRE(writer.GetFileSize() == value_count * sizeof(uint64_t));
+	}
+	TestDeleteFile(fname);
+}
@@ -116,3 +116,46 @@ TEST_CASE("absolute paths", "[file_system]") {
 	REQUIRE(fs.NormalizeAbsolutePath(long_path) == "\\\\?\\d:\\very long network\\");
 #endif
 }
+
+TEST_CASE("Test batched reads", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	duckdb::unique_ptr<FileHandle> handle;
+	int64_t test_data[INTEGER_COUNT];
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		test_data[i] = i;
+	}
+
+	auto fname = TestCreatePath("batch_read_file");
+
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE));
+	REQUIRE_NOTHROW(handle->Write((void *)test_data, sizeof(int64_t) * INTEGER_COUNT, 0));
+	handle.reset();
+
+	// read the file back in scattered out-of-order batches of 8 integers each
+	int64_t read_data[INTEGER_COUNT];
+	memset(read_data, 0, sizeof(read_data));
+	duckdb::vector<ReadRequest> requests;
+	for (int i = INTEGER_COUNT / 8 - 1; i >= 0; i--) {
+		ReadRequest request;
+		request.buffer = (void *)(read_data + i * 8);
+		request.nr_bytes = sizeof(int64_t) * 8;
+		request.location = sizeof(int64_t) * 8 * i;
+		requests.push_back(request);
+	}
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ));
+	REQUIRE_NOTHROW(fs->ReadBatch(*handle, requests));
+	for (int i = 0; i < INTEGER_COUNT; i++) {
+		REQUIRE(read_data[i] == i);
+	}
+
+	// a batch with an out-of-bounds read fails
+	ReadRequest oob_request;
+	oob_request.buffer = (void *)read_data;
+	oob_request.nr_bytes = sizeof(int64_t) * 8;
+	oob_request.location = sizeof(int64_t) * (INTEGER_COUNT + 1);
+	requests.push_back(oob_request);
+	REQUIRE_THROWS(fs->ReadBatch(*handle, requests));
+
+	handle.reset();
+	fs->RemoveFile(fname);
+}
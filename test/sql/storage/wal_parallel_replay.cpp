@@ -0,0 +1,51 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test parallel WAL replay", "[storage][.]") {
+	auto config = GetTestConfig();
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("parallel_wal_replay_test");
+
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	config->options.wal_parallel_replay = true;
+
+	DeleteDatabase(storage_database);
+	{
+		// create multiple tables and modify them so the WAL holds independent per-table entries
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE a AS SELECT i FROM range(1000) tbl(i)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE b AS SELECT i * 2 AS i FROM range(1000) tbl(i)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE c(i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO c VALUES (1), (2), (3)"));
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM a WHERE i < 100"));
+		REQUIRE_NO_FAIL(con.Query("UPDATE b SET i = i + 1 WHERE i >= 1000"));
+		// mix catalog-level entries between data-level entries within a single transaction
+		REQUIRE_NO_FAIL(con.Query("BEGIN"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO c VALUES (4)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE d AS SELECT 42 AS i"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO c VALUES (5)"));
+		REQUIRE_NO_FAIL(con.Query("COMMIT"));
+	}
+	for (idx_t iteration = 0; iteration < 2; iteration++) {
+		// replay the WAL and verify the contents of all tables
+		// the WAL is not checkpointed on shutdown, so the second iteration replays it again
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM a");
+		REQUIRE(CHECK_COLUMN(result, 0, {900}));
+		REQUIRE(CHECK_COLUMN(result, 1, {494550}));
+		result = con.Query("SELECT COUNT(*), SUM(i) FROM b");
+		REQUIRE(CHECK_COLUMN(result, 0, {1000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {999500}));
+		result = con.Query("SELECT SUM(i) FROM c");
+		REQUIRE(CHECK_COLUMN(result, 0, {15}));
+		result = con.Query("SELECT i FROM d");
+		REQUIRE(CHECK_COLUMN(result, 0, {42}));
+	}
+	DeleteDatabase(storage_database);
+}
@@ -1243,6 +1243,32 @@ robj *hll_merge(robj **hlls, size_t hll_count) {
 	return result;
 }
 
+/* Merge 'src' into 'dst' in-place by setting dst[i] to MAX(dst[i],src[i]),
+ * without going through a temporary object like hll_merge() does. Both
+ * objects must use the dense representation, C_ERR is returned otherwise. */
+int hll_merge_dense(robj *dst, robj *src) {
+    struct hllhdr *dst_hdr = (struct hllhdr *) dst->ptr;
+    struct hllhdr *src_hdr = (struct hllhdr *) src->ptr;
+    int i;
+
+    if (dst_hdr->encoding != HLL_DENSE || src_hdr->encoding != HLL_DENSE) {
+        return HLL_C_ERR;
+    }
+
+    uint8_t *dst_regs = dst_hdr->registers + 1;
+    uint8_t *src_regs = src_hdr->registers + 1;
+    uint8_t dst_val, src_val;
+    for (i = 0; i < HLL_REGISTERS; i++) {
+        HLL_DENSE_GET_REGISTER(src_val,src_regs,i);
+        HLL_DENSE_GET_REGISTER(dst_val,dst_regs,i);
+        if (src_val > dst_val) {
+            HLL_DENSE_SET_REGISTER(dst_regs,i,src_val);
+        }
+    }
+    HLL_INVALIDATE_CACHE(dst_hdr);
+    return HLL_C_OK;
+}
+
 uint64_t get_size() {
 	return HLL_DENSE_SIZE;
 }
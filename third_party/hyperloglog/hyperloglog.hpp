@@ -37,6 +37,9 @@ int hll_add(robj *o, unsigned char *ele, size_t elesize);
 int hll_count(robj *o, size_t *result);
 //! Merge hll_count HyperLogLog objects into a single one. Returns NULL on failure, or the new HLL object on success.
 robj *hll_merge(robj **hlls, size_t hll_count);
+//! Merge 'src' into 'dst' in-place by taking the register-wise maximum, without allocating a new object.
+//! Both objects must use the dense representation. Returns C_ERR otherwise.
+int hll_merge_dense(robj *dst, robj *src);
 //! Get size (in bytes) of the HLL
 uint64_t get_size();
 
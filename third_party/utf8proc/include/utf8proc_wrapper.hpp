@@ -23,6 +23,8 @@ class Utf8Proc {
 public:
 	//! Distinguishes ASCII, Valid UTF8 and Invalid UTF8 strings
 	static UnicodeType Analyze(const char *s, size_t len, UnicodeInvalidReason *invalid_reason = nullptr, size_t *invalid_pos = nullptr);
+	//! Returns whether or not the string consists of ASCII bytes only, checking a word at a time
+	static bool IsAscii(const char *s, size_t len);
 	//! Performs UTF NFC normalization of string, return value needs to be free'd
 	static char* Normalize(const char* s, size_t len);
 	//! Returns whether or not the UTF8 string is valid
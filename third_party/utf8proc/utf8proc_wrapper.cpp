@@ -71,10 +71,39 @@ static inline UnicodeType UTF8ExtraByteLoop(const int first_pos_seq, int utf8cha
 	return UnicodeType::UNICODE;
 }
 
+bool Utf8Proc::IsAscii(const char *s, size_t len) {
+	uint64_t word;
+	size_t i = 0;
+	for (; i + sizeof(word) <= len; i += sizeof(word)) {
+		memcpy(&word, s + i, sizeof(word));
+		if (word & 0x8080808080808080ULL) {
+			return false;
+		}
+	}
+	for (; i < len; i++) {
+		if (s[i] & 0x80) {
+			return false;
+		}
+	}
+	return true;
+}
+
 UnicodeType Utf8Proc::Analyze(const char *s, size_t len, UnicodeInvalidReason *invalid_reason, size_t *invalid_pos) {
 	UnicodeType type = UnicodeType::ASCII;
 
 	for (size_t i = 0; i < len; i++) {
+		/* skip runs of ASCII bytes a word at a time */
+		uint64_t word;
+		while (i + sizeof(word) <= len) {
+			memcpy(&word, s + i, sizeof(word));
+			if (word & 0x8080808080808080ULL) {
+				break;
+			}
+			i += sizeof(word);
+		}
+		if (i >= len) {
+			break;
+		}
 		int c = (int)s[i];
 
 		if ((c & 0x80) == 0) {